@@ -16,6 +16,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <initializer_list>
+#include <iterator>
 #include <limits>
 #include <memory>
 #include <random>
@@ -932,6 +933,177 @@ INSTANTIATE_TYPED_TEST_SUITE_P(InplaceCompareValTest,
 
 //////////////////////////////////////////////////////////////////////////////////////////
 
+//
+template <typename T>
+bool
+CompareRef(const T& t, const T& value, CompareOpType op) {
+    switch (op) {
+        case CompareOpType::EQ:
+            return t == value;
+        case CompareOpType::GE:
+            return t >= value;
+        case CompareOpType::GT:
+            return t > value;
+        case CompareOpType::LE:
+            return t <= value;
+        case CompareOpType::LT:
+            return t < value;
+        case CompareOpType::NE:
+            return t != value;
+        default:
+            return false;
+    }
+}
+
+template <typename BitsetT, typename MaskT, typename T>
+void
+TestInplaceCompareValMaskedImpl(BitsetT& bitset,
+                                MaskT& active,
+                                MaskT& valid_out,
+                                CompareOpType op) {
+    const size_t n = bitset.size();
+    constexpr size_t max_v = 3;
+    const T value = from_i32<T>(1);
+
+    std::vector<T> t(n, from_i32<T>(0));
+
+    std::default_random_engine rng(123);
+    FillRandom(t, rng, max_v);
+
+    // every third block of 64 rows is fully inactive, so that the
+    //   zero-word path is exercised for every element type.
+    std::uniform_int_distribution<int> coin(0, 3);
+    std::unique_ptr<bool[]> valid(new bool[n + 1]);
+    for (size_t i = 0; i < n; i++) {
+        active[i] = ((i / 64) % 3 != 2) && (coin(rng) != 0);
+        valid[i] = (coin(rng) != 0);
+    }
+
+    // masked rows must be overwritten, not left as they were
+    bitset.set();
+    valid_out.set();
+
+    StopWatch sw;
+    bitset.inplace_compare_val_masked(
+        t.data(), n, value, op, active, valid.get(), valid_out);
+
+    if (print_timing) {
+        printf("elapsed %f\n", sw.elapsed());
+    }
+
+    for (size_t i = 0; i < n; i++) {
+        const bool is_active = active[i];
+        const bool expected =
+            is_active && valid[i] && CompareRef(t[i], value, op);
+        ASSERT_EQ(expected, bitset[i]) << i;
+        ASSERT_EQ(!(is_active && !valid[i]), valid_out[i]) << i;
+    }
+
+    // no mask and no nulls is the plain kernel
+    MaskT no_active(0);
+    bitset.reset();
+    bitset.inplace_compare_val_masked(
+        t.data(), n, value, op, no_active, nullptr, valid_out);
+    for (size_t i = 0; i < n; i++) {
+        ASSERT_EQ(CompareRef(t[i], value, op), bitset[i]) << i;
+    }
+}
+
+template <typename BitsetT, typename T>
+void
+TestInplaceCompareValMaskedImpl() {
+    // 5000 crosses the run length limit of the masked kernels.
+    std::vector<size_t> sizes(std::begin(typical_sizes),
+                              std::end(typical_sizes));
+    sizes.push_back(5000);
+
+    for (const size_t n : sizes) {
+        for (const auto op : typical_compare_ops) {
+            BitsetT bitset(n);
+            BitsetT active(n);
+            BitsetT valid_out(n);
+
+            if (print_log) {
+                printf("Testing bitset, n=%zd, op=%zd\n", n, (size_t)op);
+            }
+
+            TestInplaceCompareValMaskedImpl<BitsetT, BitsetT, T>(
+                bitset, active, valid_out, op);
+
+            for (const size_t offset : typical_offsets) {
+                if (offset >= n) {
+                    continue;
+                }
+
+                auto view = bitset.view(offset);
+                BitsetT view_active(n - offset);
+                BitsetT view_valid_out(n - offset);
+
+                if (print_log) {
+                    printf("Testing bitset view, n=%zd, offset=%zd, op=%zd\n",
+                           n,
+                           offset,
+                           (size_t)op);
+                }
+
+                TestInplaceCompareValMaskedImpl<decltype(view), BitsetT, T>(
+                    view, view_active, view_valid_out, op);
+            }
+        }
+    }
+}
+
+//
+template <typename T>
+class InplaceCompareValMaskedSuite : public ::testing::Test {};
+
+TYPED_TEST_SUITE_P(InplaceCompareValMaskedSuite);
+
+TYPED_TEST_P(InplaceCompareValMaskedSuite, BitWise) {
+    using impl_traits = RefImplTraits<std::tuple_element_t<1, TypeParam>,
+                                      std::tuple_element_t<2, TypeParam>>;
+    TestInplaceCompareValMaskedImpl<typename impl_traits::bitset_type,
+                                    std::tuple_element_t<0, TypeParam>>();
+}
+
+TYPED_TEST_P(InplaceCompareValMaskedSuite, ElementWise) {
+    using impl_traits = ElementImplTraits<std::tuple_element_t<1, TypeParam>,
+                                          std::tuple_element_t<2, TypeParam>>;
+    TestInplaceCompareValMaskedImpl<typename impl_traits::bitset_type,
+                                    std::tuple_element_t<0, TypeParam>>();
+}
+
+TYPED_TEST_P(InplaceCompareValMaskedSuite, Dynamic) {
+    using impl_traits =
+        VectorizedImplTraits<std::tuple_element_t<1, TypeParam>,
+                             std::tuple_element_t<2, TypeParam>,
+                             milvus::bitset::detail::VectorizedDynamic>;
+    TestInplaceCompareValMaskedImpl<typename impl_traits::bitset_type,
+                                    std::tuple_element_t<0, TypeParam>>();
+}
+
+TYPED_TEST_P(InplaceCompareValMaskedSuite, VecRef) {
+    using impl_traits =
+        VectorizedImplTraits<std::tuple_element_t<1, TypeParam>,
+                             std::tuple_element_t<2, TypeParam>,
+                             milvus::bitset::detail::VectorizedRef>;
+    TestInplaceCompareValMaskedImpl<typename impl_traits::bitset_type,
+                                    std::tuple_element_t<0, TypeParam>>();
+}
+
+//
+REGISTER_TYPED_TEST_SUITE_P(InplaceCompareValMaskedSuite,
+                            BitWise,
+                            ElementWise,
+                            Dynamic,
+                            VecRef);
+
+INSTANTIATE_TYPED_TEST_SUITE_P(InplaceCompareValMaskedTest,
+                               InplaceCompareValMaskedSuite,
+                               Ttypes1);
+
+//////////////////////////////////////////////////////////////////////////////////////////
+
 //
 template <typename BitsetT, typename T>
 void
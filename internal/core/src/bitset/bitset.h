@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cassert>
 #include <cstddef>
 #include <cstdint>
@@ -1030,6 +1031,141 @@ class BitsetBase {
             this->data(), this->offset(), src, right_operand, value, size);
     }
 
+    // Masked variants of the compare kernels above. Each evaluates the
+    //   predicate only for rows that are set in `active` (an empty `active`
+    //   means every row) and not null according to `valid` (one byte per
+    //   row, nullptr means no nulls):
+    //   * active non-null rows get the predicate result;
+    //   * active null rows get 0, and are also reset in `valid_out`;
+    //   * inactive rows get 0, `valid_out` is left untouched.
+    //   Runs of all-zero words of the mask are written without touching
+    //   the input column.
+    template <typename T, typename IA, bool RA, typename IV, bool RV>
+    void
+    inplace_compare_val_masked(const T* const __restrict t,
+                               const size_t size,
+                               const T& value,
+                               CompareOpType op,
+                               const BitsetBase<PolicyT, IA, RA>& active,
+                               const bool* const __restrict valid,
+                               BitsetBase<PolicyT, IV, RV>& valid_out) {
+        if (op == CompareOpType::EQ) {
+            this->inplace_compare_val_masked<T, CompareOpType::EQ>(
+                t, size, value, active, valid, valid_out);
+        } else if (op == CompareOpType::GE) {
+            this->inplace_compare_val_masked<T, CompareOpType::GE>(
+                t, size, value, active, valid, valid_out);
+        } else if (op == CompareOpType::GT) {
+            this->inplace_compare_val_masked<T, CompareOpType::GT>(
+                t, size, value, active, valid, valid_out);
+        } else if (op == CompareOpType::LE) {
+            this->inplace_compare_val_masked<T, CompareOpType::LE>(
+                t, size, value, active, valid, valid_out);
+        } else if (op == CompareOpType::LT) {
+            this->inplace_compare_val_masked<T, CompareOpType::LT>(
+                t, size, value, active, valid, valid_out);
+        } else if (op == CompareOpType::NE) {
+            this->inplace_compare_val_masked<T, CompareOpType::NE>(
+                t, size, value, active, valid, valid_out);
+        } else {
+            // unimplemented
+        }
+    }
+
+    template <typename T,
+              CompareOpType Op,
+              typename IA,
+              bool RA,
+              typename IV,
+              bool RV>
+    void
+    inplace_compare_val_masked(const T* const __restrict t,
+                               const size_t size,
+                               const T& value,
+                               const BitsetBase<PolicyT, IA, RA>& active,
+                               const bool* const __restrict valid,
+                               BitsetBase<PolicyT, IV, RV>& valid_out) {
+        range_checker::le(size, this->size());
+
+        this->masked_apply(
+            size,
+            active,
+            valid,
+            valid_out,
+            [this, t, &value](const size_t start, const size_t nbits) {
+                policy_type::template op_compare_val<T, Op>(
+                    this->data(), this->offset() + start, t + start, nbits,
+                    value);
+            });
+    }
+
+    template <typename T,
+              RangeType Op,
+              typename IA,
+              bool RA,
+              typename IV,
+              bool RV>
+    void
+    inplace_within_range_val_masked(const T& lower,
+                                    const T& upper,
+                                    const T* const __restrict values,
+                                    const size_t size,
+                                    const BitsetBase<PolicyT, IA, RA>& active,
+                                    const bool* const __restrict valid,
+                                    BitsetBase<PolicyT, IV, RV>& valid_out) {
+        range_checker::le(size, this->size());
+
+        this->masked_apply(
+            size,
+            active,
+            valid,
+            valid_out,
+            [this, &lower, &upper, values](const size_t start,
+                                           const size_t nbits) {
+                policy_type::template op_within_range_val<T, Op>(
+                    this->data(),
+                    this->offset() + start,
+                    lower,
+                    upper,
+                    values + start,
+                    nbits);
+            });
+    }
+
+    template <typename T,
+              ArithOpType AOp,
+              CompareOpType CmpOp,
+              typename IA,
+              bool RA,
+              typename IV,
+              bool RV>
+    void
+    inplace_arith_compare_masked(const T* const __restrict src,
+                                 const ArithHighPrecisionType<T>& right_operand,
+                                 const ArithHighPrecisionType<T>& value,
+                                 const size_t size,
+                                 const BitsetBase<PolicyT, IA, RA>& active,
+                                 const bool* const __restrict valid,
+                                 BitsetBase<PolicyT, IV, RV>& valid_out) {
+        range_checker::le(size, this->size());
+
+        this->masked_apply(
+            size,
+            active,
+            valid,
+            valid_out,
+            [this, src, &right_operand, &value](const size_t start,
+                                                const size_t nbits) {
+                policy_type::template op_arith_compare<T, AOp, CmpOp>(
+                    this->data(),
+                    this->offset() + start,
+                    src + start,
+                    right_operand,
+                    value,
+                    nbits);
+            });
+    }
+
     //
     // Inplace and. Also, counts the number of active bits.
     template <typename I, bool R>
@@ -1062,6 +1198,117 @@ class BitsetBase {
     }
 
  private:
+    // Limits a run of consecutive non-zero mask words, so that the output
+    //   of a kernel call is still in L1 when the mask is applied to it.
+    static constexpr size_t masked_run_max_bits = 4096;
+
+    // A mask with the lowest nbits set, nbits <= data_bits.
+    static inline data_type
+    low_bits_mask(const size_t nbits) {
+        constexpr size_t data_bits = sizeof(data_type) * 8;
+        return (nbits == data_bits) ? data_type(~data_type(0))
+                                    : data_type((data_type(1) << nbits) - 1);
+    }
+
+    // Drives the masked kernels. The effective mask (active & valid) is
+    //   built one element-sized word at a time. Zero words are written as 0
+    //   directly, runs of non-zero words are evaluated by a single
+    //   `func(start, nbits)` call that writes the unmasked predicate into
+    //   [start, start + nbits), after which the mask is applied in place.
+    template <typename IA, bool RA, typename IV, bool RV, typename FuncT>
+    void
+    masked_apply(const size_t size,
+                 const BitsetBase<PolicyT, IA, RA>& active,
+                 const bool* const __restrict valid,
+                 BitsetBase<PolicyT, IV, RV>& valid_out,
+                 FuncT func) {
+        constexpr size_t data_bits = sizeof(data_type) * 8;
+        constexpr size_t max_run_words = masked_run_max_bits / data_bits;
+
+        const bool has_active = !active.empty();
+        if (!has_active && valid == nullptr) {
+            func(0, size);
+            return;
+        }
+        if (has_active) {
+            range_checker::le(size, active.size());
+        }
+        if (valid != nullptr) {
+            range_checker::le(size, valid_out.size());
+        }
+
+        data_type run_masks[max_run_words];
+        size_t run_start = 0;
+        size_t run_words = 0;
+        size_t run_bits = 0;
+
+        auto flush_run = [&]() {
+            if (run_words == 0) {
+                return;
+            }
+            func(run_start, run_bits);
+            for (size_t j = 0; j < run_words; j++) {
+                const size_t start = run_start + j * data_bits;
+                const size_t nbits = std::min(data_bits, size - start);
+                const data_type mask = run_masks[j];
+                if (mask == low_bits_mask(nbits)) {
+                    continue;
+                }
+                const data_type result = policy_type::op_read(
+                    this->data(), this->offset() + start, nbits);
+                policy_type::op_write(this->data(),
+                                      this->offset() + start,
+                                      nbits,
+                                      result & mask);
+            }
+            run_words = 0;
+            run_bits = 0;
+        };
+
+        for (size_t start = 0; start < size; start += data_bits) {
+            const size_t nbits = std::min(data_bits, size - start);
+
+            data_type mask = low_bits_mask(nbits);
+            if (has_active) {
+                mask &= policy_type::op_read(
+                    active.data(), active.offset() + start, nbits);
+            }
+            if (valid != nullptr && mask != 0) {
+                data_type valid_bits = 0;
+                for (size_t k = 0; k < nbits; k++) {
+                    valid_bits |= data_type(valid[start + k] ? 1 : 0) << k;
+                }
+                const data_type nulls = mask & ~valid_bits;
+                if (nulls != 0) {
+                    const data_type valid_v = policy_type::op_read(
+                        valid_out.data(), valid_out.offset() + start, nbits);
+                    policy_type::op_write(valid_out.data(),
+                                          valid_out.offset() + start,
+                                          nbits,
+                                          valid_v & ~nulls);
+                }
+                mask &= valid_bits;
+            }
+
+            if (mask == 0) {
+                flush_run();
+                policy_type::op_write(
+                    this->data(), this->offset() + start, nbits, 0);
+                continue;
+            }
+
+            if (run_words == 0) {
+                run_start = start;
+            }
+            run_masks[run_words++] = mask;
+            run_bits += nbits;
+            if (run_words == max_run_words) {
+                flush_run();
+            }
+        }
+        flush_run();
+    }
+
     // CRTP
     inline ImplT&
     as_derived() {
@@ -215,6 +215,21 @@ struct VectorizedElementWiseBitsetPolicy {
         ElementWiseBitsetPolicy<ElementT>::op_fill(data, start, size, value);
     }
 
+    static inline data_type
+    op_read(const data_type* const data,
+            const size_t start,
+            const size_t nbits) {
+        return ElementWiseBitsetPolicy<ElementT>::op_read(data, start, nbits);
+    }
+
+    static inline void
+    op_write(data_type* const data,
+             const size_t start,
+             const size_t nbits,
+             const data_type value) {
+        ElementWiseBitsetPolicy<ElementT>::op_write(data, start, nbits, value);
+    }
+
     //
     static inline std::optional<size_t>
     op_find(const data_type* const data,
@@ -21,6 +21,7 @@
 #include <atomic>
 #include <cstdint>
 #include <ctime>
+#include <future>
 #include <iosfwd>
 #include <numeric>
 #include <random>
@@ -240,21 +241,10 @@ KmeansClustering::IsDataSkew(
     return false;
 }
 
-template <typename T>
 void
-KmeansClustering::StreamingAssignandUpload(
-    knowhere::Cluster<knowhere::ClusterNode>& cluster_node,
-    const milvus::proto::clustering::AnalyzeInfo& config,
-    const milvus::proto::clustering::ClusteringCentroidsStats& centroid_stats,
-    const std::vector<
-        milvus::proto::clustering::ClusteringCentroidIdMappingStats>&
-        id_mapping_stats,
-    const std::vector<int64_t>& segment_ids,
-    const std::map<int64_t, std::vector<std::string>>& insert_files,
-    const std::map<int64_t, int64_t>& num_rows,
-    const int64_t dim,
-    const int64_t trained_segments_num,
-    const int64_t num_clusters) {
+KmeansClustering::UploadCentroids(
+    const milvus::proto::clustering::ClusteringCentroidsStats&
+        centroid_stats) {
     auto byte_size = centroid_stats.ByteSizeLong();
     std::unique_ptr<uint8_t[]> data = std::make_unique<uint8_t[]>(byte_size);
     centroid_stats.SerializeToArray(data.get(), byte_size);
@@ -270,39 +260,60 @@ KmeansClustering::StreamingAssignandUpload(
     cluster_result_.centroid_path = std::move(centroid_remote_path);
     cluster_result_.centroid_file_size =
         remote_paths_to_size.at(cluster_result_.centroid_path);
-    remote_paths_to_size.clear();
     LOG_INFO(msg_header_ + "upload cluster centroids file done");
+}
+
+void
+KmeansClustering::UploadIdMapping(
+    const int64_t segment_id,
+    const milvus::proto::clustering::ClusteringCentroidIdMappingStats&
+        id_mapping_pb,
+    std::unordered_map<std::string, int64_t>& remote_paths_to_size) {
+    auto byte_size = id_mapping_pb.ByteSizeLong();
+    std::unique_ptr<uint8_t[]> data = std::make_unique<uint8_t[]>(byte_size);
+    id_mapping_pb.SerializeToArray(data.get(), byte_size);
+    auto id_mapping_remote_path =
+        GetRemoteCentroidIdMappingObjectPrefix(segment_id) + "/" +
+        std::string(OFFSET_MAPPING_NAME);
+    AddClusteringResultFiles(file_manager_->GetChunkManager().get(),
+                             data.get(),
+                             byte_size,
+                             id_mapping_remote_path,
+                             remote_paths_to_size);
+    LOG_INFO(
+        msg_header_ +
+            "upload segment {} cluster id mapping file with size {} B done",
+        segment_id,
+        byte_size);
+}
+
+template <typename T>
+void
+KmeansClustering::StreamingAssignandUpload(
+    knowhere::Cluster<knowhere::ClusterNode>& cluster_node,
+    const milvus::proto::clustering::AnalyzeInfo& config,
+    const milvus::proto::clustering::ClusteringCentroidsStats& centroid_stats,
+    const std::vector<
+        milvus::proto::clustering::ClusteringCentroidIdMappingStats>&
+        id_mapping_stats,
+    const std::vector<int64_t>& segment_ids,
+    const std::map<int64_t, std::vector<std::string>>& insert_files,
+    const std::map<int64_t, int64_t>& num_rows,
+    const int64_t dim,
+    const int64_t trained_segments_num,
+    const int64_t num_clusters) {
+    UploadCentroids(centroid_stats);
 
     LOG_INFO(msg_header_ + "start upload cluster id mapping file");
+    std::unordered_map<std::string, int64_t> remote_paths_to_size;
     std::vector<int64_t> num_vectors_each_centroid(num_clusters, 0);
 
-    auto serializeIdMappingAndUpload = [&](const int64_t segment_id,
-                                           const milvus::proto::clustering::
-                                               ClusteringCentroidIdMappingStats&
-                                                   id_mapping_pb) {
-        auto byte_size = id_mapping_pb.ByteSizeLong();
-        std::unique_ptr<uint8_t[]> data =
-            std::make_unique<uint8_t[]>(byte_size);
-        id_mapping_pb.SerializeToArray(data.get(), byte_size);
-        AddClusteringResultFiles(
-            file_manager_->GetChunkManager().get(),
-            data.get(),
-            byte_size,
-            GetRemoteCentroidIdMappingObjectPrefix(segment_id) + "/" +
-                std::string(OFFSET_MAPPING_NAME),
-            remote_paths_to_size);
-        LOG_INFO(
-            msg_header_ +
-                "upload segment {} cluster id mapping file with size {} B done",
-            segment_id,
-            byte_size);
-    };
-
     for (size_t i = 0; i < segment_ids.size(); i++) {
         int64_t segment_id = segment_ids[i];
         // id mapping has been computed, just upload to remote
         if (i < trained_segments_num) {
-            serializeIdMappingAndUpload(segment_id, id_mapping_stats[i]);
+            UploadIdMapping(
+                segment_id, id_mapping_stats[i], remote_paths_to_size);
             for (int64_t j = 0; j < num_clusters; ++j) {
                 num_vectors_each_centroid[j] +=
                     id_mapping_stats[i].num_in_centroid(j);
@@ -336,7 +347,7 @@ KmeansClustering::StreamingAssignandUpload(
                 num_vectors_each_centroid[j] +=
                     id_mapping_pb.num_in_centroid(j);
             }
-            serializeIdMappingAndUpload(segment_id, id_mapping_pb);
+            UploadIdMapping(segment_id, id_mapping_pb, remote_paths_to_size);
         }
     }
     if (IsDataSkew<T>(config, dim, num_vectors_each_centroid)) {
@@ -350,6 +361,185 @@ KmeansClustering::StreamingAssignandUpload(
     is_runned_ = true;
 }
 
+template <typename T>
+void
+KmeansClustering::StreamDataFiles(
+    const std::vector<std::string>& files,
+    const int64_t files_per_fetch,
+    const std::function<bool(const T*, int64_t)>& fn) {
+    auto fetch = [this, &files, files_per_fetch](size_t start) {
+        auto end = std::min(files.size(), start + files_per_fetch);
+        Config config;
+        config[INSERT_FILES_KEY] = std::vector<std::string>(
+            files.begin() + start, files.begin() + end);
+        return file_manager_->CacheRawDataToMemory(config);
+    };
+    // double buffered, the next group is pulled while fn consumes this one
+    std::future<std::vector<FieldDataPtr>> next;
+    if (!files.empty()) {
+        next = std::async(std::launch::async, fetch, 0);
+    }
+    for (size_t start = 0; start < files.size(); start += files_per_fetch) {
+        auto field_datas = next.get();
+        if (start + files_per_fetch < files.size()) {
+            next =
+                std::async(std::launch::async, fetch, start + files_per_fetch);
+        }
+        for (auto& data : field_datas) {
+            if (!fn(reinterpret_cast<const T*>(data->Data()),
+                    data->get_num_rows())) {
+                return;
+            }
+            data.reset();
+        }
+    }
+}
+
+template <typename T>
+void
+KmeansClustering::RunMiniBatch(
+    const milvus::proto::clustering::AnalyzeInfo& config,
+    const MiniBatchKmeansConfig& mini_batch_config,
+    const std::vector<int64_t>& segment_ids,
+    const std::map<int64_t, std::vector<std::string>>& insert_files,
+    const std::map<int64_t, int64_t>& num_rows,
+    const int64_t data_num) {
+    auto dim = config.dim();
+    auto num_clusters = config.num_clusters();
+    if (data_num < num_clusters) {
+        LOG_WARN(msg_header_ +
+                     "kmeans data num: {} less than num_clusters: {}, skip "
+                     "clustering",
+                 data_num,
+                 num_clusters);
+        throw SegcoreError(ErrorCode::ClusterSkip,
+                           "data num less than num clusters");
+    }
+    auto batch_rows = std::max<int64_t>(1, mini_batch_config.batch_rows);
+    auto epochs = std::max<int64_t>(1, mini_batch_config.epochs);
+    // two groups of files are in memory at a time
+    auto files_per_fetch = std::max<int64_t>(
+        1, mini_batch_config.memory_budget / 2 / FILE_SLICE_SIZE.load());
+    // the last pass assigns the rows, fused with training or on its own
+    auto passes = mini_batch_config.fuse_assign ? epochs : epochs + 1;
+
+    std::map<int64_t, std::vector<std::string>> sorted_files;
+    for (auto segment_id : segment_ids) {
+        auto files = insert_files.at(segment_id);
+        std::sort(files.begin(),
+                  files.end(),
+                  [](const std::string& a, const std::string& b) {
+                      return std::stol(a.substr(a.find_last_of("/") + 1)) <
+                             std::stol(b.substr(b.find_last_of("/") + 1));
+                  });
+        sorted_files[segment_id] = std::move(files);
+    }
+
+    knowhere::TimeRecorder rc(msg_header_ + "mini-batch kmeans clustering",
+                              2 /* log level: info */);
+    LOG_INFO(msg_header_ +
+                 "mini-batch kmeans data num: {}, dim: {}, num_clusters: {}, "
+                 "batch rows: {}, epochs: {}, fuse assign: {}",
+             data_num,
+             dim,
+             num_clusters,
+             batch_rows,
+             epochs,
+             mini_batch_config.fuse_assign);
+    MiniBatchKmeans<T> kmeans(num_clusters, dim, mini_batch_config.seed);
+
+    // seed the centroids from a uniform sample of the rows of all segments,
+    // drawn in one pass by reservoir sampling
+    {
+        auto seed_rows = std::min<int64_t>(
+            data_num, std::max<int64_t>(num_clusters, batch_rows));
+        std::vector<T> seed(seed_rows * dim);
+        std::mt19937_64 rng(mini_batch_config.seed);
+        int64_t seen = 0;
+        auto sample = [&](const T* rows, int64_t n) {
+            for (int64_t i = 0; i < n; ++i, ++seen) {
+                auto slot = seen;
+                if (seen >= seed_rows) {
+                    // keeps each row seen so far with equal probability
+                    slot = std::uniform_int_distribution<int64_t>(0, seen)(rng);
+                    if (slot >= seed_rows) {
+                        continue;
+                    }
+                }
+                std::copy_n(rows + i * dim, dim, seed.data() + slot * dim);
+            }
+            return true;
+        };
+        for (auto segment_id : segment_ids) {
+            StreamDataFiles<T>(
+                sorted_files.at(segment_id), files_per_fetch, sample);
+        }
+        kmeans.Init(seed.data(), std::min(seen, seed_rows));
+    }
+    rc.RecordSection("seed done");
+
+    std::unordered_map<std::string, int64_t> remote_paths_to_size;
+    std::vector<int64_t> num_vectors_each_centroid(num_clusters, 0);
+    for (int64_t pass = 0; pass < passes; ++pass) {
+        bool assign = pass == passes - 1;
+        bool train = pass < epochs;
+        for (auto segment_id : segment_ids) {
+            auto segment_rows = num_rows.at(segment_id);
+            std::vector<uint32_t> ids(assign ? segment_rows : 0);
+            int64_t offset = 0;
+            StreamDataFiles<T>(
+                sorted_files.at(segment_id),
+                files_per_fetch,
+                [&](const T* rows, int64_t n) {
+                    AssertInfo(!assign || offset + n <= segment_rows,
+                               "segment {} has more rows than {}",
+                               segment_id,
+                               segment_rows);
+                    for (int64_t i = 0; i < n; i += batch_rows) {
+                        auto m = std::min(batch_rows, n - i);
+                        auto batch_ids =
+                            assign ? ids.data() + offset + i : nullptr;
+                        if (train) {
+                            kmeans.Update(rows + i * dim, m, batch_ids);
+                        } else {
+                            kmeans.Assign(rows + i * dim, m, batch_ids);
+                        }
+                    }
+                    offset += n;
+                    return true;
+                });
+            if (!assign) {
+                continue;
+            }
+            AssertInfo(offset == segment_rows,
+                       "segment {} rows inconsistent, expected: {}, actual: {}",
+                       segment_id,
+                       segment_rows,
+                       offset);
+            auto id_mapping_pb = CentroidIdMappingToPB(
+                ids.data(), {segment_id}, 1, num_rows, num_clusters)[0];
+            for (int64_t j = 0; j < num_clusters; ++j) {
+                num_vectors_each_centroid[j] +=
+                    id_mapping_pb.num_in_centroid(j);
+            }
+            UploadIdMapping(segment_id, id_mapping_pb, remote_paths_to_size);
+        }
+        rc.RecordSection(fmt::format("pass {} done", pass));
+    }
+
+    UploadCentroids(
+        CentroidsToPB<T>(kmeans.centroids().data(), num_clusters, dim));
+    if (IsDataSkew<T>(config, dim, num_vectors_each_centroid)) {
+        LOG_INFO(msg_header_ + "data skew! skip clustering");
+        // skip clustering, nothing takes affect
+        throw SegcoreError(ErrorCode::ClusterSkip,
+                           "data skew! skip clustering");
+    }
+    cluster_result_.id_mappings = std::move(remote_paths_to_size);
+    is_runned_ = true;
+    rc.ElapseFromBegin("mini-batch clustering done");
+}
+
 template <typename T>
 void
 KmeansClustering::Run(const milvus::proto::clustering::AnalyzeInfo& config) {
@@ -376,6 +566,27 @@ KmeansClustering::Run(const milvus::proto::clustering::AnalyzeInfo& config) {
     auto max_cluster_size = config.max_cluster_size();
     AssertInfo(max_cluster_size > 0, "max cluster size must larger than 0");
 
+    size_t data_num = 0;
+    std::vector<int64_t> segment_ids;
+    for (auto& [segment_id, num_row_each_segment] : num_rows) {
+        data_num += num_row_each_segment;
+        segment_ids.emplace_back(segment_id);
+        AssertInfo(insert_files.find(segment_id) != insert_files.end(),
+                   "segment id {} not exist in insert files",
+                   segment_id);
+    }
+
+    auto mini_batch_config = GetMiniBatchKmeansConfig();
+    if (mini_batch_config.enabled) {
+        RunMiniBatch<T>(config,
+                        mini_batch_config,
+                        segment_ids,
+                        insert_files,
+                        num_rows,
+                        data_num);
+        return;
+    }
+
     auto cluster_node_obj =
         knowhere::ClusterFactory::Instance().Create<T>(KMEANS_CLUSTER);
     knowhere::Cluster<knowhere::ClusterNode> cluster_node;
@@ -389,15 +600,6 @@ KmeansClustering::Run(const milvus::proto::clustering::AnalyzeInfo& config) {
         throw SegcoreError(ErrorCode::KnowhereError, cluster_node_obj.what());
     }
 
-    size_t data_num = 0;
-    std::vector<int64_t> segment_ids;
-    for (auto& [segment_id, num_row_each_segment] : num_rows) {
-        data_num += num_row_each_segment;
-        segment_ids.emplace_back(segment_id);
-        AssertInfo(insert_files.find(segment_id) != insert_files.end(),
-                   "segment id {} not exist in insert files",
-                   segment_id);
-    }
     size_t trained_segments_num = 0;
 
     size_t data_size = data_num * dim * sizeof(T);
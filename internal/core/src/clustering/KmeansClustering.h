@@ -17,6 +17,7 @@
 #pragma once
 
 #include <stdint.h>
+#include <functional>
 #include <map>
 #include <memory>
 #include <string>
@@ -24,6 +25,7 @@
 #include <vector>
 
 #include "boost/filesystem/path.hpp"
+#include "clustering/MiniBatchKmeans.h"
 #include "common/Consts.h"
 #include "common/EasyAssert.h"
 #include "knowhere/cluster/cluster.h"
@@ -102,6 +104,37 @@ class KmeansClustering {
     ~KmeansClustering() = default;
 
  private:
+    // trains by streaming every data file in mini-batches, see
+    // MiniBatchKmeansConfig
+    template <typename T>
+    void
+    RunMiniBatch(
+        const milvus::proto::clustering::AnalyzeInfo& config,
+        const MiniBatchKmeansConfig& mini_batch_config,
+        const std::vector<int64_t>& segment_ids,
+        const std::map<int64_t, std::vector<std::string>>& insert_files,
+        const std::map<int64_t, int64_t>& num_rows,
+        const int64_t data_num);
+
+    // passes the rows of each file to fn in order, fetching the next group of
+    // files while fn consumes the current one, until fn returns false
+    template <typename T>
+    void
+    StreamDataFiles(const std::vector<std::string>& files,
+                    const int64_t files_per_fetch,
+                    const std::function<bool(const T*, int64_t)>& fn);
+
+    void
+    UploadCentroids(const milvus::proto::clustering::ClusteringCentroidsStats&
+                        centroid_stats);
+
+    void
+    UploadIdMapping(
+        const int64_t segment_id,
+        const milvus::proto::clustering::ClusteringCentroidIdMappingStats&
+            id_mapping_pb,
+        std::unordered_map<std::string, int64_t>& remote_paths_to_size);
+
     template <typename T>
     void
     StreamingAssignandUpload(
@@ -341,6 +341,33 @@ test_run() {
                                   config["num_clusters"],
                                   true);
     }
+    // mini-batch, with fused and separate assignment
+    for (bool fuse_assign : {true, false}) {
+        clustering::MiniBatchKmeansConfig mini_batch_config;
+        mini_batch_config.enabled = true;
+        mini_batch_config.batch_rows = 1000;
+        mini_batch_config.epochs = 2;
+        mini_batch_config.fuse_assign = fuse_assign;
+        clustering::SetMiniBatchKmeansConfig(mini_batch_config);
+        config["min_cluster_ratio"] = 0.01;
+        config[INSERT_FILES_KEY] = remote_files;
+        config["num_clusters"] = 8;
+        config["train_size"] = 6L * 1024 * 1024;  // unused
+        config["dim"] = dim;
+        config["num_rows"] = num_rows;
+        clusteringJob->Run<T>(transforConfigToPB(config));
+        clustering::SetMiniBatchKmeansConfig({});
+        // both segments hold the same rows, assigned to the same centroids
+        // unless they are still trained while assigning
+        CheckResultCorrectness<T>(clusteringJob,
+                                  cm,
+                                  segment_id,
+                                  segment_id2,
+                                  dim,
+                                  nb,
+                                  config["num_clusters"],
+                                  !fuse_assign);
+    }
 }
 
 TEST(MajorCompaction, Naive) {
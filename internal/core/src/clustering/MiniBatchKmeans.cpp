@@ -0,0 +1,191 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "clustering/MiniBatchKmeans.h"
+
+#include <algorithm>
+#include <exception>
+#include <future>
+#include <limits>
+#include <mutex>
+#include <numeric>
+#include <random>
+
+#include "common/EasyAssert.h"
+#include "storage/ThreadPools.h"
+
+namespace milvus::clustering {
+
+namespace {
+
+// rows assigned by one thread pool task
+constexpr int64_t kAssignRowsPerTask = 1024;
+
+std::mutex config_mutex;
+MiniBatchKmeansConfig mini_batch_config;
+
+}  // namespace
+
+void
+SetMiniBatchKmeansConfig(const MiniBatchKmeansConfig& config) {
+    std::lock_guard lock(config_mutex);
+    mini_batch_config = config;
+}
+
+MiniBatchKmeansConfig
+GetMiniBatchKmeansConfig() {
+    std::lock_guard lock(config_mutex);
+    return mini_batch_config;
+}
+
+template <typename T>
+MiniBatchKmeans<T>::MiniBatchKmeans(int64_t num_clusters,
+                                    int64_t dim,
+                                    uint64_t seed)
+    : num_clusters_(num_clusters), dim_(dim), seed_(seed) {
+    AssertInfo(num_clusters_ > 0 && dim_ > 0,
+               "invalid mini-batch kmeans, num clusters: {}, dim: {}",
+               num_clusters_,
+               dim_);
+}
+
+template <typename T>
+void
+MiniBatchKmeans<T>::Init(const T* data, int64_t num_rows) {
+    AssertInfo(num_rows >= num_clusters_,
+               "mini-batch kmeans seeded with {} rows for {} clusters",
+               num_rows,
+               num_clusters_);
+    std::vector<int64_t> rows(num_rows);
+    std::iota(rows.begin(), rows.end(), 0);
+    std::vector<int64_t> picked;
+    picked.reserve(num_clusters_);
+    std::mt19937_64 rng(seed_);
+    std::sample(rows.begin(),
+                rows.end(),
+                std::back_inserter(picked),
+                num_clusters_,
+                rng);
+
+    centroids_.resize(num_clusters_ * dim_);
+    centroid_norms_.assign(num_clusters_, 0);
+    counts_.assign(num_clusters_, 0);
+    for (int64_t c = 0; c < num_clusters_; ++c) {
+        std::copy_n(data + picked[c] * dim_, dim_, &centroids_[c * dim_]);
+        for (int64_t d = 0; d < dim_; ++d) {
+            centroid_norms_[c] += centroids_[c * dim_ + d] *
+                                  centroids_[c * dim_ + d];
+        }
+    }
+}
+
+template <typename T>
+void
+MiniBatchKmeans<T>::AssignRange(const T* data,
+                                int64_t begin,
+                                int64_t end,
+                                uint32_t* ids) const {
+    for (int64_t i = begin; i < end; ++i) {
+        const T* row = data + i * dim_;
+        // |x - c|^2 without the |x|^2 shared by every centroid
+        float best = std::numeric_limits<float>::max();
+        uint32_t best_id = 0;
+        for (int64_t c = 0; c < num_clusters_; ++c) {
+            const T* centroid = &centroids_[c * dim_];
+            float dot = 0;
+            for (int64_t d = 0; d < dim_; ++d) {
+                dot += row[d] * centroid[d];
+            }
+            float distance = centroid_norms_[c] - 2 * dot;
+            if (distance < best) {
+                best = distance;
+                best_id = static_cast<uint32_t>(c);
+            }
+        }
+        ids[i] = best_id;
+    }
+}
+
+template <typename T>
+void
+MiniBatchKmeans<T>::Assign(const T* data,
+                           int64_t num_rows,
+                           uint32_t* ids) const {
+    AssertInfo(initialized(), "mini-batch kmeans is not initialized");
+    if (num_rows <= kAssignRowsPerTask) {
+        AssignRange(data, 0, num_rows, ids);
+        return;
+    }
+    auto& pool = ThreadPools::GetThreadPool(ThreadPoolPriority::MIDDLE);
+    std::vector<std::future<void>> futures;
+    for (int64_t begin = 0; begin < num_rows; begin += kAssignRowsPerTask) {
+        auto end = std::min(num_rows, begin + kAssignRowsPerTask);
+        futures.emplace_back(pool.Submit([this, data, begin, end, ids]() {
+            AssignRange(data, begin, end, ids);
+        }));
+    }
+    // the tasks write to ids, wait for all of them even if one failed
+    std::exception_ptr assign_exception;
+    for (auto& future : futures) {
+        try {
+            future.get();
+        } catch (...) {
+            if (!assign_exception) {
+                assign_exception = std::current_exception();
+            }
+        }
+    }
+    if (assign_exception) {
+        std::rethrow_exception(assign_exception);
+    }
+}
+
+template <typename T>
+void
+MiniBatchKmeans<T>::Update(const T* data, int64_t num_rows, uint32_t* ids) {
+    std::vector<uint32_t> assigned;
+    if (ids == nullptr) {
+        assigned.resize(num_rows);
+        ids = assigned.data();
+    }
+    Assign(data, num_rows, ids);
+
+    std::vector<bool> moved(num_clusters_, false);
+    for (int64_t i = 0; i < num_rows; ++i) {
+        auto c = ids[i];
+        T* centroid = &centroids_[c * dim_];
+        const T* row = data + i * dim_;
+        float eta = 1.0f / static_cast<float>(++counts_[c]);
+        for (int64_t d = 0; d < dim_; ++d) {
+            centroid[d] += eta * (row[d] - centroid[d]);
+        }
+        moved[c] = true;
+    }
+    for (int64_t c = 0; c < num_clusters_; ++c) {
+        if (!moved[c]) {
+            continue;
+        }
+        centroid_norms_[c] = 0;
+        for (int64_t d = 0; d < dim_; ++d) {
+            centroid_norms_[c] += centroids_[c * dim_ + d] *
+                                  centroids_[c * dim_ + d];
+        }
+    }
+}
+
+template class MiniBatchKmeans<float>;
+
+}  // namespace milvus::clustering
@@ -0,0 +1,95 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <stdint.h>
+#include <vector>
+
+namespace milvus::clustering {
+
+struct MiniBatchKmeansConfig {
+    // train by streaming the binlogs instead of one sampled buffer
+    bool enabled = false;
+    // rows per centroid update
+    int64_t batch_rows = 8192;
+    // passes over the data to train the centroids
+    int64_t epochs = 1;
+    // bytes of binlogs fetched ahead of the batch being trained
+    int64_t memory_budget = 256 << 20;
+    // assign rows during the last training pass instead of another pass
+    bool fuse_assign = true;
+    // seed of the centroid sampling, fixed so that analyzing the same data
+    // again gives the same clusters
+    uint64_t seed = 42;
+};
+
+void
+SetMiniBatchKmeansConfig(const MiniBatchKmeansConfig& config);
+
+MiniBatchKmeansConfig
+GetMiniBatchKmeansConfig();
+
+// Mini-batch k-means as in Sculley, "Web-Scale K-Means Clustering": each
+// batch is assigned to the current centroids, then every row moves its
+// centroid towards it with a learning rate of 1 / rows seen by the centroid.
+// Only the batch being trained is needed in memory.
+template <typename T>
+class MiniBatchKmeans {
+ public:
+    MiniBatchKmeans(int64_t num_clusters, int64_t dim, uint64_t seed);
+
+    bool
+    initialized() const {
+        return !centroids_.empty();
+    }
+
+    // Seeds the centroids with num_clusters distinct random rows of data,
+    // num_rows must not be less than num_clusters.
+    void
+    Init(const T* data, int64_t num_rows);
+
+    // Writes the nearest centroid of each row to ids.
+    void
+    Assign(const T* data, int64_t num_rows, uint32_t* ids) const;
+
+    // Trains the centroids on one batch. ids, if not null, receives the
+    // centroid each row was assigned to.
+    void
+    Update(const T* data, int64_t num_rows, uint32_t* ids = nullptr);
+
+    // num_clusters * dim
+    const std::vector<T>&
+    centroids() const {
+        return centroids_;
+    }
+
+ private:
+    void
+    AssignRange(const T* data,
+                int64_t begin,
+                int64_t end,
+                uint32_t* ids) const;
+
+    int64_t num_clusters_;
+    int64_t dim_;
+    uint64_t seed_;
+    std::vector<T> centroids_;
+    std::vector<float> centroid_norms_;
+    std::vector<int64_t> counts_;
+};
+
+}  // namespace milvus::clustering
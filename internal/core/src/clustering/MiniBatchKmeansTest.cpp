@@ -0,0 +1,81 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <random>
+#include <set>
+#include <vector>
+
+#include "clustering/MiniBatchKmeans.h"
+
+using namespace milvus::clustering;
+
+TEST(MiniBatchKmeans, SeparatesBlobs) {
+    const int64_t dim = 4;
+    const int64_t rows_per_blob = 3000;
+    const std::vector<float> centers = {-100, 0, 100};
+
+    std::mt19937 rng(42);
+    std::normal_distribution<float> noise(0, 1);
+    // blobs interleaved, so that every batch sees all of them
+    std::vector<float> data;
+    for (int64_t i = 0; i < rows_per_blob; ++i) {
+        for (auto center : centers) {
+            for (int64_t d = 0; d < dim; ++d) {
+                data.push_back(center + noise(rng));
+            }
+        }
+    }
+    int64_t num_rows = data.size() / dim;
+
+    MiniBatchKmeans<float> kmeans(3, dim, 7);
+    EXPECT_FALSE(kmeans.initialized());
+    // seed from rows of distinct blobs
+    kmeans.Init(data.data(), 3);
+    ASSERT_TRUE(kmeans.initialized());
+
+    std::vector<uint32_t> ids(num_rows);
+    const int64_t batch_rows = 1000;
+    for (int64_t i = 0; i < num_rows; i += batch_rows) {
+        auto n = std::min(batch_rows, num_rows - i);
+        kmeans.Update(data.data() + i * dim, n, ids.data() + i);
+    }
+
+    // every blob maps to its own centroid, which is close to the blob center
+    std::set<uint32_t> blob_ids;
+    for (int64_t blob = 0; blob < 3; ++blob) {
+        auto id = ids[blob];
+        blob_ids.insert(id);
+        for (int64_t i = blob; i < num_rows; i += 3) {
+            ASSERT_EQ(ids[i], id);
+        }
+        for (int64_t d = 0; d < dim; ++d) {
+            EXPECT_NEAR(kmeans.centroids()[id * dim + d], centers[blob], 0.5);
+        }
+    }
+    EXPECT_EQ(blob_ids.size(), 3);
+
+    std::vector<uint32_t> assigned(num_rows);
+    kmeans.Assign(data.data(), num_rows, assigned.data());
+    EXPECT_EQ(assigned, ids);
+}
+
+TEST(MiniBatchKmeans, UpdateConvergesToMean) {
+    std::vector<float> data = {1, 2, 3, 4, 5, 6};
+    MiniBatchKmeans<float> kmeans(1, 1, 0);
+    kmeans.Init(data.data(), data.size());
+    kmeans.Update(data.data(), 2);
+    kmeans.Update(data.data() + 2, 4);
+    // the first centroid update has a learning rate of 1
+    EXPECT_FLOAT_EQ(kmeans.centroids()[0], 3.5);
+}
@@ -20,6 +20,7 @@
 #include "analyze_c.h"
 #include "bitset/common.h"
 #include "clustering/KmeansClustering.h"
+#include "clustering/MiniBatchKmeans.h"
 #include "common/EasyAssert.h"
 #include "common/Types.h"
 #include "fmt/core.h"
@@ -195,3 +196,18 @@ GetAnalyzeResultMeta(CAnalyze analyze,
     }
     return status;
 }
+
+void
+SetMiniBatchKmeansConfig(bool enabled,
+                         int64_t batch_rows,
+                         int64_t epochs,
+                         int64_t memory_budget,
+                         bool fuse_assign) {
+    milvus::clustering::MiniBatchKmeansConfig config;
+    config.enabled = enabled;
+    config.batch_rows = batch_rows;
+    config.epochs = epochs;
+    config.memory_budget = memory_budget;
+    config.fuse_assign = fuse_assign;
+    milvus::clustering::SetMiniBatchKmeansConfig(config);
+}
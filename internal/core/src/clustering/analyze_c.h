@@ -35,6 +35,14 @@ GetAnalyzeResultMeta(CAnalyze analyze,
                      void* id_mapping_paths,
                      int64_t* id_mapping_sizes);
 
+// set mini-batch kmeans training for the following analyze tasks
+void
+SetMiniBatchKmeansConfig(bool enabled,
+                         int64_t batch_rows,
+                         int64_t epochs,
+                         int64_t memory_budget,
+                         bool fuse_assign);
+
 #ifdef __cplusplus
 };
 #endif
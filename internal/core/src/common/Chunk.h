@@ -47,6 +47,12 @@ class ChunkMmapGuard {
         : mmap_ptr_(mmap_ptr), mmap_size_(mmap_size), file_path_(file_path) {
     }
 
+    // Keeps memory the chunk adopted instead of copying, e.g. an Arrow
+    // buffer, alive as long as the chunk.
+    explicit ChunkMmapGuard(std::shared_ptr<const void> owner)
+        : mmap_ptr_(nullptr), mmap_size_(0), owner_(std::move(owner)) {
+    }
+
     ~ChunkMmapGuard() {
         if (mmap_ptr_ != nullptr) {
             munmap(mmap_ptr_, mmap_size_);
@@ -70,6 +76,7 @@ class ChunkMmapGuard {
     char* mmap_ptr_;
     size_t mmap_size_;
     const std::string file_path_;
+    std::shared_ptr<const void> owner_;
 };
 
 class Chunk {
@@ -1377,4 +1377,51 @@ TEST(chunk, test_create_group_chunk_nullable_fields) {
             EXPECT_EQ(str_views[i], str_data[i]);
         }
     }
-}
\ No newline at end of file
+}
+TEST(chunk, test_adopt_arrow_buffers) {
+    arrow::Int64Builder int_builder;
+    arrow::StringBuilder str_builder;
+    for (int64_t i = 0; i < 1000; ++i) {
+        ASSERT_TRUE(int_builder.Append(i * 3).ok());
+        ASSERT_TRUE(str_builder.Append("str_" + std::to_string(i)).ok());
+    }
+    auto int_array = std::static_pointer_cast<arrow::Int64Array>(
+        int_builder.Finish().ValueOrDie());
+    auto str_array = str_builder.Finish().ValueOrDie();
+
+    FieldMeta int_meta(
+        FieldName("a"), FieldId(40), DataType::INT64, false, std::nullopt);
+    FieldMeta str_meta(
+        FieldName("b"), FieldId(41), DataType::VARCHAR, false, std::nullopt);
+
+    // a single non-nullable fixed-width array is adopted, not copied
+    auto chunk = create_chunk(int_meta, {int_array});
+    auto fixed_chunk = static_cast<FixedWidthChunk*>(chunk.get());
+    EXPECT_EQ(fixed_chunk->Data(),
+              reinterpret_cast<const char*>(int_array->raw_values()));
+
+    // arrays split over several arrays are still copied
+    auto copied = create_chunk(
+        int_meta, {int_array->Slice(0, 500), int_array->Slice(500)});
+    auto copied_chunk = static_cast<FixedWidthChunk*>(copied.get());
+    EXPECT_NE(copied_chunk->Data(),
+              reinterpret_cast<const char*>(int_array->raw_values()));
+
+    auto group = create_group_chunk({FieldId(40), FieldId(41)},
+                                    {int_meta, str_meta},
+                                    {{int_array}, {str_array}});
+    auto group_int = static_cast<FixedWidthChunk*>(group[FieldId(40)].get());
+    EXPECT_EQ(group_int->Data(),
+              reinterpret_cast<const char*>(int_array->raw_values()));
+    auto group_str = static_cast<StringChunk*>(group[FieldId(41)].get());
+
+    // the chunks keep the adopted buffers alive
+    int_array.reset();
+    str_array.reset();
+    for (int64_t i = 0; i < 1000; ++i) {
+        for (auto c : {fixed_chunk, copied_chunk, group_int}) {
+            EXPECT_EQ(*reinterpret_cast<const int64_t*>(c->ValueAt(i)), i * 3);
+        }
+        EXPECT_EQ((*group_str)[i], "str_" + std::to_string(i));
+    }
+}
@@ -23,6 +23,7 @@
 #include "arrow/array/array_nested.h"
 #include "arrow/record_batch.h"
 #include "arrow/result.h"
+#include "arrow/type.h"
 #include "common/Array.h"
 #include "common/Chunk.h"
 #include "common/EasyAssert.h"
@@ -788,6 +789,65 @@ make_chunk(const FieldMeta& field_meta,
     }
 }
 
+// Alignment of Arrow value buffers, which only slices can break.
+static constexpr uintptr_t kArrowBufferAlignment = 64;
+
+// A non-nullable fixed-width column read into a single Arrow array is laid
+// out exactly as its chunk, so an in-memory chunk can adopt the array's value
+// buffer instead of copying it. Returns the adopted bytes, or nullptr if the
+// column has to be copied: nullable or bit-packed columns, columns split over
+// several arrays, or slices that would pin a much larger buffer.
+static std::shared_ptr<arrow::Buffer>
+adoptable_values(const FieldMeta& field_meta,
+                 const arrow::ArrayVector& array_vec,
+                 size_t size) {
+    switch (field_meta.get_data_type()) {
+        case milvus::DataType::INT8:
+        case milvus::DataType::INT16:
+        case milvus::DataType::INT32:
+        case milvus::DataType::INT64:
+        case milvus::DataType::FLOAT:
+        case milvus::DataType::DOUBLE:
+        case milvus::DataType::TIMESTAMPTZ:
+        case milvus::DataType::VECTOR_FLOAT:
+        case milvus::DataType::VECTOR_BINARY:
+        case milvus::DataType::VECTOR_FLOAT16:
+        case milvus::DataType::VECTOR_BFLOAT16:
+        case milvus::DataType::VECTOR_INT8:
+            break;
+        default:
+            return nullptr;
+    }
+    if (field_meta.is_nullable() || array_vec.size() != 1 || size == 0) {
+        return nullptr;
+    }
+    const auto& array = array_vec[0];
+    auto type = dynamic_cast<const arrow::FixedWidthType*>(array->type().get());
+    const auto& buffers = array->data()->buffers;
+    if (type == nullptr || type->bit_width() % 8 != 0 || buffers.size() != 2 ||
+        buffers[1] == nullptr || !buffers[1]->is_cpu()) {
+        return nullptr;
+    }
+    const int64_t byte_width = type->bit_width() / 8;
+    if (array->length() * byte_width != static_cast<int64_t>(size)) {
+        return nullptr;
+    }
+    const auto& values = buffers[1];
+    const int64_t offset = array->offset() * byte_width;
+    const int64_t unused = values->size() - static_cast<int64_t>(size);
+    auto begin = reinterpret_cast<uintptr_t>(values->data() + offset);
+    if (begin % kArrowBufferAlignment != 0 ||
+        unused > static_cast<int64_t>(ChunkTarget::ALIGNED_SIZE)) {
+        return nullptr;
+    }
+    return arrow::SliceBuffer(values, offset, size);
+}
+
+static char*
+adopted_data(const std::shared_ptr<arrow::Buffer>& values) {
+    return reinterpret_cast<char*>(const_cast<uint8_t*>(values->data()));
+}
+
 ChunkBuffer
 create_chunk_buffer(const FieldMeta& field_meta,
                     const arrow::ArrayVector& array_vec,
@@ -796,6 +856,16 @@ create_chunk_buffer(const FieldMeta& field_meta,
                     proto::common::LoadPriority load_priority) {
     auto cw = create_chunk_writer(field_meta);
     auto [size, row_nums] = cw->calculate_size(array_vec);
+    if (file_path.empty()) {
+        if (auto values = adoptable_values(field_meta, array_vec, size)) {
+            ChunkBuffer buffer;
+            buffer.data = adopted_data(values);
+            buffer.size = size;
+            buffer.row_nums = row_nums;
+            buffer.guard = std::make_shared<ChunkMmapGuard>(std::move(values));
+            return buffer;
+        }
+    }
     size_t aligned_size = (size + ChunkTarget::ALIGNED_SIZE - 1) &
                           ~(ChunkTarget::ALIGNED_SIZE - 1);
     std::shared_ptr<ChunkTarget> target;
@@ -862,6 +932,9 @@ create_group_chunk(const std::vector<FieldId>& field_ids,
     chunk_sizes.reserve(field_ids.size());
     std::vector<size_t> chunk_offsets;
     chunk_offsets.reserve(field_ids.size());
+    // value buffers adopted by in-memory chunks, which are not copied into
+    // the group's target
+    std::vector<std::shared_ptr<arrow::Buffer>> adopted(field_ids.size());
     for (size_t i = 0; i < field_ids.size(); i++) {
         auto [size, row_nums] = cws[i]->calculate_size(array_vec[i]);
         // Allocate and place each sub-chunk at an aligned boundary,
@@ -871,7 +944,12 @@ create_group_chunk(const std::vector<FieldId>& field_ids,
         // store raw size for make_chunk()
         chunk_sizes.push_back(size);
         chunk_offsets.push_back(total_aligned_size);
-        total_aligned_size += aligned_size;
+        if (file_path.empty()) {
+            adopted[i] = adoptable_values(field_metas[i], array_vec[i], size);
+        }
+        if (adopted[i] == nullptr) {
+            total_aligned_size += aligned_size;
+        }
         // each column should have the same number of rows
         if (i == 0) {
             final_row_nums = row_nums;
@@ -882,6 +960,22 @@ create_group_chunk(const std::vector<FieldId>& field_ids,
             }
         }
     }
+    std::unordered_map<FieldId, std::shared_ptr<Chunk>> chunks;
+    for (size_t i = 0; i < field_ids.size(); i++) {
+        if (adopted[i] != nullptr) {
+            auto data = adopted_data(adopted[i]);
+            chunks[field_ids[i]] = make_chunk(
+                field_metas[i],
+                final_row_nums,
+                data,
+                chunk_sizes[i],
+                std::make_shared<ChunkMmapGuard>(std::move(adopted[i])));
+        }
+    }
+    if (chunks.size() == field_ids.size()) {
+        return chunks;
+    }
+
     std::shared_ptr<ChunkTarget> target;
     if (file_path.empty()) {
         target =
@@ -894,6 +988,9 @@ create_group_chunk(const std::vector<FieldId>& field_ids,
             storage::io::GetPriorityFromLoadPriority(load_priority));
     }
     for (size_t i = 0; i < field_ids.size(); i++) {
+        if (chunks.count(field_ids[i]) > 0) {
+            continue;
+        }
         auto start_off = target->tell();
         cws[i]->write_to_target(array_vec[i], target);
         auto end_off = target->tell();
@@ -930,8 +1027,10 @@ create_group_chunk(const std::vector<FieldId>& field_ids,
             std::make_shared<ChunkMmapGuard>(data, total_aligned_size, "");
     }
 
-    std::unordered_map<FieldId, std::shared_ptr<Chunk>> chunks;
     for (size_t i = 0; i < field_ids.size(); i++) {
+        if (chunks.count(field_ids[i]) > 0) {
+            continue;
+        }
         chunks[field_ids[i]] = make_chunk(field_metas[i],
                                           final_row_nums,
                                           data + chunk_offsets[i],
@@ -0,0 +1,302 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "common/FilterResult.h"
+
+#include <algorithm>
+#include <iterator>
+#include <limits>
+#include <utility>
+
+#include "common/EasyAssert.h"
+
+namespace milvus {
+
+namespace {
+
+// A sorted uint32 offset costs 32 bits per kept row and a dense bitmap one
+// bit per row, so offsets win below ~1/32 density. Roaring array containers
+// cost ~16 bits per kept row plus container headers and win below ~1/16.
+// Both thresholds leave headroom for the conversion cost.
+constexpr int64_t kSortedOffsetsMaxDensityDivisor = 64;
+constexpr int64_t kRoaringMaxDensityDivisor = 16;
+
+}  // namespace
+
+FilterResult
+FilterResult::AllKept(int64_t size) {
+    FilterResult result;
+    result.kind_ = Kind::kDense;
+    result.size_ = size;
+    result.dense_ = TargetBitmap(size, false);
+    return result;
+}
+
+FilterResult::Kind
+FilterResult::ChooseKind(int64_t kept, int64_t size) {
+    if (size == 0) {
+        return Kind::kDense;
+    }
+    if (kept * kSortedOffsetsMaxDensityDivisor <= size) {
+        return Kind::kSortedOffsets;
+    }
+    if (kept * kRoaringMaxDensityDivisor <= size) {
+        return Kind::kRoaring;
+    }
+    return Kind::kDense;
+}
+
+FilterResult
+FilterResult::FromExcluded(TargetBitmap&& excluded) {
+    AssertInfo(excluded.size() <= std::numeric_limits<uint32_t>::max(),
+               "filter result size {} exceeds uint32 offsets",
+               excluded.size());
+    FilterResult result;
+    result.kind_ = Kind::kDense;
+    result.size_ = excluded.size();
+    const int64_t kept = result.size_ - excluded.count();
+    result.dense_ = std::move(excluded);
+    result.ConvertTo(ChooseKind(kept, result.size_));
+    return result;
+}
+
+FilterResult
+FilterResult::FromExcluded(const TargetBitmapView& excluded) {
+    if (auto sparse = SparseFromExcluded(excluded); sparse.has_value()) {
+        return std::move(*sparse);
+    }
+    FilterResult result;
+    result.kind_ = Kind::kDense;
+    result.size_ = excluded.size();
+    result.dense_ = TargetBitmap(excluded);
+    return result;
+}
+
+std::optional<FilterResult>
+FilterResult::SparseFromExcluded(const TargetBitmapView& excluded) {
+    const int64_t size = excluded.size();
+    const int64_t kept = size - excluded.count();
+    if (ChooseKind(kept, size) == Kind::kDense) {
+        return std::nullopt;
+    }
+    // Collect kept offsets straight from the view without copying the dense
+    // bitmap.
+    std::vector<uint32_t> offsets;
+    offsets.reserve(kept);
+    for (auto i = excluded.find_first(false); i.has_value();
+         i = excluded.find_next(*i, false)) {
+        offsets.push_back(static_cast<uint32_t>(*i));
+    }
+    auto result = FromKeptOffsets(std::move(offsets), size);
+    result.Compact();
+    return result;
+}
+
+FilterResult
+FilterResult::FromKeptOffsets(std::vector<uint32_t>&& offsets, int64_t size) {
+    AssertInfo(offsets.empty() || offsets.back() < size,
+               "kept offset {} out of range {}",
+               offsets.empty() ? 0 : offsets.back(),
+               size);
+    FilterResult result;
+    result.kind_ = Kind::kSortedOffsets;
+    result.size_ = size;
+    result.offsets_ = std::move(offsets);
+    return result;
+}
+
+FilterResult
+FilterResult::FromRoaring(roaring::Roaring&& kept, int64_t size) {
+    FilterResult result;
+    result.kind_ = Kind::kRoaring;
+    result.size_ = size;
+    result.roaring_ = std::move(kept);
+    return result;
+}
+
+int64_t
+FilterResult::kept_count() const {
+    switch (kind_) {
+        case Kind::kDense:
+            return size_ - static_cast<int64_t>(dense_.count());
+        case Kind::kSortedOffsets:
+            return static_cast<int64_t>(offsets_.size());
+        case Kind::kRoaring:
+            return static_cast<int64_t>(roaring_.cardinality());
+    }
+    return 0;
+}
+
+bool
+FilterResult::IsKept(int64_t offset) const {
+    switch (kind_) {
+        case Kind::kDense:
+            return !dense_[offset];
+        case Kind::kSortedOffsets:
+            return std::binary_search(offsets_.begin(),
+                                      offsets_.end(),
+                                      static_cast<uint32_t>(offset));
+        case Kind::kRoaring:
+            return roaring_.contains(static_cast<uint32_t>(offset));
+    }
+    return false;
+}
+
+void
+FilterResult::And(const FilterResult& other) {
+    AssertInfo(size_ == other.size_,
+               "filter result size mismatch, {} vs {}",
+               size_,
+               other.size_);
+    dense_view_valid_ = false;
+
+    if (kind_ == Kind::kDense && other.kind_ == Kind::kDense) {
+        dense_.inplace_or(other.dense_, size_);
+        return;
+    }
+    if (kind_ == Kind::kRoaring && other.kind_ == Kind::kRoaring) {
+        roaring_ &= other.roaring_;
+        return;
+    }
+    if (kind_ == Kind::kSortedOffsets &&
+        other.kind_ == Kind::kSortedOffsets) {
+        std::vector<uint32_t> merged;
+        merged.reserve(std::min(offsets_.size(), other.offsets_.size()));
+        std::set_intersection(offsets_.begin(),
+                              offsets_.end(),
+                              other.offsets_.begin(),
+                              other.offsets_.end(),
+                              std::back_inserter(merged));
+        offsets_ = std::move(merged);
+        return;
+    }
+    if (kind_ == Kind::kDense) {
+        // Dense AND sparse: the result is at most as dense as `other`, so
+        // adopt its kept rows and probe our excluded bits.
+        auto offsets = other.KeptOffsets();
+        offsets.erase(std::remove_if(offsets.begin(),
+                                     offsets.end(),
+                                     [this](uint32_t offset) {
+                                         return dense_[offset];
+                                     }),
+                      offsets.end());
+        dense_ = TargetBitmap();
+        kind_ = Kind::kSortedOffsets;
+        offsets_ = std::move(offsets);
+        Compact();
+        return;
+    }
+    // We are sparse: probe the other side for each of our kept rows.
+    RemoveIf([&other](int64_t offset) { return !other.IsKept(offset); });
+}
+
+void
+FilterResult::MaskExcluded(const TargetBitmapView& excluded) {
+    AssertInfo(excluded.size() == static_cast<size_t>(size_),
+               "mask size {} mismatch filter result size {}",
+               excluded.size(),
+               size_);
+    if (kind_ == Kind::kDense) {
+        dense_.inplace_or(excluded, size_);
+        dense_view_valid_ = false;
+        return;
+    }
+    RemoveIf([&excluded](int64_t offset) { return excluded[offset]; });
+}
+
+void
+FilterResult::Compact() {
+    ConvertTo(ChooseKind(kept_count(), size_));
+}
+
+std::vector<uint32_t>
+FilterResult::KeptOffsets() const {
+    if (kind_ == Kind::kSortedOffsets) {
+        return offsets_;
+    }
+    std::vector<uint32_t> offsets;
+    offsets.reserve(kept_count());
+    ForEachKept([&offsets](int64_t offset) {
+        offsets.push_back(static_cast<uint32_t>(offset));
+    });
+    return offsets;
+}
+
+void
+FilterResult::ConvertTo(Kind kind) {
+    if (kind == kind_) {
+        return;
+    }
+    dense_view_valid_ = false;
+    switch (kind) {
+        case Kind::kDense:
+            dense_ = ToExcludedBitmap();
+            offsets_ = std::vector<uint32_t>();
+            roaring_ = roaring::Roaring();
+            break;
+        case Kind::kSortedOffsets:
+            offsets_ = KeptOffsets();
+            dense_ = TargetBitmap();
+            roaring_ = roaring::Roaring();
+            break;
+        case Kind::kRoaring: {
+            roaring::Roaring kept;
+            if (kind_ == Kind::kSortedOffsets) {
+                kept.addMany(offsets_.size(), offsets_.data());
+            } else {
+                ForEachKept([&kept](int64_t offset) {
+                    kept.add(static_cast<uint32_t>(offset));
+                });
+            }
+            kept.runOptimize();
+            roaring_ = std::move(kept);
+            dense_ = TargetBitmap();
+            offsets_ = std::vector<uint32_t>();
+            break;
+        }
+    }
+    kind_ = kind;
+}
+
+TargetBitmap
+FilterResult::ToExcludedBitmap() const {
+    if (kind_ == Kind::kDense) {
+        return dense_.clone();
+    }
+    TargetBitmap excluded(size_, true);
+    ForEachKept([&excluded](int64_t offset) { excluded.reset(offset); });
+    return excluded;
+}
+
+BitsetView
+FilterResult::ToBitsetView() {
+    if (kind_ == Kind::kDense) {
+        return BitsetView(dense_);
+    }
+    if (!dense_view_valid_) {
+        dense_view_ = ToExcludedBitmap();
+        dense_view_valid_ = true;
+    }
+    return BitsetView(dense_view_);
+}
+
+size_t
+FilterResult::ByteSize() const {
+    return dense_.size_in_bytes() + offsets_.capacity() * sizeof(uint32_t) +
+           roaring_.getSizeInBytes() + dense_view_.size_in_bytes();
+}
+
+}  // namespace milvus
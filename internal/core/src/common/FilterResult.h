@@ -0,0 +1,212 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+#include <roaring/roaring.hh>
+
+#include "common/BitsetView.h"
+#include "common/Types.h"
+
+namespace milvus {
+
+// Density-adaptive filter result.
+//
+// TargetBitmap is always dense: a filter selecting 50 rows out of 20M still
+// allocates, zeroes, ORs and hands a 2.5 MB bitmap to the index. FilterResult
+// keeps the set of rows that pass the filter ("kept" rows) in whichever form
+// is cheapest for its density:
+//   - kSortedOffsets: sorted unique row offsets, for very selective filters
+//   - kRoaring:       a roaring bitmap, for selective filters
+//   - kDense:         a TargetBitmap using the FilterBitsNode convention
+//                     (bit set = row excluded), for everything else
+//
+// Conjunction and MVCC / delete masking work natively on every form. The
+// dense excluded bitmap expected by knowhere is only materialized by
+// ToBitsetView(), i.e. when an index actually needs it.
+class FilterResult {
+ public:
+    enum class Kind {
+        kDense,
+        kSortedOffsets,
+        kRoaring,
+    };
+
+    FilterResult() = default;
+    FilterResult(FilterResult&&) = default;
+    FilterResult&
+    operator=(FilterResult&&) = default;
+    FilterResult(const FilterResult&) = delete;
+    FilterResult&
+    operator=(const FilterResult&) = delete;
+
+    // Every row passes.
+    static FilterResult
+    AllKept(int64_t size);
+
+    // Build from an excluded bitmap (bit set = row filtered out) and pick the
+    // cheapest representation.
+    static FilterResult
+    FromExcluded(TargetBitmap&& excluded);
+
+    static FilterResult
+    FromExcluded(const TargetBitmapView& excluded);
+
+    // Like FromExcluded(), but nullopt when the dense form would be picked,
+    // so that callers holding the bitmap anyway do not copy it.
+    static std::optional<FilterResult>
+    SparseFromExcluded(const TargetBitmapView& excluded);
+
+    // `offsets` must be sorted, unique and < size.
+    static FilterResult
+    FromKeptOffsets(std::vector<uint32_t>&& offsets, int64_t size);
+
+    Kind
+    kind() const {
+        return kind_;
+    }
+
+    // Number of rows the result covers.
+    int64_t
+    size() const {
+        return size_;
+    }
+
+    int64_t
+    kept_count() const;
+
+    bool
+    IsKept(int64_t offset) const;
+
+    // kept = kept AND other.kept
+    void
+    And(const FilterResult& other);
+
+    // Drop every kept row whose bit is set in `excluded`. Used for MVCC and
+    // delete masks, which are produced as excluded bitmaps.
+    void
+    MaskExcluded(const TargetBitmapView& excluded);
+
+    // Drop every kept row for which `pred(offset)` returns true. Lets sparse
+    // results apply per-row visibility checks without a dense mask.
+    template <typename Pred>
+    void
+    RemoveIf(Pred&& pred) {
+        switch (kind_) {
+            case Kind::kDense: {
+                for (auto i = dense_.find_first(false); i.has_value();
+                     i = dense_.find_next(*i, false)) {
+                    if (pred(static_cast<int64_t>(*i))) {
+                        dense_.set(*i);
+                    }
+                }
+                break;
+            }
+            case Kind::kSortedOffsets: {
+                auto out = offsets_.begin();
+                for (auto offset : offsets_) {
+                    if (!pred(static_cast<int64_t>(offset))) {
+                        *out++ = offset;
+                    }
+                }
+                offsets_.erase(out, offsets_.end());
+                break;
+            }
+            case Kind::kRoaring: {
+                roaring::Roaring removed;
+                for (auto offset : roaring_) {
+                    if (pred(static_cast<int64_t>(offset))) {
+                        removed.add(offset);
+                    }
+                }
+                roaring_ -= removed;
+                break;
+            }
+        }
+        dense_view_valid_ = false;
+    }
+
+    // Call `fn(offset)` for every kept row in ascending order.
+    template <typename Fn>
+    void
+    ForEachKept(Fn&& fn) const {
+        switch (kind_) {
+            case Kind::kDense:
+                for (auto i = dense_.find_first(false); i.has_value();
+                     i = dense_.find_next(*i, false)) {
+                    fn(static_cast<int64_t>(*i));
+                }
+                break;
+            case Kind::kSortedOffsets:
+                for (auto offset : offsets_) {
+                    fn(static_cast<int64_t>(offset));
+                }
+                break;
+            case Kind::kRoaring:
+                for (auto offset : roaring_) {
+                    fn(static_cast<int64_t>(offset));
+                }
+                break;
+        }
+    }
+
+    // Re-pick the representation after conjunctions / masking changed the
+    // density.
+    void
+    Compact();
+
+    // Materialize the excluded bitmap (bit set = row filtered out).
+    TargetBitmap
+    ToExcludedBitmap() const;
+
+    // Excluded bitmap view for knowhere. Sparse forms are materialized once
+    // and kept alive by this object until the next mutation.
+    BitsetView
+    ToBitsetView();
+
+    // Approximate heap footprint.
+    size_t
+    ByteSize() const;
+
+ private:
+    static Kind
+    ChooseKind(int64_t kept, int64_t size);
+
+    static FilterResult
+    FromRoaring(roaring::Roaring&& kept, int64_t size);
+
+    void
+    ConvertTo(Kind kind);
+
+    std::vector<uint32_t>
+    KeptOffsets() const;
+
+    Kind kind_{Kind::kDense};
+    int64_t size_{0};
+    TargetBitmap dense_;  // kDense: bit set = excluded
+    std::vector<uint32_t> offsets_;
+    roaring::Roaring roaring_;
+
+    // Materialized excluded bitmap for sparse forms.
+    TargetBitmap dense_view_;
+    bool dense_view_valid_{false};
+};
+
+}  // namespace milvus
@@ -0,0 +1,136 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "common/FilterResult.h"
+#include "common/Types.h"
+
+using milvus::FilterResult;
+using milvus::TargetBitmap;
+
+namespace {
+
+constexpr int64_t kRows = 100000;
+
+// Excluded bitmap keeping every `stride`-th row starting at `start`.
+TargetBitmap
+MakeExcluded(int64_t stride, int64_t start = 0) {
+    TargetBitmap excluded(kRows, true);
+    for (int64_t i = start; i < kRows; i += stride) {
+        excluded.reset(i);
+    }
+    return excluded;
+}
+
+void
+ExpectSameAsDense(FilterResult& result, const TargetBitmap& expected) {
+    ASSERT_EQ(result.size(), expected.size());
+    EXPECT_EQ(result.kept_count(),
+              static_cast<int64_t>(expected.size() - expected.count()));
+    auto materialized = result.ToExcludedBitmap();
+    for (int64_t i = 0; i < result.size(); ++i) {
+        const bool is_excluded = expected[i];
+        ASSERT_EQ(static_cast<bool>(materialized[i]), is_excluded) << i;
+        ASSERT_EQ(result.IsKept(i), !is_excluded) << i;
+    }
+    auto view = result.ToBitsetView();
+    ASSERT_EQ(view.size(), expected.size());
+    for (int64_t i = 0; i < result.size(); ++i) {
+        ASSERT_EQ(view.test(i), static_cast<bool>(expected[i])) << i;
+    }
+}
+
+}  // namespace
+
+TEST(FilterResultTest, PicksRepresentationByDensity) {
+    EXPECT_EQ(FilterResult::FromExcluded(MakeExcluded(1000)).kind(),
+              FilterResult::Kind::kSortedOffsets);
+    EXPECT_EQ(FilterResult::FromExcluded(MakeExcluded(20)).kind(),
+              FilterResult::Kind::kRoaring);
+    EXPECT_EQ(FilterResult::FromExcluded(MakeExcluded(2)).kind(),
+              FilterResult::Kind::kDense);
+    EXPECT_EQ(FilterResult::AllKept(kRows).kind(), FilterResult::Kind::kDense);
+}
+
+TEST(FilterResultTest, SparseFromExcludedSkipsDenseResults) {
+    auto dense = MakeExcluded(2);
+    EXPECT_FALSE(FilterResult::SparseFromExcluded(
+                     milvus::TargetBitmapView(dense.data(), dense.size()))
+                     .has_value());
+
+    auto excluded = MakeExcluded(1000, 7);
+    auto sparse = FilterResult::SparseFromExcluded(
+        milvus::TargetBitmapView(excluded.data(), excluded.size()));
+    ASSERT_TRUE(sparse.has_value());
+    EXPECT_EQ(sparse->kind(), FilterResult::Kind::kSortedOffsets);
+    ExpectSameAsDense(*sparse, excluded);
+}
+
+TEST(FilterResultTest, FromViewMatchesDense) {
+    auto excluded = MakeExcluded(997, 13);
+    milvus::TargetBitmapView view(excluded.data(), excluded.size());
+    auto result = FilterResult::FromExcluded(view);
+    EXPECT_EQ(result.kind(), FilterResult::Kind::kSortedOffsets);
+    ExpectSameAsDense(result, excluded);
+}
+
+TEST(FilterResultTest, AndAcrossRepresentations) {
+    const std::vector<int64_t> strides = {3, 40, 500};
+    for (auto lhs_stride : strides) {
+        for (auto rhs_stride : strides) {
+            auto lhs = FilterResult::FromExcluded(MakeExcluded(lhs_stride));
+            auto rhs = FilterResult::FromExcluded(MakeExcluded(rhs_stride));
+            lhs.And(rhs);
+
+            auto expected = MakeExcluded(lhs_stride);
+            expected.inplace_or(MakeExcluded(rhs_stride), kRows);
+            ExpectSameAsDense(lhs, expected);
+        }
+    }
+}
+
+TEST(FilterResultTest, MaskExcludedAndCompact) {
+    std::mt19937 rng(42);
+    TargetBitmap deleted(kRows, false);
+    for (int i = 0; i < 5000; ++i) {
+        deleted.set(rng() % kRows);
+    }
+    milvus::TargetBitmapView deleted_view(deleted.data(), deleted.size());
+
+    for (auto stride : {2, 30, 800}) {
+        auto result = FilterResult::FromExcluded(MakeExcluded(stride));
+        result.MaskExcluded(deleted_view);
+        result.Compact();
+
+        auto expected = MakeExcluded(stride);
+        expected.inplace_or(deleted, kRows);
+        ExpectSameAsDense(result, expected);
+    }
+}
+
+TEST(FilterResultTest, RemoveIfAndForEachKept) {
+    auto result = FilterResult::FromKeptOffsets({1, 5, 9, 20, 33}, 64);
+    result.RemoveIf(
+        [](int64_t offset) { return offset % 2 == 1 && offset > 5; });
+    std::vector<int64_t> kept;
+    result.ForEachKept([&kept](int64_t offset) { kept.push_back(offset); });
+    EXPECT_EQ(kept, (std::vector<int64_t>{1, 5, 20}));
+    EXPECT_EQ(result.kept_count(), 3);
+}
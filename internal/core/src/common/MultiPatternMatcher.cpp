@@ -0,0 +1,283 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License
+
+#include "common/MultiPatternMatcher.h"
+
+#include <algorithm>
+#include <queue>
+
+#include "common/EasyAssert.h"
+
+namespace milvus {
+
+void
+AhoCorasickMatcher::Add(std::string keyword, Anchor anchor) {
+    keywords_.emplace_back(std::move(keyword), anchor);
+}
+
+int32_t
+AhoCorasickMatcher::Goto(int32_t state, uint8_t byte) const {
+    if (state == 0) {
+        return root_next_[byte];
+    }
+    const auto& next = states_[state].next;
+    auto iter = std::lower_bound(
+        next.begin(),
+        next.end(),
+        byte,
+        [](const std::pair<uint8_t, int32_t>& edge, uint8_t b) {
+            return edge.first < b;
+        });
+    if (iter == next.end() || iter->first != byte) {
+        return -1;
+    }
+    return iter->second;
+}
+
+int32_t
+AhoCorasickMatcher::Next(int32_t state, uint8_t byte) const {
+    int32_t target;
+    while ((target = Goto(state, byte)) == -1) {
+        state = states_[state].fail;
+    }
+    return target;
+}
+
+void
+AhoCorasickMatcher::Build() {
+    states_.clear();
+    states_.emplace_back();
+    empty_matches_anything_ = false;
+    empty_matches_empty_ = false;
+
+    // trie
+    for (int32_t id = 0; id < static_cast<int32_t>(keywords_.size()); id++) {
+        const auto& [keyword, anchor] = keywords_[id];
+        if (keyword.empty()) {
+            if (anchor == Anchor::Both) {
+                empty_matches_empty_ = true;
+            } else {
+                empty_matches_anything_ = true;
+            }
+            continue;
+        }
+        int32_t state = 0;
+        for (unsigned char byte : keyword) {
+            auto& next = states_[state].next;
+            auto iter = std::find_if(
+                next.begin(), next.end(), [byte](const auto& edge) {
+                    return edge.first == byte;
+                });
+            if (iter != next.end()) {
+                state = iter->second;
+                continue;
+            }
+            auto target = static_cast<int32_t>(states_.size());
+            next.emplace_back(byte, target);
+            states_.emplace_back();
+            state = target;
+        }
+        states_[state].keywords.push_back(id);
+        if (anchor == Anchor::None) {
+            states_[state].matches_anywhere = true;
+        }
+    }
+
+    for (auto& state : states_) {
+        std::sort(state.next.begin(), state.next.end());
+    }
+    root_next_.fill(0);
+    for (const auto& [byte, target] : states_[0].next) {
+        root_next_[byte] = target;
+    }
+
+    // fail and output links, breadth first so that a state's fail target
+    // is complete before the state itself
+    std::queue<int32_t> queue;
+    for (const auto& [byte, target] : states_[0].next) {
+        states_[target].fail = 0;
+        queue.push(target);
+    }
+    while (!queue.empty()) {
+        auto state = queue.front();
+        queue.pop();
+        auto& current = states_[state];
+        auto fail = current.fail;
+        current.output =
+            current.keywords.empty() ? states_[fail].output : state;
+        current.matches_anywhere |= states_[fail].matches_anywhere;
+        for (const auto& [byte, target] : current.next) {
+            states_[target].fail = Next(fail, byte);
+            queue.push(target);
+        }
+    }
+}
+
+bool
+AhoCorasickMatcher::Matches(std::string_view text) const {
+    if (empty_matches_anything_ || (empty_matches_empty_ && text.empty())) {
+        return true;
+    }
+    if (states_.size() <= 1) {
+        return false;
+    }
+    int32_t state = 0;
+    for (size_t i = 0; i < text.size(); i++) {
+        state = Next(state, static_cast<uint8_t>(text[i]));
+        const auto& current = states_[state];
+        if (current.matches_anywhere) {
+            return true;
+        }
+        size_t end = i + 1;
+        for (auto output = current.output; output > 0;
+             output = states_[states_[output].fail].output) {
+            for (auto id : states_[output].keywords) {
+                const auto& [keyword, anchor] = keywords_[id];
+                bool at_start = end == keyword.size();
+                bool at_end = end == text.size();
+                if ((anchor == Anchor::Start && at_start) ||
+                    (anchor == Anchor::End && at_end) ||
+                    (anchor == Anchor::Both && at_start && at_end)) {
+                    return true;
+                }
+            }
+        }
+    }
+    return false;
+}
+
+bool
+MultiPatternMatcher::IsSupported(proto::plan::OpType op_type) {
+    switch (op_type) {
+        case proto::plan::PrefixMatch:
+        case proto::plan::PostfixMatch:
+        case proto::plan::InnerMatch:
+        case proto::plan::Match:
+        case proto::plan::RegexMatch:
+            return true;
+        default:
+            return false;
+    }
+}
+
+std::optional<std::pair<std::string, AhoCorasickMatcher::Anchor>>
+MultiPatternMatcher::ParseLiteralLikePattern(const std::string& pattern) {
+    size_t begin = 0;
+    while (begin < pattern.size() && pattern[begin] == '%') {
+        begin++;
+    }
+    bool leading_wildcard = begin > 0;
+    bool trailing_wildcard = false;
+    std::string literal;
+    bool escape_mode = false;
+    for (size_t i = begin; i < pattern.size(); i++) {
+        char c = pattern[i];
+        if (escape_mode) {
+            literal.push_back(c);
+            escape_mode = false;
+        } else if (c == '\\') {
+            escape_mode = true;
+        } else if (c == '_') {
+            return std::nullopt;
+        } else if (c == '%') {
+            // only a run of '%' up to the end of the pattern is allowed
+            for (size_t j = i; j < pattern.size(); j++) {
+                if (pattern[j] != '%') {
+                    return std::nullopt;
+                }
+            }
+            trailing_wildcard = true;
+            break;
+        } else {
+            literal.push_back(c);
+        }
+    }
+    if (escape_mode) {
+        return std::nullopt;
+    }
+    using Anchor = AhoCorasickMatcher::Anchor;
+    Anchor anchor = leading_wildcard
+                        ? (trailing_wildcard ? Anchor::None : Anchor::End)
+                        : (trailing_wildcard ? Anchor::Start : Anchor::Both);
+    return std::make_pair(std::move(literal), anchor);
+}
+
+void
+MultiPatternMatcher::Add(proto::plan::OpType op_type,
+                         const std::string& pattern) {
+    using Anchor = AhoCorasickMatcher::Anchor;
+    switch (op_type) {
+        case proto::plan::PrefixMatch:
+            literals_.Add(pattern, Anchor::Start);
+            break;
+        case proto::plan::PostfixMatch:
+            literals_.Add(pattern, Anchor::End);
+            break;
+        case proto::plan::InnerMatch:
+            literals_.Add(pattern, Anchor::None);
+            break;
+        case proto::plan::Match: {
+            if (auto literal = ParseLiteralLikePattern(pattern)) {
+                literals_.Add(std::move(literal->first), literal->second);
+            } else {
+                like_patterns_.emplace_back(pattern);
+            }
+            break;
+        }
+        case proto::plan::RegexMatch: {
+            if (regexes_ == nullptr) {
+                // same options as PartialRegexMatcher
+                RE2::Options options;
+                options.set_dot_nl(true);
+                options.set_log_errors(false);
+                options.set_encoding(RE2::Options::EncodingUTF8);
+                regexes_ =
+                    std::make_unique<RE2::Set>(options, RE2::UNANCHORED);
+            }
+            std::string error;
+            AssertInfo(regexes_->Add(pattern, &error) >= 0,
+                       "Failed to compile regex pattern: " + error);
+            break;
+        }
+        default:
+            ThrowInfo(OpTypeInvalid,
+                      "unsupported op type for multi-pattern match: {}",
+                      op_type);
+    }
+}
+
+void
+MultiPatternMatcher::Build() {
+    literals_.Build();
+    if (regexes_ != nullptr) {
+        AssertInfo(regexes_->Compile(), "Failed to compile regex set");
+    }
+}
+
+bool
+MultiPatternMatcher::Matches(std::string_view operand) const {
+    if (literals_.Matches(operand)) {
+        return true;
+    }
+    if (regexes_ != nullptr &&
+        regexes_->Match(re2::StringPiece(operand.data(), operand.size()),
+                        nullptr)) {
+        return true;
+    }
+    for (const auto& like_pattern : like_patterns_) {
+        if (like_pattern(operand)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+}  // namespace milvus
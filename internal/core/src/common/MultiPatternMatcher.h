@@ -0,0 +1,119 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <re2/re2.h>
+#include <re2/set.h>
+
+#include "common/RegexQuery.h"
+#include "common/Types.h"
+
+namespace milvus {
+
+// Aho-Corasick automaton over bytes. Every keyword is anchored to the start
+// of the text, its end, both or neither; Matches() tells whether any of them
+// occurs in a text with its anchoring, in one pass over the text.
+class AhoCorasickMatcher {
+ public:
+    enum class Anchor : uint8_t { None, Start, End, Both };
+
+    void
+    Add(std::string keyword, Anchor anchor);
+
+    // Must be called after the last Add() and before Matches().
+    void
+    Build();
+
+    bool
+    Matches(std::string_view text) const;
+
+    bool
+    empty() const {
+        return keywords_.empty();
+    }
+
+ private:
+    struct State {
+        // sorted by byte
+        std::vector<std::pair<uint8_t, int32_t>> next;
+        int32_t fail = 0;
+        // nearest state on the fail chain (itself included) ending a keyword
+        int32_t output = -1;
+        // keywords ending exactly at this state
+        std::vector<int32_t> keywords;
+        // an unanchored keyword ends at this state or on its fail chain
+        bool matches_anywhere = false;
+    };
+
+    int32_t
+    Next(int32_t state, uint8_t byte) const;
+
+    int32_t
+    Goto(int32_t state, uint8_t byte) const;
+
+    std::vector<std::pair<std::string, Anchor>> keywords_;
+    std::vector<State> states_;
+    // transitions of the root, the state the scan returns to most often
+    std::array<int32_t, 256> root_next_{};
+    // keywords that are empty strings
+    bool empty_matches_anything_ = false;
+    bool empty_matches_empty_ = false;
+};
+
+// Tells whether a string matches any of a set of LIKE/regex patterns, each
+// with the semantics of the unary range filter op it comes from
+// (PrefixMatch, PostfixMatch, InnerMatch, Match or RegexMatch). A string is
+// scanned once for all literal patterns, with an Aho-Corasick automaton, and
+// once for all regexes, with an RE2::Set. LIKE patterns that aren't a
+// literal with leading/trailing '%' are matched one by one.
+class MultiPatternMatcher {
+ public:
+    static bool
+    IsSupported(proto::plan::OpType op_type);
+
+    void
+    Add(proto::plan::OpType op_type, const std::string& pattern);
+
+    // Must be called after the last Add() and before matching.
+    void
+    Build();
+
+    template <typename T>
+    bool
+    operator()(const T& operand) const {
+        return Matches(std::string_view(operand));
+    }
+
+    bool
+    Matches(std::string_view operand) const;
+
+ private:
+    // The literal and anchoring of a LIKE pattern whose only wildcards are
+    // leading and trailing '%', nullopt for other patterns.
+    static std::optional<std::pair<std::string, AhoCorasickMatcher::Anchor>>
+    ParseLiteralLikePattern(const std::string& pattern);
+
+    AhoCorasickMatcher literals_;
+    std::unique_ptr<RE2::Set> regexes_;
+    std::vector<LikePatternMatcher> like_patterns_;
+};
+
+}  // namespace milvus
@@ -0,0 +1,126 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License
+
+#include <gtest/gtest.h>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "common/MultiPatternMatcher.h"
+#include "common/RegexQuery.h"
+#include "query/Utils.h"
+
+using namespace milvus;
+using proto::plan::OpType;
+
+namespace {
+
+bool
+MatchOne(OpType op_type, const std::string& pattern, const std::string& str) {
+    switch (op_type) {
+        case OpType::Match:
+            return LikePatternMatcher(pattern)(str);
+        case OpType::RegexMatch:
+            return PartialRegexMatcher(pattern)(str);
+        default:
+            return query::Match(str, pattern, op_type);
+    }
+}
+
+const std::vector<std::string> kStrings = {
+    "",
+    "a",
+    "abc",
+    "xabcx",
+    "hello world",
+    "say hello",
+    "worldwide",
+    "50% off",
+    "under_score",
+    "ushers",
+    "she sells sea shells",
+    "中文测试",
+    "测试中",
+};
+
+}  // namespace
+
+TEST(AhoCorasickMatcherTest, Anchors) {
+    using Anchor = AhoCorasickMatcher::Anchor;
+    AhoCorasickMatcher matcher;
+    matcher.Add("he", Anchor::None);
+    matcher.Add("she", Anchor::Start);
+    matcher.Add("hers", Anchor::End);
+    matcher.Add("his", Anchor::Both);
+    matcher.Build();
+
+    EXPECT_TRUE(matcher.Matches("ushe"));
+    EXPECT_TRUE(matcher.Matches("ushers"));
+    EXPECT_TRUE(matcher.Matches("his"));
+    EXPECT_FALSE(matcher.Matches("this"));
+    EXPECT_FALSE(matcher.Matches("sh"));
+    EXPECT_FALSE(matcher.Matches(""));
+
+    AhoCorasickMatcher anchored;
+    anchored.Add("she", Anchor::Start);
+    anchored.Add("hers", Anchor::End);
+    anchored.Build();
+    EXPECT_TRUE(anchored.Matches("shell"));
+    EXPECT_FALSE(anchored.Matches("ashe"));
+    EXPECT_TRUE(anchored.Matches("ushers"));
+    EXPECT_FALSE(anchored.Matches("hersh"));
+}
+
+TEST(MultiPatternMatcherTest, SameAsSinglePatterns) {
+    std::vector<std::vector<std::pair<OpType, std::string>>> pattern_sets = {
+        {{OpType::InnerMatch, "abc"}, {OpType::InnerMatch, "world"}},
+        {{OpType::PrefixMatch, "hello"}, {OpType::PostfixMatch, "hello"}},
+        {{OpType::Match, "%ell%"}, {OpType::Match, "a%"}},
+        {{OpType::Match, "abc"}, {OpType::Match, "%shells"}},
+        {{OpType::Match, "50\\% off"}, {OpType::Match, "%\\_%"}},
+        {{OpType::Match, "h_llo%"}, {OpType::Match, "%w%d%"}},
+        {{OpType::RegexMatch, "^wor"}, {OpType::RegexMatch, "s+ea"}},
+        {{OpType::Match, "%测试"}, {OpType::RegexMatch, "文.试"}},
+        {{OpType::Match, ""}, {OpType::InnerMatch, "zzz"}},
+        {{OpType::Match, "%"}},
+        {{OpType::InnerMatch, "she"},
+         {OpType::PrefixMatch, "us"},
+         {OpType::Match, "x%x"},
+         {OpType::RegexMatch, "d$"}},
+    };
+
+    for (const auto& patterns : pattern_sets) {
+        MultiPatternMatcher matcher;
+        for (const auto& [op_type, pattern] : patterns) {
+            ASSERT_TRUE(MultiPatternMatcher::IsSupported(op_type));
+            matcher.Add(op_type, pattern);
+        }
+        matcher.Build();
+        for (const auto& str : kStrings) {
+            bool expected = false;
+            for (const auto& [op_type, pattern] : patterns) {
+                expected |= MatchOne(op_type, pattern, str);
+            }
+            EXPECT_EQ(matcher(str), expected)
+                << "string: '" << str << "', first pattern: '"
+                << patterns[0].second << "'";
+            EXPECT_EQ(matcher(std::string_view(str)), expected);
+        }
+    }
+}
+
+TEST(MultiPatternMatcherTest, Unsupported) {
+    EXPECT_FALSE(MultiPatternMatcher::IsSupported(OpType::Equal));
+    EXPECT_FALSE(MultiPatternMatcher::IsSupported(OpType::TextMatch));
+
+    MultiPatternMatcher matcher;
+    EXPECT_ANY_THROW(matcher.Add(OpType::RegexMatch, "(unclosed"));
+}
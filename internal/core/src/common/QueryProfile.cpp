@@ -0,0 +1,181 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "common/QueryProfile.h"
+
+#include <time.h>
+
+#include <fmt/core.h>
+#include <nlohmann/json.hpp>
+
+namespace milvus {
+
+void
+RuntimeStats::Merge(const RuntimeStats& other) {
+    wall_ns += other.wall_ns;
+    cpu_ns += other.cpu_ns;
+    input_rows += other.input_rows;
+    output_rows += other.output_rows;
+    batches += other.batches;
+    pinned_bytes += other.pinned_bytes;
+    cold_bytes += other.cold_bytes;
+    cache_hits += other.cache_hits;
+}
+
+RuntimeStatsTimer::RuntimeStatsTimer(RuntimeStats& stats)
+    : stats_(stats),
+      wall_start_(std::chrono::steady_clock::now()),
+      cpu_start_(ThreadCpuNanos()) {
+}
+
+RuntimeStatsTimer::~RuntimeStatsTimer() {
+    stats_.wall_ns += std::chrono::duration_cast<std::chrono::nanoseconds>(
+                          std::chrono::steady_clock::now() - wall_start_)
+                          .count();
+    stats_.cpu_ns += ThreadCpuNanos() - cpu_start_;
+}
+
+int64_t
+RuntimeStatsTimer::ThreadCpuNanos() {
+    struct timespec ts;
+    if (clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts) != 0) {
+        return 0;
+    }
+    return static_cast<int64_t>(ts.tv_sec) * 1000000000LL + ts.tv_nsec;
+}
+
+void
+OperatorProfile::Merge(const OperatorProfile& other) {
+    stats.Merge(other.stats);
+    if (exec_path.empty()) {
+        exec_path = other.exec_path;
+    }
+    // Drivers of one task compile the same expressions, so the trees line
+    // up node by node.
+    if (exprs.empty()) {
+        exprs = other.exprs;
+    } else if (exprs.size() == other.exprs.size()) {
+        for (size_t i = 0; i < exprs.size(); ++i) {
+            exprs[i].stats.Merge(other.exprs[i].stats);
+            if (exprs[i].exec_path.empty()) {
+                exprs[i].exec_path = other.exprs[i].exec_path;
+            }
+        }
+    }
+}
+
+void
+QueryProfile::Merge(const std::vector<OperatorProfile>& driver_operators) {
+    for (const auto& op : driver_operators) {
+        bool merged = false;
+        for (auto& existing : operators) {
+            if (existing.operator_id == op.operator_id &&
+                existing.plan_node_id == op.plan_node_id) {
+                existing.Merge(op);
+                merged = true;
+                break;
+            }
+        }
+        if (!merged) {
+            operators.push_back(op);
+        }
+    }
+}
+
+namespace {
+
+std::string
+FormatStats(const RuntimeStats& stats) {
+    auto text = fmt::format(
+        "wall={:.3f}ms cpu={:.3f}ms rows_in={} rows_out={} batches={}",
+        stats.wall_ns / 1e6,
+        stats.cpu_ns / 1e6,
+        stats.input_rows,
+        stats.output_rows,
+        stats.batches);
+    if (stats.pinned_bytes > 0) {
+        text += fmt::format(" pinned_bytes={} cold_bytes={}",
+                            stats.pinned_bytes,
+                            stats.cold_bytes);
+    }
+    if (stats.cache_hits > 0) {
+        text += fmt::format(" cache_hits={}", stats.cache_hits);
+    }
+    return text;
+}
+
+nlohmann::json
+StatsToJson(const RuntimeStats& stats) {
+    return nlohmann::json{{"wall_ns", stats.wall_ns},
+                          {"cpu_ns", stats.cpu_ns},
+                          {"input_rows", stats.input_rows},
+                          {"output_rows", stats.output_rows},
+                          {"batches", stats.batches},
+                          {"pinned_bytes", stats.pinned_bytes},
+                          {"cold_bytes", stats.cold_bytes},
+                          {"cache_hits", stats.cache_hits}};
+}
+
+}  // namespace
+
+std::string
+QueryProfile::ToString() const {
+    std::string text;
+    for (const auto& op : operators) {
+        text += fmt::format("{} [id={}, plan_node={}]",
+                            op.operator_type,
+                            op.operator_id,
+                            op.plan_node_id);
+        if (!op.exec_path.empty()) {
+            text += fmt::format(" path={}", op.exec_path);
+        }
+        text += fmt::format(": {}\n", FormatStats(op.stats));
+        for (const auto& expr : op.exprs) {
+            text += std::string(2 * (expr.depth + 1), ' ');
+            text += expr.name;
+            if (!expr.exec_path.empty()) {
+                text += fmt::format(" path={}", expr.exec_path);
+            }
+            text += fmt::format(": {}\n", FormatStats(expr.stats));
+        }
+    }
+    return text;
+}
+
+std::string
+QueryProfile::ToJson() const {
+    auto ops = nlohmann::json::array();
+    for (const auto& op : operators) {
+        auto exprs = nlohmann::json::array();
+        for (const auto& expr : op.exprs) {
+            exprs.push_back({{"name", expr.name},
+                             {"depth", expr.depth},
+                             {"exec_path", expr.exec_path},
+                             {"stats", StatsToJson(expr.stats)}});
+        }
+        ops.push_back({{"operator_id", op.operator_id},
+                       {"plan_node_id", op.plan_node_id},
+                       {"operator_type", op.operator_type},
+                       {"exec_path", op.exec_path},
+                       {"stats", StatsToJson(op.stats)},
+                       {"exprs", std::move(exprs)}});
+    }
+    return nlohmann::json{{"segment_id", segment_id},
+                          {"operators", std::move(ops)}}
+        .dump();
+}
+
+}  // namespace milvus
@@ -0,0 +1,116 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace milvus {
+
+// Runtime counters of one operator or expression within a query.
+// Times are inclusive: an expression's time includes its inputs and an
+// operator's time includes the expressions it evaluates.
+struct RuntimeStats {
+    int64_t wall_ns{0};
+    int64_t cpu_ns{0};
+    int64_t input_rows{0};
+    int64_t output_rows{0};
+    int64_t batches{0};
+    // bytes pinned through the caching layer while running, as reported by
+    // OpContext::storage_usage, and the part of them that was cold
+    int64_t pinned_bytes{0};
+    int64_t cold_bytes{0};
+    // results served from the expression / filter result caches
+    int64_t cache_hits{0};
+
+    void
+    Merge(const RuntimeStats& other);
+};
+
+// Adds the wall and CPU time between construction and destruction to
+// `stats`. CPU time is the calling thread's, so work a call hands off to
+// other pools is counted in wall time only.
+class RuntimeStatsTimer {
+ public:
+    explicit RuntimeStatsTimer(RuntimeStats& stats);
+
+    ~RuntimeStatsTimer();
+
+    RuntimeStatsTimer(const RuntimeStatsTimer&) = delete;
+    RuntimeStatsTimer&
+    operator=(const RuntimeStatsTimer&) = delete;
+
+    static int64_t
+    ThreadCpuNanos();
+
+ private:
+    RuntimeStats& stats_;
+    std::chrono::steady_clock::time_point wall_start_;
+    int64_t cpu_start_;
+};
+
+struct ExprProfile {
+    std::string name;
+    // distance from the root of the expression tree
+    int32_t depth{0};
+    // how the expression was evaluated: ScalarIndex, RawData, JsonStats, ...
+    std::string exec_path;
+    RuntimeStats stats;
+};
+
+struct OperatorProfile {
+    int32_t operator_id{0};
+    std::string plan_node_id;
+    std::string operator_type;
+    std::string exec_path;
+    RuntimeStats stats;
+    // pre-order walk of the expression trees the operator evaluates
+    std::vector<ExprProfile> exprs;
+
+    // Accumulate another driver's run of the same operator.
+    void
+    Merge(const OperatorProfile& other);
+};
+
+// Per-query execution profile, i.e. the result of an EXPLAIN ANALYZE.
+struct QueryProfile {
+    // segment the query ran on, set once the segment hands the profile out
+    int64_t segment_id{0};
+
+    // in pipeline order, source first
+    std::vector<OperatorProfile> operators;
+
+    bool
+    empty() const {
+        return operators.empty();
+    }
+
+    // Merge the operators of one driver, matching them by operator id.
+    void
+    Merge(const std::vector<OperatorProfile>& driver_operators);
+
+    // Human readable plan with per operator and expression stats.
+    std::string
+    ToString() const;
+
+    std::string
+    ToJson() const;
+};
+
+}  // namespace milvus
@@ -0,0 +1,125 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+
+#include "common/QueryProfile.h"
+
+using milvus::ExprProfile;
+using milvus::OperatorProfile;
+using milvus::QueryProfile;
+using milvus::RuntimeStats;
+using milvus::RuntimeStatsTimer;
+
+namespace {
+
+OperatorProfile
+MakeFilterProfile(int64_t rows, int64_t matched) {
+    OperatorProfile op;
+    op.operator_id = 1;
+    op.plan_node_id = "7";
+    op.operator_type = "PhyFilterBitsNode";
+    op.stats.wall_ns = 1000;
+    op.stats.input_rows = rows;
+    op.stats.output_rows = rows;
+    op.stats.batches = 1;
+
+    ExprProfile conjunct;
+    conjunct.name = "PhyConjunctFilterExpr";
+    conjunct.stats.input_rows = rows;
+    conjunct.stats.output_rows = matched;
+    ExprProfile unary;
+    unary.name = "PhyUnaryRangeFilterExpr";
+    unary.depth = 1;
+    unary.exec_path = "ScalarIndex";
+    unary.stats.input_rows = rows;
+    unary.stats.output_rows = matched;
+    op.exprs = {conjunct, unary};
+    return op;
+}
+
+}  // namespace
+
+TEST(QueryProfileTest, MergeDriversByOperator) {
+    OperatorProfile mvcc;
+    mvcc.operator_id = 0;
+    mvcc.plan_node_id = "6";
+    mvcc.operator_type = "PhyMvccNode";
+    mvcc.stats.output_rows = 100;
+
+    QueryProfile profile;
+    profile.Merge({mvcc, MakeFilterProfile(100, 10)});
+    profile.Merge({mvcc, MakeFilterProfile(50, 5)});
+
+    ASSERT_EQ(profile.operators.size(), 2u);
+    EXPECT_EQ(profile.operators[0].operator_type, "PhyMvccNode");
+    EXPECT_EQ(profile.operators[0].stats.output_rows, 200);
+
+    const auto& filter = profile.operators[1];
+    EXPECT_EQ(filter.stats.input_rows, 150);
+    EXPECT_EQ(filter.stats.wall_ns, 2000);
+    EXPECT_EQ(filter.stats.batches, 2);
+    ASSERT_EQ(filter.exprs.size(), 2u);
+    EXPECT_EQ(filter.exprs[0].stats.output_rows, 15);
+    EXPECT_EQ(filter.exprs[1].stats.output_rows, 15);
+    EXPECT_EQ(filter.exprs[1].exec_path, "ScalarIndex");
+}
+
+TEST(QueryProfileTest, ToStringAndJson) {
+    QueryProfile profile;
+    EXPECT_TRUE(profile.empty());
+    auto filter = MakeFilterProfile(100, 10);
+    filter.stats.cache_hits = 1;
+    profile.Merge({filter});
+    EXPECT_FALSE(profile.empty());
+
+    auto text = profile.ToString();
+    EXPECT_NE(text.find("PhyFilterBitsNode [id=1, plan_node=7]"),
+              std::string::npos);
+    EXPECT_NE(text.find("cache_hits=1"), std::string::npos);
+    // expressions are indented by their depth below the operator
+    EXPECT_NE(text.find("\n    PhyUnaryRangeFilterExpr path=ScalarIndex: "),
+              std::string::npos);
+
+    profile.segment_id = 42;
+    auto json = nlohmann::json::parse(profile.ToJson());
+    EXPECT_EQ(json["segment_id"], 42);
+    ASSERT_EQ(json["operators"].size(), 1u);
+    const auto& op = json["operators"][0];
+    EXPECT_EQ(op["operator_type"], "PhyFilterBitsNode");
+    EXPECT_EQ(op["stats"]["input_rows"], 100);
+    ASSERT_EQ(op["exprs"].size(), 2u);
+    EXPECT_EQ(op["exprs"][1]["depth"], 1);
+    EXPECT_EQ(op["exprs"][1]["stats"]["output_rows"], 10);
+}
+
+TEST(QueryProfileTest, TimerAccumulates) {
+    RuntimeStats stats;
+    for (int i = 0; i < 2; ++i) {
+        RuntimeStatsTimer timer(stats);
+        volatile int64_t sum = 0;
+        for (int64_t j = 0; j < 1000000; ++j) {
+            sum = sum + j;
+        }
+    }
+    EXPECT_GT(stats.wall_ns, 0);
+    EXPECT_GT(stats.cpu_ns, 0);
+}
@@ -19,6 +19,7 @@
 #include <memory>
 #include <map>
 #include <limits>
+#include <optional>
 #include <string>
 #include <queue>
 #include <utility>
@@ -31,6 +32,7 @@
 #include "common/FieldMeta.h"
 #include "common/ArrayOffsets.h"
 #include "common/OffsetMapping.h"
+#include "common/QueryProfile.h"
 #include "common/Types.h"
 #include "pb/schema.pb.h"
 #include "knowhere/index/index_node.h"
@@ -325,6 +327,8 @@ struct SearchResult {
         vector_iterators_;
     // record the storage usage in search
     StorageCost search_storage_cost_;
+    // per operator runtime stats, set when the plan asked for them
+    std::optional<QueryProfile> query_profile_;
 
     bool element_level_{false};
     std::vector<int32_t> element_indices_;
@@ -360,6 +364,8 @@ struct RetrieveResult {
     bool has_more_result = true;
     // record the storage usage in retrieve
     StorageCost retrieve_storage_cost_;
+    // per operator runtime stats, set when the plan asked for them
+    std::optional<QueryProfile> query_profile_;
 
     // Element-level query support
     // When element_level_ is true:
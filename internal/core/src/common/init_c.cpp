@@ -31,6 +31,9 @@
 #include "log/Log.h"
 #include "storage/ThreadPool.h"
 #include "exec/expression/ExprCache.h"
+#include "exec/expression/JsonPathCache.h"
+#include "exec/operator/SearchResultCache.h"
+#include "exec/operator/VectorSearchBatcher.h"
 #include "log/Log.h"
 #include "segcore/memory_planner.h"
 #include "segcore/storagev2translator/GroupCTMeta.h"
@@ -185,6 +188,49 @@ SetExprResCacheConfig(const char* mode,
     milvus::exec::ExprResCacheManager::SetEnabled(applied);
 }
 
+void
+SetSearchResultCacheConfig(bool enable,
+                           int64_t max_bytes,
+                           int32_t admission_threshold) {
+    if (!enable || max_bytes <= 0) {
+        milvus::exec::SearchResultCache::SetEnabled(false);
+        return;
+    }
+    milvus::exec::SearchResultCacheConfig config;
+    config.max_bytes = static_cast<size_t>(max_bytes);
+    config.admission_threshold =
+        static_cast<uint8_t>(std::clamp(admission_threshold, 1, 255));
+    milvus::exec::SearchResultCache::Instance().SetConfig(config);
+    milvus::exec::SearchResultCache::SetEnabled(true);
+}
+
+void
+SetVectorSearchBatchConfig(bool enable,
+                           int64_t window_us,
+                           int64_t max_batch_nq) {
+    if (!enable || window_us <= 0 || max_batch_nq <= 1) {
+        milvus::exec::VectorSearchBatcher::SetEnabled(false);
+        return;
+    }
+    milvus::exec::VectorSearchBatcherConfig config;
+    config.window_us = window_us;
+    config.max_batch_nq = max_batch_nq;
+    milvus::exec::VectorSearchBatcher::Instance().SetConfig(config);
+    milvus::exec::VectorSearchBatcher::SetEnabled(true);
+}
+
+void
+SetJsonPathCacheConfig(bool enable, int64_t max_bytes) {
+    if (!enable || max_bytes <= 0) {
+        milvus::exec::JsonPathCache::SetEnabled(false);
+        return;
+    }
+    milvus::exec::JsonPathCacheConfig config;
+    config.max_bytes = static_cast<size_t>(max_bytes);
+    milvus::exec::JsonPathCache::Instance().SetConfig(config);
+    milvus::exec::JsonPathCache::SetEnabled(true);
+}
+
 void
 SetArrowIOThreadPoolCapacity(int threads) {
     if (threads <= 0) {
@@ -102,6 +102,26 @@ SetExprResCacheConfig(const char* mode,            // "memory" or "disk"
                       int64_t disk_max_file_size,
                       int64_t disk_min_eval_duration_us);
 
+// Per-segment vector search result cache. Disabled when `enable` is false
+// or `max_bytes` <= 0.
+void
+SetSearchResultCacheConfig(bool enable,
+                           int64_t max_bytes,
+                           int32_t admission_threshold);
+
+// Cross-request micro-batching of vector searches per segment. Requests wait
+// up to `window_us` for companions; a batch is dispatched once it holds
+// `max_batch_nq` queries.
+void
+SetVectorSearchBatchConfig(bool enable,
+                           int64_t window_us,
+                           int64_t max_batch_nq);
+
+// Cache of JSON path locations used by brute-force JSON filters on growing
+// segments. Disabled when `enable` is false or `max_bytes` <= 0.
+void
+SetJsonPathCacheConfig(bool enable, int64_t max_bytes);
+
 // Set the capacity of arrow's internal IO thread pool. This pool runs
 // async range reads (ReadRangeCache) that issue actual S3 GetObject
 // requests, so it's the true ceiling on parallel object-storage reads —
@@ -23,11 +23,13 @@
 #include <cassert>
 #include <exception>
 #include <memory>
+#include <optional>
 #include <string>
 
 #include "common/Common.h"
 #include "common/EasyAssert.h"
 #include "common/Exception.h"
+#include "common/QueryProfile.h"
 #include "common/Tracer.h"
 #include "common/protobuf_utils.h"
 #include "exec/QueryContext.h"
@@ -59,6 +61,69 @@ namespace exec {
 
 std::atomic_uint64_t BlockingState::num_blocked_drivers_{0};
 
+namespace {
+
+// Charges the time and the caching layer bytes of one operator call to the
+// operator's runtime stats. A no-op unless the query collects runtime stats.
+// Bytes are read from the query-wide OpContext, so they are exact only while
+// one driver runs at a time, which is how ExecuteTask drives its tasks.
+class OperatorStatsScope {
+ public:
+    OperatorStatsScope(Operator* op, milvus::OpContext* op_ctx, bool enabled)
+        : op_ctx_(op_ctx) {
+        if (!enabled) {
+            return;
+        }
+        stats_ = &op->runtime_stats();
+        if (op_ctx_ != nullptr) {
+            total_bytes_start_ =
+                op_ctx_->storage_usage.scanned_total_bytes.load();
+            cold_bytes_start_ =
+                op_ctx_->storage_usage.scanned_cold_bytes.load();
+        }
+        timer_.emplace(*stats_);
+    }
+
+    ~OperatorStatsScope() {
+        if (stats_ == nullptr) {
+            return;
+        }
+        timer_.reset();
+        if (op_ctx_ != nullptr) {
+            stats_->pinned_bytes +=
+                op_ctx_->storage_usage.scanned_total_bytes.load() -
+                total_bytes_start_;
+            stats_->cold_bytes +=
+                op_ctx_->storage_usage.scanned_cold_bytes.load() -
+                cold_bytes_start_;
+        }
+    }
+
+    void
+    CountInput(const RowVectorPtr& input) {
+        if (stats_ != nullptr && input != nullptr) {
+            stats_->input_rows += input->size();
+        }
+    }
+
+    void
+    CountOutput(const RowVectorPtr& output) {
+        if (stats_ != nullptr && output != nullptr) {
+            stats_->output_rows += output->size();
+            ++stats_->batches;
+        }
+    }
+
+ private:
+    RuntimeStats* stats_{nullptr};
+    milvus::OpContext* op_ctx_;
+    int64_t total_bytes_start_{0};
+    int64_t cold_bytes_start_{0};
+    std::optional<RuntimeStatsTimer> timer_;
+};
+
+}  // namespace
+
 std::shared_ptr<QueryConfig>
 DriverContext::GetQueryConfig() {
     return task_->query_context()->query_config();
@@ -232,6 +297,10 @@ Driver::Init(std::unique_ptr<DriverContext> ctx,
     AssertInfo(operators.size() != 0, "operators in driver must not empty");
     operators_ = std::move(operators);
     current_operator_index_ = operators_.size() - 1;
+    if (ctx_->task_ != nullptr && ctx_->task_->collect_runtime_stats()) {
+        collect_runtime_stats_ = true;
+        op_context_ = ctx_->task_->query_context()->get_op_context();
+    }
 }
 
 void
@@ -240,6 +309,15 @@ Driver::Close() {
         return;
     }
 
+    if (collect_runtime_stats_) {
+        std::vector<OperatorProfile> profiles;
+        profiles.reserve(operators_.size());
+        for (auto& op : operators_) {
+            profiles.push_back(op->GetProfile());
+        }
+        ctx_->task_->AddDriverProfile(profiles);
+    }
+
     for (auto& op : operators_) {
         op->WaitPrefetch();
         op->Close();
@@ -323,6 +401,8 @@ Driver::RunInternal(std::shared_ptr<Driver>& self,
                     if (needs_input) {
                         RowVectorPtr result;
                         {
+                            OperatorStatsScope stats_scope(
+                                op, op_context_, collect_runtime_stats_);
                             CALL_OPERATOR(
                                 result = op->GetOutput(), op, "GetOutput");
                             if (result) {
@@ -333,8 +413,12 @@ Driver::RunInternal(std::shared_ptr<Driver>& self,
                                         "a non-empty vector: {}",
                                         op->get_operator_type()));
                             }
+                            stats_scope.CountOutput(result);
                         }
                         if (result) {
+                            OperatorStatsScope stats_scope(
+                                next_op, op_context_, collect_runtime_stats_);
+                            stats_scope.CountInput(result);
                             CALL_OPERATOR(
                                 next_op->AddInput(result), next_op, "AddInput");
                             i += 2;
@@ -364,8 +448,11 @@ Driver::RunInternal(std::shared_ptr<Driver>& self,
                     }
                 } else {
                     {
+                        OperatorStatsScope stats_scope(
+                            op, op_context_, collect_runtime_stats_);
                         CALL_OPERATOR(
                             result = op->GetOutput(), op, "GetOutput");
+                        stats_scope.CountOutput(result);
                         if (result) {
                             AssertInfo(
                                 result->size() > 0,
@@ -249,6 +249,10 @@ class Driver : public std::enable_shared_from_this<Driver> {
 
     std::vector<std::shared_ptr<Operator>> operators_;
 
+    // set when the query asked for runtime stats (EXPLAIN ANALYZE)
+    bool collect_runtime_stats_{false};
+    milvus::OpContext* op_context_{nullptr};
+
     size_t current_operator_index_{0};
 
     std::atomic_bool operatorsInitialized_{false};
@@ -18,6 +18,7 @@
 
 #include <memory>
 #include <string>
+#include <optional>
 #include <vector>
 
 #include <folly/Executor.h>
@@ -29,7 +30,9 @@
 #include "common/Types.h"
 #include "common/Exception.h"
 #include "common/ArrayOffsets.h"
+#include "common/FilterResult.h"
 #include "common/OpContext.h"
+#include "common/QueryProfile.h"
 #include "segcore/SegmentInterface.h"
 #include "segcore/Utils.h"
 
@@ -388,6 +391,19 @@ class QueryContext : public Context {
         return all_rows_visible_;
     }
 
+    // Rows kept by the filter in a sparse FilterResult, set by
+    // FilterBitsNode when the filter is selective and narrowed to the visible
+    // rows by MvccNode. nullptr when consumers have to read the bitmap.
+    void
+    set_filter_result(std::shared_ptr<FilterResult> filter_result) {
+        filter_result_ = std::move(filter_result);
+    }
+
+    const std::shared_ptr<FilterResult>&
+    get_filter_result() const {
+        return filter_result_;
+    }
+
     void
     set_enable_expr_cache(bool enable) {
         enable_expr_cache_ = enable;
@@ -408,6 +424,16 @@ class QueryContext : public Context {
         return enable_sub_expr_cache_write_;
     }
 
+    void
+    set_query_profile(QueryProfile&& profile) {
+        query_profile_ = std::move(profile);
+    }
+
+    std::optional<QueryProfile>
+    get_query_profile() {
+        return std::move(query_profile_);
+    }
+
  private:
     folly::Executor* executor_;
     //folly::Executor::KeepAlive<> executor_keepalive_;
@@ -432,6 +458,8 @@ class QueryContext : public Context {
     // used for store segment search/retrieve result
     milvus::SearchResult search_result_;
     milvus::RetrieveResult retrieve_result_;
+    // runtime stats of the last executed task, when requested by the plan
+    std::optional<QueryProfile> query_profile_;
 
     // used for save op context
     milvus::OpContext* op_context_{nullptr};
@@ -452,6 +480,8 @@ class QueryContext : public Context {
     // MVCC fast path: set true when sealed + no-filter + no-delete + no-TTL
     bool all_rows_visible_{false};
 
+    std::shared_ptr<FilterResult> filter_result_;
+
     // Expression filter cache for two-stage search
     bool enable_expr_cache_ = false;
     // Allow sub-expression results (for example TextMatch/PhraseMatch) to be
@@ -26,6 +26,7 @@
 #include <vector>
 
 #include "common/Promise.h"
+#include "common/QueryProfile.h"
 #include "common/Vector.h"
 #include "common/protobuf_utils.h"
 #include "exec/Driver.h"
@@ -179,6 +180,25 @@ class Task : public std::enable_shared_from_this<Task> {
         Terminate(TaskState::kCanceled);
     }
 
+    bool
+    collect_runtime_stats() const {
+        return query_context_ != nullptr &&
+               query_context_->get_plan_options().collect_runtime_stats;
+    }
+
+    // Called by each driver as it closes, with the profiles of its operators.
+    void
+    AddDriverProfile(const std::vector<OperatorProfile>& operators) {
+        std::lock_guard<std::mutex> l(mutex_);
+        query_profile_.Merge(operators);
+    }
+
+    QueryProfile
+    query_profile() const {
+        std::lock_guard<std::mutex> l(mutex_);
+        return query_profile_;
+    }
+
  private:
     std::string uuid_;
 
@@ -211,6 +231,9 @@ class Task : public std::enable_shared_from_this<Task> {
     uint32_t num_ungrouped_drivers_{0};
 
     uint32_t num_finished_drivers_{0};
+
+    // per operator runtime stats, filled when collect_runtime_stats() is set
+    QueryProfile query_profile_;
 };
 
 }  // namespace exec
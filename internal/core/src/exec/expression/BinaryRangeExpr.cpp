@@ -29,6 +29,7 @@
 #include "common/bson_view.h"
 #include "common/type_c.h"
 #include "common/ScopedTimer.h"
+#include "exec/expression/StringChunkKernels.h"
 #include "exec/expression/Utils.h"
 #include "fmt/core.h"
 #include "folly/FBVector.h"
@@ -456,6 +457,47 @@ PhyBinaryRangeFilterExpr::ExecRangeVisitorImplForData(EvalCtx& context) {
                     op_ctx, field_id, chunk_id, val1, val2, false, false);
             }
         };
+
+    if constexpr (std::is_same_v<T, std::string_view>) {
+        if (!has_offset_input_ && !expr_->column_.element_level_) {
+            auto range_chunk = [&](const char* data,
+                                   const uint32_t* offsets,
+                                   const bool* valid_data,
+                                   const int size,
+                                   TargetBitmapView res,
+                                   TargetBitmapView valid_res) {
+                if (data == nullptr) {
+                    processed_cursor += size;
+                    return;
+                }
+                auto active = bitmap_input.empty()
+                                  ? TargetBitmapView()
+                                  : bitmap_input.view(processed_cursor, size);
+                StringChunkRange(data,
+                                 offsets,
+                                 size,
+                                 val1,
+                                 lower_inclusive,
+                                 val2,
+                                 upper_inclusive,
+                                 active,
+                                 res);
+                ApplyValidMask(valid_data, res, valid_res, size);
+                processed_cursor += size;
+            };
+            auto processed_size = ProcessStringChunks(
+                range_chunk, skip_index_func, res, valid_res);
+            if (processed_size >= 0) {
+                AssertInfo(processed_size == real_batch_size,
+                           "internal error: expr processed rows {} not equal "
+                           "expect batch size {}",
+                           processed_size,
+                           real_batch_size);
+                return res_vec;
+            }
+        }
+    }
+
     int64_t processed_size;
     if (has_offset_input_) {
         if (expr_->column_.element_level_) {
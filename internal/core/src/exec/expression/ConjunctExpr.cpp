@@ -170,7 +170,7 @@ PhyConjunctFilterExpr::Eval(EvalCtx& context, VectorPtr& result) {
         }
 
         VectorPtr input_result;
-        inputs_[idx]->Eval(context, input_result);
+        inputs_[idx]->EvalWithStats(context, input_result);
 
         ColumnVectorPtr all_flat_result;
         if (!has_result) {
@@ -159,8 +159,8 @@ PhyExistsFilterExpr::EvalJsonExistsForDataSegment(EvalCtx& context) {
     auto pointer = milvus::Json::pointer(expr_->column_.nested_path_);
     int processed_cursor = 0;
     auto execute_sub_batch =
-        [&bitmap_input, &
-         processed_cursor ]<FilterType filter_type = FilterType::sequential>(
+        [ this, &bitmap_input, &
+          processed_cursor ]<FilterType filter_type = FilterType::sequential>(
             const milvus::Json* data,
             const bool* valid_data,
             const int32_t* offsets,
@@ -174,6 +174,7 @@ PhyExistsFilterExpr::EvalJsonExistsForDataSegment(EvalCtx& context) {
             processed_cursor += size;
             return;
         }
+        auto rows = MakeJsonPathRows<filter_type>(data, size, pointer);
         bool has_bitmap_input = !bitmap_input.empty();
         for (int i = 0; i < size; ++i) {
             auto offset = i;
@@ -187,7 +188,7 @@ PhyExistsFilterExpr::EvalJsonExistsForDataSegment(EvalCtx& context) {
             if (has_bitmap_input && !bitmap_input[processed_cursor + i]) {
                 continue;
             }
-            res[i] = data[offset].exist(pointer);
+            res[i] = rows.row(offset).exist(rows.pointer());
         }
         processed_cursor += size;
     };
@@ -37,6 +37,7 @@
 #include "exec/expression/LogicalBinaryExpr.h"
 #include "exec/expression/LogicalUnaryExpr.h"
 #include "exec/expression/MatchExpr.h"
+#include "exec/expression/MultiPatternMatchExpr.h"
 #include "exec/expression/NullExpr.h"
 #include "exec/expression/TermExpr.h"
 #include "exec/expression/TimestamptzArithCompareExpr.h"
@@ -89,7 +90,7 @@ ExprSet::Eval(int32_t begin,
         exec_ctx != nullptr ? exec_ctx->get_query_context() : nullptr;
     for (size_t i = begin; i < end; ++i) {
         milvus::exec::checkCancellation(query_ctx);
-        exprs_[i]->Eval(context, results[i]);
+        exprs_[i]->EvalWithStats(context, results[i]);
     }
 }
 
@@ -306,6 +307,10 @@ CompileExpression(const expr::TypedExprPtr& expr,
                 milvus::expr::LogicalBinaryExpr::OpType::And ||
             casted_expr->op_type_ ==
                 milvus::expr::LogicalBinaryExpr::OpType::Or) {
+            if (casted_expr->op_type_ ==
+                milvus::expr::LogicalBinaryExpr::OpType::Or) {
+                FoldMultiPatternMatchExprs(compiled_inputs, context);
+            }
             result = std::make_shared<PhyConjunctFilterExpr>(
                 std::move(compiled_inputs),
                 casted_expr->op_type_ ==
@@ -475,6 +480,9 @@ IsLikeExpr(std::shared_ptr<Expr> input) {
                 return false;
         }
     }
+    if (input->name() == "PhyMultiPatternMatchExpr") {
+        return true;
+    }
     // Also check NOT(like/regex) — e.g. !~ expands to NOT(RegexMatch)
     if (input->name() == "PhyUnaryExpr") {
         auto& children = input->GetInputsRef();
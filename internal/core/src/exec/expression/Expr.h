@@ -30,9 +30,11 @@
 #include "common/FieldDataInterface.h"
 #include "common/Json.h"
 #include "common/OpContext.h"
+#include "common/QueryProfile.h"
 #include "common/Types.h"
 #include "exec/expression/EvalCtx.h"
 #include "exec/expression/ExprCacheHelper.h"
+#include "exec/expression/JsonPathCache.h"
 #include "exec/expression/Utils.h"
 #include "exec/QueryContext.h"
 #include "expr/ITypeExpr.h"
@@ -40,6 +42,7 @@
 #include "index/JsonFlatIndex.h"
 #include "log/Log.h"
 #include "query/PlanProto.h"
+#include "segcore/ChunkedSegmentSealedImpl.h"
 #include "segcore/SegmentSealed.h"
 #include "segcore/SegmentInterface.h"
 #include "segcore/SegmentGrowingImpl.h"
@@ -231,11 +234,69 @@ class Expr : public std::enable_shared_from_this<Expr> {
         }
     }
 
+    // Eval(), plus runtime stats when the query collects them. Operators and
+    // parent expressions evaluate their inputs through this so that every
+    // node of the tree shows up in the query profile.
+    void
+    EvalWithStats(EvalCtx& context, VectorPtr& result) {
+        if (!CollectRuntimeStats(context)) {
+            Eval(context, result);
+            return;
+        }
+        {
+            RuntimeStatsTimer timer(runtime_stats_);
+            Eval(context, result);
+        }
+        ++runtime_stats_.batches;
+        auto col_vec = std::dynamic_pointer_cast<ColumnVector>(result);
+        if (col_vec == nullptr) {
+            return;
+        }
+        runtime_stats_.input_rows += col_vec->size();
+        if (col_vec->IsBitmap()) {
+            TargetBitmapView view(col_vec->GetRawData(), col_vec->size());
+            runtime_stats_.output_rows += view.count();
+        } else {
+            runtime_stats_.output_rows += col_vec->size();
+        }
+    }
+
+    // How the expression was evaluated, empty if it has no choice to make.
+    virtual std::string
+    ExecPathName() const {
+        return "";
+    }
+
+    // Append the profile of this expression and its inputs, pre-order.
+    void
+    CollectProfiles(std::vector<ExprProfile>& profiles,
+                    int32_t depth = 0) const {
+        ExprProfile profile;
+        profile.name = name_;
+        profile.depth = depth;
+        profile.exec_path = ExecPathName();
+        profile.stats = runtime_stats_;
+        profiles.push_back(std::move(profile));
+        for (const auto& input : inputs_) {
+            input->CollectProfiles(profiles, depth + 1);
+        }
+    }
+
  protected:
+    static bool
+    CollectRuntimeStats(EvalCtx& context) {
+        auto* exec_ctx = context.get_exec_context();
+        auto* query_ctx =
+            exec_ctx != nullptr ? exec_ctx->get_query_context() : nullptr;
+        return query_ctx != nullptr &&
+               query_ctx->get_plan_options().collect_runtime_stats;
+    }
+
     DataType type_;
     std::vector<std::shared_ptr<Expr>> inputs_;
     std::string name_;
     milvus::OpContext* op_ctx_;
+    RuntimeStats runtime_stats_;
 
     // whether we have offset input and do expr filtering on these data
     // default is false which means we will do expr filtering on the total segment data
@@ -458,6 +519,7 @@ class SegmentExpr : public Expr {
             cached_index_chunk_res_ = got.result;
             cached_index_chunk_valid_res_ = got.valid_result;
             cached_index_chunk_id_ = 0;
+            ++runtime_stats_.cache_hits;
             return true;
         }
         return false;
@@ -511,6 +573,33 @@ class SegmentExpr : public Expr {
         return *cached_index_valid_res_;
     }
 
+    // Row accessor for a batch of JSON rows looked up at `pointer`. On
+    // growing segments with JsonPathCache enabled, sequential batches read
+    // the value at the path from cached locations instead of re-tokenizing
+    // whole documents.
+    template <FilterType filter_type>
+    JsonPathRows
+    MakeJsonPathRows(const milvus::Json* data,
+                     int size,
+                     const std::string& pointer) const {
+        if constexpr (filter_type == FilterType::sequential) {
+            if (current_func_segment_offset_ >= 0 && !pointer.empty() &&
+                segment_->type() == SegmentType::Growing &&
+                JsonPathCache::IsEnabled()) {
+                return JsonPathRows(
+                    data,
+                    JsonPathCache::Instance().Resolve(
+                        segment_->get_segment_id(),
+                        field_id_,
+                        pointer,
+                        current_func_segment_offset_,
+                        data,
+                        size));
+            }
+        }
+        return JsonPathRows(data, pointer);
+    }
+
     int64_t
     GetNextBatchSize() {
         auto current_chunk =
@@ -1481,7 +1570,9 @@ class SegmentExpr : public Expr {
                 if (valid_data != nullptr) {
                     valid_data += data_pos;
                 }
+                current_func_segment_offset_ = size_per_chunk_ * i + data_pos;
                 process_chunk(chunk.data() + data_pos, valid_data);
+                current_func_segment_offset_ = -1;
             }
 
             processed_size += size;
@@ -1691,6 +1782,96 @@ class SegmentExpr : public Expr {
         }
     }
 
+    // The sealed segment whose StringChunks ProcessStringChunks scans, null
+    // for other segments.
+    const segcore::ChunkedSegmentSealedImpl*
+    StringChunkSegment() const {
+        return dynamic_cast<const segcore::ChunkedSegmentSealedImpl*>(
+            segment_);
+    }
+
+    // Sequential scan of a sealed VARCHAR/STRING field straight over its
+    // StringChunk buffers, for kernels that compare rows without building
+    // string views: func(data, offsets, valid_data, size, res, valid_res)
+    // where row i is data[offsets[i], offsets[i + 1]) and data is nullptr
+    // for a chunk skipped by skip_func. Returns -1 without moving the
+    // cursor if the segment doesn't keep the field in StringChunks; the
+    // caller then falls back to ProcessDataChunks.
+    template <typename FUNC>
+    int64_t
+    ProcessStringChunks(
+        FUNC func,
+        std::function<bool(const milvus::SkipIndex&, FieldId, int)> skip_func,
+        TargetBitmapView res,
+        TargetBitmapView valid_res) {
+        auto sealed = StringChunkSegment();
+        if (sealed == nullptr) {
+            return -1;
+        }
+        int64_t processed_size = 0;
+        bool prefetched = prefetched_;
+        for (size_t i = current_data_chunk_; i < num_data_chunk_; i++) {
+            auto data_pos =
+                i == current_data_chunk_ ? current_data_chunk_pos_ : 0;
+            int64_t size = segment_->chunk_size(field_id_, i) - data_pos;
+            size = std::min(size, batch_size_ - processed_size);
+            if (size == 0) {
+                continue;
+            }
+
+            auto pw = sealed->string_chunk(op_ctx_, field_id_, i);
+            auto* chunk = pw.get();
+            if (chunk == nullptr) {
+                AssertInfo(processed_size == 0,
+                           "field {} is only partly kept in string chunks",
+                           field_id_.get());
+                return -1;
+            }
+            if (!prefetched) {
+                std::vector<int64_t> pf_chunk_ids;
+                for (size_t j = i + 1; j < num_data_chunk_; j++) {
+                    pf_chunk_ids.push_back(j);
+                }
+                if (!pf_chunk_ids.empty()) {
+                    segment_->prefetch_chunks(op_ctx_, field_id_, pf_chunk_ids);
+                }
+                prefetched = prefetched_ = true;
+            }
+
+            const bool* valid_data = chunk->Valid().empty()
+                                         ? nullptr
+                                         : chunk->Valid().data() + data_pos;
+            auto& skip_index = segment_->GetSkipIndex();
+            if (!skip_func || !skip_func(skip_index, field_id_, i)) {
+                func(chunk->Data(),
+                     chunk->Offsets() + data_pos,
+                     valid_data,
+                     size,
+                     res + processed_size,
+                     valid_res + processed_size);
+            } else {
+                ApplyValidData(valid_data,
+                               res + processed_size,
+                               valid_res + processed_size,
+                               size);
+                func(nullptr,
+                     nullptr,
+                     nullptr,
+                     size,
+                     res + processed_size,
+                     valid_res + processed_size);
+            }
+
+            processed_size += size;
+            if (processed_size >= batch_size_) {
+                current_data_chunk_ = i;
+                current_data_chunk_pos_ = data_pos + size;
+                break;
+            }
+        }
+        return processed_size;
+    }
+
     // Specialized method for ngram post-filter: processes data in a specific range
     // - Starts from segment_offset (global offset across all chunks)
     // - Processes exactly 'size' rows
@@ -2330,6 +2511,26 @@ class SegmentExpr : public Expr {
         return exec_path_ == ExprExecPath::ScalarIndex;
     }
 
+    std::string
+    ExecPathName() const override {
+        if (runtime_stats_.cache_hits > 0) {
+            return "ExprCache";
+        }
+        switch (exec_path_) {
+            case ExprExecPath::RawData:
+                return "RawData";
+            case ExprExecPath::ScalarIndex:
+                return "ScalarIndex";
+            case ExprExecPath::PkIndex:
+                return "PkIndex";
+            case ExprExecPath::TextIndex:
+                return "TextIndex";
+            case ExprExecPath::JsonStats:
+                return "JsonStats";
+        }
+        return "";
+    }
+
     void
     EnsureExecPathDetermined() const {
         std::call_once(determine_exec_path_once_, [this]() {
@@ -2517,6 +2718,9 @@ class SegmentExpr : public Expr {
     int64_t current_index_chunk_{0};
     int64_t current_index_chunk_pos_{0};
     int64_t size_per_chunk_{0};
+    // Segment offset of the first row handed to the sub-batch function that
+    // ProcessDataChunksForSingleChunk is currently calling, -1 otherwise.
+    int64_t current_func_segment_offset_{-1};
 
     // Unified cache for all index paths (ScalarIndex, PkIndex, TextIndex, JsonStats).
     // Populated once per segment, then sliced per batch via SliceCachedResult().
@@ -2666,6 +2870,13 @@ class ExprSet {
         }
     }
 
+    void
+    CollectProfiles(std::vector<ExprProfile>& profiles) const {
+        for (const auto& expr : exprs_) {
+            expr->CollectProfiles(profiles);
+        }
+    }
+
  private:
     std::vector<std::shared_ptr<Expr>> exprs_;
     ExecContext* exec_ctx_;
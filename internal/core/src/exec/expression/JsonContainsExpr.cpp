@@ -468,8 +468,8 @@ PhyJsonContainsFilterExpr::ExecJsonContains(EvalCtx& context) {
 
     size_t processed_cursor = 0;
     auto execute_sub_batch =
-        [&processed_cursor, &
-         bitmap_input ]<FilterType filter_type = FilterType::sequential>(
+        [ this, &processed_cursor, &
+          bitmap_input ]<FilterType filter_type = FilterType::sequential>(
             const milvus::Json* data,
             const bool* valid_data,
             const int32_t* offsets,
@@ -484,9 +484,10 @@ PhyJsonContainsFilterExpr::ExecJsonContains(EvalCtx& context) {
             processed_cursor += size;
             return;
         }
+        auto rows = MakeJsonPathRows<filter_type>(data, size, pointer);
         auto executor = [&](size_t i) {
-            auto doc = data[i].doc();
-            auto array = doc.at_pointer(pointer).get_array();
+            auto doc = rows.row(i).doc();
+            auto array = doc.at_pointer(rows.pointer()).get_array();
             if (array.error()) {
                 return std::make_pair(false, false);
             }
@@ -736,8 +737,8 @@ PhyJsonContainsFilterExpr::ExecJsonContainsArray(EvalCtx& context) {
         arg_cached_set_);
     size_t processed_cursor = 0;
     auto execute_sub_batch =
-        [&processed_cursor, &
-         bitmap_input ]<FilterType filter_type = FilterType::sequential>(
+        [ this, &processed_cursor, &
+          bitmap_input ]<FilterType filter_type = FilterType::sequential>(
             const milvus::Json* data,
             const bool* valid_data,
             const int32_t* offsets,
@@ -752,9 +753,10 @@ PhyJsonContainsFilterExpr::ExecJsonContainsArray(EvalCtx& context) {
             processed_cursor += size;
             return;
         }
+        auto rows = MakeJsonPathRows<filter_type>(data, size, pointer);
         auto executor = [&](size_t i) {
-            auto doc = data[i].doc();
-            auto array = doc.at_pointer(pointer).get_array();
+            auto doc = rows.row(i).doc();
+            auto array = doc.at_pointer(rows.pointer()).get_array();
             if (array.error()) {
                 return std::make_pair(false, false);
             }
@@ -1104,8 +1106,8 @@ PhyJsonContainsFilterExpr::ExecJsonContainsAll(EvalCtx& context) {
     std::vector<uint64_t> found_large(
         matcher.use_small() ? 0 : matcher.num_words());
     auto execute_sub_batch =
-        [&processed_cursor, &bitmap_input, &matcher, &
-         found_large ]<FilterType filter_type = FilterType::sequential>(
+        [ this, &processed_cursor, &bitmap_input, &matcher, &
+          found_large ]<FilterType filter_type = FilterType::sequential>(
             const milvus::Json* data,
             const bool* valid_data,
             const int32_t* offsets,
@@ -1120,9 +1122,10 @@ PhyJsonContainsFilterExpr::ExecJsonContainsAll(EvalCtx& context) {
             processed_cursor += size;
             return;
         }
+        auto rows = MakeJsonPathRows<filter_type>(data, size, pointer);
         auto executor = [&](const size_t i) {
-            auto doc = data[i].doc();
-            auto array = doc.at_pointer(pointer).get_array();
+            auto doc = rows.row(i).doc();
+            auto array = doc.at_pointer(rows.pointer()).get_array();
             if (array.error()) {
                 return std::make_pair(false, false);
             }
@@ -1808,8 +1811,8 @@ PhyJsonContainsFilterExpr::ExecJsonContainsAllArray(EvalCtx& context) {
 
     size_t processed_cursor = 0;
     auto execute_sub_batch =
-        [&processed_cursor, &
-         bitmap_input ]<FilterType filter_type = FilterType::sequential>(
+        [ this, &processed_cursor, &
+          bitmap_input ]<FilterType filter_type = FilterType::sequential>(
             const milvus::Json* data,
             const bool* valid_data,
             const int32_t* offsets,
@@ -1824,9 +1827,10 @@ PhyJsonContainsFilterExpr::ExecJsonContainsAllArray(EvalCtx& context) {
             processed_cursor += size;
             return;
         }
+        auto rows = MakeJsonPathRows<filter_type>(data, size, pointer);
         auto executor = [&](const size_t i) {
-            auto doc = data[i].doc();
-            auto array = doc.at_pointer(pointer).get_array();
+            auto doc = rows.row(i).doc();
+            auto array = doc.at_pointer(rows.pointer()).get_array();
             if (array.error()) {
                 return std::make_pair(false, false);
             }
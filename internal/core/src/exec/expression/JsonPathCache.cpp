@@ -0,0 +1,119 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "exec/expression/JsonPathCache.h"
+
+#include <algorithm>
+
+#include "log/Log.h"
+
+namespace milvus {
+namespace exec {
+
+void
+JsonPathCache::SetConfig(const JsonPathCacheConfig& config) {
+    std::lock_guard lock(mutex_);
+    config_ = config;
+    blocks_.SetMaxBytes(config_.max_bytes);
+    LOG_INFO("JsonPathCache: config updated, max_bytes={}", config_.max_bytes);
+}
+
+JsonPathSlot
+JsonPathCache::Locate(const Json& row, const std::string& pointer) {
+    JsonPathSlot slot;
+    slot.offset = 0;
+    if (row.size() == 0) {
+        return slot;
+    }
+    auto doc = row.doc();
+    auto value = doc.at_pointer(pointer);
+    if (value.error()) {
+        return slot;
+    }
+    auto raw = value.value().raw_json();
+    if (raw.error()) {
+        return slot;
+    }
+    const auto raw_json = raw.value();
+    slot.offset = static_cast<uint32_t>(raw_json.data() - row.c_str());
+    slot.length = static_cast<uint32_t>(raw_json.size());
+    return slot;
+}
+
+std::shared_ptr<JsonPathCache::Block>
+JsonPathCache::GetOrCreateBlock(const BlockKey& key) {
+    std::lock_guard lock(mutex_);
+    if (auto* cached = blocks_.Get(key)) {
+        return *cached;
+    }
+    auto block = std::make_shared<Block>();
+    block->slots.resize(kBlockRows);
+    blocks_.Put(key, block, kBlockBytes);
+    return block;
+}
+
+std::vector<JsonPathSlot>
+JsonPathCache::Resolve(int64_t segment_id,
+                       FieldId field_id,
+                       const std::string& pointer,
+                       int64_t segment_offset,
+                       const Json* rows,
+                       int64_t size) {
+    std::vector<JsonPathSlot> slots(size);
+    BlockKey key{segment_id, field_id.get(), pointer, 0};
+    int64_t done = 0;
+    while (done < size) {
+        const int64_t offset = segment_offset + done;
+        const int64_t in_block = offset % kBlockRows;
+        const int64_t n = std::min(size - done, kBlockRows - in_block);
+        key.block_id = offset / kBlockRows;
+
+        // An evicted block stays usable by holders of the shared_ptr; it is
+        // just no longer reachable for later queries.
+        auto block = GetOrCreateBlock(key);
+        std::lock_guard block_lock(block->mutex);
+        for (int64_t i = 0; i < n; ++i) {
+            auto& slot = block->slots[in_block + i];
+            if (!slot.resolved()) {
+                slot = Locate(rows[done + i], pointer);
+            }
+            slots[done + i] = slot;
+        }
+        done += n;
+    }
+    return slots;
+}
+
+size_t
+JsonPathCache::EraseSegment(int64_t segment_id) {
+    std::lock_guard lock(mutex_);
+    return blocks_.EraseSegment(segment_id);
+}
+
+void
+JsonPathCache::Clear() {
+    std::lock_guard lock(mutex_);
+    blocks_.Clear();
+}
+
+size_t
+JsonPathCache::GetCurrentBytes() const {
+    std::lock_guard lock(mutex_);
+    return blocks_.bytes();
+}
+
+}  // namespace exec
+}  // namespace milvus
@@ -0,0 +1,194 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "common/Json.h"
+#include "common/Types.h"
+#include "exec/expression/SegmentLruCache.h"
+
+namespace milvus {
+namespace exec {
+
+struct JsonPathCacheConfig {
+    size_t max_bytes{256ULL * 1024 * 1024};
+};
+
+// Where the value a JSON pointer resolves to lives inside one row: the raw
+// bytes [offset, offset + length) of the row. length == 0 means the path
+// does not exist in the row.
+struct JsonPathSlot {
+    static constexpr uint32_t kUnresolved =
+        std::numeric_limits<uint32_t>::max();
+
+    uint32_t offset{kUnresolved};
+    uint32_t length{0};
+
+    bool
+    resolved() const {
+        return offset != kUnresolved;
+    }
+};
+
+// Process-level cache of JSON path locations for growing segments.
+//
+// Brute-force JSON filters (exists, unary compare, json_contains) re-tokenize
+// every row with simdjson ondemand and walk to the filtered path on each
+// query, although rows of a growing segment never change once inserted. This
+// cache remembers, per (segment, field, JSON pointer), the byte range of the
+// value each row's path resolves to. Later queries parse only that value
+// instead of the whole row, which is what dominates for wide documents.
+//
+// Slots are kept in fixed blocks of kBlockRows rows that are allocated on
+// first use and filled lazily, so only the row ranges that filters actually
+// scan are indexed. Blocks are evicted LRU within a byte budget and dropped
+// with the segment.
+class JsonPathCache : public ProcessCache<JsonPathCache> {
+ public:
+    static constexpr int64_t kBlockRows = 8192;
+
+    void
+    SetConfig(const JsonPathCacheConfig& config);
+
+    // Slots of rows [segment_offset, segment_offset + size) of a field.
+    // rows[i] must be the row at segment_offset + i; rows that are not cached
+    // yet are located by parsing them.
+    std::vector<JsonPathSlot>
+    Resolve(int64_t segment_id,
+            FieldId field_id,
+            const std::string& pointer,
+            int64_t segment_offset,
+            const Json* rows,
+            int64_t size);
+
+    // Locate `pointer` in `row` by parsing it.
+    static JsonPathSlot
+    Locate(const Json& row, const std::string& pointer);
+
+    // The value at `slot` as a standalone document, to be read with an
+    // empty JSON pointer. A missing path yields an empty Json, on which every
+    // lookup fails just like a missing path on the full row.
+    static Json
+    ValueOf(const Json& row, const JsonPathSlot& slot) {
+        if (slot.length == 0) {
+            return Json();
+        }
+        return Json(row.c_str() + slot.offset,
+                    slot.length,
+                    row.size() - slot.offset + simdjson::SIMDJSON_PADDING);
+    }
+
+    size_t
+    EraseSegment(int64_t segment_id);
+
+    void
+    Clear();
+
+    size_t
+    GetCurrentBytes() const;
+
+ private:
+    friend class ProcessCache<JsonPathCache>;
+
+    struct BlockKey {
+        int64_t segment_id{0};
+        int64_t field_id{0};
+        std::string pointer;
+        int64_t block_id{0};
+
+        bool
+        operator==(const BlockKey& other) const {
+            return segment_id == other.segment_id &&
+                   field_id == other.field_id &&
+                   block_id == other.block_id && pointer == other.pointer;
+        }
+    };
+
+    struct BlockKeyHasher {
+        size_t
+        operator()(const BlockKey& k) const noexcept {
+            return HashCacheKey(
+                k.segment_id, k.field_id, k.pointer, k.block_id);
+        }
+    };
+
+    struct Block {
+        std::mutex mutex;  // guards slots
+        std::vector<JsonPathSlot> slots;
+    };
+
+    static constexpr size_t kBlockBytes =
+        sizeof(Block) + kBlockRows * sizeof(JsonPathSlot);
+
+    // Always keeps the most recently used block, even over budget, so that a
+    // tiny budget degrades to one block instead of thrashing on every call.
+    JsonPathCache() : blocks_(config_.max_bytes, /*min_entries=*/1) {
+    }
+
+    std::shared_ptr<Block>
+    GetOrCreateBlock(const BlockKey& key);
+
+    mutable std::mutex mutex_;
+    JsonPathCacheConfig config_;
+    SegmentLruCache<BlockKey, std::shared_ptr<Block>, BlockKeyHasher> blocks_;
+};
+
+// Row accessor for brute-force JSON path filters. With cached slots, row(i)
+// is narrowed to the value at the path and pointer() is empty; without, rows
+// and the pointer are handed out unchanged.
+class JsonPathRows {
+ public:
+    JsonPathRows(const Json* data, const std::string& pointer)
+        : data_(data), pointer_(&pointer) {
+    }
+
+    JsonPathRows(const Json* data, std::vector<JsonPathSlot>&& slots)
+        : data_(data), pointer_(&kEmptyPointer), slots_(std::move(slots)) {
+    }
+
+    const Json&
+    row(size_t i) {
+        if (slots_.empty()) {
+            return data_[i];
+        }
+        narrowed_ = JsonPathCache::ValueOf(data_[i], slots_[i]);
+        return narrowed_;
+    }
+
+    const std::string&
+    pointer() const {
+        return *pointer_;
+    }
+
+ private:
+    static inline const std::string kEmptyPointer{};
+
+    const Json* data_;
+    const std::string* pointer_;
+    std::vector<JsonPathSlot> slots_;
+    Json narrowed_;
+};
+
+}  // namespace exec
+}  // namespace milvus
@@ -0,0 +1,169 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "common/Json.h"
+#include "exec/expression/JsonPathCache.h"
+
+using milvus::FieldId;
+using milvus::Json;
+using milvus::exec::JsonPathCache;
+using milvus::exec::JsonPathCacheConfig;
+using milvus::exec::JsonPathRows;
+
+namespace {
+
+std::vector<Json>
+MakeRows(int64_t n) {
+    std::vector<Json> rows;
+    rows.reserve(n);
+    for (int64_t i = 0; i < n; ++i) {
+        std::string text;
+        if (i % 3 == 0) {
+            text = R"({"other": 1})";
+        } else {
+            text = R"({"pad": "xxxxxxxx", "a": {"b": )" + std::to_string(i) +
+                   R"(, "s": "v)" + std::to_string(i) +
+                   R"(", "arr": [1, 2, 3], "n": null}})";
+        }
+        rows.emplace_back(simdjson::padded_string(text));
+    }
+    return rows;
+}
+
+class JsonPathCacheTest : public ::testing::Test {
+ protected:
+    void
+    SetUp() override {
+        JsonPathCache::Instance().Clear();
+        JsonPathCache::Instance().SetConfig(JsonPathCacheConfig{});
+        JsonPathCache::SetEnabled(true);
+    }
+
+    void
+    TearDown() override {
+        JsonPathCache::SetEnabled(false);
+    }
+};
+
+}  // namespace
+
+TEST_F(JsonPathCacheTest, NarrowedRowsMatchFullRows) {
+    auto rows = MakeRows(100);
+    for (const std::string pointer : {"/a/b", "/a/s", "/a/arr", "/a/n"}) {
+        auto slots = JsonPathCache::Instance().Resolve(
+            1, FieldId(101), pointer, 0, rows.data(), rows.size());
+        JsonPathRows cached(rows.data(), std::move(slots));
+        ASSERT_TRUE(cached.pointer().empty());
+
+        for (size_t i = 0; i < rows.size(); ++i) {
+            const auto& row = rows[i];
+            const auto& narrowed = cached.row(i);
+            ASSERT_EQ(narrowed.exist(""), row.exist(pointer)) << i;
+
+            auto expected_int = row.at<int64_t>(pointer);
+            auto actual_int = narrowed.at<int64_t>("");
+            ASSERT_EQ(actual_int.error() == simdjson::SUCCESS,
+                      expected_int.error() == simdjson::SUCCESS)
+                << i;
+            if (!expected_int.error()) {
+                ASSERT_EQ(actual_int.value(), expected_int.value());
+            }
+
+            auto expected_str = row.at<std::string_view>(pointer);
+            std::string expected_value;
+            if (!expected_str.error()) {
+                expected_value = std::string(expected_str.value());
+            }
+            auto actual_str = narrowed.at<std::string_view>("");
+            ASSERT_EQ(actual_str.error() == simdjson::SUCCESS,
+                      !expected_str.error())
+                << i;
+            if (!actual_str.error()) {
+                ASSERT_EQ(std::string(actual_str.value()), expected_value);
+            }
+
+            auto doc = narrowed.doc();
+            auto array = doc.at_pointer("").get_array();
+            ASSERT_EQ(array.error() == simdjson::SUCCESS,
+                      pointer == "/a/arr" && i % 3 != 0)
+                << i;
+        }
+    }
+}
+
+TEST_F(JsonPathCacheTest, ResolveAcrossBlocksAndReuse) {
+    const int64_t n = JsonPathCache::kBlockRows + 100;
+    auto rows = MakeRows(n);
+    const std::string pointer = "/a/b";
+
+    // Resolve in two batches crossing the block boundary.
+    const int64_t first = JsonPathCache::kBlockRows - 10;
+    auto head = JsonPathCache::Instance().Resolve(
+        2, FieldId(101), pointer, 0, rows.data(), first);
+    auto tail = JsonPathCache::Instance().Resolve(
+        2, FieldId(101), pointer, first, rows.data() + first, n - first);
+    ASSERT_EQ(head.size() + tail.size(), static_cast<size_t>(n));
+
+    // Cached slots are served without looking at the rows again.
+    std::vector<Json> empty_rows(n);
+    auto cached = JsonPathCache::Instance().Resolve(
+        2, FieldId(101), pointer, 0, empty_rows.data(), n);
+    for (int64_t i = 0; i < n; ++i) {
+        const auto& slot = i < first ? head[i] : tail[i - first];
+        ASSERT_TRUE(slot.resolved());
+        ASSERT_EQ(cached[i].offset, slot.offset) << i;
+        ASSERT_EQ(cached[i].length, slot.length) << i;
+        ASSERT_EQ(slot.length == 0, i % 3 == 0) << i;
+    }
+}
+
+TEST_F(JsonPathCacheTest, EvictionAndEraseSegment) {
+    auto rows = MakeRows(10);
+    JsonPathCacheConfig config;
+    config.max_bytes = 1;  // room for a single block only
+    JsonPathCache::Instance().SetConfig(config);
+
+    JsonPathCache::Instance().Resolve(
+        3, FieldId(101), "/a/b", 0, rows.data(), rows.size());
+    const auto one_block = JsonPathCache::Instance().GetCurrentBytes();
+    ASSERT_GT(one_block, 0u);
+    JsonPathCache::Instance().Resolve(
+        3, FieldId(101), "/a/s", 0, rows.data(), rows.size());
+    EXPECT_EQ(JsonPathCache::Instance().GetCurrentBytes(), one_block);
+
+    JsonPathCache::Instance().SetConfig(JsonPathCacheConfig{});
+    JsonPathCache::Instance().Resolve(
+        4, FieldId(101), "/a/b", 0, rows.data(), rows.size());
+    EXPECT_EQ(JsonPathCache::Instance().GetCurrentBytes(), 2 * one_block);
+    EXPECT_EQ(JsonPathCache::Instance().EraseSegment(3), 1u);
+    EXPECT_EQ(JsonPathCache::Instance().GetCurrentBytes(), one_block);
+}
+
+TEST_F(JsonPathCacheTest, DisablingClears) {
+    auto rows = MakeRows(10);
+    JsonPathCache::Instance().Resolve(
+        5, FieldId(101), "/a/b", 0, rows.data(), rows.size());
+    ASSERT_GT(JsonPathCache::Instance().GetCurrentBytes(), 0u);
+
+    JsonPathCache::SetEnabled(false);
+    EXPECT_FALSE(JsonPathCache::IsEnabled());
+    EXPECT_EQ(JsonPathCache::Instance().GetCurrentBytes(), 0u);
+}
@@ -0,0 +1,229 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "MultiPatternMatchExpr.h"
+
+#include <map>
+#include <string_view>
+#include <utility>
+
+#include "UnaryExpr.h"
+#include "common/Tracer.h"
+#include "exec/QueryContext.h"
+#include "log/Log.h"
+#include "storage/MmapManager.h"
+
+namespace milvus {
+namespace exec {
+
+PhyMultiPatternMatchExpr::PhyMultiPatternMatchExpr(
+    std::vector<std::shared_ptr<const milvus::expr::UnaryRangeFilterExpr>>
+        exprs,
+    const std::string& name,
+    milvus::OpContext* op_ctx,
+    const segcore::SegmentInternalInterface* segment,
+    int64_t active_count,
+    int64_t batch_size,
+    int32_t consistency_level)
+    : SegmentExpr(std::vector<ExprPtr>{},
+                  name,
+                  op_ctx,
+                  segment,
+                  exprs.front()->column_.field_id_,
+                  exprs.front()->column_.nested_path_,
+                  DataType::NONE,
+                  active_count,
+                  batch_size,
+                  consistency_level),
+      exprs_(std::move(exprs)) {
+    for (const auto& expr : exprs_) {
+        matcher_.Add(expr->op_type_, expr->val_.string_val());
+    }
+    matcher_.Build();
+}
+
+std::string
+PhyMultiPatternMatchExpr::ToString() const {
+    std::string result = "MultiPatternMatch: {";
+    for (size_t i = 0; i < exprs_.size(); i++) {
+        if (i > 0) {
+            result += " or ";
+        }
+        result += exprs_[i]->ToString();
+    }
+    return result + "}";
+}
+
+void
+PhyMultiPatternMatchExpr::Eval(EvalCtx& context, VectorPtr& result) {
+    tracer::AutoSpan span(
+        "PhyMultiPatternMatchExpr::Eval", tracer::GetRootSpan(), true);
+    span.GetSpan()->SetAttribute("pattern_count",
+                                 static_cast<int>(exprs_.size()));
+
+    SetHasOffsetInput(context.get_offset_input() != nullptr);
+    if (segment_->type() == SegmentType::Growing &&
+        !storage::MmapManager::GetInstance()
+             .GetMmapConfig()
+             .growing_enable_mmap) {
+        result = ExecVisitorImpl<std::string>(context);
+    } else {
+        result = ExecVisitorImpl<std::string_view>(context);
+    }
+}
+
+template <typename T>
+VectorPtr
+PhyMultiPatternMatchExpr::ExecVisitorImpl(EvalCtx& context) {
+    auto* input = context.get_offset_input();
+    const auto& bitmap_input = context.get_bitmap_input();
+
+    auto real_batch_size = GetNextRealBatchSize(input, false);
+    if (real_batch_size == 0) {
+        return nullptr;
+    }
+
+    auto res_vec =
+        std::make_shared<ColumnVector>(TargetBitmap(real_batch_size, false),
+                                       TargetBitmap(real_batch_size, true));
+    TargetBitmapView res(res_vec->GetRawData(), real_batch_size);
+    TargetBitmapView valid_res(res_vec->GetValidRawData(), real_batch_size);
+
+    const auto& matcher = matcher_;
+    size_t processed_cursor = 0;
+    auto execute_sub_batch =
+        [&matcher, &processed_cursor, &bitmap_input]<
+            FilterType filter_type = FilterType::sequential>(
+            const T* data,
+            const bool* valid_data,
+            const int32_t* offsets,
+            const int size,
+            TargetBitmapView res,
+            TargetBitmapView valid_res) {
+        bool has_bitmap_input = !bitmap_input.empty();
+        for (int i = 0; i < size; ++i) {
+            if (has_bitmap_input && !bitmap_input[i + processed_cursor]) {
+                continue;
+            }
+            auto offset = i;
+            if constexpr (filter_type == FilterType::random) {
+                offset = (offsets) ? offsets[i] : i;
+            }
+            if (valid_data != nullptr && !valid_data[offset]) {
+                res[i] = valid_res[i] = false;
+                continue;
+            }
+            res[i] = matcher(data[offset]);
+        }
+        processed_cursor += size;
+    };
+
+    int64_t processed_size;
+    if (has_offset_input_) {
+        processed_size = ProcessDataByOffsets<T>(
+            execute_sub_batch, nullptr, input, res, valid_res);
+    } else {
+        processed_size =
+            ProcessDataChunks<T>(execute_sub_batch, nullptr, res, valid_res);
+    }
+    AssertInfo(processed_size == real_batch_size,
+               "internal error: expr processed rows {} not equal "
+               "expect batch size {}",
+               processed_size,
+               real_batch_size);
+    return res_vec;
+}
+
+namespace {
+
+// The field a LIKE/regex filter scans the raw data of, nullopt if the
+// filter isn't one or may be served by an index.
+std::optional<FieldId>
+FoldableField(const ExprPtr& input,
+              const segcore::SegmentInternalInterface* segment) {
+    auto unary = std::dynamic_pointer_cast<PhyUnaryRangeFilterExpr>(input);
+    if (unary == nullptr) {
+        return std::nullopt;
+    }
+    const auto& expr = unary->GetLogicalExpr();
+    const auto& column = expr->column_;
+    if (!MultiPatternMatcher::IsSupported(expr->op_type_) ||
+        expr->val_.val_case() != proto::plan::GenericValue::kStringVal ||
+        (column.data_type_ != DataType::VARCHAR &&
+         column.data_type_ != DataType::STRING) ||
+        !column.nested_path_.empty() || column.element_level_ ||
+        segment->HasIndex(column.field_id_) ||
+        !segment->HasFieldData(column.field_id_)) {
+        return std::nullopt;
+    }
+    return column.field_id_;
+}
+
+}  // namespace
+
+void
+FoldMultiPatternMatchExprs(std::vector<ExprPtr>& inputs,
+                           QueryContext* context) {
+    auto* segment = context->get_segment();
+    if (segment == nullptr) {
+        return;
+    }
+    std::map<FieldId, std::vector<size_t>> groups;
+    for (size_t i = 0; i < inputs.size(); i++) {
+        if (auto field_id = FoldableField(inputs[i], segment)) {
+            groups[*field_id].push_back(i);
+        }
+    }
+
+    std::vector<bool> folded(inputs.size(), false);
+    for (const auto& [field_id, indices] : groups) {
+        if (indices.size() < PhyMultiPatternMatchExpr::kMinFoldedPatterns) {
+            continue;
+        }
+        std::vector<std::shared_ptr<const milvus::expr::UnaryRangeFilterExpr>>
+            exprs;
+        for (auto idx : indices) {
+            exprs.push_back(
+                std::static_pointer_cast<PhyUnaryRangeFilterExpr>(inputs[idx])
+                    ->GetLogicalExpr());
+            folded[idx] = true;
+        }
+        LOG_DEBUG("fold {} like/regex filters on field {} into one matcher",
+                  exprs.size(),
+                  field_id.get());
+        // the folded expression takes the place of the first filter
+        inputs[indices[0]] = std::make_shared<PhyMultiPatternMatchExpr>(
+            std::move(exprs),
+            "PhyMultiPatternMatchExpr",
+            context->get_op_context(),
+            segment,
+            context->get_active_count(),
+            context->query_config()->get_expr_batch_size(),
+            context->get_consistency_level());
+        folded[indices[0]] = false;
+    }
+
+    size_t kept = 0;
+    for (size_t i = 0; i < inputs.size(); i++) {
+        if (!folded[i]) {
+            inputs[kept++] = std::move(inputs[i]);
+        }
+    }
+    inputs.resize(kept);
+}
+
+}  // namespace exec
+}  // namespace milvus
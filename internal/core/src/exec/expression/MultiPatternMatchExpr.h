@@ -0,0 +1,86 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "common/MultiPatternMatcher.h"
+#include "exec/expression/Expr.h"
+#include "expr/ITypeExpr.h"
+
+namespace milvus {
+namespace exec {
+
+class QueryContext;
+
+// PhyMultiPatternMatchExpr evaluates OR-ed LIKE/regex filters on the same
+// string field in one pass over the raw data, with a MultiPatternMatcher,
+// instead of scanning the column once per pattern.
+class PhyMultiPatternMatchExpr : public SegmentExpr {
+ public:
+    PhyMultiPatternMatchExpr(
+        std::vector<std::shared_ptr<const milvus::expr::UnaryRangeFilterExpr>>
+            exprs,
+        const std::string& name,
+        milvus::OpContext* op_ctx,
+        const segcore::SegmentInternalInterface* segment,
+        int64_t active_count,
+        int64_t batch_size,
+        int32_t consistency_level);
+
+    void
+    Eval(EvalCtx& context, VectorPtr& result) override;
+
+    void
+    DetermineExecPath() override {
+        exec_path_ = ExprExecPath::RawData;
+    }
+
+    std::string
+    ToString() const override;
+
+    std::optional<milvus::expr::ColumnInfo>
+    GetColumnInfo() const override {
+        return exprs_[0]->column_;
+    }
+
+    // Minimum number of OR-ed patterns worth folding into one expression.
+    static constexpr size_t kMinFoldedPatterns = 2;
+
+ private:
+    template <typename T>
+    VectorPtr
+    ExecVisitorImpl(EvalCtx& context);
+
+ private:
+    std::vector<std::shared_ptr<const milvus::expr::UnaryRangeFilterExpr>>
+        exprs_;
+    MultiPatternMatcher matcher_;
+};
+
+// Replaces the LIKE/regex filters among the inputs of an OR that read the
+// raw data of the same string field by one PhyMultiPatternMatchExpr per
+// field. Filters that can be served by an index are left alone.
+void
+FoldMultiPatternMatchExprs(std::vector<ExprPtr>& inputs,
+                           QueryContext* context);
+
+}  // namespace exec
+}  // namespace milvus
@@ -0,0 +1,290 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "common/Schema.h"
+#include "common/Types.h"
+#include "common/Vector.h"
+#include "exec/QueryContext.h"
+#include "exec/expression/Expr.h"
+#include "expr/ITypeExpr.h"
+#include "knowhere/comp/index_param.h"
+#include "plan/PlanNode.h"
+#include "plan/PlanNodeIdGenerator.h"
+#include "segcore/SegmentGrowingImpl.h"
+#include "test_utils/DataGen.h"
+#include "test_utils/GenExprProto.h"
+#include "test_utils/storage_test_utils.h"
+
+using namespace milvus;
+using namespace milvus::segcore;
+
+namespace {
+
+using OpType = proto::plan::OpType;
+
+// The folded OR must give the same rows as the unfolded one, which is the OR
+// of its children evaluated one by one: a single pattern is never folded.
+// The parameter picks a growing (true) or a sealed (false) segment.
+class MultiPatternMatchExprTest : public testing::TestWithParam<bool> {
+ protected:
+    void
+    SetUp() override {
+        schema_ = std::make_shared<Schema>();
+        schema_->AddDebugField(
+            "fakevec", DataType::VECTOR_FLOAT, 16, knowhere::metric::L2);
+        pk_fid_ = schema_->AddDebugField("id", DataType::INT64);
+        str_fid_ = schema_->AddDebugField("str", DataType::VARCHAR, true);
+        tag_fid_ = schema_->AddDebugField("tag", DataType::VARCHAR);
+        schema_->set_primary_field_id(pk_fid_);
+
+        auto raw_data = DataGen(schema_, kNumRows);
+        const std::vector<std::string> words{"apple",
+                                             "applesauce",
+                                             "pineapple",
+                                             "banana",
+                                             "cherry",
+                                             "blueberry",
+                                             "grape",
+                                             "kiwi",
+                                             "app_le",
+                                             "日本apple"};
+        for (int i = 0; i < raw_data.raw_->fields_data_size(); i++) {
+            auto* field_data = raw_data.raw_->mutable_fields_data(i);
+            if (field_data->field_id() != str_fid_.get() &&
+                field_data->field_id() != tag_fid_.get()) {
+                continue;
+            }
+            auto* strings = field_data->mutable_scalars()
+                                ->mutable_string_data()
+                                ->mutable_data();
+            strings->Clear();
+            for (int64_t row = 0; row < kNumRows; row++) {
+                // shift the tags so that they don't follow the strs
+                auto shift = field_data->field_id() == tag_fid_.get() ? 3 : 0;
+                strings->Add()->assign(words[(row + shift) % words.size()]);
+            }
+            if (field_data->field_id() == str_fid_.get()) {
+                // every 7th str is null, including some that would match
+                auto* valid_data = field_data->mutable_valid_data();
+                valid_data->Clear();
+                for (int64_t row = 0; row < kNumRows; row++) {
+                    valid_data->Add(row % 7 != 0);
+                }
+            }
+        }
+
+        if (GetParam()) {
+            auto segment = CreateGrowingSegment(schema_, empty_index_meta);
+            segment->PreInsert(kNumRows);
+            segment->Insert(0,
+                            kNumRows,
+                            raw_data.row_ids_.data(),
+                            raw_data.timestamps_.data(),
+                            raw_data.raw_);
+            segment_ = std::move(segment);
+        } else {
+            segment_ = CreateSealedWithFieldDataLoaded(schema_, raw_data);
+        }
+    }
+
+    static expr::TypedExprPtr
+    Pattern(FieldId field_id, OpType op, const std::string& pattern) {
+        proto::plan::GenericValue val;
+        val.set_string_val(pattern);
+        return std::make_shared<expr::UnaryRangeFilterExpr>(
+            expr::ColumnInfo(field_id, DataType::VARCHAR),
+            op,
+            val,
+            std::vector<proto::plan::GenericValue>{});
+    }
+
+    expr::TypedExprPtr
+    PkLessThan(int64_t value) const {
+        proto::plan::GenericValue val;
+        val.set_int64_val(value);
+        return std::make_shared<expr::UnaryRangeFilterExpr>(
+            expr::ColumnInfo(pk_fid_, DataType::INT64),
+            OpType::LessThan,
+            val,
+            std::vector<proto::plan::GenericValue>{});
+    }
+
+    static expr::TypedExprPtr
+    Or(const std::vector<expr::TypedExprPtr>& children) {
+        auto result = children[0];
+        for (size_t i = 1; i < children.size(); i++) {
+            result = std::make_shared<expr::LogicalBinaryExpr>(
+                expr::LogicalBinaryExpr::OpType::Or, result, children[i]);
+        }
+        return result;
+    }
+
+    // Rows of the segment, or of the offsets, passing `filter`: true and not
+    // null.
+    TargetBitmap
+    Passing(const expr::TypedExprPtr& filter,
+            FixedVector<int32_t>* offsets = nullptr) const {
+        auto filter_node = std::make_shared<plan::FilterBitsNode>(
+            plan::GetNextPlanNodeId(),
+            filter,
+            std::vector<plan::PlanNodePtr>{});
+        auto result = milvus::test::gen_filter_res(filter_node.get(),
+                                                   segment_.get(),
+                                                   kNumRows,
+                                                   MAX_TIMESTAMP,
+                                                   offsets);
+        TargetBitmapView data(result->GetRawData(), result->size());
+        TargetBitmapView valid(result->GetValidRawData(), result->size());
+        TargetBitmap passing(data);
+        passing.inplace_and(valid, result->size());
+        return passing;
+    }
+
+    // The OR of the rows passing each child on its own.
+    TargetBitmap
+    PassingAny(const std::vector<expr::TypedExprPtr>& children) const {
+        TargetBitmap passing(kNumRows, false);
+        for (const auto& child : children) {
+            passing.inplace_or(Passing(child), kNumRows);
+        }
+        return passing;
+    }
+
+    // Number of PhyMultiPatternMatchExpr CompileExpression makes of filter.
+    size_t
+    FoldedCount(const expr::TypedExprPtr& filter) const {
+        auto query_context = std::make_shared<exec::QueryContext>(
+            DEAFULT_QUERY_ID, segment_.get(), kNumRows, MAX_TIMESTAMP);
+        exec::ExecContext exec_context(query_context.get());
+        exec::ExprSet expr_set({filter}, &exec_context);
+        size_t count = 0;
+        std::vector<exec::ExprPtr> pending(expr_set.exprs().begin(),
+                                           expr_set.exprs().end());
+        while (!pending.empty()) {
+            auto expr = pending.back();
+            pending.pop_back();
+            if (expr->name() == "PhyMultiPatternMatchExpr") {
+                ++count;
+            }
+            for (const auto& input : expr->GetInputsRef()) {
+                pending.push_back(input);
+            }
+        }
+        return count;
+    }
+
+    void
+    ExpectFoldedMatchesUnfolded(
+        const std::vector<expr::TypedExprPtr>& children) {
+        auto filter = Or(children);
+        auto expected = PassingAny(children);
+        auto actual = Passing(filter);
+        ASSERT_EQ(actual.size(), expected.size());
+        for (int64_t row = 0; row < kNumRows; row++) {
+            EXPECT_EQ(actual[row], expected[row]) << "row " << row;
+        }
+
+        // every other row, as the offsets handed down by an upper filter
+        FixedVector<int32_t> offsets;
+        for (int32_t row = 1; row < kNumRows; row += 2) {
+            offsets.push_back(row);
+        }
+        auto actual_offsets = Passing(filter, &offsets);
+        ASSERT_EQ(actual_offsets.size(), offsets.size());
+        for (size_t i = 0; i < offsets.size(); i++) {
+            EXPECT_EQ(actual_offsets[i], expected[offsets[i]])
+                << "offset " << offsets[i];
+        }
+    }
+
+    static constexpr int64_t kNumRows = 200;
+
+    SchemaPtr schema_;
+    FieldId pk_fid_;
+    FieldId str_fid_;
+    FieldId tag_fid_;
+    std::unique_ptr<SegmentInternalInterface> segment_;
+};
+
+}  // namespace
+
+INSTANTIATE_TEST_SUITE_P(Segment,
+                         MultiPatternMatchExprTest,
+                         testing::Bool(),
+                         [](const testing::TestParamInfo<bool>& info) {
+                             return info.param ? "Growing" : "Sealed";
+                         });
+
+TEST_P(MultiPatternMatchExprTest, LiteralPatterns) {
+    std::vector<expr::TypedExprPtr> children{
+        Pattern(str_fid_, OpType::PrefixMatch, "apple"),
+        Pattern(str_fid_, OpType::PostfixMatch, "rry"),
+        Pattern(str_fid_, OpType::InnerMatch, "nan")};
+    EXPECT_EQ(FoldedCount(Or(children)), 1);
+    ExpectFoldedMatchesUnfolded(children);
+}
+
+TEST_P(MultiPatternMatchExprTest, LikeAndRegexPatterns) {
+    // '_' matches exactly one character, also a multi-byte one
+    std::vector<expr::TypedExprPtr> children{
+        Pattern(str_fid_, OpType::Match, "%apple"),
+        Pattern(str_fid_, OpType::Match, "app_le"),
+        Pattern(str_fid_, OpType::Match, "__apple"),
+        Pattern(str_fid_, OpType::RegexMatch, "^gr.*e$"),
+        Pattern(str_fid_, OpType::RegexMatch, "wi")};
+    EXPECT_EQ(FoldedCount(Or(children)), 1);
+    ExpectFoldedMatchesUnfolded(children);
+}
+
+TEST_P(MultiPatternMatchExprTest, MixedWithUnfoldableChildren) {
+    // the pk range, the equality and the single pattern on "tag" are left
+    // as they are, the patterns on "str" are folded around them
+    std::vector<expr::TypedExprPtr> children{
+        PkLessThan(kNumRows / 10),
+        Pattern(str_fid_, OpType::PrefixMatch, "blue"),
+        Pattern(tag_fid_, OpType::PostfixMatch, "wi"),
+        Pattern(str_fid_, OpType::RegexMatch, "ana"),
+        Pattern(str_fid_, OpType::Equal, "cherry"),
+        Pattern(str_fid_, OpType::Match, "pine%")};
+    EXPECT_EQ(FoldedCount(Or(children)), 1);
+    ExpectFoldedMatchesUnfolded(children);
+}
+
+TEST_P(MultiPatternMatchExprTest, PatternsOnTwoFields) {
+    // one folded expression per field
+    std::vector<expr::TypedExprPtr> children{
+        Pattern(str_fid_, OpType::PrefixMatch, "app"),
+        Pattern(tag_fid_, OpType::PrefixMatch, "ch"),
+        Pattern(str_fid_, OpType::PostfixMatch, "ape"),
+        Pattern(tag_fid_, OpType::InnerMatch, "nan")};
+    EXPECT_EQ(FoldedCount(Or(children)), 2);
+    ExpectFoldedMatchesUnfolded(children);
+}
+
+TEST_P(MultiPatternMatchExprTest, SinglePatternIsNotFolded) {
+    std::vector<expr::TypedExprPtr> children{
+        PkLessThan(kNumRows / 10),
+        Pattern(str_fid_, OpType::PrefixMatch, "app")};
+    EXPECT_EQ(FoldedCount(Or(children)), 0);
+    ExpectFoldedMatchesUnfolded(children);
+}
@@ -0,0 +1,181 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <unordered_map>
+#include <utility>
+
+#include "common/EasyAssert.h"
+
+namespace milvus {
+namespace exec {
+
+// Hash of the fields of a cache key, combined in order.
+template <typename... Fields>
+size_t
+HashCacheKey(const Fields&... fields) {
+    size_t seed = 0;
+    ((seed ^= std::hash<Fields>()(fields) + 0x9e3779b97f4a7c15ULL +
+              (seed << 6) + (seed >> 2)),
+     ...);
+    return seed;
+}
+
+// Singleton and on/off switch of a process-level query cache. Derived must
+// provide Clear(), which drops every entry when the cache gets disabled, and
+// befriend ProcessCache<Derived> if its constructor is private.
+template <typename Derived>
+class ProcessCache {
+ public:
+    static Derived&
+    Instance() {
+        static Derived instance;
+        return instance;
+    }
+
+    static void
+    SetEnabled(bool enabled) {
+        enabled_.store(enabled);
+        if (!enabled) {
+            // entries would go stale while nothing maintains them
+            Instance().Clear();
+        }
+    }
+
+    static bool
+    IsEnabled() {
+        return enabled_.load();
+    }
+
+ private:
+    static inline std::atomic<bool> enabled_{false};
+};
+
+// Entries of a process-level query cache, evicted least recently used first
+// within a byte budget. Key has a segment_id member, the segment its entry
+// was computed from. Not thread-safe, the owning cache serializes calls.
+template <typename Key, typename Value, typename Hasher>
+class SegmentLruCache {
+ public:
+    // min_entries most recently used entries are kept even over budget.
+    explicit SegmentLruCache(size_t max_bytes, size_t min_entries = 0)
+        : max_bytes_(max_bytes), min_entries_(min_entries) {
+    }
+
+    void
+    SetMaxBytes(size_t max_bytes) {
+        max_bytes_ = max_bytes;
+        EvictUntilWithinBudget();
+    }
+
+    // The value of key, marked most recently used; nullptr on miss.
+    Value*
+    Get(const Key& key) {
+        auto it = entries_.find(key);
+        if (it == entries_.end()) {
+            return nullptr;
+        }
+        lru_.splice(lru_.begin(), lru_, it->second.lru_it);
+        return &it->second.value;
+    }
+
+    // Inserts or replaces the value of key, which takes bytes of the budget,
+    // and evicts what no longer fits.
+    void
+    Put(const Key& key, Value value, size_t bytes) {
+        auto existing = entries_.find(key);
+        if (existing != entries_.end()) {
+            Erase(existing);
+        }
+        lru_.push_front(key);
+        entries_.emplace(key, Entry{std::move(value), bytes, lru_.begin()});
+        current_bytes_ += bytes;
+        EvictUntilWithinBudget();
+    }
+
+    size_t
+    EraseSegment(int64_t segment_id) {
+        size_t erased = 0;
+        for (auto it = entries_.begin(); it != entries_.end();) {
+            auto next = std::next(it);
+            if (it->first.segment_id == segment_id) {
+                Erase(it);
+                ++erased;
+            }
+            it = next;
+        }
+        return erased;
+    }
+
+    void
+    Clear() {
+        entries_.clear();
+        lru_.clear();
+        current_bytes_ = 0;
+    }
+
+    size_t
+    bytes() const {
+        return current_bytes_;
+    }
+
+    size_t
+    size() const {
+        return entries_.size();
+    }
+
+ private:
+    using LruList = std::list<Key>;
+
+    struct Entry {
+        Value value;
+        size_t bytes{0};
+        typename LruList::iterator lru_it;
+    };
+
+    using EntryMap = std::unordered_map<Key, Entry, Hasher>;
+
+    void
+    Erase(typename EntryMap::iterator it) {
+        current_bytes_ -= it->second.bytes;
+        lru_.erase(it->second.lru_it);
+        entries_.erase(it);
+    }
+
+    void
+    EvictUntilWithinBudget() {
+        while (current_bytes_ > max_bytes_ && entries_.size() > min_entries_) {
+            auto it = entries_.find(lru_.back());
+            AssertInfo(it != entries_.end(), "lru entry without cache entry");
+            Erase(it);
+        }
+    }
+
+    size_t max_bytes_;
+    size_t min_entries_;
+    EntryMap entries_;
+    LruList lru_;  // front = most recently used
+    size_t current_bytes_{0};
+};
+
+}  // namespace exec
+}  // namespace milvus
@@ -0,0 +1,359 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "StringChunkKernels.h"
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+
+#include "common/EasyAssert.h"
+
+namespace milvus {
+namespace exec {
+
+namespace {
+
+constexpr int kBlockSize = 64;
+
+// First 8 bytes of str as a big-endian word, zero padded, so that words
+// compare like the bytes they hold.
+inline uint64_t
+PrefixWord(const char* str, uint32_t len) {
+    uint64_t word = 0;
+    if (len >= sizeof(word)) {
+        std::memcpy(&word, str, sizeof(word));
+    } else {
+        std::memcpy(&word, str, len);
+    }
+    if constexpr (std::endian::native == std::endian::little) {
+        word = __builtin_bswap64(word);
+    }
+    return word;
+}
+
+// Last 8 bytes of str, for hashing only.
+inline uint64_t
+SuffixWord(const char* str, uint32_t len) {
+    uint64_t word = 0;
+    if (len >= sizeof(word)) {
+        std::memcpy(&word, str + len - sizeof(word), sizeof(word));
+    } else {
+        std::memcpy(&word, str, len);
+    }
+    return word;
+}
+
+struct CompareKey {
+    explicit CompareKey(std::string_view value)
+        : value(value),
+          prefix(PrefixWord(value.data(), value.size())),
+          size(value.size()) {
+    }
+
+    // <0, 0 or >0 as std::string_view(str, len).compare(value)
+    int
+    Compare(const char* str, uint32_t len) const {
+        auto word = PrefixWord(str, len);
+        if (word != prefix) {
+            return word < prefix ? -1 : 1;
+        }
+        if (len <= sizeof(word) && size <= sizeof(word)) {
+            // equal words: the shorter one is a prefix of the other
+            return len == size ? 0 : (len < size ? -1 : 1);
+        }
+        return std::string_view(str, len).compare(value);
+    }
+
+    std::string_view value;
+    uint64_t prefix;
+    uint32_t size;
+};
+
+// Calls fn(i, str, len) for the active rows of [0, size).
+template <typename Fn>
+inline void
+ForEachActiveRow(const char* data,
+                 const uint32_t* offsets,
+                 int size,
+                 TargetBitmapView active,
+                 Fn&& fn) {
+    const bool has_active = !active.empty();
+    for (int i = 0; i < size; ++i) {
+        if (has_active && !active[i]) {
+            continue;
+        }
+        auto begin = offsets[i];
+        fn(i, data + begin, offsets[i + 1] - begin);
+    }
+}
+
+void
+StringChunkEqual(const char* data,
+                 const uint32_t* offsets,
+                 int size,
+                 std::string_view val,
+                 bool negate,
+                 TargetBitmapView active,
+                 TargetBitmapView res) {
+    const CompareKey key(val);
+    const bool has_active = !active.empty();
+    for (int block = 0; block < size; block += kBlockSize) {
+        const int count = std::min(kBlockSize, size - block);
+        const uint32_t* block_offsets = offsets + block;
+        // rows of the same length as val, the only candidates
+        uint64_t candidates = 0;
+        for (int k = 0; k < count; ++k) {
+            candidates |=
+                uint64_t(block_offsets[k + 1] - block_offsets[k] == key.size)
+                << k;
+        }
+        for (int k = 0; k < count; ++k) {
+            const int i = block + k;
+            if (has_active && !active[i]) {
+                continue;
+            }
+            bool equal = false;
+            if ((candidates >> k) & 1) {
+                const char* str = data + block_offsets[k];
+                equal = PrefixWord(str, key.size) == key.prefix &&
+                        (key.size <= sizeof(uint64_t) ||
+                         std::memcmp(str + sizeof(uint64_t),
+                                     val.data() + sizeof(uint64_t),
+                                     key.size - sizeof(uint64_t)) == 0);
+            }
+            res[i] = equal != negate;
+        }
+    }
+}
+
+void
+StringChunkPrefixMatch(const char* data,
+                       const uint32_t* offsets,
+                       int size,
+                       std::string_view val,
+                       TargetBitmapView active,
+                       TargetBitmapView res) {
+    const CompareKey key(val);
+    const uint32_t word_bytes =
+        std::min<uint32_t>(key.size, sizeof(uint64_t));
+    // bits of the prefix word covered by val
+    const uint64_t word_mask =
+        word_bytes == 0 ? 0 : ~uint64_t(0) << (64 - 8 * word_bytes);
+    ForEachActiveRow(
+        data, offsets, size, active, [&](int i, const char* str, uint32_t len) {
+            res[i] = len >= key.size &&
+                     ((PrefixWord(str, len) ^ key.prefix) & word_mask) == 0 &&
+                     (key.size <= sizeof(uint64_t) ||
+                      std::memcmp(str + sizeof(uint64_t),
+                                  val.data() + sizeof(uint64_t),
+                                  key.size - sizeof(uint64_t)) == 0);
+        });
+}
+
+template <typename Pred>
+void
+StringChunkOrder(const char* data,
+                 const uint32_t* offsets,
+                 int size,
+                 std::string_view val,
+                 TargetBitmapView active,
+                 TargetBitmapView res,
+                 Pred pred) {
+    const CompareKey key(val);
+    ForEachActiveRow(
+        data, offsets, size, active, [&](int i, const char* str, uint32_t len) {
+            res[i] = pred(key.Compare(str, len));
+        });
+}
+
+}  // namespace
+
+bool
+IsStringChunkCompareOp(proto::plan::OpType op_type) {
+    switch (op_type) {
+        case proto::plan::Equal:
+        case proto::plan::NotEqual:
+        case proto::plan::GreaterThan:
+        case proto::plan::GreaterEqual:
+        case proto::plan::LessThan:
+        case proto::plan::LessEqual:
+        case proto::plan::PrefixMatch:
+            return true;
+        default:
+            return false;
+    }
+}
+
+void
+StringChunkCompare(const char* data,
+                   const uint32_t* offsets,
+                   int size,
+                   proto::plan::OpType op_type,
+                   std::string_view val,
+                   TargetBitmapView active,
+                   TargetBitmapView res) {
+    switch (op_type) {
+        case proto::plan::Equal:
+            StringChunkEqual(data, offsets, size, val, false, active, res);
+            break;
+        case proto::plan::NotEqual:
+            StringChunkEqual(data, offsets, size, val, true, active, res);
+            break;
+        case proto::plan::GreaterThan:
+            StringChunkOrder(data, offsets, size, val, active, res, [](int c) {
+                return c > 0;
+            });
+            break;
+        case proto::plan::GreaterEqual:
+            StringChunkOrder(data, offsets, size, val, active, res, [](int c) {
+                return c >= 0;
+            });
+            break;
+        case proto::plan::LessThan:
+            StringChunkOrder(data, offsets, size, val, active, res, [](int c) {
+                return c < 0;
+            });
+            break;
+        case proto::plan::LessEqual:
+            StringChunkOrder(data, offsets, size, val, active, res, [](int c) {
+                return c <= 0;
+            });
+            break;
+        case proto::plan::PrefixMatch:
+            StringChunkPrefixMatch(data, offsets, size, val, active, res);
+            break;
+        default:
+            ThrowInfo(OpTypeInvalid,
+                      "unsupported op type for string chunk compare: {}",
+                      op_type);
+    }
+}
+
+void
+StringChunkRange(const char* data,
+                 const uint32_t* offsets,
+                 int size,
+                 std::string_view lower,
+                 bool lower_inclusive,
+                 std::string_view upper,
+                 bool upper_inclusive,
+                 TargetBitmapView active,
+                 TargetBitmapView res) {
+    const CompareKey lower_key(lower);
+    const CompareKey upper_key(upper);
+    ForEachActiveRow(
+        data, offsets, size, active, [&](int i, const char* str, uint32_t len) {
+            auto lower_cmp = lower_key.Compare(str, len);
+            if (lower_inclusive ? lower_cmp < 0 : lower_cmp <= 0) {
+                res[i] = false;
+                return;
+            }
+            auto upper_cmp = upper_key.Compare(str, len);
+            res[i] = upper_inclusive ? upper_cmp <= 0 : upper_cmp < 0;
+        });
+}
+
+StringTermSet::StringTermSet(const std::vector<std::string>& vals) {
+    size_t capacity = 16;
+    while (capacity < vals.size() * 2) {
+        capacity <<= 1;
+    }
+    slots_.assign(capacity, 0);
+    mask_ = capacity - 1;
+    values_.reserve(vals.size());
+    for (const auto& val : vals) {
+        auto prefix = PrefixWord(val.data(), val.size());
+        auto slot = Slot(val.data(), val.size(), prefix);
+        while (slots_[slot] != 0 &&
+               values_[slots_[slot] - 1].str != std::string_view(val)) {
+            slot = (slot + 1) & mask_;
+        }
+        if (slots_[slot] != 0) {
+            continue;
+        }
+        values_.push_back({val, prefix});
+        slots_[slot] = static_cast<uint32_t>(values_.size());
+    }
+}
+
+size_t
+StringTermSet::Slot(const char* str, uint32_t len, uint64_t prefix) const {
+    uint64_t h = prefix ^ (SuffixWord(str, len) * 0x9e3779b97f4a7c15ULL) ^
+                 (uint64_t(len) * 0xc2b2ae3d27d4eb4fULL);
+    // murmur3 finalizer
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33;
+    return h & mask_;
+}
+
+bool
+StringTermSet::ContainsAt(size_t slot,
+                          const char* str,
+                          uint32_t len,
+                          uint64_t prefix) const {
+    for (; slots_[slot] != 0; slot = (slot + 1) & mask_) {
+        const auto& value = values_[slots_[slot] - 1];
+        if (value.prefix == prefix && value.str.size() == len &&
+            std::memcmp(value.str.data(), str, len) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool
+StringTermSet::Contains(std::string_view row) const {
+    auto prefix = PrefixWord(row.data(), row.size());
+    return ContainsAt(
+        Slot(row.data(), row.size(), prefix), row.data(), row.size(), prefix);
+}
+
+void
+StringTermSet::Probe(const char* data,
+                     const uint32_t* offsets,
+                     int size,
+                     TargetBitmapView active,
+                     TargetBitmapView res) const {
+    const bool has_active = !active.empty();
+    uint64_t prefixes[kBlockSize];
+    size_t slots[kBlockSize];
+    for (int block = 0; block < size; block += kBlockSize) {
+        const int count = std::min(kBlockSize, size - block);
+        const uint32_t* block_offsets = offsets + block;
+        for (int k = 0; k < count; ++k) {
+            const char* str = data + block_offsets[k];
+            uint32_t len = block_offsets[k + 1] - block_offsets[k];
+            prefixes[k] = PrefixWord(str, len);
+            slots[k] = Slot(str, len, prefixes[k]);
+            __builtin_prefetch(&slots_[slots[k]]);
+        }
+        for (int k = 0; k < count; ++k) {
+            const int i = block + k;
+            if (has_active && !active[i]) {
+                continue;
+            }
+            res[i] = ContainsAt(slots[k],
+                                data + block_offsets[k],
+                                block_offsets[k + 1] - block_offsets[k],
+                                prefixes[k]);
+        }
+    }
+}
+
+}  // namespace exec
+}  // namespace milvus
@@ -0,0 +1,113 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "common/Types.h"
+#include "pb/plan.pb.h"
+
+namespace milvus {
+namespace exec {
+
+// Comparison kernels over the raw buffers of a StringChunk, for filters on
+// sealed VARCHAR fields that would otherwise build a std::string_view per
+// row. Row i of a batch is data[offsets[i], offsets[i + 1]), offsets being
+// StringChunk's offset array shifted to the first row of the batch.
+//
+// Rows are compared by their first 8 bytes read as a big-endian word (zero
+// padded), which orders like memcmp, before falling back to a full
+// comparison; equality first filters rows by length, in a fixed-trip loop
+// over the offsets that vectorizes. Only rows set in `active` (all rows if
+// it is empty) are written to res; null rows are left to the caller.
+
+// Whether StringChunkCompare supports op_type.
+bool
+IsStringChunkCompareOp(proto::plan::OpType op_type);
+
+// res[i] = row i <op_type> val, op_type being a comparison or PrefixMatch.
+void
+StringChunkCompare(const char* data,
+                   const uint32_t* offsets,
+                   int size,
+                   proto::plan::OpType op_type,
+                   std::string_view val,
+                   TargetBitmapView active,
+                   TargetBitmapView res);
+
+// res[i] = lower <(=) row i <(=) upper.
+void
+StringChunkRange(const char* data,
+                 const uint32_t* offsets,
+                 int size,
+                 std::string_view lower,
+                 bool lower_inclusive,
+                 std::string_view upper,
+                 bool upper_inclusive,
+                 TargetBitmapView active,
+                 TargetBitmapView res);
+
+// Open-addressing hash set of the values of a string IN filter. Rows are
+// hashed by their length and first/last 8 bytes, so probing never reads a
+// whole row unless its fingerprint matches a value.
+class StringTermSet {
+ public:
+    explicit StringTermSet(const std::vector<std::string>& vals);
+
+    bool
+    Contains(std::string_view row) const;
+
+    // res[i] = row i is one of the values. Slots of a block of rows are
+    // computed and prefetched before any of them is probed.
+    void
+    Probe(const char* data,
+          const uint32_t* offsets,
+          int size,
+          TargetBitmapView active,
+          TargetBitmapView res) const;
+
+    size_t
+    size() const {
+        return values_.size();
+    }
+
+ private:
+    struct Value {
+        std::string str;
+        uint64_t prefix;
+    };
+
+    size_t
+    Slot(const char* str, uint32_t len, uint64_t prefix) const;
+
+    bool
+    ContainsAt(size_t slot,
+               const char* str,
+               uint32_t len,
+               uint64_t prefix) const;
+
+    std::vector<Value> values_;
+    // index + 1 into values_, 0 for an empty slot; size is a power of two
+    std::vector<uint32_t> slots_;
+    size_t mask_ = 0;
+};
+
+}  // namespace exec
+}  // namespace milvus
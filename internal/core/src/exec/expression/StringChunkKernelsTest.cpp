@@ -0,0 +1,191 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "common/Types.h"
+#include "exec/expression/StringChunkKernels.h"
+
+using namespace milvus;
+using namespace milvus::exec;
+using proto::plan::OpType;
+
+namespace {
+
+// Rows laid out as in a StringChunk: one buffer and size + 1 offsets.
+struct StringRows {
+    explicit StringRows(const std::vector<std::string>& rows) : rows(rows) {
+        offsets.push_back(0);
+        for (const auto& row : rows) {
+            data += row;
+            offsets.push_back(data.size());
+        }
+    }
+
+    int
+    size() const {
+        return rows.size();
+    }
+
+    std::vector<std::string> rows;
+    std::string data;
+    std::vector<uint32_t> offsets;
+};
+
+std::vector<std::string>
+TestRows() {
+    std::vector<std::string> rows = {
+        "",
+        "a",
+        "ab",
+        "abc",
+        std::string("a\0", 2),
+        "abcdefg",
+        "abcdefgh",
+        "abcdefghi",
+        "abcdefgh\xff",
+        "abcdefghijklmnop",
+        "abcdefghijklmnoq",
+        "b",
+        "\xff\xfe",
+        "zzzzzzzzzzzz",
+    };
+    // enough rows to span more than one 64-row block
+    for (int i = 0; i < 150; ++i) {
+        rows.push_back("key_" + std::to_string(i * 7919 % 1000));
+    }
+    return rows;
+}
+
+}  // namespace
+
+TEST(StringChunkKernelsTest, CompareSameAsStringView) {
+    StringRows rows(TestRows());
+    std::vector<std::string> vals = {"",
+                                     "a",
+                                     "abc",
+                                     "abcdefgh",
+                                     "abcdefghi",
+                                     "abcdefghijklmnop",
+                                     "key_5",
+                                     "key_500",
+                                     "\xff"};
+    std::vector<OpType> ops = {OpType::Equal,
+                               OpType::NotEqual,
+                               OpType::GreaterThan,
+                               OpType::GreaterEqual,
+                               OpType::LessThan,
+                               OpType::LessEqual,
+                               OpType::PrefixMatch};
+    for (auto op : ops) {
+        ASSERT_TRUE(IsStringChunkCompareOp(op));
+        for (const auto& val : vals) {
+            TargetBitmap res(rows.size(), false);
+            StringChunkCompare(rows.data.data(),
+                               rows.offsets.data(),
+                               rows.size(),
+                               op,
+                               val,
+                               TargetBitmapView(),
+                               TargetBitmapView(res.data(), res.size()));
+            for (int i = 0; i < rows.size(); ++i) {
+                std::string_view row = rows.rows[i];
+                bool expected = false;
+                switch (op) {
+                    case OpType::Equal:
+                        expected = row == val;
+                        break;
+                    case OpType::NotEqual:
+                        expected = row != val;
+                        break;
+                    case OpType::GreaterThan:
+                        expected = row > val;
+                        break;
+                    case OpType::GreaterEqual:
+                        expected = row >= val;
+                        break;
+                    case OpType::LessThan:
+                        expected = row < val;
+                        break;
+                    case OpType::LessEqual:
+                        expected = row <= val;
+                        break;
+                    default:
+                        expected = row.substr(0, val.size()) == val;
+                }
+                EXPECT_EQ(res[i], expected)
+                    << "op: " << op << ", val: " << val << ", row: " << row;
+            }
+        }
+    }
+    EXPECT_FALSE(IsStringChunkCompareOp(OpType::InnerMatch));
+}
+
+TEST(StringChunkKernelsTest, RangeAndActiveRows) {
+    StringRows rows(TestRows());
+    TargetBitmap active(rows.size());
+    for (int i = 0; i < rows.size(); i += 3) {
+        active.set(i);
+    }
+    TargetBitmap res(rows.size(), false);
+    StringChunkRange(rows.data.data(),
+                     rows.offsets.data(),
+                     rows.size(),
+                     "abc",
+                     true,
+                     "key_5",
+                     false,
+                     TargetBitmapView(active.data(), active.size()),
+                     TargetBitmapView(res.data(), res.size()));
+    for (int i = 0; i < rows.size(); ++i) {
+        std::string_view row = rows.rows[i];
+        bool expected = i % 3 == 0 && row >= "abc" && row < "key_5";
+        EXPECT_EQ(res[i], expected) << "row: " << row;
+    }
+}
+
+TEST(StringChunkKernelsTest, TermSetProbe) {
+    StringRows rows(TestRows());
+    std::vector<std::string> vals = {"",
+                                     "abcdefgh",
+                                     "abcdefghijklmnoq",
+                                     "key_0",
+                                     "key_7",
+                                     "key_999",
+                                     "key_7",
+                                     "missing"};
+    StringTermSet term_set(vals);
+    EXPECT_EQ(term_set.size(), vals.size() - 1);
+
+    TargetBitmap res(rows.size(), false);
+    term_set.Probe(rows.data.data(),
+                   rows.offsets.data(),
+                   rows.size(),
+                   TargetBitmapView(),
+                   TargetBitmapView(res.data(), res.size()));
+    for (int i = 0; i < rows.size(); ++i) {
+        const auto& row = rows.rows[i];
+        bool expected =
+            std::find(vals.begin(), vals.end(), row) != vals.end();
+        EXPECT_EQ(res[i], expected) << "row: " << row;
+        EXPECT_EQ(term_set.Contains(row), expected);
+    }
+}
@@ -1172,6 +1172,48 @@ PhyTermFilterExpr::ExecVisitorImplForData(EvalCtx& context) {
                 op_ctx, field_id, chunk_id, *elements);
         };
 
+    if constexpr (std::is_same_v<T, std::string_view>) {
+        if (!has_offset_input_ && !expr_->column_.element_level_ &&
+            StringChunkSegment() != nullptr) {
+            if (str_term_set_ == nullptr) {
+                std::vector<std::string> str_vals;
+                str_vals.reserve(expr_->vals_.size());
+                for (const auto& val : expr_->vals_) {
+                    str_vals.emplace_back(GetValueFromProto<std::string>(val));
+                }
+                str_term_set_ = std::make_shared<StringTermSet>(str_vals);
+            }
+            const auto& term_set = *str_term_set_;
+            auto probe_chunk = [&](const char* data,
+                                   const uint32_t* offsets,
+                                   const bool* valid_data,
+                                   const int size,
+                                   TargetBitmapView res,
+                                   TargetBitmapView valid_res) {
+                if (data == nullptr) {
+                    processed_cursor += size;
+                    return;
+                }
+                auto active = bitmap_input.empty()
+                                  ? TargetBitmapView()
+                                  : bitmap_input.view(processed_cursor, size);
+                term_set.Probe(data, offsets, size, active, res);
+                ApplyValidMask(valid_data, res, valid_res, size);
+                processed_cursor += size;
+            };
+            auto processed_size = ProcessStringChunks(
+                probe_chunk, skip_index_func, res, valid_res);
+            if (processed_size >= 0) {
+                AssertInfo(processed_size == real_batch_size,
+                           "internal error: expr processed rows {} not equal "
+                           "expect batch size {}",
+                           processed_size,
+                           real_batch_size);
+                return res_vec;
+            }
+        }
+    }
+
     int64_t processed_size;
     if (has_offset_input_) {
         if (expr_->column_.element_level_) {
@@ -25,6 +25,7 @@
 #include "common/Vector.h"
 #include "exec/expression/Expr.h"
 #include "exec/expression/Element.h"
+#include "exec/expression/StringChunkKernels.h"
 #include "segcore/SegmentInterface.h"
 #include "index/json_stats/bson_inverted.h"
 #include "cachinglayer/CacheSlot.h"
@@ -183,6 +184,9 @@ class PhyTermFilterExpr : public SegmentExpr {
     // variant construction. Set once during init; nullptr when arg_set_ is not
     // SetElement<string> (e.g. FlatVectorElement for small IN).
     SetElement<std::string>* cached_str_set_elem_{nullptr};
+    // IN values of a string field, probed straight over sealed StringChunk
+    // buffers. Built on the first batch that takes that path.
+    std::shared_ptr<StringTermSet> str_term_set_;
     // Cached element values for skip_index (avoids per-chunk vector copy).
     std::any cached_skip_elements_;
 };
@@ -46,6 +46,7 @@
 #include "common/type_c.h"
 #include "exec/expression/ExprCache.h"
 #include "exec/expression/ExprCacheHelper.h"
+#include "exec/expression/StringChunkKernels.h"
 #include "fmt/core.h"
 #include "folly/FBVector.h"
 #include "glog/logging.h"
@@ -247,6 +248,7 @@ PhyUnaryRangeFilterExpr::Eval(EvalCtx& context, VectorPtr& result) {
                 // If nullopt is returned, it means the query cannot be
                 // optimized by ngram index. Forward it to the normal path.
                 if (res.has_value()) {
+                    ngram_matched_ = true;
                     result = res.value();
                     break;
                 }
@@ -769,7 +771,7 @@ PhyUnaryRangeFilterExpr::ExecRangeVisitorImplJson(EvalCtx& context) {
 #define UnaryRangeJSONCompare(cmp)                                     \
     do {                                                               \
         if constexpr (std::is_same_v<GetType, int64_t>) {              \
-            auto x_num = data[offset].at_numeric(pointer);             \
+            auto x_num = rows.row(offset).at_numeric(rows.pointer());  \
             if (x_num.error()) {                                       \
                 res[i] = valid_res[i] = false;                         \
                 break;                                                 \
@@ -785,7 +787,8 @@ PhyUnaryRangeFilterExpr::ExecRangeVisitorImplJson(EvalCtx& context) {
                 res[i] = (cmp);                                        \
             }                                                          \
         } else {                                                       \
-            auto x = data[offset].template at<GetType>(pointer);       \
+            auto x =                                                   \
+                rows.row(offset).template at<GetType>(rows.pointer()); \
             if (x.error()) {                                           \
                 res[i] = valid_res[i] = false;                         \
                 break;                                                 \
@@ -797,7 +800,7 @@ PhyUnaryRangeFilterExpr::ExecRangeVisitorImplJson(EvalCtx& context) {
 
     int processed_cursor = 0;
     auto execute_sub_batch =
-        [ op_type, pointer, &processed_cursor, &
+        [ this, op_type, pointer, &processed_cursor, &
           bitmap_input ]<FilterType filter_type = FilterType::sequential>(
             const milvus::Json* data,
             const bool* valid_data,
@@ -806,6 +809,7 @@ PhyUnaryRangeFilterExpr::ExecRangeVisitorImplJson(EvalCtx& context) {
             TargetBitmapView res,
             TargetBitmapView valid_res,
             ExprValueType val) {
+        auto rows = MakeJsonPathRows<filter_type>(data, size, pointer);
         bool has_bitmap_input = !bitmap_input.empty();
         switch (op_type) {
             case proto::plan::GreaterThan: {
@@ -911,8 +915,9 @@ PhyUnaryRangeFilterExpr::ExecRangeVisitorImplJson(EvalCtx& context) {
                         continue;
                     }
                     if constexpr (std::is_same_v<GetType, proto::plan::Array>) {
-                        auto doc = data[offset].doc();
-                        auto array = doc.at_pointer(pointer).get_array();
+                        auto doc = rows.row(offset).doc();
+                        auto array =
+                            doc.at_pointer(rows.pointer()).get_array();
                         if (array.error()) {
                             res[i] = valid_res[i] = false;
                             continue;
@@ -939,8 +944,9 @@ PhyUnaryRangeFilterExpr::ExecRangeVisitorImplJson(EvalCtx& context) {
                         continue;
                     }
                     if constexpr (std::is_same_v<GetType, proto::plan::Array>) {
-                        auto doc = data[offset].doc();
-                        auto array = doc.at_pointer(pointer).get_array();
+                        auto doc = rows.row(offset).doc();
+                        auto array =
+                            doc.at_pointer(rows.pointer()).get_array();
                         if (array.error()) {
                             res[i] = valid_res[i] = false;
                             continue;
@@ -1415,6 +1421,7 @@ PhyUnaryRangeFilterExpr::ExecRangeVisitorImpl(EvalCtx& context) {
         // If nullopt is returned, it means the query cannot be
         // optimized by ngram index. Forward it to the normal path.
         if (res.has_value()) {
+            ngram_matched_ = true;
             return res.value();
         }
     }
@@ -1696,6 +1703,23 @@ PhyUnaryRangeFilterExpr::ExecRangeVisitorImplForData(EvalCtx& context) {
             processed_cursor += size;
             return;
         }
+        // Numeric comparisons apply bitmap_input and valid_data in the same
+        // pass as the compare instead of masking the result afterwards.
+        if constexpr (filter_type == FilterType::sequential &&
+                      (std::is_integral_v<T> || std::is_floating_point_v<T>)) {
+            if (BatchUnaryCompareMasked<T>(data,
+                                           size,
+                                           val,
+                                           expr_type,
+                                           res,
+                                           valid_res,
+                                           bitmap_input,
+                                           processed_cursor,
+                                           valid_data)) {
+                processed_cursor += size;
+                return;
+            }
+        }
         switch (expr_type) {
             case proto::plan::GreaterThan: {
                 UnaryElementFunc<T, proto::plan::GreaterThan, filter_type> func;
@@ -1857,6 +1881,46 @@ PhyUnaryRangeFilterExpr::ExecRangeVisitorImplForData(EvalCtx& context) {
                 op_ctx, field_id, chunk_id, expr_type, val);
         };
 
+    if constexpr (std::is_same_v<T, std::string_view>) {
+        if (!has_offset_input_ && !expr_->column_.element_level_ &&
+            IsStringChunkCompareOp(expr_type)) {
+            auto compare_chunk = [&](const char* data,
+                                     const uint32_t* offsets,
+                                     const bool* valid_data,
+                                     const int size,
+                                     TargetBitmapView res,
+                                     TargetBitmapView valid_res) {
+                if (data == nullptr) {
+                    processed_cursor += size;
+                    return;
+                }
+                auto active = bitmap_input.empty()
+                                  ? TargetBitmapView()
+                                  : bitmap_input.view(processed_cursor, size);
+                StringChunkCompare(
+                    data, offsets, size, expr_type, val, active, res);
+                if (valid_data != nullptr) {
+                    for (int i = 0; i < size; i++) {
+                        if ((active.empty() || active[i]) && !valid_data[i]) {
+                            res[i] = valid_res[i] = false;
+                        }
+                    }
+                }
+                processed_cursor += size;
+            };
+            auto processed_size = ProcessStringChunks(
+                compare_chunk, skip_index_func, res, valid_res);
+            if (processed_size >= 0) {
+                AssertInfo(processed_size == real_batch_size,
+                           "internal error: expr processed rows {} not equal "
+                           "expect batch size {}",
+                           processed_size,
+                           real_batch_size);
+                return res_vec;
+            }
+        }
+    }
+
     int64_t processed_size;
     if (has_offset_input_) {
         if (expr_->column_.element_level_) {
@@ -747,6 +747,53 @@ struct UnaryIndexFunc {
     }
 };
 
+// Numeric `src[i] <op> val` restricted to the active rows of bitmap_input
+// (from start_cursor on) and to the non-null rows of valid_data, in a single
+// pass over the column. Active null rows are also cleared in valid_res.
+// Returns false if op_type is not a plain comparison.
+template <typename T>
+bool
+BatchUnaryCompareMasked(const T* src,
+                        size_t size,
+                        const T& val,
+                        proto::plan::OpType op_type,
+                        TargetBitmapView res,
+                        TargetBitmapView valid_res,
+                        const TargetBitmap& bitmap_input,
+                        size_t start_cursor,
+                        const bool* valid_data) {
+    using milvus::bitset::CompareOpType;
+    CompareOpType cmp_op;
+    switch (op_type) {
+        case proto::plan::GreaterThan:
+            cmp_op = CompareOpType::GT;
+            break;
+        case proto::plan::GreaterEqual:
+            cmp_op = CompareOpType::GE;
+            break;
+        case proto::plan::LessThan:
+            cmp_op = CompareOpType::LT;
+            break;
+        case proto::plan::LessEqual:
+            cmp_op = CompareOpType::LE;
+            break;
+        case proto::plan::Equal:
+            cmp_op = CompareOpType::EQ;
+            break;
+        case proto::plan::NotEqual:
+            cmp_op = CompareOpType::NE;
+            break;
+        default:
+            return false;
+    }
+    auto active = bitmap_input.empty()
+                      ? TargetBitmapView()
+                      : bitmap_input.view(start_cursor, size);
+    res.inplace_compare_val_masked<T>(
+        src, size, val, cmp_op, active, valid_data, valid_res);
+    return true;
+}
+
 template <typename T, typename U>
 void
 BatchUnaryCompare(const T* src,
@@ -1081,6 +1128,11 @@ class PhyUnaryRangeFilterExpr : public SegmentExpr {
     bool
     CanUseNgramIndex() const override;
 
+    std::string
+    ExecPathName() const override {
+        return ngram_matched_ ? "NgramIndex" : SegmentExpr::ExecPathName();
+    }
+
     // Execute ngram Phase1 only (index query), ANDs result into candidates
     // Requires: CanUseNgramIndex() == true
     // Requires: candidates must be non-empty (caller initializes with all-true,
@@ -1172,6 +1224,8 @@ class PhyUnaryRangeFilterExpr : public SegmentExpr {
     bool arg_inited_{false};
     SingleElement value_arg_;
     PinWrapper<index::NgramInvertedIndex*> pinned_ngram_index_{nullptr};
+    // set once a batch was answered by the ngram index
+    bool ngram_matched_{false};
     PinWrapper<index::BsonInvertedIndex*> bson_index_{nullptr};
     bool enable_sub_expr_cache_write_{true};
 
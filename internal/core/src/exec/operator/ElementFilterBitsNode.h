@@ -87,6 +87,13 @@ class PhyElementFilterBitsNode : public Operator {
         return "PhyElementFilterBitsNode";
     }
 
+    void
+    CollectExprProfiles(std::vector<ExprProfile>& profiles) const override {
+        if (element_exprs_) {
+            element_exprs_->CollectProfiles(profiles);
+        }
+    }
+
  private:
     std::pair<TargetBitmap, TargetBitmap>
     EvaluateElementExpression(const TargetBitmapView& doc_bitset,
@@ -23,6 +23,7 @@
 #include <vector>
 
 #include "common/EasyAssert.h"
+#include "common/FilterResult.h"
 #include "common/Tracer.h"
 #include "common/Types.h"
 #include "exec/QueryContext.h"
@@ -53,6 +54,16 @@ BuildExprCacheKey(const plan::FilterBitsNode& filter,
     return key;
 }
 
+// Hands the rows a selective filter keeps to MvccNode in sparse form.
+void
+PublishFilterResult(QueryContext* query_context,
+                    const TargetBitmapView& excluded) {
+    auto sparse = FilterResult::SparseFromExcluded(excluded);
+    query_context->set_filter_result(
+        sparse.has_value() ? std::make_shared<FilterResult>(std::move(*sparse))
+                           : nullptr);
+}
+
 }  // namespace
 
 bool
@@ -147,7 +158,10 @@ PhyFilterBitsNode::GetOutput() {
         if (ExprResCacheManager::Instance().Get(key, cached) &&
             cached.result != nullptr &&
             cached.result->size() == need_process_rows_) {
+            ++runtime_stats_.cache_hits;
             num_processed_rows_ = need_process_rows_;
+            PublishFilterResult(query_context_,
+                                TargetBitmapView(*cached.result));
             std::vector<VectorPtr> col_res;
             col_res.push_back(std::make_shared<ColumnVector>(
                 cached.result->clone(),
@@ -195,6 +209,7 @@ PhyFilterBitsNode::GetOutput() {
                    "bitset size: {}, need_process_rows_: {}",
                    col_vec_size,
                    need_process_rows_);
+        PublishFilterResult(query_context_, view);
 
         if (can_use_cache) {
             ExprResCacheManager::Key key{cache_segment->get_segment_id(),
@@ -256,6 +271,7 @@ PhyFilterBitsNode::GetOutput() {
                bitset.size(),
                need_process_rows_);
     Assert(valid_bitset.size() == need_process_rows_);
+    PublishFilterResult(query_context_, bitset_view);
 
     // Cache write: clone bitset into ExprResCacheManager — Stage 1 of two-stage
     // search. Must clone before move since Stage 1 still owns the bitset for
@@ -79,6 +79,13 @@ class PhyFilterBitsNode : public Operator {
         return "PhyFilterBitsNode";
     }
 
+    void
+    CollectExprProfiles(std::vector<ExprProfile>& profiles) const override {
+        if (exprs_) {
+            exprs_->CollectProfiles(profiles);
+        }
+    }
+
     void
     PrefetchAsync(const std::shared_ptr<folly::CPUThreadPoolExecutor>
                       prefetch_pool) override {
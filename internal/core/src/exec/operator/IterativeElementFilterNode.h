@@ -79,6 +79,13 @@ class PhyIterativeElementFilterNode : public Operator {
         return "PhyIterativeElementFilterNode";
     }
 
+    void
+    CollectExprProfiles(std::vector<ExprProfile>& profiles) const override {
+        if (element_exprs_) {
+            element_exprs_->CollectProfiles(profiles);
+        }
+    }
+
  private:
     void
     CollectResults(SearchResult& search_result,
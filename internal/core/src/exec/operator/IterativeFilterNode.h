@@ -76,6 +76,13 @@ class PhyIterativeFilterNode : public Operator {
         return "PhyIterativeFilterNode";
     }
 
+    void
+    CollectExprProfiles(std::vector<ExprProfile>& profiles) const override {
+        if (exprs_) {
+            exprs_->CollectProfiles(profiles);
+        }
+    }
+
  private:
     std::unique_ptr<ExprSet> exprs_;
     QueryContext* query_context_;
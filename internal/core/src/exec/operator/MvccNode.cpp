@@ -37,7 +37,7 @@ PhyMvccNode::PhyMvccNode(int32_t operator_id,
                mvcc_node->output_type(),
                operator_id,
                mvcc_node->id(),
-               "PhyIterativeFilterNode") {
+               "PhyMvccNode") {
     ExecContext* exec_context = operator_context_->get_exec_context();
     QueryContext* query_context = exec_context->get_query_context();
     segment_ = query_context->get_segment();
@@ -124,6 +124,11 @@ PhyMvccNode::GetOutput() {
     segment_->mask_with_timestamps(
         data, query_timestamp_, collection_ttl_timestamp_);
     segment_->mask_with_delete(data, active_count_, query_timestamp_);
+    if (const auto& filter_result = query_context->get_filter_result()) {
+        // a sparse filter result only tests its kept rows against the masks
+        filter_result->MaskExcluded(data);
+        filter_result->Compact();
+    }
     is_finished_ = true;
 
     // input_ have already been updated
@@ -22,5 +22,17 @@ void
 Operator::initialize() {
     // TODO check memory and set up memory pool in the future
 }
+
+OperatorProfile
+Operator::GetProfile() const {
+    OperatorProfile profile;
+    profile.operator_id = get_operator_id();
+    profile.plan_node_id = get_plannode_id();
+    profile.operator_type = get_operator_type();
+    profile.exec_path = ExecPathName();
+    profile.stats = runtime_stats_;
+    CollectExprProfiles(profile.exprs);
+    return profile;
+}
 }  // namespace exec
 }  // namespace milvus
@@ -21,6 +21,7 @@
 #include <vector>
 
 #include "common/EasyAssert.h"
+#include "common/QueryProfile.h"
 #include "common/Types.h"
 #include "common/Vector.h"
 #include "exec/Driver.h"
@@ -182,9 +183,32 @@ class Operator : public std::enable_shared_from_this<Operator> {
     WaitPrefetch() {
     }
 
+    RuntimeStats&
+    runtime_stats() {
+        return runtime_stats_;
+    }
+
+    // How the operator produced its output, e.g. whether a filter was served
+    // from the expression result cache. Empty when there is nothing to tell.
+    virtual std::string
+    ExecPathName() const {
+        return "";
+    }
+
+    // Append the runtime stats of the expressions evaluated by this
+    // operator. Must be called before Close(), which drops them.
+    virtual void
+    CollectExprProfiles(std::vector<ExprProfile>& profiles) const {
+    }
+
+    OperatorProfile
+    GetProfile() const;
+
  protected:
     std::unique_ptr<OperatorContext> operator_context_;
 
+    RuntimeStats runtime_stats_;
+
     RowTypePtr output_type_;
 
     RowVectorPtr input_;
@@ -18,6 +18,8 @@
 
 #include <algorithm>
 #include <optional>
+#include <string>
+#include <type_traits>
 #include <utility>
 
 #include "common/Consts.h"
@@ -27,7 +29,10 @@
 #include "exec/QueryContext.h"
 #include "exec/expression/Utils.h"
 #include "exec/operator/Operator.h"
+#include "index/ScalarIndex.h"
+#include "log/Log.h"
 #include "plan/PlanNode.h"
+#include "segcore/ChunkedSegmentSealedImpl.h"
 #include "segcore/InsertRecord.h"
 #include "segcore/SegmentInterface.h"
 #include "segcore/Utils.h"
@@ -79,6 +84,275 @@ SelectOffsets(const TargetBitmapView& raw_data_view,
     return selected;
 }
 
+// The pushdowns below pick rows straight from the filter bitmap. Only a
+// sealed segment sorted by pk selects rows that way too; the others keep one
+// row per pk through find_first_n, so a pushdown could return the rows of a
+// duplicated pk that the full projection drops.
+bool
+CanPushDownRowSelection(const segcore::SegmentInternalInterface* segment) {
+    auto sealed =
+        dynamic_cast<const segcore::ChunkedSegmentSealedImpl*>(segment);
+    return sealed != nullptr && sealed->is_sorted_by_pk();
+}
+
+template <typename T>
+std::optional<SelectedOffsets>
+ScanIndexInOrder(const index::IndexBase* index,
+                 const plan::OrderedScan& ordered_scan,
+                 const TargetBitmapView& raw_data_view,
+                 bool nullable) {
+    auto scalar_index = dynamic_cast<const index::ScalarIndex<T>*>(index);
+    if (scalar_index == nullptr || !scalar_index->SupportOrderedScan()) {
+        return std::nullopt;
+    }
+
+    auto limit = static_cast<size_t>(ordered_scan.limit);
+    auto active_count = static_cast<int64_t>(raw_data_view.size());
+    SelectedOffsets selected;
+    auto& offsets = selected.row_offsets;
+    // returns false once enough rows are taken
+    auto take = [&](int64_t offset) {
+        if (offset < active_count && !raw_data_view[offset]) {
+            offsets.push_back(offset);
+        }
+        return offsets.size() < limit;
+    };
+    auto take_nulls = [&]() {
+        if (nullable && offsets.size() < limit) {
+            scalar_index->VisitNullsInOrder(take);
+        }
+    };
+
+    if (ordered_scan.nulls_first) {
+        take_nulls();
+    }
+    if (offsets.size() < limit) {
+        scalar_index->VisitInValueOrder(ordered_scan.ascending, take);
+    }
+    if (!ordered_scan.nulls_first) {
+        take_nulls();
+    }
+    return selected;
+}
+
+// Selects at most ordered_scan.limit matching rows in sort order by walking a
+// sorted scalar index on the sort field, so the rows after the limit are
+// never projected. Returns nullopt if the field has no such index.
+std::optional<SelectedOffsets>
+SelectOffsetsInIndexOrder(const plan::OrderedScan& ordered_scan,
+                          const TargetBitmapView& raw_data_view,
+                          const segcore::SegmentInternalInterface* segment,
+                          OpContext* op_ctx) {
+    auto field_id = ordered_scan.field_id;
+    if (!segment->is_field_exist(field_id)) {
+        return std::nullopt;
+    }
+    auto pinned = segment->PinIndex(op_ctx, field_id);
+    if (pinned.size() != 1) {
+        return std::nullopt;
+    }
+    auto index = pinned[0].get();
+    auto& field_meta = segment->get_schema()[field_id];
+    auto nullable = field_meta.is_nullable();
+    switch (field_meta.get_data_type()) {
+        case DataType::BOOL:
+            return ScanIndexInOrder<bool>(
+                index, ordered_scan, raw_data_view, nullable);
+        case DataType::INT8:
+            return ScanIndexInOrder<int8_t>(
+                index, ordered_scan, raw_data_view, nullable);
+        case DataType::INT16:
+            return ScanIndexInOrder<int16_t>(
+                index, ordered_scan, raw_data_view, nullable);
+        case DataType::INT32:
+            return ScanIndexInOrder<int32_t>(
+                index, ordered_scan, raw_data_view, nullable);
+        case DataType::INT64:
+        case DataType::TIMESTAMPTZ:
+            return ScanIndexInOrder<int64_t>(
+                index, ordered_scan, raw_data_view, nullable);
+        case DataType::FLOAT:
+            return ScanIndexInOrder<float>(
+                index, ordered_scan, raw_data_view, nullable);
+        case DataType::DOUBLE:
+            return ScanIndexInOrder<double>(
+                index, ordered_scan, raw_data_view, nullable);
+        case DataType::VARCHAR:
+        case DataType::STRING:
+            return ScanIndexInOrder<std::string>(
+                index, ordered_scan, raw_data_view, nullable);
+        default:
+            return std::nullopt;
+    }
+}
+
+// Finds a matching row holding the smallest (or largest) non-null value of
+// the field by walking a sorted scalar index. Returns false if the index
+// can't be walked in order.
+template <typename T>
+bool
+FindExtremeRowByIndex(const index::IndexBase* index,
+                      bool is_max,
+                      const TargetBitmapView& raw_data_view,
+                      std::optional<int64_t>& row) {
+    auto scalar_index = dynamic_cast<const index::ScalarIndex<T>*>(index);
+    if (scalar_index == nullptr || !scalar_index->SupportOrderedScan()) {
+        return false;
+    }
+    auto active_count = static_cast<int64_t>(raw_data_view.size());
+    scalar_index->VisitInValueOrder(!is_max, [&](int64_t offset) {
+        if (offset < active_count && !raw_data_view[offset]) {
+            row = offset;
+            return false;
+        }
+        return true;
+    });
+    return true;
+}
+
+// Same as FindExtremeRowByIndex, by scanning the raw chunks. A chunk is
+// skipped when its zone map proves that no value in it beats the best one
+// found so far. Returns false if the segment has no raw data of the field.
+template <typename T>
+bool
+FindExtremeRowByScan(const segcore::SegmentInternalInterface* segment,
+                     OpContext* op_ctx,
+                     FieldId field_id,
+                     bool is_max,
+                     const TargetBitmapView& raw_data_view,
+                     std::optional<int64_t>& row) {
+    if (!segment->HasFieldData(field_id)) {
+        return false;
+    }
+    auto& skip_index = segment->GetSkipIndex();
+    auto better_op = is_max ? OpType::GreaterThan : OpType::LessThan;
+    auto active_count = static_cast<int64_t>(raw_data_view.size());
+    std::optional<T> best;
+    auto num_chunks = segment->num_chunk_data(field_id);
+    for (int64_t chunk_id = 0; chunk_id < num_chunks; ++chunk_id) {
+        auto begin = segment->num_rows_until_chunk(field_id, chunk_id);
+        if (begin >= active_count) {
+            break;
+        }
+        if (best.has_value() &&
+            skip_index.CanSkipUnaryRange<T>(
+                op_ctx, field_id, chunk_id, better_op, *best)) {
+            continue;
+        }
+        auto pw = segment->chunk_data<T>(op_ctx, field_id, chunk_id);
+        auto chunk = pw.get();
+        const T* data = chunk.data();
+        const bool* valid_data = chunk.valid_data();
+        auto rows = std::min<int64_t>(chunk.row_count(), active_count - begin);
+        for (int64_t i = 0; i < rows; ++i) {
+            if (raw_data_view[begin + i] ||
+                (valid_data != nullptr && !valid_data[i])) {
+                continue;
+            }
+            if (!best.has_value() ||
+                (is_max ? data[i] > *best : data[i] < *best)) {
+                best = data[i];
+                row = begin + i;
+            }
+        }
+    }
+    return true;
+}
+
+template <typename T>
+bool
+FindExtremeRow(const segcore::SegmentInternalInterface* segment,
+               OpContext* op_ctx,
+               const plan::ExtremeValueScan& scan,
+               const TargetBitmapView& raw_data_view,
+               std::optional<int64_t>& row) {
+    auto pinned = segment->PinIndex(op_ctx, scan.field_id);
+    if (pinned.size() == 1 &&
+        FindExtremeRowByIndex<T>(
+            pinned[0].get(), scan.is_max, raw_data_view, row)) {
+        return true;
+    }
+    if constexpr (std::is_arithmetic_v<T> && !std::is_same_v<T, bool>) {
+        return FindExtremeRowByScan<T>(segment,
+                                       op_ctx,
+                                       scan.field_id,
+                                       scan.is_max,
+                                       raw_data_view,
+                                       row);
+    }
+    return false;
+}
+
+// Selects, for every min/max aggregate, one matching row holding the extreme
+// value of its field. Aggregating over these rows gives the same min and max
+// as aggregating over all matching rows. Returns nullopt if some field can't
+// be served from an index or a chunk scan.
+std::optional<SelectedOffsets>
+SelectExtremeRows(const std::vector<plan::ExtremeValueScan>& scans,
+                  const TargetBitmapView& raw_data_view,
+                  const segcore::SegmentInternalInterface* segment,
+                  OpContext* op_ctx) {
+    SelectedOffsets selected;
+    auto& offsets = selected.row_offsets;
+    for (const auto& scan : scans) {
+        if (!segment->is_field_exist(scan.field_id)) {
+            return std::nullopt;
+        }
+        std::optional<int64_t> row;
+        bool found;
+        switch (segment->get_schema()[scan.field_id].get_data_type()) {
+            case DataType::INT8:
+                found = FindExtremeRow<int8_t>(
+                    segment, op_ctx, scan, raw_data_view, row);
+                break;
+            case DataType::INT16:
+                found = FindExtremeRow<int16_t>(
+                    segment, op_ctx, scan, raw_data_view, row);
+                break;
+            case DataType::INT32:
+                found = FindExtremeRow<int32_t>(
+                    segment, op_ctx, scan, raw_data_view, row);
+                break;
+            case DataType::INT64:
+            case DataType::TIMESTAMPTZ:
+                found = FindExtremeRow<int64_t>(
+                    segment, op_ctx, scan, raw_data_view, row);
+                break;
+            case DataType::FLOAT:
+                found = FindExtremeRow<float>(
+                    segment, op_ctx, scan, raw_data_view, row);
+                break;
+            case DataType::DOUBLE:
+                found = FindExtremeRow<double>(
+                    segment, op_ctx, scan, raw_data_view, row);
+                break;
+            case DataType::VARCHAR:
+            case DataType::STRING:
+                found = FindExtremeRow<std::string>(
+                    segment, op_ctx, scan, raw_data_view, row);
+                break;
+            default:
+                found = false;
+        }
+        if (!found) {
+            return std::nullopt;
+        }
+        if (row.has_value()) {
+            offsets.push_back(*row);
+        }
+    }
+    // Matching rows whose aggregated fields are all null still make the
+    // aggregation emit a row of nulls.
+    if (offsets.empty()) {
+        if (auto first = raw_data_view.find_first(false); first.has_value()) {
+            offsets.push_back(*first);
+        }
+    }
+    std::sort(offsets.begin(), offsets.end());
+    offsets.erase(std::unique(offsets.begin(), offsets.end()), offsets.end());
+    return selected;
+}
+
 ColumnVectorPtr
 MakeInt64Column(const std::vector<int64_t>& values) {
     auto selected_count = values.size();
@@ -118,6 +392,9 @@ PhyProjectNode::PhyProjectNode(
                projectNode->id(),
                "Project"),
       fields_to_project_(projectNode->FieldsToProject()),
+      ordered_scan_(projectNode->GetOrderedScan()),
+      extreme_value_scans_(projectNode->GetExtremeValueScans()),
+      keep_row_count_(projectNode->KeepRowCount()),
       query_context_(nullptr),
       op_context_(nullptr) {
     auto exec_context = operator_context_->get_exec_context();
@@ -159,7 +436,25 @@ PhyProjectNode::GetOutput() {
         return row_vector;
     }
 
-    auto selected = SelectOffsets(raw_data_view, query_context_, segment_);
+    std::optional<SelectedOffsets> pushed_down;
+    if (!query_context_->bitset_is_element_level() &&
+        CanPushDownRowSelection(segment_)) {
+        if (ordered_scan_.has_value()) {
+            pushed_down = SelectOffsetsInIndexOrder(
+                *ordered_scan_, raw_data_view, segment_, op_context_);
+        } else if (!extreme_value_scans_.empty()) {
+            pushed_down = SelectExtremeRows(
+                extreme_value_scans_, raw_data_view, segment_, op_context_);
+        }
+        if (pushed_down.has_value()) {
+            LOG_DEBUG("ProjectNode: projecting {} rows picked by pushdown",
+                      pushed_down->row_offsets.size());
+        }
+    }
+    auto selected =
+        pushed_down.has_value()
+            ? std::move(*pushed_down)
+            : SelectOffsets(raw_data_view, query_context_, segment_);
     auto& selected_offsets = selected.row_offsets;
     auto& selected_element_indices = selected.element_indices;
     auto selected_count = selected_offsets.size();
@@ -216,6 +511,16 @@ PhyProjectNode::GetOutput() {
             std::move(field_data), std::move(valid_map), null_count);
         column_vectors.emplace_back(std::move(column_vector));
     }
+    // The picked rows stand in for every matching row; rows of nulls make up
+    // the difference, which leaves min and max as they are and count(*) exact.
+    if (pushed_down.has_value() && keep_row_count_) {
+        auto matching_count =
+            static_cast<int64_t>(col_input->size()) - raw_data_view.count();
+        for (auto& column_vector : column_vectors) {
+            std::static_pointer_cast<ColumnVector>(column_vector)
+                ->resize(matching_count, /*setNotNull=*/false);
+        }
+    }
     is_finished_ = true;
     auto row_vector = std::make_shared<RowVector>(std::move(column_vectors));
     return row_vector;
@@ -72,6 +72,12 @@ class PhyProjectNode : public Operator {
     const segcore::SegmentInternalInterface* segment_;
     bool is_finished_{false};
     const std::vector<FieldId> fields_to_project_;
+    // set below a single-key ORDER BY ... LIMIT, see plan::OrderedScan
+    const std::optional<plan::OrderedScan> ordered_scan_;
+    // set below a global min/max aggregation, see plan::ExtremeValueScan
+    const std::vector<plan::ExtremeValueScan> extreme_value_scans_;
+    // pad the rows picked by extreme_value_scans_ to the matching row count
+    const bool keep_row_count_;
     QueryContext* query_context_;
     OpContext* op_context_;
 };
@@ -43,6 +43,10 @@ namespace exec {
  *
  * The operator delegates all sorting logic to SortBuffer, keeping the
  * operator itself thin and focused on the Operator interface contract.
+ *
+ * For a single sort key with a limit, the ProjectNode below may already
+ * have picked at most `limit` rows by walking a sorted scalar index on the
+ * key (see plan::OrderedScan), so the buffer only sorts those.
  */
 class PhyQueryOrderByNode : public Operator {
  public:
@@ -0,0 +1,171 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "exec/operator/SearchResultCache.h"
+
+#include <utility>
+
+#include <fmt/core.h>
+
+#include "log/Log.h"
+#include "segcore/SegmentInterface.h"
+#include "xxhash.h"
+
+namespace milvus {
+namespace exec {
+
+namespace {
+
+// Hash the filter bitset handed to the index. Trailing bits of the last byte
+// past size() are not guaranteed to be zero, so they are masked out.
+uint64_t
+HashBitsetView(const BitsetView& bitset) {
+    if (bitset.empty()) {
+        return 0;
+    }
+    const size_t num_bits = bitset.size();
+    const size_t full_bytes = num_bits / 8;
+    XXH3_state_t* state = XXH3_createState();
+    XXH3_64bits_reset(state);
+    XXH3_64bits_update(state, &num_bits, sizeof(num_bits));
+    XXH3_64bits_update(state, bitset.data(), full_bytes);
+    const size_t tail_bits = num_bits % 8;
+    if (tail_bits != 0) {
+        uint8_t tail = bitset.data()[full_bytes] & ((1u << tail_bits) - 1);
+        XXH3_64bits_update(state, &tail, sizeof(tail));
+    }
+    uint64_t hash = XXH3_64bits_digest(state);
+    XXH3_freeState(state);
+    // Reserve 0 for the "no bitset" case.
+    return hash == 0 ? 1 : hash;
+}
+
+}  // namespace
+
+void
+SearchResultCache::SetConfig(const SearchResultCacheConfig& config) {
+    std::lock_guard lock(mutex_);
+    config_ = config;
+    entries_.SetMaxBytes(config_.max_bytes);
+    LOG_INFO(
+        "SearchResultCache: config updated, max_bytes={}, "
+        "admission_threshold={}",
+        config_.max_bytes,
+        config_.admission_threshold);
+}
+
+std::optional<SearchResultCache::Key>
+SearchResultCache::MakeKey(const segcore::SegmentInternalInterface* segment,
+                           const SearchInfo& search_info,
+                           const query::Placeholder& placeholder,
+                           int64_t active_count,
+                           const BitsetView& bitset) {
+    if (segment == nullptr || placeholder.element_level_ ||
+        placeholder.blob_.empty() || !placeholder.offsets_.empty() ||
+        search_info.has_group_by() ||
+        search_info.iterator_v2_info_.has_value() ||
+        search_info.iterative_filter_execution ||
+        search_info.materialized_view_involved) {
+        return std::nullopt;
+    }
+
+    Key key;
+    key.segment_id = segment->get_segment_id();
+    key.active_count = active_count;
+    key.deleted_count = segment->get_deleted_count();
+    key.filter_hash = HashBitsetView(bitset);
+
+    // Field order is fixed; the query bytes go last so that the textual
+    // prefix cannot be confused with payload bytes.
+    auto& sig = key.signature;
+    sig = fmt::format("{}|{}|{}|{}|{}|{}|{}|",
+                      search_info.field_id_.get(),
+                      search_info.metric_type_,
+                      search_info.topk_,
+                      search_info.round_decimal_,
+                      segment->HasIndex(search_info.field_id_),
+                      placeholder.num_of_queries_,
+                      search_info.search_params_.dump());
+    sig.append(placeholder.blob_.data(), placeholder.blob_.size());
+    return key;
+}
+
+bool
+SearchResultCache::Get(const Key& key, SearchResult& out) {
+    std::lock_guard lock(mutex_);
+    auto* value = entries_.Get(key);
+    if (value == nullptr) {
+        return false;
+    }
+    out.total_nq_ = value->total_nq;
+    out.unity_topK_ = value->unity_topk;
+    out.distances_ = value->distances;
+    out.seg_offsets_ = value->seg_offsets;
+    return true;
+}
+
+void
+SearchResultCache::Put(const Key& key, const SearchResult& result) {
+    if (result.HasIterators() || result.HasGroupBy()) {
+        return;
+    }
+    uint64_t sig_hash = KeyHasher()(key);
+
+    std::lock_guard lock(mutex_);
+    if (!frequency_tracker_.RecordAndCheck(sig_hash,
+                                           config_.admission_threshold)) {
+        return;
+    }
+
+    Value value;
+    value.total_nq = result.total_nq_;
+    value.unity_topk = result.unity_topK_;
+    value.distances = result.distances_;
+    value.seg_offsets = result.seg_offsets_;
+    const size_t bytes = value.Bytes() + key.signature.capacity();
+    if (bytes > config_.max_bytes) {
+        return;
+    }
+    entries_.Put(key, std::move(value), bytes);
+}
+
+size_t
+SearchResultCache::EraseSegment(int64_t segment_id) {
+    std::lock_guard lock(mutex_);
+    return entries_.EraseSegment(segment_id);
+}
+
+void
+SearchResultCache::Clear() {
+    std::lock_guard lock(mutex_);
+    entries_.Clear();
+    frequency_tracker_.Reset();
+}
+
+size_t
+SearchResultCache::GetCurrentBytes() const {
+    std::lock_guard lock(mutex_);
+    return entries_.bytes();
+}
+
+size_t
+SearchResultCache::GetEntryCount() const {
+    std::lock_guard lock(mutex_);
+    return entries_.size();
+}
+
+}  // namespace exec
+}  // namespace milvus
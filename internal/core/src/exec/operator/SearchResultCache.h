@@ -0,0 +1,161 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "common/BitsetView.h"
+#include "common/QueryInfo.h"
+#include "common/QueryResult.h"
+#include "exec/expression/ExprCache.h"
+#include "exec/expression/SegmentLruCache.h"
+#include "query/PlanImpl.h"
+
+namespace milvus {
+namespace segcore {
+class SegmentInternalInterface;
+}
+
+namespace exec {
+
+// Configuration for SearchResultCache.
+struct SearchResultCacheConfig {
+    size_t max_bytes{64ULL * 1024 * 1024};
+    // Same semantics as CacheConfig::admission_threshold: only cache a query
+    // after its signature has been seen this many times.
+    uint8_t admission_threshold{2};
+};
+
+// Process-level per-segment cache of vector search results.
+//
+// Recommendation fan-out sends the same embedding with identical params many
+// times per minute. Each repeat would otherwise run the full index / brute
+// force search per segment. This cache stores the per-segment top-k
+// (distances + segment offsets) keyed by:
+//   - segment id
+//   - the exact query vector bytes, nq, metric, topk, round_decimal and the
+//     serialized search params
+//   - whether the field currently has an index (results differ between the
+//     interim brute force path and the loaded index)
+//   - the segment's active_count and deleted count
+//   - a hash of the final filter bitset handed to the index. The bitset is
+//     the product of the filter, MVCC and delete masking, so it covers the
+//     filter signature, the query timestamp and the delete version at once.
+//
+// Only plain row-level dense searches are cacheable: group-by, iterator,
+// iterative-filter, element-level, embedding-list and sparse searches go
+// straight to the index.
+//
+// Admission control reuses ExprResCacheManager's FrequencyTracker; eviction
+// is LRU within a byte budget.
+class SearchResultCache : public ProcessCache<SearchResultCache> {
+ public:
+    struct Key {
+        int64_t segment_id{0};
+        std::string signature;
+        int64_t active_count{0};
+        int64_t deleted_count{0};
+        uint64_t filter_hash{0};
+
+        bool
+        operator==(const Key& other) const {
+            return segment_id == other.segment_id &&
+                   active_count == other.active_count &&
+                   deleted_count == other.deleted_count &&
+                   filter_hash == other.filter_hash &&
+                   signature == other.signature;
+        }
+    };
+
+    struct KeyHasher {
+        size_t
+        operator()(const Key& k) const noexcept {
+            return HashCacheKey(k.segment_id,
+                                k.signature,
+                                k.active_count,
+                                k.deleted_count,
+                                k.filter_hash);
+        }
+    };
+
+    struct Value {
+        int64_t total_nq{0};
+        int64_t unity_topk{0};
+        std::vector<float> distances;
+        std::vector<int64_t> seg_offsets;
+
+        size_t
+        Bytes() const {
+            return sizeof(Value) + distances.capacity() * sizeof(float) +
+                   seg_offsets.capacity() * sizeof(int64_t);
+        }
+    };
+
+ public:
+    void
+    SetConfig(const SearchResultCacheConfig& config);
+
+    // Build the cache key for one search on `segment`. Returns nullopt when
+    // the search is not eligible for caching.
+    static std::optional<Key>
+    MakeKey(const segcore::SegmentInternalInterface* segment,
+            const SearchInfo& search_info,
+            const query::Placeholder& placeholder,
+            int64_t active_count,
+            const BitsetView& bitset);
+
+    // On hit, fills distances/offsets/nq/topk of `out` and returns true.
+    bool
+    Get(const Key& key, SearchResult& out);
+
+    // Cache the search output. Results carrying iterators or group-by values
+    // are ignored.
+    void
+    Put(const Key& key, const SearchResult& result);
+
+    size_t
+    EraseSegment(int64_t segment_id);
+
+    void
+    Clear();
+
+    size_t
+    GetCurrentBytes() const;
+
+    size_t
+    GetEntryCount() const;
+
+ private:
+    friend class ProcessCache<SearchResultCache>;
+
+    SearchResultCache() : entries_(config_.max_bytes) {
+    }
+
+    mutable std::mutex mutex_;
+    SearchResultCacheConfig config_;
+    SegmentLruCache<Key, Value, KeyHasher> entries_;
+
+    FrequencyTracker frequency_tracker_;
+};
+
+}  // namespace exec
+}  // namespace milvus
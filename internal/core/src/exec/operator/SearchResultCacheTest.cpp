@@ -0,0 +1,150 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "common/QueryResult.h"
+#include "exec/operator/SearchResultCache.h"
+
+using milvus::exec::SearchResultCache;
+using milvus::exec::SearchResultCacheConfig;
+
+namespace {
+
+SearchResultCache::Key
+MakeTestKey(int64_t segment_id,
+            const std::string& signature,
+            int64_t active_count = 1000,
+            uint64_t filter_hash = 0) {
+    SearchResultCache::Key key;
+    key.segment_id = segment_id;
+    key.signature = signature;
+    key.active_count = active_count;
+    key.filter_hash = filter_hash;
+    return key;
+}
+
+milvus::SearchResult
+MakeTestResult(int64_t nq, int64_t topk) {
+    milvus::SearchResult result;
+    result.total_nq_ = nq;
+    result.unity_topK_ = topk;
+    for (int64_t i = 0; i < nq * topk; ++i) {
+        result.distances_.push_back(static_cast<float>(i) * 0.5f);
+        result.seg_offsets_.push_back(i * 3);
+    }
+    return result;
+}
+
+class SearchResultCacheTest : public ::testing::Test {
+ protected:
+    void
+    SetUp() override {
+        SearchResultCache::SetEnabled(true);
+        SearchResultCacheConfig config;
+        config.max_bytes = 1ULL << 20;
+        config.admission_threshold = 1;
+        SearchResultCache::Instance().SetConfig(config);
+        SearchResultCache::Instance().Clear();
+    }
+
+    void
+    TearDown() override {
+        SearchResultCache::SetEnabled(false);
+    }
+};
+
+}  // namespace
+
+TEST_F(SearchResultCacheTest, PutGetRoundTrip) {
+    auto& cache = SearchResultCache::Instance();
+    auto key = MakeTestKey(1, "q1");
+    auto expected = MakeTestResult(2, 10);
+    cache.Put(key, expected);
+
+    milvus::SearchResult got;
+    ASSERT_TRUE(cache.Get(key, got));
+    EXPECT_EQ(got.total_nq_, 2);
+    EXPECT_EQ(got.unity_topK_, 10);
+    EXPECT_EQ(got.distances_, expected.distances_);
+    EXPECT_EQ(got.seg_offsets_, expected.seg_offsets_);
+}
+
+TEST_F(SearchResultCacheTest, SnapshotChangesMiss) {
+    auto& cache = SearchResultCache::Instance();
+    cache.Put(MakeTestKey(1, "q1", 1000, 42), MakeTestResult(1, 5));
+
+    milvus::SearchResult got;
+    EXPECT_FALSE(cache.Get(MakeTestKey(1, "q1", 1001, 42), got));
+    EXPECT_FALSE(cache.Get(MakeTestKey(1, "q1", 1000, 43), got));
+    EXPECT_FALSE(cache.Get(MakeTestKey(2, "q1", 1000, 42), got));
+    EXPECT_FALSE(cache.Get(MakeTestKey(1, "q2", 1000, 42), got));
+    EXPECT_TRUE(cache.Get(MakeTestKey(1, "q1", 1000, 42), got));
+}
+
+TEST_F(SearchResultCacheTest, AdmissionThreshold) {
+    auto& cache = SearchResultCache::Instance();
+    SearchResultCacheConfig config;
+    config.max_bytes = 1ULL << 20;
+    config.admission_threshold = 2;
+    cache.SetConfig(config);
+
+    auto key = MakeTestKey(1, "q_admission");
+    milvus::SearchResult got;
+    cache.Put(key, MakeTestResult(1, 5));
+    EXPECT_FALSE(cache.Get(key, got));
+    cache.Put(key, MakeTestResult(1, 5));
+    EXPECT_TRUE(cache.Get(key, got));
+}
+
+TEST_F(SearchResultCacheTest, EvictsLeastRecentlyUsed) {
+    auto& cache = SearchResultCache::Instance();
+    auto one = MakeTestResult(1, 100);
+    cache.Put(MakeTestKey(1, "a"), one);
+    size_t entry_bytes = cache.GetCurrentBytes();
+    ASSERT_GT(entry_bytes, 0);
+
+    SearchResultCacheConfig config;
+    config.max_bytes = entry_bytes * 2 + entry_bytes / 2;
+    config.admission_threshold = 1;
+    cache.SetConfig(config);
+
+    cache.Put(MakeTestKey(1, "b"), one);
+    milvus::SearchResult got;
+    // Touch "a" so "b" becomes the eviction victim.
+    ASSERT_TRUE(cache.Get(MakeTestKey(1, "a"), got));
+    cache.Put(MakeTestKey(1, "c"), one);
+
+    EXPECT_LE(cache.GetCurrentBytes(), config.max_bytes);
+    EXPECT_TRUE(cache.Get(MakeTestKey(1, "a"), got));
+    EXPECT_FALSE(cache.Get(MakeTestKey(1, "b"), got));
+    EXPECT_TRUE(cache.Get(MakeTestKey(1, "c"), got));
+}
+
+TEST_F(SearchResultCacheTest, EraseSegment) {
+    auto& cache = SearchResultCache::Instance();
+    cache.Put(MakeTestKey(1, "a"), MakeTestResult(1, 5));
+    cache.Put(MakeTestKey(1, "b"), MakeTestResult(1, 5));
+    cache.Put(MakeTestKey(2, "a"), MakeTestResult(1, 5));
+
+    EXPECT_EQ(cache.EraseSegment(1), 2);
+    EXPECT_EQ(cache.GetEntryCount(), 1);
+    milvus::SearchResult got;
+    EXPECT_TRUE(cache.Get(MakeTestKey(2, "a"), got));
+}
@@ -0,0 +1,370 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "exec/operator/VectorSearchBatcher.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <utility>
+
+#include <fmt/core.h>
+
+#include "common/Consts.h"
+#include "common/EasyAssert.h"
+#include "knowhere/comp/index_param.h"
+#include "log/Log.h"
+#include "segcore/SegmentInterface.h"
+#include "segcore/Utils.h"
+
+namespace milvus {
+namespace exec {
+
+namespace {
+
+// How often a waiting follower checks its own cancellation.
+constexpr std::chrono::milliseconds kFollowerCancelCheckInterval{1};
+
+bool
+IsCancelled(milvus::OpContext* op_context) {
+    return op_context != nullptr &&
+           op_context->cancellation_token.isCancellationRequested();
+}
+
+using BitsetPolicy = bitset::detail::ElementWiseBitsetPolicy<uint8_t>;
+
+// A merged call fetches at most this many times the requested top-k to make
+// room for rows that only some of the requests filter out.
+constexpr int64_t kMaxTopkExpansion = 4;
+
+}  // namespace
+
+std::atomic<bool> VectorSearchBatcher::enabled_{false};
+
+VectorSearchBatcher&
+VectorSearchBatcher::Instance() {
+    static VectorSearchBatcher instance;
+    return instance;
+}
+
+void
+VectorSearchBatcher::SetEnabled(bool enabled) {
+    enabled_.store(enabled);
+}
+
+bool
+VectorSearchBatcher::IsEnabled() {
+    return enabled_.load();
+}
+
+void
+VectorSearchBatcher::SetConfig(const VectorSearchBatcherConfig& config) {
+    std::lock_guard lock(mutex_);
+    config_ = config;
+    LOG_INFO("VectorSearchBatcher: config updated, window_us={}, "
+             "max_batch_nq={}",
+             config_.window_us,
+             config_.max_batch_nq);
+}
+
+std::optional<std::string>
+VectorSearchBatcher::MakeBatchKey(
+    const segcore::SegmentInternalInterface* segment,
+    const SearchInfo& search_info,
+    const query::Placeholder& placeholder,
+    Timestamp timestamp,
+    const BitsetView& bitset) {
+    if (segment == nullptr || placeholder.element_level_ ||
+        placeholder.blob_.empty() || !placeholder.offsets_.empty() ||
+        placeholder.num_of_queries_ <= 0 || search_info.has_group_by() ||
+        search_info.iterator_v2_info_.has_value() ||
+        search_info.iterative_filter_execution ||
+        search_info.materialized_view_involved ||
+        search_info.global_refine_enable_ ||
+        search_info.search_params_.contains(knowhere::meta::RADIUS) ||
+        bitset.has_out_ids()) {
+        return std::nullopt;
+    }
+    // Growing segments bound the searched rows by the query timestamp, so
+    // only requests with the same snapshot may share a call.
+    const Timestamp snapshot_ts =
+        segment->type() == SegmentType::Growing ? timestamp : 0;
+    return fmt::format(
+        "{}|{}|{}|{}|{}|{}|{}|{}|{}",
+        static_cast<const void*>(segment),
+        search_info.field_id_.get(),
+        search_info.metric_type_,
+        search_info.topk_,
+        search_info.round_decimal_,
+        placeholder.blob_.size() / placeholder.num_of_queries_,
+        bitset.size(),
+        snapshot_ts,
+        search_info.search_params_.dump());
+}
+
+bool
+VectorSearchBatcher::TrySearch(const segcore::SegmentInternalInterface* segment,
+                               const SearchInfo& search_info,
+                               const query::Placeholder& placeholder,
+                               Timestamp timestamp,
+                               const BitsetView& bitset,
+                               milvus::OpContext* op_context,
+                               SearchResult& output) {
+    auto key =
+        MakeBatchKey(segment, search_info, placeholder, timestamp, bitset);
+    if (!key.has_value()) {
+        return false;
+    }
+    const int64_t nq = placeholder.num_of_queries_;
+    Request request{placeholder.blob_.data(), nq, bitset, {}, {}};
+
+    std::unique_lock lock(mutex_);
+    if (nq >= config_.max_batch_nq) {
+        return false;
+    }
+
+    // Follower path: join an open batch that has room for the queries.
+    auto it = open_batches_.find(*key);
+    if (it != open_batches_.end() && CanJoinLocked(*it->second, nq)) {
+        auto batch = it->second;
+        // The follower may leave on cancellation before the leader reads its
+        // queries and bitset, so it hands over copies, made without the lock.
+        lock.unlock();
+        request.owned_query.assign(placeholder.blob_.begin(),
+                                   placeholder.blob_.end());
+        request.query_data = request.owned_query.data();
+        if (!bitset.empty()) {
+            request.owned_bitset.assign(
+                bitset.data(), bitset.data() + (bitset.size() + 7) / 8);
+            request.bitset =
+                BitsetView(request.owned_bitset.data(), bitset.size());
+        }
+        lock.lock();
+
+        if (CanJoinLocked(*batch, nq)) {
+            const size_t index = batch->requests.size();
+            batch->requests.push_back(std::move(request));
+            batch->total_nq += nq;
+            if (batch->total_nq >= config_.max_batch_nq) {
+                batch->sealed = true;
+                auto open = open_batches_.find(*key);
+                if (open != open_batches_.end() && open->second == batch) {
+                    open_batches_.erase(open);
+                }
+                batch->cv.notify_all();
+            }
+            while (!batch->done) {
+                batch->cv.wait_for(lock, kFollowerCancelCheckInterval);
+                if (!batch->done) {
+                    segcore::CheckCancellation(op_context,
+                                               segment->get_segment_id(),
+                                               "batched vector search");
+                }
+            }
+            if (batch->error) {
+                if (batch->leader_cancelled && !IsCancelled(op_context)) {
+                    return false;
+                }
+                std::rethrow_exception(batch->error);
+            }
+            output = std::move(batch->results[index]);
+            return true;
+        }
+        // the batch filled up meanwhile, lead a new one
+    }
+
+    // Leader path. Waiting for followers only pays off while other searches
+    // of the key are running; a lone request is dispatched at once.
+    auto batch = std::make_shared<Batch>();
+    batch->requests.push_back(std::move(request));
+    batch->total_nq = nq;
+    if (running_leaders_[*key]++ == 0) {
+        batch->sealed = true;
+    } else {
+        // replaces a full batch that is still open
+        open_batches_[*key] = batch;
+        batch->cv.wait_for(lock,
+                           std::chrono::microseconds(config_.window_us),
+                           [&batch] { return batch->sealed; });
+        if (!batch->sealed) {
+            batch->sealed = true;
+            auto open = open_batches_.find(*key);
+            if (open != open_batches_.end() && open->second == batch) {
+                open_batches_.erase(open);
+            }
+        }
+    }
+    lock.unlock();
+
+    // No more followers can touch the request list once the batch is sealed.
+    Execute(segment, search_info, placeholder, timestamp, op_context, *batch);
+
+    lock.lock();
+    if (--running_leaders_[*key] == 0) {
+        running_leaders_.erase(*key);
+    }
+    batch->done = true;
+    batch->cv.notify_all();
+    if (batch->error) {
+        std::rethrow_exception(batch->error);
+    }
+    output = std::move(batch->results[0]);
+    return true;
+}
+
+void
+VectorSearchBatcher::Execute(const segcore::SegmentInternalInterface* segment,
+                             const SearchInfo& search_info,
+                             const query::Placeholder& placeholder,
+                             Timestamp timestamp,
+                             milvus::OpContext* op_context,
+                             Batch& batch) {
+    const auto& requests = batch.requests;
+    batch.results.resize(requests.size());
+    auto info = search_info;
+    try {
+        if (requests.size() == 1) {
+            segment->vector_search(info,
+                                   placeholder.get_blob(),
+                                   placeholder.get_offsets(),
+                                   batch.total_nq,
+                                   timestamp,
+                                   requests[0].bitset,
+                                   op_context,
+                                   batch.results[0]);
+            return;
+        }
+
+        // All bitsets of a batch have the same size (it is part of the batch
+        // key), zero when the searches are unfiltered. The merged call keeps
+        // the rows any request admits and fetches enough extra rows per query
+        // for the request whose filter is furthest from that union.
+        const size_t num_bits = requests[0].bitset.size();
+        std::vector<uint8_t> shared_bits;
+        BitsetView shared;
+        std::vector<bool> own_filter(requests.size(), false);
+        int64_t expansion = 1;
+        if (num_bits != 0) {
+            shared_bits.assign(requests[0].bitset.data(),
+                               requests[0].bitset.data() + (num_bits + 7) / 8);
+            for (size_t i = 1; i < requests.size(); ++i) {
+                BitsetPolicy::op_and(shared_bits.data(),
+                                     requests[i].bitset.data(),
+                                     0,
+                                     0,
+                                     num_bits);
+            }
+            shared = BitsetView(shared_bits.data(), num_bits);
+            const size_t shared_excluded =
+                BitsetPolicy::op_count(shared_bits.data(), 0, num_bits);
+            const size_t candidates = num_bits - shared_excluded;
+            for (size_t i = 0; i < requests.size(); ++i) {
+                // a request's filtered rows contain the shared ones, so equal
+                // counts mean an identical bitset
+                const size_t excluded = BitsetPolicy::op_count(
+                    requests[i].bitset.data(), 0, num_bits);
+                if (excluded == shared_excluded) {
+                    continue;
+                }
+                own_filter[i] = true;
+                const size_t admitted =
+                    std::max<size_t>(num_bits - excluded, 1);
+                expansion = std::max<int64_t>(
+                    expansion, (candidates + admitted - 1) / admitted);
+            }
+        }
+        expansion = std::min(expansion, kMaxTopkExpansion);
+        info.topk_ = search_info.topk_ * expansion;
+
+        const size_t bytes_per_query =
+            placeholder.blob_.size() / placeholder.num_of_queries_;
+        aligned_vector<char> combined(bytes_per_query * batch.total_nq);
+        size_t pos = 0;
+        for (const auto& request : requests) {
+            const size_t bytes = bytes_per_query * request.nq;
+            std::memcpy(combined.data() + pos, request.query_data, bytes);
+            pos += bytes;
+        }
+
+        SearchResult merged;
+        segment->vector_search(info,
+                               combined.data(),
+                               nullptr,
+                               batch.total_nq,
+                               timestamp,
+                               shared,
+                               op_context,
+                               merged);
+        AssertInfo(!merged.HasIterators() && !merged.HasGroupBy(),
+                   "batched vector search must produce plain top-k results");
+        const int64_t fetched = merged.unity_topK_;
+        AssertInfo(merged.distances_.size() == batch.total_nq * fetched,
+                   "unexpected batched search result size {}, nq {}, topk {}",
+                   merged.distances_.size(),
+                   batch.total_nq,
+                   fetched);
+        const int64_t topk = std::min(search_info.topk_, fetched);
+
+        int64_t query_begin = 0;
+        for (size_t i = 0; i < requests.size(); ++i) {
+            const auto& request = requests[i];
+            auto& result = batch.results[i];
+            result.total_nq_ = request.nq;
+            result.unity_topK_ = topk;
+            result.distances_.reserve(request.nq * topk);
+            result.seg_offsets_.reserve(request.nq * topk);
+            bool complete = true;
+            for (int64_t q = 0; complete && q < request.nq; ++q) {
+                const int64_t begin = (query_begin + q) * fetched;
+                int64_t kept = 0;
+                for (int64_t k = 0; k < fetched && kept < topk; ++k) {
+                    const auto offset = merged.seg_offsets_[begin + k];
+                    if (own_filter[i] &&
+                        (offset == INVALID_SEG_OFFSET ||
+                         request.bitset.test(offset))) {
+                        continue;
+                    }
+                    result.distances_.push_back(merged.distances_[begin + k]);
+                    result.seg_offsets_.push_back(offset);
+                    ++kept;
+                }
+                complete = kept == topk;
+            }
+            query_begin += request.nq;
+            if (!complete) {
+                // the enlarged top-k did not leave enough rows this request
+                // admits
+                result = SearchResult();
+                auto own_info = search_info;
+                segment->vector_search(own_info,
+                                       request.query_data,
+                                       nullptr,
+                                       request.nq,
+                                       timestamp,
+                                       request.bitset,
+                                       op_context,
+                                       result);
+            }
+        }
+        batch.results[0].search_storage_cost_ += merged.search_storage_cost_;
+    } catch (...) {
+        batch.error = std::current_exception();
+        batch.leader_cancelled = IsCancelled(op_context);
+    }
+}
+
+}  // namespace exec
+}  // namespace milvus
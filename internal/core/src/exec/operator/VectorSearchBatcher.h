@@ -0,0 +1,169 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "common/BitsetView.h"
+#include "common/OpContext.h"
+#include "common/QueryInfo.h"
+#include "common/QueryResult.h"
+#include "common/Types.h"
+#include "query/PlanImpl.h"
+
+namespace milvus {
+namespace segcore {
+class SegmentInternalInterface;
+}
+
+namespace exec {
+
+struct VectorSearchBatcherConfig {
+    // How long the first request of a batch waits for companions.
+    int64_t window_us{200};
+    // A batch is dispatched as soon as it holds this many queries.
+    int64_t max_batch_nq{64};
+};
+
+// Cross-request micro-batching of vector searches on one segment.
+//
+// Concurrent AsyncSearch calls that hit the same segment, field and search
+// params each issue their own knowhere query even though index search is
+// much cheaper per query at nq > 1. The batcher coalesces such calls:
+//
+//   - The first request for a batch key becomes the leader. It waits up to
+//     `window_us` (or until the batch reaches `max_batch_nq`) for followers.
+//   - Followers append their query vectors and block.
+//   - The leader issues one multi-nq vector_search and splits the per-query
+//     top-k slices back out to each request.
+//
+// Each request keeps its own filter bitset. knowhere applies one bitset to
+// every query of a call, so the merged call searches the rows that pass any
+// request's filter (the AND of the bitsets, whose set bits are filtered out)
+// with a top-k enlarged by how much the filters differ, and each request's
+// slice is then narrowed to the rows its own bitset admits. A request that
+// is left with fewer than top-k rows is searched again on its own. Requests
+// sharing one bitset, such as unfiltered searches, get the merged slice
+// unchanged.
+//
+// A request only waits `window_us` for companions while another search of
+// the same batch key is running; a lone request is dispatched at once.
+//
+// Only plain row-level dense top-k searches are batched (no range search,
+// no global refine); everything else returns false from TrySearch and the
+// caller searches directly.
+//
+// The merged call runs under the leader's op_context, so its storage cost is
+// attributed to the leader. Followers keep honouring their own cancellation
+// while they wait: a cancelled follower throws and leaves the batch, which
+// is safe because a follower's query vectors are copied into the batch when
+// it joins. When the merged call fails because the leader was cancelled, the
+// followers' TrySearch returns false and they search on their own instead of
+// inheriting the leader's cancellation; any other error reaches every
+// request of the batch.
+class VectorSearchBatcher {
+ public:
+    static VectorSearchBatcher&
+    Instance();
+    static void
+    SetEnabled(bool enabled);
+    static bool
+    IsEnabled();
+
+    void
+    SetConfig(const VectorSearchBatcherConfig& config);
+
+    // Run the search through the batcher. Returns false without touching
+    // `output` when the request is not batchable.
+    bool
+    TrySearch(const segcore::SegmentInternalInterface* segment,
+              const SearchInfo& search_info,
+              const query::Placeholder& placeholder,
+              Timestamp timestamp,
+              const BitsetView& bitset,
+              milvus::OpContext* op_context,
+              SearchResult& output);
+
+ private:
+    VectorSearchBatcher() = default;
+
+    struct Request {
+        const char* query_data{nullptr};
+        int64_t nq{0};
+        BitsetView bitset;
+        // followers' copies of their query vectors and bitset, which
+        // query_data and bitset point into
+        std::vector<char> owned_query;
+        std::vector<uint8_t> owned_bitset;
+    };
+
+    struct Batch {
+        std::vector<Request> requests;
+        int64_t total_nq{0};
+        bool sealed{false};  // no more followers may join
+        bool done{false};
+        std::vector<SearchResult> results;
+        std::exception_ptr error;
+        // the error comes from the leader's own cancellation
+        bool leader_cancelled{false};
+        std::condition_variable cv;
+    };
+
+    static std::optional<std::string>
+    MakeBatchKey(const segcore::SegmentInternalInterface* segment,
+                 const SearchInfo& search_info,
+                 const query::Placeholder& placeholder,
+                 Timestamp timestamp,
+                 const BitsetView& bitset);
+
+    // Whether a follower with nq queries may still join `batch`.
+    bool
+    CanJoinLocked(const Batch& batch, int64_t nq) const {
+        return !batch.sealed && batch.total_nq + nq <= config_.max_batch_nq;
+    }
+
+    // Executed by the leader without holding mutex_.
+    static void
+    Execute(const segcore::SegmentInternalInterface* segment,
+            const SearchInfo& search_info,
+            const query::Placeholder& placeholder,
+            Timestamp timestamp,
+            milvus::OpContext* op_context,
+            Batch& batch);
+
+    static std::atomic<bool> enabled_;
+
+    // Guards config_, open_batches_, running_leaders_ and the mutable state
+    // of every Batch.
+    std::mutex mutex_;
+    VectorSearchBatcherConfig config_;
+    std::unordered_map<std::string, std::shared_ptr<Batch>> open_batches_;
+    // leaders per batch key that are collecting followers or searching
+    std::unordered_map<std::string, int64_t> running_leaders_;
+};
+
+}  // namespace exec
+}  // namespace milvus
@@ -0,0 +1,391 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+#include <folly/CancellationToken.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <future>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "common/BitsetView.h"
+#include "common/Exception.h"
+#include "common/IndexMeta.h"
+#include "common/OpContext.h"
+#include "common/QueryResult.h"
+#include "common/Schema.h"
+#include "exec/operator/VectorSearchBatcher.h"
+#include "knowhere/comp/index_param.h"
+#include "segcore/SegmentGrowingImpl.h"
+#include "segcore/Utils.h"
+
+using namespace milvus;
+using namespace milvus::segcore;
+using milvus::exec::VectorSearchBatcher;
+using milvus::exec::VectorSearchBatcherConfig;
+
+namespace {
+
+constexpr int64_t kDim = 4;
+constexpr int64_t kTopK = 2;
+
+// Answers every query with offsets derived from its first component, so that
+// each request can tell whether it got its own slice of a merged call. Rows
+// the bitset filters out are skipped.
+class FakeSegment : public SegmentGrowingImpl {
+ public:
+    explicit FakeSegment(SchemaPtr schema)
+        : SegmentGrowingImpl(std::move(schema),
+                             empty_index_meta,
+                             SegcoreConfig::default_config(),
+                             1) {
+    }
+
+    void
+    vector_search(SearchInfo& search_info,
+                  const void* query_data,
+                  const size_t* query_offsets,
+                  int64_t query_count,
+                  Timestamp timestamp,
+                  const BitsetView& bitset,
+                  milvus::OpContext* op_context,
+                  SearchResult& output) const override {
+        if (calls++ == 0 && first_gate.valid()) {
+            first_entered.set_value();
+            first_gate.wait();
+        }
+        max_nq = std::max<int64_t>(max_nq.load(), query_count);
+        std::this_thread::sleep_for(delay);
+        CheckCancellation(op_context, get_segment_id(), "fake search");
+        if (fail) {
+            throw std::runtime_error("fake search failure");
+        }
+        auto queries = static_cast<const float*>(query_data);
+        output.total_nq_ = query_count;
+        output.unity_topK_ = search_info.topk_;
+        for (int64_t i = 0; i < query_count; ++i) {
+            auto offset = static_cast<int64_t>(queries[i * kDim]) * 10;
+            for (int64_t k = 0; k < search_info.topk_; ++offset) {
+                if (!bitset.empty() && bitset.test(offset)) {
+                    continue;
+                }
+                output.seg_offsets_.push_back(offset);
+                output.distances_.push_back(static_cast<float>(k++));
+            }
+        }
+    }
+
+    mutable std::atomic<int> calls{0};
+    mutable std::atomic<int64_t> max_nq{0};
+    std::chrono::milliseconds delay{0};
+    bool fail{false};
+    // when valid, the first call waits for it after setting first_entered
+    std::shared_future<void> first_gate;
+    mutable std::promise<void> first_entered;
+};
+
+query::Placeholder
+MakePlaceholder(const std::vector<float>& first_components) {
+    query::Placeholder placeholder;
+    placeholder.num_of_queries_ = first_components.size();
+    placeholder.blob_.resize(first_components.size() * kDim * sizeof(float));
+    std::vector<float> data(first_components.size() * kDim, 0);
+    for (size_t i = 0; i < first_components.size(); ++i) {
+        data[i * kDim] = first_components[i];
+    }
+    std::memcpy(
+        placeholder.blob_.data(), data.data(), placeholder.blob_.size());
+    return placeholder;
+}
+
+class VectorSearchBatcherTest : public ::testing::Test {
+ protected:
+    void
+    SetUp() override {
+        auto schema = std::make_shared<Schema>();
+        schema->AddDebugField(
+            "fakevec", DataType::VECTOR_FLOAT, kDim, knowhere::metric::L2);
+        auto pk = schema->AddDebugField("pk", DataType::INT64);
+        schema->set_primary_field_id(pk);
+        segment_ = std::make_unique<FakeSegment>(schema);
+
+        search_info_.field_id_ = FieldId(100);
+        search_info_.metric_type_ = knowhere::metric::L2;
+        search_info_.topk_ = kTopK;
+        search_info_.round_decimal_ = -1;
+
+        VectorSearchBatcher::SetEnabled(true);
+    }
+
+    void
+    TearDown() override {
+        VectorSearchBatcher::SetEnabled(false);
+        VectorSearchBatcher::Instance().SetConfig(VectorSearchBatcherConfig{});
+    }
+
+    void
+    Configure(int64_t window_us, int64_t max_batch_nq) {
+        VectorSearchBatcherConfig config;
+        config.window_us = window_us;
+        config.max_batch_nq = max_batch_nq;
+        VectorSearchBatcher::Instance().SetConfig(config);
+    }
+
+    bool
+    Search(const query::Placeholder& placeholder,
+           const BitsetView& bitset,
+           milvus::OpContext* op_context,
+           SearchResult& output) {
+        auto info = search_info_;
+        return VectorSearchBatcher::Instance().TrySearch(segment_.get(),
+                                                         info,
+                                                         placeholder,
+                                                         MAX_TIMESTAMP,
+                                                         bitset,
+                                                         op_context,
+                                                         output);
+    }
+
+    // Runs a search that stays in the segment until ReleaseBlocker(), so
+    // that the requests issued meanwhile wait for companions instead of
+    // being dispatched alone. Counts as one of the segment's calls.
+    void
+    StartBlocker(const BitsetView& bitset = nullptr) {
+        segment_->first_gate = release_.get_future().share();
+        auto entered = segment_->first_entered.get_future();
+        blocker_ = std::thread([this, bitset] {
+            auto placeholder = MakePlaceholder({0});
+            SearchResult result;
+            try {
+                Search(placeholder, bitset, nullptr, result);
+            } catch (const std::exception&) {
+            }
+        });
+        entered.wait();
+    }
+
+    void
+    ReleaseBlocker() {
+        release_.set_value();
+        blocker_.join();
+    }
+
+    std::unique_ptr<FakeSegment> segment_;
+    SearchInfo search_info_;
+    std::promise<void> release_;
+    std::thread blocker_;
+};
+
+}  // namespace
+
+TEST_F(VectorSearchBatcherTest, MergesAndSplitsConcurrentRequests) {
+    // a long window, the batch is dispatched once it is full
+    Configure(10 * 1000 * 1000, 6);
+    StartBlocker();
+    const std::vector<std::vector<float>> queries = {{1}, {2, 3}, {4}, {5, 6}};
+    std::vector<SearchResult> results(queries.size());
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < queries.size(); ++i) {
+        threads.emplace_back([&, i] {
+            auto placeholder = MakePlaceholder(queries[i]);
+            EXPECT_TRUE(Search(placeholder, nullptr, nullptr, results[i]));
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    ReleaseBlocker();
+
+    EXPECT_EQ(segment_->calls.load(), 2);
+    EXPECT_EQ(segment_->max_nq.load(), 6);
+    for (size_t i = 0; i < queries.size(); ++i) {
+        const auto& result = results[i];
+        ASSERT_EQ(result.total_nq_, static_cast<int64_t>(queries[i].size()));
+        ASSERT_EQ(result.unity_topK_, kTopK);
+        ASSERT_EQ(result.seg_offsets_.size(), queries[i].size() * kTopK);
+        for (size_t q = 0; q < queries[i].size(); ++q) {
+            for (int64_t k = 0; k < kTopK; ++k) {
+                EXPECT_EQ(result.seg_offsets_[q * kTopK + k],
+                          static_cast<int64_t>(queries[i][q]) * 10 + k);
+            }
+        }
+    }
+}
+
+TEST_F(VectorSearchBatcherTest, ErrorReachesFollowers) {
+    Configure(10 * 1000 * 1000, 3);
+    segment_->fail = true;
+    StartBlocker();
+    std::atomic<int> failed{0};
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 3; ++i) {
+        threads.emplace_back([&, i] {
+            auto placeholder = MakePlaceholder({static_cast<float>(i)});
+            SearchResult result;
+            try {
+                Search(placeholder, nullptr, nullptr, result);
+            } catch (const std::runtime_error&) {
+                ++failed;
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    ReleaseBlocker();
+    EXPECT_EQ(segment_->calls.load(), 2);
+    EXPECT_EQ(failed.load(), 3);
+}
+
+TEST_F(VectorSearchBatcherTest, LoneRequestSkipsTheWindow) {
+    Configure(10 * 1000 * 1000, 64);
+    auto placeholder = MakePlaceholder({1});
+    SearchResult result;
+    auto start = std::chrono::steady_clock::now();
+    EXPECT_TRUE(Search(placeholder, nullptr, nullptr, result));
+    EXPECT_LT(std::chrono::steady_clock::now() - start,
+              std::chrono::seconds(5));
+    EXPECT_EQ(segment_->calls.load(), 1);
+    EXPECT_EQ(result.seg_offsets_[0], 10);
+}
+
+TEST_F(VectorSearchBatcherTest, DifferentBitsetsShareOneCall) {
+    Configure(10 * 1000 * 1000, 2);
+    constexpr int64_t kRows = 64;
+    TargetBitmap none(kRows);
+    TargetBitmap first(kRows);
+    first.set(10);
+    TargetBitmap second(kRows);
+    second.set(21);
+    StartBlocker(none);
+    std::vector<SearchResult> results(2);
+    std::thread t1([&] {
+        auto placeholder = MakePlaceholder({1});
+        EXPECT_TRUE(Search(placeholder, first, nullptr, results[0]));
+    });
+    std::thread t2([&] {
+        auto placeholder = MakePlaceholder({2});
+        EXPECT_TRUE(Search(placeholder, second, nullptr, results[1]));
+    });
+    t1.join();
+    t2.join();
+    ReleaseBlocker();
+
+    EXPECT_EQ(segment_->calls.load(), 2);
+    EXPECT_EQ(segment_->max_nq.load(), 2);
+    EXPECT_EQ(results[0].unity_topK_, kTopK);
+    EXPECT_EQ(results[0].seg_offsets_, (std::vector<int64_t>{11, 12}));
+    EXPECT_EQ(results[1].seg_offsets_, (std::vector<int64_t>{20, 22}));
+}
+
+TEST_F(VectorSearchBatcherTest, NarrowFilterSearchesAlone) {
+    Configure(10 * 1000 * 1000, 2);
+    constexpr int64_t kRows = 64;
+    TargetBitmap none(kRows);
+    // filters out every row the merged call fetches for the query
+    TargetBitmap narrow(kRows);
+    for (int64_t row = 10; row < 18; ++row) {
+        narrow.set(row);
+    }
+    StartBlocker(none);
+    std::vector<SearchResult> results(2);
+    std::thread t1([&] {
+        auto placeholder = MakePlaceholder({1});
+        EXPECT_TRUE(Search(placeholder, narrow, nullptr, results[0]));
+    });
+    std::thread t2([&] {
+        auto placeholder = MakePlaceholder({2});
+        EXPECT_TRUE(Search(placeholder, none, nullptr, results[1]));
+    });
+    t1.join();
+    t2.join();
+    ReleaseBlocker();
+
+    EXPECT_EQ(segment_->calls.load(), 3);
+    EXPECT_EQ(results[0].seg_offsets_, (std::vector<int64_t>{18, 19}));
+    EXPECT_EQ(results[1].seg_offsets_, (std::vector<int64_t>{20, 21}));
+}
+
+TEST_F(VectorSearchBatcherTest, CancelledFollowerLeaves) {
+    Configure(10 * 1000 * 1000, 2);
+    segment_->delay = std::chrono::milliseconds(200);
+    folly::CancellationSource source;
+    milvus::OpContext follower_context(source.getToken());
+    StartBlocker();
+
+    SearchResult leader_result;
+    std::thread leader([&] {
+        auto placeholder = MakePlaceholder({1});
+        EXPECT_TRUE(Search(placeholder, nullptr, nullptr, leader_result));
+    });
+    std::thread follower([&] {
+        // the follower's placeholder is gone once it leaves the batch
+        auto placeholder = std::make_unique<query::Placeholder>(
+            MakePlaceholder({2}));
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        SearchResult result;
+        try {
+            Search(*placeholder, nullptr, &follower_context, result);
+            ADD_FAILURE() << "a cancelled follower must not wait for the batch";
+        } catch (const SegcoreError& e) {
+            EXPECT_EQ(e.get_error_code(), ErrorCode::FollyCancel);
+        }
+        placeholder.reset();
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(80));
+    source.requestCancellation();
+    follower.join();
+    leader.join();
+    ReleaseBlocker();
+
+    EXPECT_EQ(segment_->calls.load(), 2);
+    EXPECT_EQ(leader_result.seg_offsets_[0], 10);
+}
+
+TEST_F(VectorSearchBatcherTest, FollowerFallsBackWhenLeaderIsCancelled) {
+    Configure(10 * 1000 * 1000, 2);
+    segment_->delay = std::chrono::milliseconds(100);
+    folly::CancellationSource source;
+    milvus::OpContext leader_context(source.getToken());
+    StartBlocker();
+
+    std::thread leader([&] {
+        auto placeholder = MakePlaceholder({1});
+        SearchResult result;
+        EXPECT_THROW(Search(placeholder, nullptr, &leader_context, result),
+                     SegcoreError);
+    });
+    std::thread follower([&] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        auto placeholder = MakePlaceholder({2});
+        SearchResult result;
+        // the caller searches on its own
+        EXPECT_FALSE(Search(placeholder, nullptr, nullptr, result));
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    source.requestCancellation();
+    leader.join();
+    follower.join();
+    ReleaseBlocker();
+    EXPECT_EQ(segment_->calls.load(), 2);
+}
@@ -19,6 +19,7 @@
 #include <algorithm>
 #include <chrono>
 #include <functional>
+#include <optional>
 #include <ratio>
 #include <utility>
 #include <vector>
@@ -32,7 +33,9 @@
 #include "common/Utils.h"
 #include "exec/QueryContext.h"
 #include "exec/expression/Utils.h"
+#include "exec/operator/SearchResultCache.h"
 #include "exec/operator/Utils.h"
+#include "exec/operator/VectorSearchBatcher.h"
 #include "monitor/Monitor.h"
 #include "opentelemetry/trace/span.h"
 #include "plan/PlanNode.h"
@@ -176,17 +179,49 @@ PhyVectorSearchNode::GetOutput() {
         data_cnt = search_view.size();
     }
 
+    // Repeated identical searches on an unchanged segment snapshot are
+    // answered from SearchResultCache without touching the index.
+    std::optional<SearchResultCache::Key> cache_key;
+    if (SearchResultCache::IsEnabled()) {
+        cache_key = SearchResultCache::MakeKey(
+            segment_, search_info_, ph, active_count_, search_view);
+    }
+
     // Single search + metrics path
     milvus::SearchResult search_result;
-    auto op_context = query_context_->get_op_context();
-    segment_->vector_search(search_info_,
-                            src_data,
-                            src_offsets,
-                            num_queries,
-                            query_timestamp_,
-                            search_view,
-                            op_context,
-                            search_result);
+    bool cache_hit =
+        cache_key.has_value() &&
+        SearchResultCache::Instance().Get(*cache_key, search_result);
+    exec_path_ = "ResultCache";
+    if (cache_hit) {
+        ++runtime_stats_.cache_hits;
+    } else {
+        auto op_context = query_context_->get_op_context();
+        bool batched = VectorSearchBatcher::IsEnabled() &&
+                       VectorSearchBatcher::Instance().TrySearch(
+                           segment_,
+                           search_info_,
+                           ph,
+                           query_timestamp_,
+                           search_view,
+                           op_context,
+                           search_result);
+        exec_path_ = batched ? "Batched" : "Search";
+        if (!batched) {
+            segment_->vector_search(search_info_,
+                                    src_data,
+                                    src_offsets,
+                                    num_queries,
+                                    query_timestamp_,
+                                    search_view,
+                                    op_context,
+                                    search_result);
+        }
+        if (cache_key.has_value()) {
+            SearchResultCache::Instance().Put(*cache_key, search_result);
+        }
+    }
+    span.GetSpan()->SetAttribute("result_cache_hit", cache_hit);
 
     search_result.total_data_cnt_ = data_cnt;
     search_result.element_level_ = ph.element_level_;
@@ -78,6 +78,11 @@ class PhyVectorSearchNode : public Operator {
         return "PhyVectorSearchNode";
     }
 
+    std::string
+    ExecPathName() const override {
+        return exec_path_;
+    }
+
     void
     PrefetchAsync(const std::shared_ptr<folly::CPUThreadPoolExecutor>
                       prefetch_pool) override {
@@ -114,6 +119,9 @@ class PhyVectorSearchNode : public Operator {
     milvus::SearchInfo search_info_;
 
     std::optional<folly::Future<folly::Unit>> prefetch_future_;
+
+    // ResultCache, Batched or Search, for the query profile
+    std::string exec_path_;
 };
 }  // namespace exec
 }  // namespace milvus
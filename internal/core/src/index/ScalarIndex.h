@@ -17,6 +17,7 @@
 #pragma once
 
 #include <boost/dynamic_bitset.hpp>
+#include <functional>
 #include <map>
 #include <memory>
 #include <string>
@@ -158,6 +159,29 @@ class ScalarIndex : public IndexBase {
     virtual std::optional<T>
     Reverse_Lookup(size_t offset) const = 0;
 
+    // Whether the index keeps its rows sorted by value, so that
+    // VisitInValueOrder can walk them without sorting.
+    virtual bool
+    SupportOrderedScan() const {
+        return false;
+    }
+
+    // Calls fn(offset) for the non-null rows in ascending or descending value
+    // order, until fn returns false. Rows with equal values come in no
+    // particular order.
+    virtual void
+    VisitInValueOrder(bool ascending,
+                      const std::function<bool(int64_t)>& fn) const {
+        ThrowInfo(Unsupported, "ordered scan is not supported");
+    }
+
+    // Calls fn(offset) for the null rows in offset order, until fn returns
+    // false. Supported wherever VisitInValueOrder is.
+    virtual void
+    VisitNullsInOrder(const std::function<bool(int64_t)>& fn) const {
+        ThrowInfo(Unsupported, "ordered scan is not supported");
+    }
+
     virtual const TargetBitmap
     Query(const DatasetPtr& dataset);
 
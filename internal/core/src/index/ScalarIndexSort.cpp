@@ -647,6 +647,38 @@ ScalarIndexSort<T>::Reverse_Lookup(size_t idx) const {
     return operator[](offset).a_;
 }
 
+template <typename T>
+void
+ScalarIndexSort<T>::VisitInValueOrder(
+    bool ascending, const std::function<bool(int64_t)>& fn) const {
+    AssertInfo(SupportOrderedScan(),
+               "ordered scan is not supported by this index");
+    if (ascending) {
+        for (auto it = begin(); it != end(); ++it) {
+            if (!fn(it->idx_)) {
+                return;
+            }
+        }
+    } else {
+        for (auto it = rbegin(); it != const_reverse_iterator(begin()); ++it) {
+            if (!fn(it->idx_)) {
+                return;
+            }
+        }
+    }
+}
+
+template <typename T>
+void
+ScalarIndexSort<T>::VisitNullsInOrder(
+    const std::function<bool(int64_t)>& fn) const {
+    AssertInfo(SupportOrderedScan(),
+               "ordered scan is not supported by this index");
+    for (auto i = valid_bitset_.find_first(false); i.has_value() && fn(*i);
+         i = valid_bitset_.find_next(*i, false)) {
+    }
+}
+
 template <typename T>
 bool
 ScalarIndexSort<T>::ShouldSkip(const T lower_value,
@@ -125,6 +125,18 @@ class ScalarIndexSort : public ScalarIndex<T> {
     std::optional<T>
     Reverse_Lookup(size_t offset) const override;
 
+    bool
+    SupportOrderedScan() const override {
+        return is_built_ && !is_nested_index_ && !is_array_field_;
+    }
+
+    void
+    VisitInValueOrder(bool ascending,
+                      const std::function<bool(int64_t)>& fn) const override;
+
+    void
+    VisitNullsInOrder(const std::function<bool(int64_t)>& fn) const override;
+
     int64_t
     Size() override {
         return (int64_t)size_;
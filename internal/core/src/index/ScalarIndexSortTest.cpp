@@ -132,6 +132,37 @@ TEST(StlSortIndexTest, TestIn) {
         data, DataType::INT64, true, exec_expr, expected_result);
 }
 
+TEST(StlSortIndexTest, TestVisitInValueOrder) {
+    std::vector<int64_t> data = {10, 2, 6, 5, 9, 3, 7, 8, 4, 1};
+    bool valid[] = {
+        true, true, false, true, true, true, true, true, true, true};
+    ScalarIndexSort<int64_t> index(CreateScalarSortTestFileManagerContext());
+    index.Build(data.size(), data.data(), valid);
+    ASSERT_TRUE(index.SupportOrderedScan());
+
+    std::vector<int64_t> values;
+    index.VisitInValueOrder(true, [&](int64_t offset) {
+        values.push_back(data[offset]);
+        return true;
+    });
+    // the null row (6) is not visited
+    ASSERT_EQ(values, std::vector<int64_t>({1, 2, 3, 4, 5, 7, 8, 9, 10}));
+
+    values.clear();
+    index.VisitInValueOrder(false, [&](int64_t offset) {
+        values.push_back(data[offset]);
+        return values.size() < 3;
+    });
+    ASSERT_EQ(values, std::vector<int64_t>({10, 9, 8}));
+
+    std::vector<int64_t> nulls;
+    index.VisitNullsInOrder([&](int64_t offset) {
+        nulls.push_back(offset);
+        return true;
+    });
+    ASSERT_EQ(nulls, std::vector<int64_t>({2}));
+}
+
 TEST(StlSortIndexTest, MmapByteSizeCountsValidBitsetOnce) {
     constexpr size_t kAlignment = 32;
     constexpr uint64_t kMmapIndexPadding = 1;
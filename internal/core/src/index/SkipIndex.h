@@ -45,6 +45,23 @@ class FieldChunkMetricsTranslatorFromStatistics
         }
     }
 
+    // Takes the metrics of every chunk as they are, e.g. built from the zone
+    // map sidecars of the segment.
+    FieldChunkMetricsTranslatorFromStatistics(
+        int64_t segment_id,
+        FieldId field_id,
+        milvus::DataType data_type,
+        std::vector<std::unique_ptr<index::FieldChunkMetrics>> cells)
+        : key_(fmt::format("skip_seg_{}_f_{}", segment_id, field_id.get())),
+          data_type_(data_type),
+          meta_(cachinglayer::StorageType::MEMORY,
+                milvus::cachinglayer::CellIdMappingMode::IDENTICAL,
+                milvus::cachinglayer::CellDataType::OTHER,
+                CacheWarmupPolicy::CacheWarmupPolicy_Disable,
+                false),
+          cells_(std::move(cells)) {
+    }
+
     size_t
     num_cells() const override {
         return cells_.size();
@@ -474,6 +491,23 @@ class SkipIndex {
         fieldChunkMetrics_[field_id] = std::move(cache_slot);
     }
 
+    void
+    LoadSkipFromMetrics(
+        int64_t segment_id,
+        milvus::FieldId field_id,
+        milvus::DataType data_type,
+        std::vector<std::unique_ptr<index::FieldChunkMetrics>> metrics) {
+        auto translator =
+            std::make_unique<FieldChunkMetricsTranslatorFromStatistics>(
+                segment_id, field_id, data_type, std::move(metrics));
+        auto cache_slot = cachinglayer::Manager::GetInstance()
+                              .CreateCacheSlot<index::FieldChunkMetrics>(
+                                  std::move(translator));
+
+        std::unique_lock lck(mutex_);
+        fieldChunkMetrics_[field_id] = std::move(cache_slot);
+    }
+
  private:
     OpType
     FlipComparisonOperator(OpType op) const {
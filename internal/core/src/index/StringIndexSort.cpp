@@ -530,6 +530,24 @@ StringIndexSort::Reverse_Lookup(size_t offset) const {
                                  idx_to_offsets_size_);
 }
 
+void
+StringIndexSort::VisitInValueOrder(
+    bool ascending, const std::function<bool(int64_t)>& fn) const {
+    AssertInfo(SupportOrderedScan(),
+               "ordered scan is not supported by this index");
+    impl_->VisitInValueOrder(ascending, fn);
+}
+
+void
+StringIndexSort::VisitNullsInOrder(
+    const std::function<bool(int64_t)>& fn) const {
+    AssertInfo(SupportOrderedScan(),
+               "ordered scan is not supported by this index");
+    for (auto i = valid_bitset_.find_first(false); i.has_value() && fn(*i);
+         i = valid_bitset_.find_next(*i, false)) {
+    }
+}
+
 int64_t
 StringIndexSort::Size() {
     return total_size_;
@@ -1342,6 +1360,20 @@ StringIndexSortMemoryImpl::Reverse_Lookup(size_t offset,
     return std::nullopt;
 }
 
+void
+StringIndexSortMemoryImpl::VisitInValueOrder(
+    bool ascending, const std::function<bool(int64_t)>& fn) const {
+    auto n = posting_lists_.size();
+    for (size_t i = 0; i < n; ++i) {
+        const auto& posting_list = posting_lists_[ascending ? i : n - 1 - i];
+        for (auto row_id : posting_list) {
+            if (!fn(row_id)) {
+                return;
+            }
+        }
+    }
+}
+
 int64_t
 StringIndexSortMemoryImpl::Size() {
     size_t size = 0;
@@ -1846,6 +1878,19 @@ StringIndexSortMmapImpl::Reverse_Lookup(size_t offset,
     return std::nullopt;
 }
 
+void
+StringIndexSortMmapImpl::VisitInValueOrder(
+    bool ascending, const std::function<bool(int64_t)>& fn) const {
+    for (size_t i = 0; i < unique_count_; ++i) {
+        auto entry = GetEntry(ascending ? i : unique_count_ - 1 - i);
+        for (size_t j = 0; j < entry.get_posting_list_len(); ++j) {
+            if (!fn(entry.get_row_id(j))) {
+                return;
+            }
+        }
+    }
+}
+
 int64_t
 StringIndexSortMmapImpl::Size() {
     return mmap_size_ > 0 ? mmap_size_ : data_size_;
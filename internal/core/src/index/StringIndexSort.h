@@ -138,6 +138,18 @@ class StringIndexSort : public StringIndex {
     std::optional<std::string>
     Reverse_Lookup(size_t offset) const override;
 
+    bool
+    SupportOrderedScan() const override {
+        return is_built_ && !is_nested_index_ && !is_array_field_;
+    }
+
+    void
+    VisitInValueOrder(bool ascending,
+                      const std::function<bool(int64_t)>& fn) const override;
+
+    void
+    VisitNullsInOrder(const std::function<bool(int64_t)>& fn) const override;
+
     int64_t
     Size() override;
 
@@ -253,6 +265,12 @@ class StringIndexSortImpl {
                    const int32_t* idx_to_offsets_ptr,
                    size_t idx_to_offsets_size) const = 0;
 
+    // Walks the posting lists of the sorted unique values, see
+    // ScalarIndex::VisitInValueOrder.
+    virtual void
+    VisitInValueOrder(bool ascending,
+                      const std::function<bool(int64_t)>& fn) const = 0;
+
     virtual int64_t
     Size() = 0;
 
@@ -349,6 +367,10 @@ class StringIndexSortMemoryImpl : public StringIndexSortImpl {
                    const int32_t* idx_to_offsets_ptr,
                    size_t idx_to_offsets_size) const override;
 
+    void
+    VisitInValueOrder(bool ascending,
+                      const std::function<bool(int64_t)>& fn) const override;
+
     int64_t
     Size() override;
 
@@ -505,6 +527,10 @@ class StringIndexSortMmapImpl : public StringIndexSortImpl {
                    const int32_t* idx_to_offsets_ptr,
                    size_t idx_to_offsets_size) const override;
 
+    void
+    VisitInValueOrder(bool ascending,
+                      const std::function<bool(int64_t)>& fn) const override;
+
     int64_t
     Size() override;
 
@@ -1069,3 +1069,49 @@ TEST(StringIndexSortPatternMatchTest, InnerMatchMmap) {
     ASSERT_TRUE(bitset[1]);   // category
     ASSERT_FALSE(bitset[2]);  // dog
 }
+
+TEST_F(StringIndexSortTest, VisitInValueOrder) {
+    std::vector<std::string> test_strs = {
+        "kiwi", "apple", "fig", "banana", "apple", "cherry"};
+    std::unique_ptr<bool[]> valid(new bool[test_strs.size()]);
+    for (size_t i = 0; i < test_strs.size(); i++) {
+        valid[i] = (i != 2);  // "fig" is null
+    }
+    auto index = milvus::index::CreateStringIndexSort({});
+    index->Build(test_strs.size(), test_strs.data(), valid.get());
+
+    Config mmap_config;
+    mmap_config[MMAP_FILE_PATH] =
+        TestLocalPath + "test_string_index_sort_ordered.idx";
+    auto mmap_index = milvus::index::CreateStringIndexSort({});
+    mmap_index->Load(index->Serialize({}), mmap_config);
+
+    for (auto* idx : {index.get(), mmap_index.get()}) {
+        ASSERT_TRUE(idx->SupportOrderedScan());
+        std::vector<std::string> values;
+        idx->VisitInValueOrder(true, [&](int64_t offset) {
+            values.push_back(test_strs[offset]);
+            return true;
+        });
+        ASSERT_EQ(values,
+                  std::vector<std::string>(
+                      {"apple", "apple", "banana", "cherry", "kiwi"}));
+
+        // stops as soon as the callback returns false
+        values.clear();
+        idx->VisitInValueOrder(false, [&](int64_t offset) {
+            values.push_back(test_strs[offset]);
+            return values.size() < 2;
+        });
+        ASSERT_EQ(values, std::vector<std::string>({"kiwi", "cherry"}));
+
+        std::vector<int64_t> nulls;
+        idx->VisitNullsInOrder([&](int64_t offset) {
+            nulls.push_back(offset);
+            return true;
+        });
+        ASSERT_EQ(nulls, std::vector<int64_t>({2}));
+    }
+
+    std::remove((TestLocalPath + "test_string_index_sort_ordered.idx").c_str());
+}
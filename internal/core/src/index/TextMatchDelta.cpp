@@ -0,0 +1,229 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License
+
+#include "index/TextMatchDelta.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <mutex>
+#include <shared_mutex>
+
+namespace milvus::index {
+
+TextMatchDelta::TextMatchDelta(const char* analyzer_params)
+    : tokenizer_(std::make_unique<tantivy::Tokenizer>(
+          std::string(analyzer_params))) {
+}
+
+std::vector<std::pair<int64_t, std::string>>
+TextMatchDelta::Tokenize(tantivy::Tokenizer& tokenizer,
+                         const std::string& text) const {
+    std::vector<std::pair<int64_t, std::string>> tokens;
+    auto token_stream = tokenizer.CreateTokenStreamCopyText(text);
+    while (token_stream->advance()) {
+        auto token = token_stream->get_detailed_token();
+        tokens.emplace_back(token.position, std::string(token.token));
+        free_rust_string(token.token);
+    }
+    return tokens;
+}
+
+void
+TextMatchDelta::Add(size_t n,
+                    const std::string* texts,
+                    const bool* valids,
+                    int64_t offset_begin) {
+    // tokenize outside of the lock, inserts of other rows may run in parallel
+    auto tokenizer = tokenizer_->Clone();
+    std::vector<std::vector<std::pair<int64_t, std::string>>> tokens(n);
+    for (size_t i = 0; i < n; i++) {
+        if (valids == nullptr || valids[i]) {
+            tokens[i] = Tokenize(*tokenizer, texts[i]);
+        }
+    }
+
+    std::unique_lock<folly::SharedMutex> lock(mutex_);
+    auto& generation = generations_[current_generation_];
+    size_t added = 0;
+    for (size_t i = 0; i < n; i++) {
+        int64_t offset = offset_begin + static_cast<int64_t>(i);
+        for (auto& [position, token] : tokens[i]) {
+            added += token.size() + sizeof(Posting);
+            generation.postings[std::move(token)].push_back(
+                Posting{offset, position});
+        }
+    }
+    generation.byte_size += added;
+    byte_size_ += added;
+    row_end_ = std::max(row_end_, offset_begin + static_cast<int64_t>(n));
+}
+
+int64_t
+TextMatchDelta::Seal() {
+    std::unique_lock<folly::SharedMutex> lock(mutex_);
+    return current_generation_++;
+}
+
+void
+TextMatchDelta::Drop(int64_t generation) {
+    std::unique_lock<folly::SharedMutex> lock(mutex_);
+    auto end = generations_.upper_bound(generation);
+    for (auto iter = generations_.begin(); iter != end; ++iter) {
+        byte_size_ -= iter->second.byte_size;
+    }
+    generations_.erase(generations_.begin(), end);
+}
+
+int64_t
+TextMatchDelta::RowEnd() const {
+    std::shared_lock<folly::SharedMutex> lock(mutex_);
+    return row_end_;
+}
+
+size_t
+TextMatchDelta::ByteSize() const {
+    std::shared_lock<folly::SharedMutex> lock(mutex_);
+    return byte_size_;
+}
+
+void
+TextMatchDelta::MatchQuery(const std::string& query,
+                           uint32_t min_should_match,
+                           TargetBitmap& bitset) const {
+    auto tokenizer = tokenizer_->Clone();
+    std::vector<std::string> terms;
+    for (auto& [position, token] : Tokenize(*tokenizer, query)) {
+        terms.push_back(std::move(token));
+    }
+    if (terms.empty()) {
+        return;
+    }
+    std::shared_lock<folly::SharedMutex> lock(mutex_);
+    for (const auto& [id, generation] : generations_) {
+        MatchGeneration(generation, terms, min_should_match, bitset);
+    }
+}
+
+void
+TextMatchDelta::MatchGeneration(const Generation& generation,
+                                const std::vector<std::string>& terms,
+                                uint32_t min_should_match,
+                                TargetBitmap& bitset) const {
+    auto set = [&bitset](int64_t offset) {
+        if (offset < static_cast<int64_t>(bitset.size())) {
+            bitset.set(offset);
+        }
+    };
+    if (min_should_match <= 1) {
+        for (const auto& term : terms) {
+            auto iter = generation.postings.find(term);
+            if (iter == generation.postings.end()) {
+                continue;
+            }
+            for (const auto& posting : iter->second) {
+                set(posting.offset);
+            }
+        }
+        return;
+    }
+
+    // every query token is a clause, a row matches if it contains the terms
+    // of at least min_should_match clauses
+    std::unordered_map<int64_t, uint32_t> matched_clauses;
+    for (const auto& term : terms) {
+        auto iter = generation.postings.find(term);
+        if (iter == generation.postings.end()) {
+            continue;
+        }
+        int64_t last_offset = -1;
+        for (const auto& posting : iter->second) {
+            if (posting.offset != last_offset) {
+                matched_clauses[posting.offset]++;
+                last_offset = posting.offset;
+            }
+        }
+    }
+    for (const auto& [offset, count] : matched_clauses) {
+        if (count >= min_should_match) {
+            set(offset);
+        }
+    }
+}
+
+void
+TextMatchDelta::PhraseMatchQuery(const std::string& query,
+                                 uint32_t slop,
+                                 TargetBitmap& bitset) const {
+    auto tokenizer = tokenizer_->Clone();
+    auto terms = Tokenize(*tokenizer, query);
+    if (terms.empty()) {
+        return;
+    }
+    std::shared_lock<folly::SharedMutex> lock(mutex_);
+    for (const auto& [id, generation] : generations_) {
+        if (terms.size() == 1) {
+            // a single token phrase is a plain match, like in the reader
+            MatchGeneration(generation, {terms[0].second}, 1, bitset);
+        } else {
+            PhraseMatchGeneration(generation, terms, slop, bitset);
+        }
+    }
+}
+
+// Follows the reader's sloppy phrase intersection: positions are shifted by
+// the token's position in the query, and a position r of the next term
+// continues a chain ending at l if |r - l| <= slop, so swapping two tokens
+// costs a slop of 2.
+void
+TextMatchDelta::PhraseMatchGeneration(
+    const Generation& generation,
+    const std::vector<std::pair<int64_t, std::string>>& terms,
+    uint32_t slop,
+    TargetBitmap& bitset) const {
+    std::vector<const std::vector<Posting>*> postings;
+    for (const auto& [position, term] : terms) {
+        auto iter = generation.postings.find(term);
+        if (iter == generation.postings.end()) {
+            return;
+        }
+        postings.push_back(&iter->second);
+    }
+
+    // row offset -> shifted end positions of the chains matched so far
+    std::unordered_map<int64_t, std::vector<int64_t>> chains;
+    for (const auto& posting : *postings[0]) {
+        chains[posting.offset].push_back(posting.position - terms[0].first);
+    }
+    for (size_t i = 1; i < terms.size() && !chains.empty(); i++) {
+        std::unordered_map<int64_t, std::vector<int64_t>> next;
+        for (const auto& posting : *postings[i]) {
+            auto iter = chains.find(posting.offset);
+            if (iter == chains.end()) {
+                continue;
+            }
+            auto right = posting.position - terms[i].first;
+            for (auto left : iter->second) {
+                if (std::abs(right - left) <= static_cast<int64_t>(slop)) {
+                    next[posting.offset].push_back(right);
+                    break;
+                }
+            }
+        }
+        chains = std::move(next);
+    }
+    for (const auto& [offset, ends] : chains) {
+        if (offset < static_cast<int64_t>(bitset.size())) {
+            bitset.set(offset);
+        }
+    }
+}
+
+}  // namespace milvus::index
@@ -0,0 +1,117 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License
+
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <folly/SharedMutex.h>
+
+#include "common/Types.h"
+#include "tantivy/tokenizer.h"
+
+namespace milvus::index {
+
+// In-memory postings of the texts a growing TextMatchIndex received since
+// its reader was last reloaded, so that text match sees fresh rows without
+// waiting for a tantivy commit.
+//
+// Rows are added to the current generation. A commit seals the current
+// generation, and once a reader reload has made a commit visible, all
+// generations sealed up to it are dropped. A row may be both in the delta
+// and in the reader for a while, which is harmless since query results are
+// unioned.
+class TextMatchDelta {
+ public:
+    // analyzer_params must be the params the tantivy writer analyzes with.
+    explicit TextMatchDelta(const char* analyzer_params);
+
+    // texts[i] is the text of row offset_begin + i, valids may be nullptr.
+    void
+    Add(size_t n,
+        const std::string* texts,
+        const bool* valids,
+        int64_t offset_begin);
+
+    // Seals the current generation and returns its id.
+    int64_t
+    Seal();
+
+    // Drops all generations sealed with an id <= generation.
+    void
+    Drop(int64_t generation);
+
+    // One past the largest row offset ever added.
+    int64_t
+    RowEnd() const;
+
+    size_t
+    ByteSize() const;
+
+    // Same semantics as the tantivy reader's match query.
+    void
+    MatchQuery(const std::string& query,
+               uint32_t min_should_match,
+               TargetBitmap& bitset) const;
+
+    // Same semantics as the tantivy reader's phrase match query.
+    void
+    PhraseMatchQuery(const std::string& query,
+                     uint32_t slop,
+                     TargetBitmap& bitset) const;
+
+ private:
+    struct Posting {
+        int64_t offset;
+        int64_t position;
+    };
+
+    struct Generation {
+        // postings of a row are contiguous and in position order
+        std::unordered_map<std::string, std::vector<Posting>> postings;
+        size_t byte_size = 0;
+    };
+
+    // (position, token) of every token of text.
+    std::vector<std::pair<int64_t, std::string>>
+    Tokenize(tantivy::Tokenizer& tokenizer, const std::string& text) const;
+
+    void
+    MatchGeneration(const Generation& generation,
+                    const std::vector<std::string>& terms,
+                    uint32_t min_should_match,
+                    TargetBitmap& bitset) const;
+
+    void
+    PhraseMatchGeneration(
+        const Generation& generation,
+        const std::vector<std::pair<int64_t, std::string>>& terms,
+        uint32_t slop,
+        TargetBitmap& bitset) const;
+
+ private:
+    // tokenizing needs a mutable analyzer, every call works on a clone
+    std::unique_ptr<tantivy::Tokenizer> tokenizer_;
+
+    mutable folly::SharedMutex mutex_;
+    std::map<int64_t, Generation> generations_;
+    int64_t current_generation_{0};
+    int64_t row_end_{0};
+    size_t byte_size_{0};
+};
+
+}  // namespace milvus::index
@@ -9,6 +9,7 @@
 // is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
 // or implied. See the License for the specific language governing permissions and limitations under the License
 
+#include <algorithm>
 #include <boost/uuid/random_generator.hpp>
 #include "common/FastMem.h"
 #include <boost/uuid/uuid_io.hpp>
@@ -37,9 +38,12 @@ TextMatchIndex::TextMatchIndex(int64_t commit_interval_in_ms,
                                const char* unique_id,
                                const char* analyzer_name,
                                const char* analyzer_params,
-                               bool enable_background_merge)
+                               bool enable_background_merge,
+                               int64_t delta_commit_interval_in_ms,
+                               size_t delta_max_byte_size)
     : commit_interval_in_ms_(commit_interval_in_ms),
-      last_commit_time_(stdclock::now()) {
+      last_commit_time_(stdclock::now()),
+      delta_max_byte_size_(delta_max_byte_size) {
     d_type_ = TantivyDataType::Text;
     wrapper_ = std::make_shared<TantivyIndexWrapper>(
         unique_id,
@@ -54,6 +58,16 @@ TextMatchIndex::TextMatchIndex(int64_t commit_interval_in_ms,
         milvus::tantivy::DEFAULT_OVERALL_MEMORY_BUDGET_IN_BYTES,
         enable_background_merge);
     set_is_growing(true);
+    try {
+        delta_ = std::make_unique<TextMatchDelta>(analyzer_params);
+        commit_interval_in_ms_ =
+            std::max(commit_interval_in_ms_, delta_commit_interval_in_ms);
+    } catch (std::exception& e) {
+        LOG_WARN(
+            "text match delta disabled, fresh rows are visible after the "
+            "next commit only: {}",
+            e.what());
+    }
 }
 
 TextMatchIndex::TextMatchIndex(const std::string& path,
@@ -288,9 +302,17 @@ TextMatchIndex::AddTextsGrowing(size_t n,
             }
         }
     }
+    // the delta must only see rows already handed to the writer, see Commit
     wrapper_->add_data(texts, n, offset_begin);
+    if (delta_ != nullptr) {
+        delta_->Add(n, texts, valids, offset_begin);
+    }
     if (shouldTriggerCommit()) {
         Commit();
+        if (delta_ != nullptr) {
+            // release the rows the commit made redundant in the delta
+            Reload();
+        }
     }
 }
 
@@ -344,17 +366,33 @@ TextMatchIndex::Finish() {
 
 bool
 TextMatchIndex::shouldTriggerCommit() {
+    if (delta_ != nullptr && delta_->ByteSize() > delta_max_byte_size_) {
+        return true;
+    }
     auto span = (std::chrono::duration<double, std::milli>(
                      stdclock::now() - last_commit_time_.load()))
                     .count();
     return span > commit_interval_in_ms_;
 }
 
+int64_t
+TextMatchIndex::Count() {
+    auto count = InvertedIndexTantivy<std::string>::Count();
+    if (delta_ != nullptr) {
+        count = std::max(count, delta_->RowEnd());
+    }
+    return count;
+}
+
 void
 TextMatchIndex::Commit() {
     std::unique_lock<std::mutex> lck(mtx_, std::defer_lock);
     if (lck.try_lock()) {
+        // Every row of the sealed generation was added to the writer before
+        // it entered the delta, so this commit covers all of them.
+        auto generation = delta_ != nullptr ? delta_->Seal() : -1;
         wrapper_->commit();
+        committed_generation_.store(generation);
         last_commit_time_.store(stdclock::now());
     }
 }
@@ -363,7 +401,13 @@ void
 TextMatchIndex::Reload() {
     std::unique_lock<std::mutex> lck(mtx_, std::defer_lock);
     if (lck.try_lock()) {
+        auto generation = committed_generation_.load();
+        std::unique_lock<folly::SharedMutex> reader_lock(reader_mutex_);
         wrapper_->reload();
+        if (delta_ != nullptr) {
+            delta_->Drop(generation);
+        }
+        reloaded_generation_.store(generation);
     }
 }
 
@@ -380,9 +424,15 @@ TextMatchIndex::RegisterAnalyzer(const char* analyzer_name,
 
 // Refresh a growing index if due, then allocate the result bitset. Shared by
 // the text-index query methods so the commit/reload logic lives in one place.
+// With a delta, fresh rows are found there and the reader only has to catch
+// up with commits made on the insert path, which also shrinks the delta.
 TargetBitmap
 TextMatchIndex::PrepareBitset() {
-    if (shouldTriggerCommit()) {
+    if (delta_ != nullptr) {
+        if (committed_generation_.load() != reloaded_generation_.load()) {
+            Reload();
+        }
+    } else if (shouldTriggerCommit()) {
         Commit();
         Reload();
     }
@@ -394,7 +444,11 @@ TextMatchIndex::MatchQuery(const std::string& query,
                            uint32_t min_should_match) {
     tracer::AutoSpan span("TextMatchIndex::MatchQuery", tracer::GetRootSpan());
     TargetBitmap bitset = PrepareBitset();
+    std::shared_lock<folly::SharedMutex> reader_lock(reader_mutex_);
     wrapper_->match_query(query, min_should_match, &bitset);
+    if (delta_ != nullptr) {
+        delta_->MatchQuery(query, min_should_match, bitset);
+    }
     return bitset;
 }
 
@@ -403,7 +457,11 @@ TextMatchIndex::PhraseMatchQuery(const std::string& query, uint32_t slop) {
     tracer::AutoSpan span("TextMatchIndex::PhraseMatchQuery",
                           tracer::GetRootSpan());
     TargetBitmap bitset = PrepareBitset();
+    std::shared_lock<folly::SharedMutex> reader_lock(reader_mutex_);
     wrapper_->phrase_match_query(query, slop, &bitset);
+    if (delta_ != nullptr) {
+        delta_->PhraseMatchQuery(query, slop, bitset);
+    }
     return bitset;
 }
 
@@ -412,6 +470,12 @@ TextMatchIndex::FuzzyMatchQuery(const std::string& query,
                                 uint32_t max_edit_distance) {
     tracer::AutoSpan span("TextMatchIndex::FuzzyMatchQuery",
                           tracer::GetRootSpan());
+    // the delta has no fuzzy term lookup, make every row visible to the
+    // reader instead
+    if (delta_ != nullptr && delta_->ByteSize() > 0) {
+        Commit();
+        Reload();
+    }
     TargetBitmap bitset = PrepareBitset();
     wrapper_->fuzzy_match_query(query, max_edit_distance, &bitset);
     return bitset;
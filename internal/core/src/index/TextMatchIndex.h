@@ -17,6 +17,7 @@
 #include "cachinglayer/Manager.h"
 #include "index/InvertedIndexTantivy.h"
 #include "index/IndexStats.h"
+#include "index/TextMatchDelta.h"
 
 namespace milvus::index {
 
@@ -29,11 +30,18 @@ class TextMatchIndex : public InvertedIndexTantivy<std::string> {
     // segment count unbounded); a sealed interim index passes false so that
     // finish()'s explicit merge-all is the only merge and cannot race a
     // background policy merge.
-    explicit TextMatchIndex(int64_t commit_interval_in_ms,
-                            const char* unique_id,
-                            const char* analyzer_name,
-                            const char* analyzer_params,
-                            bool enable_background_merge);
+    // Rows not yet visible to the reader are served from a TextMatchDelta,
+    // so commit_interval_in_ms only bounds how long they stay there. With a
+    // delta, commits are at least delta_commit_interval_in_ms apart unless
+    // the delta grows beyond delta_max_byte_size.
+    explicit TextMatchIndex(
+        int64_t commit_interval_in_ms,
+        const char* unique_id,
+        const char* analyzer_name,
+        const char* analyzer_params,
+        bool enable_background_merge,
+        int64_t delta_commit_interval_in_ms = kDefaultDeltaCommitIntervalInMs,
+        size_t delta_max_byte_size = kDefaultDeltaMaxByteSize);
     // for sealed segment to create index from raw data during loading.
     explicit TextMatchIndex(const std::string& path,
                             const char* unique_id,
@@ -51,7 +59,13 @@ class TextMatchIndex : public InvertedIndexTantivy<std::string> {
 
     using InvertedIndexTantivy<std::string>::Load;
 
+    static constexpr int64_t kDefaultDeltaCommitIntervalInMs = 10 * 1000;
+    static constexpr size_t kDefaultDeltaMaxByteSize = 64 << 20;
+
  public:
+    int64_t
+    Count() override;
+
     IndexStatsPtr
     Upload(const Config& config) override;
 
@@ -114,6 +128,18 @@ class TextMatchIndex : public InvertedIndexTantivy<std::string> {
     mutable std::mutex mtx_;
     std::atomic<stdclock::time_point> last_commit_time_;
     int64_t commit_interval_in_ms_;
+    // rows of a growing index not yet visible to the reader, nullptr if the
+    // analyzer could not be created outside of tantivy's writer
+    std::unique_ptr<TextMatchDelta> delta_;
+    size_t delta_max_byte_size_{kDefaultDeltaMaxByteSize};
+    // held shared by a query across its reader and delta lookups, and
+    // exclusively by Reload across the reader reload and the delta drop, so
+    // a query never misses the rows moving from the delta to the reader
+    folly::SharedMutex reader_mutex_;
+    // generation of the delta sealed by the last commit, and the one the
+    // reader has caught up with
+    std::atomic<int64_t> committed_generation_{-1};
+    std::atomic<int64_t> reloaded_generation_{-1};
 };
 
 class TextMatchIndexHolder {
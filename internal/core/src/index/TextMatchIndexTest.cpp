@@ -15,6 +15,7 @@
 #include <nlohmann/json_fwd.hpp>
 #include <stdint.h>
 #include <boost/filesystem.hpp>
+#include <atomic>
 #include <chrono>
 #include <initializer_list>
 #include <iostream>
@@ -343,6 +344,96 @@ TEST(TextMatch, Index) {
     }
 }
 
+// Rows of a growing index are served from the in-memory delta until a
+// commit and reload make them visible to the reader.
+TEST(TextMatch, GrowingDeltaVisibleBeforeCommit) {
+    using Index = index::TextMatchIndex;
+    auto index = std::make_unique<Index>(std::numeric_limits<int64_t>::max(),
+                                         "unique_id",
+                                         "milvus_tokenizer",
+                                         "{}",
+                                         /*enable_background_merge=*/true);
+    index->Commit();
+    index->CreateReader(milvus::index::SetBitsetGrowing);
+    index->RegisterAnalyzer("milvus_tokenizer", "{}");
+
+    std::vector<std::string> texts = {"football, basketball, pingpang",
+                                      "",
+                                      "swimming, football"};
+    bool valids[] = {true, false, true};
+    index->AddTextsGrowing(texts.size(), texts.data(), valids, 0);
+
+    auto check = [&]() {
+        auto res = index->MatchQuery("football", 1);
+        ASSERT_EQ(res.size(), 3);
+        ASSERT_TRUE(res[0]);
+        ASSERT_FALSE(res[1]);
+        ASSERT_TRUE(res[2]);
+        auto valid = index->IsNotNull();
+        ASSERT_TRUE(valid[0]);
+        ASSERT_FALSE(valid[1]);
+        ASSERT_TRUE(valid[2]);
+
+        res = index->MatchQuery("football pingpang cricket", 2);
+        ASSERT_TRUE(res[0]);
+        ASSERT_FALSE(res[2]);
+
+        res = index->PhraseMatchQuery("football pingpang", 0);
+        ASSERT_FALSE(res[0]);
+        res = index->PhraseMatchQuery("football pingpang", 1);
+        ASSERT_TRUE(res[0]);
+        ASSERT_FALSE(res[2]);
+        res = index->PhraseMatchQuery("football swimming", 1);
+        ASSERT_FALSE(res[2]);
+        res = index->PhraseMatchQuery("football swimming", 2);
+        ASSERT_TRUE(res[2]);
+    };
+    check();
+
+    // once committed and reloaded, the same rows come from the reader
+    index->Commit();
+    index->Reload();
+    check();
+}
+
+// Every insert commits and reloads, moving its row from the delta to the
+// reader. Queries running meanwhile must find each row in one of the two.
+TEST(TextMatch, GrowingDeltaConsistentAcrossReload) {
+    using Index = index::TextMatchIndex;
+    auto index = std::make_unique<Index>(0,
+                                         "unique_id",
+                                         "milvus_tokenizer",
+                                         "{}",
+                                         /*enable_background_merge=*/true,
+                                         /*delta_commit_interval_in_ms=*/0,
+                                         /*delta_max_byte_size=*/0);
+    index->Commit();
+    index->CreateReader(milvus::index::SetBitsetGrowing);
+    index->RegisterAnalyzer("milvus_tokenizer", "{}");
+
+    constexpr int64_t N = 200;
+    std::atomic<int64_t> inserted{0};
+    std::thread writer([&]() {
+        const std::string text = "football";
+        for (int64_t i = 0; i < N; ++i) {
+            index->AddTextsGrowing(1, &text, nullptr, i);
+            inserted.store(i + 1);
+        }
+    });
+    std::thread reader([&]() {
+        while (inserted.load() < N) {
+            auto visible = inserted.load();
+            auto res = index->MatchQuery("football", 1);
+            ASSERT_GE(res.size(), visible);
+            for (int64_t i = 0; i < visible; ++i) {
+                ASSERT_TRUE(res[i]) << "row " << i << " of " << visible;
+            }
+        }
+    });
+    writer.join();
+    reader.join();
+}
+
 TEST(TextMatch, FuzzyIndex) {
     using Index = index::TextMatchIndex;
     auto index = std::make_unique<Index>(std::numeric_limits<int64_t>::max(),
@@ -37,6 +37,7 @@
 #include "common/FieldMeta.h"
 #include "common/Span.h"
 #include "segcore/storagev1translator/ChunkTranslator.h"
+#include "segcore/WarmSetSnapshot.h"
 #include "cachinglayer/Translator.h"
 #include "mmap/ChunkedColumnInterface.h"
 
@@ -122,6 +123,7 @@ class ChunkedColumnBase : public ChunkedColumnInterface {
                                const FieldMeta& field_meta)
         : nullable_(field_meta.is_nullable()),
           data_type_(field_meta.get_data_type()),
+          field_id_(field_meta.get_id()),
           num_chunks_(slot->num_cells()),
           slot_(std::move(slot)) {
         num_rows_ = GetNumRowsUntilChunk().back();
@@ -141,9 +143,14 @@ class ChunkedColumnBase : public ChunkedColumnInterface {
         slot_->CancelWarmup();
     }
 
+    void
+    TrackWarmSet(int64_t segment_id) override {
+        warm_set_segment_id_ = segment_id;
+    }
+
     PinWrapper<const char*>
     DataOfChunk(milvus::OpContext* op_ctx, int chunk_id) const override {
-        auto ca = SemiInlineGet(slot_->PinCells(op_ctx, {chunk_id}));
+        auto ca = PinCells(op_ctx, {chunk_id});
         auto chunk = ca->get_cell_of(chunk_id);
         return PinWrapper<const char*>(std::move(ca), chunk->Data());
     }
@@ -154,8 +161,7 @@ class ChunkedColumnBase : public ChunkedColumnInterface {
             return true;
         }
         auto [chunk_id, offset_in_chunk] = GetChunkIDByOffset(offset);
-        auto ca = SemiInlineGet(
-            slot_->PinCells(op_ctx, {static_cast<cid_t>(chunk_id)}));
+        auto ca = PinCells(op_ctx, {static_cast<cid_t>(chunk_id)});
         auto chunk = ca->get_cell_of(chunk_id);
         return chunk->isValid(offset_in_chunk);
     }
@@ -178,7 +184,7 @@ class ChunkedColumnBase : public ChunkedColumnInterface {
         }
         // nullable:
         if (offsets == nullptr) {
-            auto ca = SemiInlineGet(slot_->PinAllCells(op_ctx));
+            auto ca = PinAllCells(op_ctx);
             for (int64_t i = 0; i < num_rows_; i++) {
                 auto [cid, offset_in_chunk] = GetChunkIDByOffset(i);
                 auto chunk = ca->get_cell_of(cid);
@@ -187,7 +193,7 @@ class ChunkedColumnBase : public ChunkedColumnInterface {
             }
         } else {
             auto [cids, offsets_in_chunk] = ToChunkIdAndOffset(offsets, count);
-            auto ca = SemiInlineGet(slot_->PinCells(op_ctx, cids));
+            auto ca = PinCells(op_ctx, cids);
             for (int64_t i = 0; i < count; i++) {
                 auto chunk = ca->get_cell_of(cids[i]);
                 auto valid = chunk->isValid(offsets_in_chunk[i]);
@@ -231,6 +237,7 @@ class ChunkedColumnBase : public ChunkedColumnInterface {
     void
     PrefetchChunks(milvus::OpContext* op_ctx,
                    const std::vector<int64_t>& chunk_ids) const override {
+        // a prefetch is not an access
         SemiInlineGet(slot_->PinCells(op_ctx, chunk_ids));
     }
 
@@ -359,14 +366,14 @@ class ChunkedColumnBase : public ChunkedColumnInterface {
 
     PinWrapper<Chunk*>
     GetChunk(milvus::OpContext* op_ctx, int64_t chunk_id) const override {
-        auto ca = SemiInlineGet(slot_->PinCells(op_ctx, {chunk_id}));
+        auto ca = PinCells(op_ctx, {chunk_id});
         auto chunk = ca->get_cell_of(chunk_id);
         return PinWrapper<Chunk*>(std::move(ca), chunk);
     }
 
     std::vector<PinWrapper<Chunk*>>
     GetAllChunks(milvus::OpContext* op_ctx) const override {
-        auto ca = SemiInlineGet(slot_->PinAllCells(op_ctx));
+        auto ca = PinAllCells(op_ctx);
         std::vector<PinWrapper<Chunk*>> ret;
         ret.reserve(num_chunks_);
         for (size_t i = 0; i < num_chunks_; i++) {
@@ -389,8 +396,35 @@ class ChunkedColumnBase : public ChunkedColumnInterface {
     }
 
  protected:
+    // Pins through the cache slot, counting the access in the warm set.
+    std::shared_ptr<CellAccessor<Chunk>>
+    PinCells(milvus::OpContext* op_ctx, const std::vector<cid_t>& cids) const {
+        if (warm_set_segment_id_ >= 0) {
+            auto& warm_set = segcore::WarmSetSnapshot::GetInstance();
+            if (warm_set.enabled()) {
+                warm_set.RecordAccesses(warm_set_segment_id_, field_id_, cids);
+            }
+        }
+        return SemiInlineGet(slot_->PinCells(op_ctx, cids));
+    }
+
+    std::shared_ptr<CellAccessor<Chunk>>
+    PinAllCells(milvus::OpContext* op_ctx) const {
+        if (warm_set_segment_id_ >= 0) {
+            auto& warm_set = segcore::WarmSetSnapshot::GetInstance();
+            if (warm_set.enabled()) {
+                warm_set.RecordAllAccesses(
+                    warm_set_segment_id_, field_id_, num_chunks_);
+            }
+        }
+        return SemiInlineGet(slot_->PinAllCells(op_ctx));
+    }
+
     bool nullable_{false};
     DataType data_type_{DataType::NONE};
+    FieldId field_id_;
+    // segment the warm set counts pins under, -1 if untracked
+    int64_t warm_set_segment_id_{-1};
     size_t num_rows_{0};
     size_t num_chunks_{0};
     mutable std::shared_ptr<CacheSlot<Chunk>> slot_;
@@ -410,7 +444,7 @@ class ChunkedColumn : public ChunkedColumnBase {
                 const int64_t* offsets,
                 int64_t count) override {
         auto [cids, offsets_in_chunk] = ToChunkIdAndOffset(offsets, count);
-        auto ca = SemiInlineGet(slot_->PinCells(op_ctx, cids));
+        auto ca = PinCells(op_ctx, cids);
         for (int64_t i = 0; i < count; i++) {
             auto chunk = ca->get_cell_of(cids[i]);
             auto offset = offsets_in_chunk[i];
@@ -429,14 +463,22 @@ class ChunkedColumn : public ChunkedColumnBase {
                              int64_t count) {
         static_assert(std::is_fundamental_v<S> && std::is_fundamental_v<T>);
         auto [cids, offsets_in_chunk] = ToChunkIdAndOffset(offsets, count);
-        auto ca = SemiInlineGet(slot_->PinCells(op_ctx, cids));
+        auto ca = PinCells(op_ctx, cids);
         auto typed_dst = static_cast<T*>(dst);
-        for (int64_t i = 0; i < count; i++) {
-            auto chunk = ca->get_cell_of(cids[i]);
-            auto value = chunk->ValueAt(offsets_in_chunk[i]);
-            typed_dst[i] =
-                *static_cast<const S*>(static_cast<const void*>(value));
-        }
+        VisitInChunkOrder(
+            cids,
+            offsets_in_chunk,
+            false,
+            [&](int64_t i) {
+                __builtin_prefetch(
+                    ca->get_cell_of(cids[i])->ValueAt(offsets_in_chunk[i]));
+            },
+            [&](int64_t i) {
+                auto chunk = ca->get_cell_of(cids[i]);
+                auto value = chunk->ValueAt(offsets_in_chunk[i]);
+                typed_dst[i] =
+                    *static_cast<const S*>(static_cast<const void*>(value));
+            });
     }
 
     void
@@ -513,23 +555,30 @@ class ChunkedColumn : public ChunkedColumnBase {
                       int64_t element_sizeof,
                       int64_t count) override {
         auto [cids, offsets_in_chunk] = ToChunkIdAndOffset(offsets, count);
-        auto ca = SemiInlineGet(slot_->PinCells(op_ctx, cids));
+        auto ca = PinCells(op_ctx, cids);
         auto dst_vec = reinterpret_cast<char*>(dst);
-        for (int64_t i = 0; i < count; i++) {
+        auto value_at = [&](int64_t i) {
             auto chunk = ca->get_cell_of(cids[i]);
             auto offset = offsets_in_chunk[i];
             if (nullable_) {
                 offset = chunk->PhysicalOffsetOf(offset);
             }
-            auto value = chunk->ValueAt(offset);
-            milvus::fastmem::FastMemcpy(
-                dst_vec + i * element_sizeof, value, element_sizeof);
-        }
+            return chunk->ValueAt(offset);
+        };
+        VisitInChunkOrder(
+            cids,
+            offsets_in_chunk,
+            false,
+            [&](int64_t i) { __builtin_prefetch(value_at(i)); },
+            [&](int64_t i) {
+                milvus::fastmem::FastMemcpy(
+                    dst_vec + i * element_sizeof, value_at(i), element_sizeof);
+            });
     }
 
     PinWrapper<SpanBase>
     Span(milvus::OpContext* op_ctx, int64_t chunk_id) const override {
-        auto ca = SemiInlineGet(slot_->PinCells(op_ctx, {chunk_id}));
+        auto ca = PinCells(op_ctx, {chunk_id});
         auto chunk = ca->get_cell_of(chunk_id);
         return PinWrapper<SpanBase>(
             std::move(ca), static_cast<FixedWidthChunk*>(chunk)->Span());
@@ -553,7 +602,7 @@ class ChunkedVariableColumn : public ChunkedColumnBase {
                 int64_t chunk_id,
                 std::optional<std::pair<int64_t, int64_t>> offset_len =
                     std::nullopt) const override {
-        auto ca = SemiInlineGet(slot_->PinCells(op_ctx, {chunk_id}));
+        auto ca = PinCells(op_ctx, {chunk_id});
         auto chunk = ca->get_cell_of(chunk_id);
         return PinWrapper<
             std::pair<std::vector<std::string_view>, FixedVector<bool>>>(
@@ -565,7 +614,7 @@ class ChunkedVariableColumn : public ChunkedColumnBase {
     StringViewsByOffsets(milvus::OpContext* op_ctx,
                          int64_t chunk_id,
                          const FixedVector<int32_t>& offsets) const override {
-        auto ca = SemiInlineGet(slot_->PinCells(op_ctx, {chunk_id}));
+        auto ca = PinCells(op_ctx, {chunk_id});
         auto chunk = ca->get_cell_of(chunk_id);
         return PinWrapper<
             std::pair<std::vector<std::string_view>, FixedVector<bool>>>(
@@ -577,14 +626,15 @@ class ChunkedVariableColumn : public ChunkedColumnBase {
     BulkRawStringAt(milvus::OpContext* op_ctx,
                     std::function<void(std::string_view, size_t, bool)> fn,
                     const int64_t* offsets,
-                    int64_t count) const override {
+                    int64_t count,
+                    bool any_order) const override {
         if constexpr (!std::is_same_v<T, std::string>) {
             ThrowInfo(ErrorCode::Unsupported,
                       "BulkRawStringAt only supported for "
                       "ChunkedVariableColumn<std::string>");
         }
         if (offsets == nullptr) {
-            auto ca = SemiInlineGet(slot_->PinAllCells(op_ctx));
+            auto ca = PinAllCells(op_ctx);
             for (int64_t i = 0; i < num_rows_; i++) {
                 auto [cid, offset_in_chunk] = GetChunkIDByOffset(i);
                 auto chunk = ca->get_cell_of(cid);
@@ -596,16 +646,24 @@ class ChunkedVariableColumn : public ChunkedColumnBase {
             }
         } else {
             auto [cids, offsets_in_chunk] = ToChunkIdAndOffset(offsets, count);
-            auto ca = SemiInlineGet(slot_->PinCells(op_ctx, cids));
-            for (int64_t i = 0; i < count; i++) {
-                auto chunk = ca->get_cell_of(cids[i]);
-                auto valid =
-                    nullable_ ? chunk->isValid(offsets_in_chunk[i]) : true;
-                fn(static_cast<StringChunk*>(chunk)->operator[](
-                       offsets_in_chunk[i]),
-                   i,
-                   valid);
-            }
+            auto ca = PinCells(op_ctx, cids);
+            VisitInChunkOrder(
+                cids,
+                offsets_in_chunk,
+                !any_order,
+                [&](int64_t i) {
+                    __builtin_prefetch(ca->get_cell_of(cids[i])->ValueAt(
+                        offsets_in_chunk[i]));
+                },
+                [&](int64_t i) {
+                    auto chunk = ca->get_cell_of(cids[i]);
+                    auto valid =
+                        nullable_ ? chunk->isValid(offsets_in_chunk[i]) : true;
+                    fn(static_cast<StringChunk*>(chunk)->operator[](
+                           offsets_in_chunk[i]),
+                       i,
+                       valid);
+                });
         }
     }
 
@@ -613,7 +671,8 @@ class ChunkedVariableColumn : public ChunkedColumnBase {
     BulkRawJsonAt(milvus::OpContext* op_ctx,
                   std::function<void(Json, size_t, bool)> fn,
                   const int64_t* offsets,
-                  int64_t count) const override {
+                  int64_t count,
+                  bool any_order) const override {
         if constexpr (!std::is_same_v<T, Json>) {
             ThrowInfo(
                 ErrorCode::Unsupported,
@@ -623,14 +682,23 @@ class ChunkedVariableColumn : public ChunkedColumnBase {
             return;
         }
         auto [cids, offsets_in_chunk] = ToChunkIdAndOffset(offsets, count);
-        auto ca = SemiInlineGet(slot_->PinCells(op_ctx, cids));
-        for (int64_t i = 0; i < count; i++) {
-            auto chunk = ca->get_cell_of(cids[i]);
-            auto valid = nullable_ ? chunk->isValid(offsets_in_chunk[i]) : true;
-            auto str_view = static_cast<StringChunk*>(chunk)->operator[](
-                offsets_in_chunk[i]);
-            fn(Json(str_view.data(), str_view.size()), i, valid);
-        }
+        auto ca = PinCells(op_ctx, cids);
+        VisitInChunkOrder(
+            cids,
+            offsets_in_chunk,
+            !any_order,
+            [&](int64_t i) {
+                __builtin_prefetch(
+                    ca->get_cell_of(cids[i])->ValueAt(offsets_in_chunk[i]));
+            },
+            [&](int64_t i) {
+                auto chunk = ca->get_cell_of(cids[i]);
+                auto valid =
+                    nullable_ ? chunk->isValid(offsets_in_chunk[i]) : true;
+                auto str_view = static_cast<StringChunk*>(chunk)->operator[](
+                    offsets_in_chunk[i]);
+                fn(Json(str_view.data(), str_view.size()), i, valid);
+            });
     }
 
     void
@@ -646,7 +714,7 @@ class ChunkedVariableColumn : public ChunkedColumnBase {
                    "row_offsets and value_offsets must be provided");
 
         auto [cids, offsets_in_chunk] = ToChunkIdAndOffset(row_offsets, count);
-        auto ca = SemiInlineGet(slot_->PinCells(op_ctx, cids));
+        auto ca = PinCells(op_ctx, cids);
         for (int64_t i = 0; i < count; i++) {
             auto chunk = ca->get_cell_of(cids[i]);
             auto str_view = static_cast<StringChunk*>(chunk)->operator[](
@@ -670,14 +738,20 @@ class ChunkedArrayColumn : public ChunkedColumnBase {
     BulkArrayAt(milvus::OpContext* op_ctx,
                 std::function<void(const ArrayView&, size_t)> fn,
                 const int64_t* offsets,
-                int64_t count) const override {
+                int64_t count,
+                bool any_order) const override {
         auto [cids, offsets_in_chunk] = ToChunkIdAndOffset(offsets, count);
-        auto ca = SemiInlineGet(slot_->PinCells(op_ctx, cids));
-        for (int64_t i = 0; i < count; i++) {
-            auto view = static_cast<ArrayChunk*>(ca->get_cell_of(cids[i]))
-                            ->View(offsets_in_chunk[i]);
-            fn(view, i);
-        }
+        auto ca = PinCells(op_ctx, cids);
+        VisitInChunkOrder(
+            cids,
+            offsets_in_chunk,
+            !any_order,
+            [](int64_t) {},
+            [&](int64_t i) {
+                auto view = static_cast<ArrayChunk*>(ca->get_cell_of(cids[i]))
+                                ->View(offsets_in_chunk[i]);
+                fn(view, i);
+            });
     }
 
     PinWrapper<std::pair<std::vector<ArrayView>, FixedVector<bool>>>
@@ -685,8 +759,7 @@ class ChunkedArrayColumn : public ChunkedColumnBase {
                int64_t chunk_id,
                std::optional<std::pair<int64_t, int64_t>> offset_len =
                    std::nullopt) const override {
-        auto ca = SemiInlineGet(
-            slot_->PinCells(op_ctx, {static_cast<cid_t>(chunk_id)}));
+        auto ca = PinCells(op_ctx, {static_cast<cid_t>(chunk_id)});
         auto chunk = ca->get_cell_of(chunk_id);
         return PinWrapper<std::pair<std::vector<ArrayView>, FixedVector<bool>>>(
             std::move(ca), static_cast<ArrayChunk*>(chunk)->Views(offset_len));
@@ -696,7 +769,7 @@ class ChunkedArrayColumn : public ChunkedColumnBase {
     ArrayViewsByOffsets(milvus::OpContext* op_ctx,
                         int64_t chunk_id,
                         const FixedVector<int32_t>& offsets) const override {
-        auto ca = SemiInlineGet(slot_->PinCells(op_ctx, {chunk_id}));
+        auto ca = PinCells(op_ctx, {chunk_id});
         auto chunk = ca->get_cell_of(chunk_id);
         return PinWrapper<std::pair<std::vector<ArrayView>, FixedVector<bool>>>(
             std::move(ca),
@@ -717,7 +790,7 @@ class ChunkedVectorArrayColumn : public ChunkedColumnBase {
                       const int64_t* offsets,
                       int64_t count) const override {
         auto [cids, offsets_in_chunk] = ToChunkIdAndOffset(offsets, count);
-        auto ca = SemiInlineGet(slot_->PinCells(op_ctx, cids));
+        auto ca = PinCells(op_ctx, cids);
         for (int64_t i = 0; i < count; i++) {
             auto chunk =
                 static_cast<VectorArrayChunk*>(ca->get_cell_of(cids[i]));
@@ -732,8 +805,7 @@ class ChunkedVectorArrayColumn : public ChunkedColumnBase {
                      int64_t chunk_id,
                      std::optional<std::pair<int64_t, int64_t>> offset_len =
                          std::nullopt) const override {
-        auto ca = SemiInlineGet(
-            slot_->PinCells(op_ctx, {static_cast<cid_t>(chunk_id)}));
+        auto ca = PinCells(op_ctx, {static_cast<cid_t>(chunk_id)});
         auto chunk = ca->get_cell_of(chunk_id);
         return PinWrapper<
             std::pair<std::vector<VectorArrayView>, FixedVector<bool>>>(
@@ -744,8 +816,7 @@ class ChunkedVectorArrayColumn : public ChunkedColumnBase {
     PinWrapper<const size_t*>
     VectorArrayOffsets(milvus::OpContext* op_ctx,
                        int64_t chunk_id) const override {
-        auto ca = SemiInlineGet(
-            slot_->PinCells(op_ctx, {static_cast<cid_t>(chunk_id)}));
+        auto ca = PinCells(op_ctx, {static_cast<cid_t>(chunk_id)});
         auto chunk = ca->get_cell_of(chunk_id);
         return PinWrapper<const size_t*>(
             std::move(ca), static_cast<VectorArrayChunk*>(chunk)->Offsets());
@@ -37,6 +37,7 @@
 #include "common/Span.h"
 #include "mmap/ChunkedColumnInterface.h"
 #include "segcore/storagev2translator/GroupCTMeta.h"
+#include "segcore/WarmSetSnapshot.h"
 
 namespace milvus {
 
@@ -68,6 +69,15 @@ class ChunkedColumnGroup {
         slot_->CancelWarmup();
     }
 
+    // Counts the cells pinned through this group as accesses of each of
+    // field_ids of segment_id in the warm set snapshot. Called before the
+    // group is shared.
+    void
+    TrackWarmSet(int64_t segment_id, std::vector<FieldId> field_ids) {
+        warm_set_segment_id_ = segment_id;
+        warm_set_field_ids_ = std::move(field_ids);
+    }
+
     // Get the number of group chunks
     size_t
     num_chunks() const {
@@ -80,7 +90,7 @@ class ChunkedColumnGroup {
             chunk_id >= 0 && chunk_id < num_chunks_,
             "[StorageV2] chunk_id out of range: " + std::to_string(chunk_id) +
                 ", num_chunks: " + std::to_string(num_chunks_));
-        auto ca = SemiInlineGet(slot_->PinCells(op_ctx, {chunk_id}));
+        auto ca = PinCells(op_ctx, {chunk_id});
         auto chunk = ca->get_cell_of(chunk_id);
         return PinWrapper<GroupChunk*>(std::move(ca), chunk);
     }
@@ -94,7 +104,14 @@ class ChunkedColumnGroup {
                            std::to_string(chunk_id) +
                            ", num_chunks: " + std::to_string(num_chunks_));
         }
-        return SemiInlineGet(slot_->PinCells(op_ctx, chunk_ids));
+        return PinCells(op_ctx, chunk_ids);
+    }
+
+    // Loads chunk_ids without counting them as accessed.
+    void
+    PrefetchGroupChunks(milvus::OpContext* op_ctx,
+                        const std::vector<int64_t>& chunk_ids) {
+        SemiInlineGet(slot_->PinCells(op_ctx, chunk_ids));
     }
 
     bool
@@ -106,7 +123,7 @@ class ChunkedColumnGroup {
 
     std::vector<PinWrapper<GroupChunk*>>
     GetAllGroupChunks(milvus::OpContext* op_ctx) {
-        auto ca = SemiInlineGet(slot_->PinAllCells(op_ctx));
+        auto ca = PinAllCells(op_ctx);
         std::vector<PinWrapper<GroupChunk*>> ret;
         ret.reserve(num_chunks_);
         for (size_t i = 0; i < num_chunks_; i++) {
@@ -193,9 +210,41 @@ class ChunkedColumnGroup {
     }
 
  protected:
+    // Pins through the cache slot, counting the access in the warm set.
+    std::shared_ptr<CellAccessor<GroupChunk>>
+    PinCells(milvus::OpContext* op_ctx, const std::vector<cid_t>& cids) const {
+        if (warm_set_segment_id_ >= 0) {
+            auto& warm_set = segcore::WarmSetSnapshot::GetInstance();
+            if (warm_set.enabled()) {
+                for (auto field_id : warm_set_field_ids_) {
+                    warm_set.RecordAccesses(
+                        warm_set_segment_id_, field_id, cids);
+                }
+            }
+        }
+        return SemiInlineGet(slot_->PinCells(op_ctx, cids));
+    }
+
+    std::shared_ptr<CellAccessor<GroupChunk>>
+    PinAllCells(milvus::OpContext* op_ctx) const {
+        if (warm_set_segment_id_ >= 0) {
+            auto& warm_set = segcore::WarmSetSnapshot::GetInstance();
+            if (warm_set.enabled()) {
+                for (auto field_id : warm_set_field_ids_) {
+                    warm_set.RecordAllAccesses(
+                        warm_set_segment_id_, field_id, num_chunks_);
+                }
+            }
+        }
+        return SemiInlineGet(slot_->PinAllCells(op_ctx));
+    }
+
     mutable std::shared_ptr<CacheSlot<GroupChunk>> slot_;
     size_t num_chunks_{0};
     size_t num_rows_{0};
+    // segment the warm set counts pins under, -1 if untracked
+    int64_t warm_set_segment_id_{-1};
+    std::vector<FieldId> warm_set_field_ids_;
 };
 
 class ProxyChunkColumn : public ChunkedColumnInterface {
@@ -307,7 +356,7 @@ class ProxyChunkColumn : public ChunkedColumnInterface {
     void
     PrefetchChunks(milvus::OpContext* op_ctx,
                    const std::vector<int64_t>& chunk_ids) const override {
-        group_->GetGroupChunks(op_ctx, chunk_ids);
+        group_->PrefetchGroupChunks(op_ctx, chunk_ids);
     }
 
     bool
@@ -495,14 +544,21 @@ class ProxyChunkColumn : public ChunkedColumnInterface {
         static_assert(std::is_fundamental_v<S> && std::is_fundamental_v<T>);
         auto [cids, offsets_in_chunk] = ToChunkIdAndOffset(offsets, count);
         auto ca = group_->GetGroupChunks(op_ctx, cids);
+        auto chunks = FieldChunksOf(*ca, cids);
         auto typed_dst = static_cast<T*>(dst);
-        for (int64_t i = 0; i < count; i++) {
-            auto* group_chunk = ca->get_cell_of(cids[i]);
-            auto chunk = group_chunk->GetChunk(field_id_);
-            auto value = chunk->ValueAt(offsets_in_chunk[i]);
-            typed_dst[i] =
-                *static_cast<const S*>(static_cast<const void*>(value));
-        }
+        VisitInChunkOrder(
+            cids,
+            offsets_in_chunk,
+            false,
+            [&](int64_t i) {
+                __builtin_prefetch(
+                    chunks[cids[i]]->ValueAt(offsets_in_chunk[i]));
+            },
+            [&](int64_t i) {
+                auto value = chunks[cids[i]]->ValueAt(offsets_in_chunk[i]);
+                typed_dst[i] =
+                    *static_cast<const S*>(static_cast<const void*>(value));
+            });
     }
 
     void
@@ -580,25 +636,33 @@ class ProxyChunkColumn : public ChunkedColumnInterface {
                       int64_t count) override {
         auto [cids, offsets_in_chunk] = ToChunkIdAndOffset(offsets, count);
         auto ca = group_->GetGroupChunks(op_ctx, cids);
+        auto chunks = FieldChunksOf(*ca, cids);
         auto dst_vec = reinterpret_cast<char*>(dst);
-        for (int64_t i = 0; i < count; i++) {
-            auto* group_chunk = ca->get_cell_of(cids[i]);
-            auto chunk = group_chunk->GetChunk(field_id_);
+        auto value_at = [&](int64_t i) {
+            auto& chunk = chunks[cids[i]];
             auto offset = offsets_in_chunk[i];
             if (field_meta_.is_nullable()) {
                 offset = chunk->PhysicalOffsetOf(offset);
             }
-            auto value = chunk->ValueAt(offset);
-            milvus::fastmem::FastMemcpy(
-                dst_vec + i * element_sizeof, value, element_sizeof);
-        }
+            return chunk->ValueAt(offset);
+        };
+        VisitInChunkOrder(
+            cids,
+            offsets_in_chunk,
+            false,
+            [&](int64_t i) { __builtin_prefetch(value_at(i)); },
+            [&](int64_t i) {
+                milvus::fastmem::FastMemcpy(
+                    dst_vec + i * element_sizeof, value_at(i), element_sizeof);
+            });
     }
 
     void
     BulkRawStringAt(milvus::OpContext* op_ctx,
                     std::function<void(std::string_view, size_t, bool)> fn,
                     const int64_t* offsets = nullptr,
-                    int64_t count = 0) const override {
+                    int64_t count = 0,
+                    bool any_order = false) const override {
         if (!IsChunkedVariableColumnDataType(data_type_) ||
             data_type_ == DataType::JSON) {
             ThrowInfo(ErrorCode::Unsupported,
@@ -623,20 +687,23 @@ class ProxyChunkColumn : public ChunkedColumnInterface {
         } else {
             auto [cids, offsets_in_chunk] = ToChunkIdAndOffset(offsets, count);
             auto ca = group_->GetGroupChunks(op_ctx, cids);
-            std::vector<std::shared_ptr<Chunk>> chunks(num_chunks());
-            for (int64_t i = 0; i < count; i++) {
-                auto cid = cids[i];
-                auto& chunk = chunks[cid];
-                if (chunk == nullptr) {
-                    auto* group_chunk = ca->get_cell_of(cid);
-                    chunk = group_chunk->GetChunk(field_id_);
-                }
-                auto valid = chunk->isValid(offsets_in_chunk[i]);
-                auto value = static_cast<StringChunk*>(chunk.get())
-                                 ->
-                                 operator[](offsets_in_chunk[i]);
-                fn(value, i, valid);
-            }
+            auto chunks = FieldChunksOf(*ca, cids);
+            VisitInChunkOrder(
+                cids,
+                offsets_in_chunk,
+                !any_order,
+                [&](int64_t i) {
+                    __builtin_prefetch(
+                        chunks[cids[i]]->ValueAt(offsets_in_chunk[i]));
+                },
+                [&](int64_t i) {
+                    auto& chunk = chunks[cids[i]];
+                    auto valid = chunk->isValid(offsets_in_chunk[i]);
+                    auto value = static_cast<StringChunk*>(chunk.get())
+                                     ->
+                                     operator[](offsets_in_chunk[i]);
+                    fn(value, i, valid);
+                });
         }
     }
 
@@ -645,7 +712,8 @@ class ProxyChunkColumn : public ChunkedColumnInterface {
     BulkRawJsonAt(milvus::OpContext* op_ctx,
                   std::function<void(Json, size_t, bool)> fn,
                   const int64_t* offsets,
-                  int64_t count) const override {
+                  int64_t count,
+                  bool any_order) const override {
         if (data_type_ != DataType::JSON) {
             ThrowInfo(ErrorCode::Unsupported,
                       "[StorageV2] RawJsonAt only supported for "
@@ -656,16 +724,23 @@ class ProxyChunkColumn : public ChunkedColumnInterface {
         }
         auto [cids, offsets_in_chunk] = ToChunkIdAndOffset(offsets, count);
         auto ca = group_->GetGroupChunks(op_ctx, cids);
-
-        for (int64_t i = 0; i < count; i++) {
-            auto* group_chunk = ca->get_cell_of(cids[i]);
-            auto chunk = group_chunk->GetChunk(field_id_);
-            auto valid = chunk->isValid(offsets_in_chunk[i]);
-            auto str_view = static_cast<StringChunk*>(chunk.get())
-                                ->
-                                operator[](offsets_in_chunk[i]);
-            fn(Json(str_view.data(), str_view.size()), i, valid);
-        }
+        auto chunks = FieldChunksOf(*ca, cids);
+        VisitInChunkOrder(
+            cids,
+            offsets_in_chunk,
+            !any_order,
+            [&](int64_t i) {
+                __builtin_prefetch(
+                    chunks[cids[i]]->ValueAt(offsets_in_chunk[i]));
+            },
+            [&](int64_t i) {
+                auto& chunk = chunks[cids[i]];
+                auto valid = chunk->isValid(offsets_in_chunk[i]);
+                auto str_view = static_cast<StringChunk*>(chunk.get())
+                                    ->
+                                    operator[](offsets_in_chunk[i]);
+                fn(Json(str_view.data(), str_view.size()), i, valid);
+            });
     }
 
     void
@@ -704,7 +779,8 @@ class ProxyChunkColumn : public ChunkedColumnInterface {
     BulkArrayAt(milvus::OpContext* op_ctx,
                 std::function<void(const ArrayView&, size_t)> fn,
                 const int64_t* offsets,
-                int64_t count) const override {
+                int64_t count,
+                bool any_order) const override {
         if (!IsChunkedArrayColumnDataType(data_type_)) {
             ThrowInfo(ErrorCode::Unsupported,
                       "[StorageV2] BulkArrayAt only supported for "
@@ -712,13 +788,17 @@ class ProxyChunkColumn : public ChunkedColumnInterface {
         }
         auto [cids, offsets_in_chunk] = ToChunkIdAndOffset(offsets, count);
         auto ca = group_->GetGroupChunks(op_ctx, cids);
-        for (int64_t i = 0; i < count; i++) {
-            auto* group_chunk = ca->get_cell_of(cids[i]);
-            auto chunk = group_chunk->GetChunk(field_id_);
-            auto view = static_cast<ArrayChunk*>(chunk.get())
-                            ->View(offsets_in_chunk[i]);
-            fn(view, i);
-        }
+        auto chunks = FieldChunksOf(*ca, cids);
+        VisitInChunkOrder(
+            cids,
+            offsets_in_chunk,
+            !any_order,
+            [](int64_t) {},
+            [&](int64_t i) {
+                auto view = static_cast<ArrayChunk*>(chunks[cids[i]].get())
+                                ->View(offsets_in_chunk[i]);
+                fn(view, i);
+            });
     }
 
     void
@@ -744,6 +824,21 @@ class ProxyChunkColumn : public ChunkedColumnInterface {
         }
     }
 
+ private:
+    // This field's chunk of every pinned group cell, indexed by cid, so a
+    // bulk read resolves each cell once instead of once per row.
+    std::vector<std::shared_ptr<Chunk>>
+    FieldChunksOf(CellAccessor<GroupChunk>& ca,
+                  const std::vector<cid_t>& cids) const {
+        std::vector<std::shared_ptr<Chunk>> chunks(num_chunks());
+        for (auto cid : cids) {
+            if (chunks[cid] == nullptr) {
+                chunks[cid] = ca.get_cell_of(cid)->GetChunk(field_id_);
+            }
+        }
+        return chunks;
+    }
+
  private:
     std::shared_ptr<ChunkedColumnGroup> group_;
     FieldId field_id_;
@@ -15,8 +15,11 @@
 // limitations under the License.
 #pragma once
 
+#include <algorithm>
 #include <atomic>
 #include <mutex>
+#include <numeric>
+#include <vector>
 
 #include "cachinglayer/CacheSlot.h"
 #include "common/Chunk.h"
@@ -48,6 +51,13 @@ class ChunkedColumnInterface {
     CancelWarmup() {
     }
 
+    // Counts the cells pinned through this column as accesses of segment_id
+    // in the warm set snapshot. Called before the column is shared.
+    // Default implementation does nothing.
+    virtual void
+    TrackWarmSet(int64_t segment_id) {
+    }
+
     // Get raw data pointer of a specific chunk
     virtual cachinglayer::PinWrapper<const char*>
     DataOfChunk(milvus::OpContext* op_ctx, int chunk_id) const = 0;
@@ -289,11 +299,14 @@ class ChunkedColumnInterface {
     // If offsets is nullptr, this function will iterate over all rows.
     // Only BulkRawStringAt and BulkIsValid allow offsets to be nullptr.
     // Other Bulk* methods can also support nullptr offsets, but not added at this moment.
+    // any_order: fn only depends on its index argument, so the rows may be
+    // visited in chunk order rather than in the order of offsets.
     virtual void
     BulkRawStringAt(milvus::OpContext* op_ctx,
                     std::function<void(std::string_view, size_t, bool)> fn,
                     const int64_t* offsets = nullptr,
-                    int64_t count = 0) const {
+                    int64_t count = 0,
+                    bool any_order = false) const {
         ThrowInfo(ErrorCode::Unsupported,
                   "BulkRawStringAt only supported for ChunkColumnInterface of "
                   "variable length type");
@@ -303,7 +316,8 @@ class ChunkedColumnInterface {
     BulkRawJsonAt(milvus::OpContext* op_ctx,
                   std::function<void(Json, size_t, bool)> fn,
                   const int64_t* offsets,
-                  int64_t count) const {
+                  int64_t count,
+                  bool any_order = false) const {
         ThrowInfo(
             ErrorCode::Unsupported,
             "RawJsonAt only supported for ChunkColumnInterface of Json type");
@@ -324,7 +338,8 @@ class ChunkedColumnInterface {
     BulkArrayAt(milvus::OpContext* op_ctx,
                 std::function<void(const ArrayView&, size_t)> fn,
                 const int64_t* offsets,
-                int64_t count) const {
+                int64_t count,
+                bool any_order = false) const {
         ThrowInfo(ErrorCode::Unsupported,
                   "BulkArrayAt only supported for ChunkedArrayColumn");
     }
@@ -372,6 +387,51 @@ class ChunkedColumnInterface {
     }
 
  protected:
+    // Bulk reads of fewer rows are not worth sorting.
+    static constexpr int64_t kChunkOrderMinRows = 64;
+    // Rows between prefetching a value and reading it.
+    static constexpr int64_t kBulkPrefetchDistance = 8;
+
+    // Calls fn(i) for every row i of a bulk read, with prefetch(i) issued
+    // kBulkPrefetchDistance rows ahead. Unless keep_order is set, rows are
+    // visited sorted by (chunk, offset in chunk): top-k results come in
+    // score order, which is random with respect to the chunks, and sorting
+    // turns the scattered faults on mmap'd chunks into forward scans. The
+    // callers write row i to slot i, which scatters the values back.
+    template <typename OffsetT, typename Prefetch, typename Fn>
+    static void
+    VisitInChunkOrder(const std::vector<milvus::cachinglayer::cid_t>& cids,
+                      const std::vector<OffsetT>& offsets_in_chunk,
+                      bool keep_order,
+                      Prefetch&& prefetch,
+                      Fn&& fn) {
+        const auto count = static_cast<int64_t>(cids.size());
+        std::vector<int64_t> order;
+        if (!keep_order && count >= kChunkOrderMinRows) {
+            auto before = [&](int64_t a, int64_t b) {
+                return cids[a] != cids[b]
+                           ? cids[a] < cids[b]
+                           : offsets_in_chunk[a] < offsets_in_chunk[b];
+            };
+            bool sorted = true;
+            for (int64_t i = 1; i < count && sorted; ++i) {
+                sorted = !before(i, i - 1);
+            }
+            if (!sorted) {
+                order.resize(count);
+                std::iota(order.begin(), order.end(), 0);
+                std::sort(order.begin(), order.end(), before);
+            }
+        }
+        auto row = [&](int64_t j) { return order.empty() ? j : order[j]; };
+        for (int64_t j = 0; j < count; ++j) {
+            if (j + kBulkPrefetchDistance < count) {
+                prefetch(row(j + kBulkPrefetchDistance));
+            }
+            fn(row(j));
+        }
+    }
+
     FixedVector<bool> valid_data_;
     std::vector<int64_t> valid_count_per_chunk_;
     std::vector<int64_t> num_valid_rows_until_chunk_;
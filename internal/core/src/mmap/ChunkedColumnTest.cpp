@@ -10,6 +10,8 @@
 // or implied. See the License for the specific language governing permissions and limitations under the License
 
 #include <cachinglayer/Translator.h>
+#include <algorithm>
+#include <random>
 #include "common/Chunk.h"
 #include "gtest/gtest.h"
 #include "mmap/ChunkedColumn.h"
@@ -250,4 +252,67 @@ TEST(test_chunked_column, test_nullable_all_null) {
     }
 }
 
+TEST(test_chunked_column, test_bulk_read_unsorted_offsets) {
+    // Four chunks of int64 values equal to their global row offset.
+    std::vector<int64_t> num_rows_per_chunk = {100, 50, 150, 100};
+    auto num_chunks = num_rows_per_chunk.size();
+    std::vector<std::vector<int64_t>> buffers(num_chunks);
+    std::vector<std::unique_ptr<Chunk>> chunks;
+    int64_t total_rows = 0;
+    for (size_t i = 0; i < num_chunks; i++) {
+        auto row_num = num_rows_per_chunk[i];
+        for (int64_t j = 0; j < row_num; j++) {
+            buffers[i].push_back(total_rows++);
+        }
+        auto chunk_mmap_guard =
+            std::make_shared<ChunkMmapGuard>(nullptr, 0, "");
+        chunks.push_back(std::make_unique<FixedWidthChunk>(
+            row_num,
+            1,
+            reinterpret_cast<char*>(buffers[i].data()),
+            buffers[i].size() * sizeof(int64_t),
+            sizeof(int64_t),
+            false,
+            chunk_mmap_guard));
+    }
+    auto translator = std::make_unique<TestChunkTranslator>(
+        num_rows_per_chunk, "test_bulk", std::move(chunks));
+    FieldMeta field_meta(
+        FieldName("test"), FieldId(1), DataType::INT64, false, std::nullopt);
+    auto slot =
+        cachinglayer::Manager::GetInstance().CreateCacheSlot<milvus::Chunk>(
+            std::move(translator), nullptr);
+    ChunkedColumn column(std::move(slot), field_meta);
+
+    // Offsets in score order: shuffled across chunks, with duplicates.
+    std::vector<int64_t> offsets;
+    for (int64_t i = 0; i < total_rows; i += 3) {
+        offsets.push_back(i);
+        offsets.push_back(total_rows - 1 - i);
+    }
+    std::shuffle(offsets.begin(), offsets.end(), std::mt19937(42));
+    auto count = static_cast<int64_t>(offsets.size());
+
+    std::vector<int64_t> values(count, -1);
+    column.BulkPrimitiveValueAt(nullptr, values.data(), offsets.data(), count);
+    EXPECT_EQ(values, offsets);
+
+    std::vector<int64_t> vectors(count, -1);
+    column.BulkVectorValueAt(
+        nullptr, vectors.data(), offsets.data(), sizeof(int64_t), count);
+    EXPECT_EQ(vectors, offsets);
+
+    // BulkValueAt keeps the order of the offsets.
+    std::vector<int64_t> visited;
+    column.BulkValueAt(
+        nullptr,
+        [&](const char* value, size_t i) {
+            EXPECT_EQ(i, visited.size());
+            visited.push_back(*reinterpret_cast<const int64_t*>(value));
+        },
+        offsets.data(),
+        count);
+    EXPECT_EQ(visited, offsets);
+}
+
 }  // namespace milvus
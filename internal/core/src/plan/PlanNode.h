@@ -19,6 +19,7 @@
 #include <stdint.h>
 #include <algorithm>
 #include <memory>
+#include <optional>
 #include <string>
 #include <string_view>
 #include <utility>
@@ -316,6 +317,24 @@ class ElementFilterBitsNode : public PlanNode {
     const std::string struct_name_;
 };
 
+// Lets the ProjectNode below a single-key ORDER BY ... LIMIT pick its rows by
+// walking a sorted scalar index on the sort field, stopping after `limit`
+// rows pass the filter, instead of projecting every matching row.
+struct OrderedScan {
+    FieldId field_id;
+    bool ascending;
+    bool nulls_first;
+    int64_t limit;
+};
+
+// Lets the ProjectNode below a global aggregation computing only min, max and
+// count(*) project, per min/max aggregate, one matching row holding the
+// extreme value of its field instead of every matching row.
+struct ExtremeValueScan {
+    FieldId field_id;
+    bool is_max;
+};
+
 class ProjectNode : public PlanNode {
  public:
     ProjectNode(const PlanNodeId& id,
@@ -356,10 +375,45 @@ class ProjectNode : public PlanNode {
         return field_ids_;
     }
 
+    void
+    SetOrderedScan(const OrderedScan& ordered_scan) {
+        ordered_scan_ = ordered_scan;
+    }
+
+    const std::optional<OrderedScan>&
+    GetOrderedScan() const {
+        return ordered_scan_;
+    }
+
+    void
+    SetExtremeValueScans(std::vector<ExtremeValueScan> scans) {
+        extreme_value_scans_ = std::move(scans);
+    }
+
+    const std::vector<ExtremeValueScan>&
+    GetExtremeValueScans() const {
+        return extreme_value_scans_;
+    }
+
+    // With extreme value scans, pad the picked rows with rows of nulls up to
+    // the number of matching rows, so that count(*) stays exact.
+    void
+    SetKeepRowCount(bool keep_row_count) {
+        keep_row_count_ = keep_row_count;
+    }
+
+    bool
+    KeepRowCount() const {
+        return keep_row_count_;
+    }
+
  private:
     const std::vector<PlanNodePtr> sources_;
     const std::vector<FieldId> field_ids_;
     const RowTypePtr output_type_;
+    std::optional<OrderedScan> ordered_scan_;
+    std::vector<ExtremeValueScan> extreme_value_scans_;
+    bool keep_row_count_{false};
 };
 
 class MvccNode : public PlanNode {
@@ -340,6 +340,14 @@ CachedSearchIterator::GetBatchedNextResults(size_t query_idx,
 
     std::vector<DisIdPair> rst;
     rst.reserve(batch_size_);
+    // without last_bound every emitted result counts as accepted
+    if (last_bound.has_value()) {
+        for (const auto& result : pending_[query_idx]) {
+            if (IsValid(result, last_bound, radius, range_filter)) {
+                rst.emplace_back(result);
+            }
+        }
+    }
 
     if (num_chunks_ == 1) {
         auto& iterator = iterators_[query_idx];
@@ -352,6 +360,7 @@ CachedSearchIterator::GetBatchedNextResults(size_t query_idx,
     } else {
         MergeChunksResults(query_idx, last_bound, radius, range_filter, rst);
     }
+    pending_[query_idx] = rst;
     std::sort(rst.begin(), rst.end());
     if (sign_ == -1) {
         std::for_each(rst.begin(), rst.end(), [this](DisIdPair& x) {
@@ -424,6 +433,7 @@ CachedSearchIterator::Init(const SearchInfo& search_info) {
             ErrorCode::UnexpectedError,
             "Number of queries is greater than 1, cannot initialize iterator");
     }
+    pending_.resize(nq_);
 }
 
 }  // namespace milvus::query
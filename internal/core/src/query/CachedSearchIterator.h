@@ -119,6 +119,11 @@ class CachedSearchIterator {
                                     std::vector<IterIdDisIdPair>,
                                     IterIdDisIdPairComparator>>
         chunked_heaps_;
+    // the last batch of each query, already drawn from the iterators. The
+    // proxy keeps only the global top of every batch, so when the iterator
+    // serves several pages, results beyond the next last_bound are emitted
+    // again before drawing new ones.
+    std::vector<std::vector<DisIdPair>> pending_;
 
     inline bool
     IsValid(const DisIdPair& result,
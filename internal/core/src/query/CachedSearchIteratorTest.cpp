@@ -654,6 +654,35 @@ TEST_P(CachedSearchIteratorTest, NextBatchtAllBatchesNormal) {
     }
 }
 
+TEST_P(CachedSearchIteratorTest, NextBatchReemitsResultsBeyondLastBound) {
+    SearchInfo search_info = GetDefaultNormalSearchInfo();
+    auto iterator =
+        DispatchIterator(std::get<0>(GetParam()), search_info, nullptr);
+    // like the proxy when other segments are closer, accept only the first
+    // half of every batch
+    const size_t num_accepted = kBatchSize / 2;
+    std::unordered_set<int64_t> accepted;
+    for (size_t rnd = 0; rnd <= nb_ / num_accepted; ++rnd) {
+        SearchResult search_result;
+        iterator->NextBatch(search_info, search_result);
+        size_t cnt = 0;
+        while (cnt < num_accepted && search_result.seg_offsets_[cnt] != -1) {
+            auto offset = search_result.seg_offsets_[cnt++];
+            EXPECT_TRUE(accepted.insert(offset).second);
+        }
+        if (cnt == 0) {
+            break;
+        }
+        search_info.iterator_v2_info_->last_bound =
+            search_result.distances_[cnt - 1];
+    }
+    if (std::get<0>(GetParam()) == ConstructorType::VectorIndex) {
+        EXPECT_GE(accepted.size(), nb_ * 0.9);
+    } else {
+        EXPECT_EQ(accepted.size(), nb_);
+    }
+}
+
 TEST_P(CachedSearchIteratorTest, ConstructorWithInvalidSearchInfo) {
     EXPECT_THROW(
         DispatchIterator(std::get<0>(GetParam()), SearchInfo{}, nullptr),
@@ -104,6 +104,9 @@ ExecPlanNodeVisitor::ExecuteTask(
             ret = result;
         }
     }
+    if (task->collect_runtime_stats()) {
+        query_context->set_query_profile(task->query_profile());
+    }
     span.GetSpan()->SetAttribute("total_rows", processed_num);
     span.GetSpan()->SetAttribute("matched_rows",
                                  ret ? processed_num - ret->nullCount() : 0);
@@ -303,6 +306,10 @@ ExecPlanNodeVisitor::visit(RetrievePlanNode& node) {
     auto result = ExecuteTask(plan, query_context);
     setupRetrieveResult(
         result, op_context, node, retrieve_result, segment, query_context);
+    if (retrieve_result_opt_.has_value()) {
+        retrieve_result_opt_->query_profile_ =
+            query_context->get_query_profile();
+    }
 }
 
 void
@@ -523,6 +530,7 @@ ExecPlanNodeVisitor::visit(VectorPlanNode& node) {
         op_context.storage_usage.scanned_cold_bytes.load();
     search_result_opt_->search_storage_cost_.scanned_total_bytes =
         op_context.storage_usage.scanned_total_bytes.load();
+    search_result_opt_->query_profile_ = query_context->get_query_profile();
 }
 
 }  // namespace milvus::query
@@ -0,0 +1,399 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License
+
+#include "query/PlanCache.h"
+
+#include <algorithm>
+#include <utility>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/io/zero_copy_stream_impl_lite.h>
+#include <google/protobuf/util/message_differencer.h>
+
+#include "query/Plan.h"
+#include "query/PlanProto.h"
+
+namespace milvus::query {
+
+namespace {
+
+using Literals = std::vector<proto::plan::GenericValue>;
+
+// The predicate of a plan, or nullptr. The deprecated top-level predicate
+// is left alone and stays part of the shape.
+proto::plan::Expr*
+MutablePredicate(proto::plan::PlanNode& plan_node) {
+    if (plan_node.has_vector_anns() &&
+        plan_node.vector_anns().has_predicates()) {
+        return plan_node.mutable_vector_anns()->mutable_predicates();
+    }
+    if (plan_node.has_query() && plan_node.query().has_predicates()) {
+        return plan_node.mutable_query()->mutable_predicates();
+    }
+    return nullptr;
+}
+
+// Moves value into literals and leaves a placeholder of the same kind, so
+// that the literal types stay part of the shape. Array literals are not
+// stripped.
+bool
+TakeLiteral(proto::plan::GenericValue& value, Literals& literals) {
+    using pgv = proto::plan::GenericValue;
+    pgv placeholder;
+    switch (value.val_case()) {
+        case pgv::kBoolVal:
+            placeholder.set_bool_val(false);
+            break;
+        case pgv::kInt64Val:
+            placeholder.set_int64_val(0);
+            break;
+        case pgv::kFloatVal:
+            placeholder.set_float_val(0);
+            break;
+        case pgv::kStringVal:
+            placeholder.set_string_val("");
+            break;
+        case pgv::VAL_NOT_SET:
+            break;
+        default:
+            return false;
+    }
+    literals.push_back(std::move(value));
+    value = std::move(placeholder);
+    return true;
+}
+
+// Strips the literals of expr into literals, in the order ProtoParser and
+// BindLiterals visit them. False if expr holds literals BindLiterals can't
+// rebind, expr is then left partially stripped.
+bool
+StripLiterals(proto::plan::Expr& expr, Literals& literals) {
+    using ppe = proto::plan::Expr;
+    switch (expr.expr_case()) {
+        case ppe::kUnaryRangeExpr: {
+            auto* unary_range = expr.mutable_unary_range_expr();
+            if (!TakeLiteral(*unary_range->mutable_value(), literals)) {
+                return false;
+            }
+            for (auto& value : *unary_range->mutable_extra_values()) {
+                if (!TakeLiteral(value, literals)) {
+                    return false;
+                }
+            }
+            return true;
+        }
+        case ppe::kBinaryRangeExpr: {
+            auto* binary_range = expr.mutable_binary_range_expr();
+            return TakeLiteral(*binary_range->mutable_lower_value(),
+                               literals) &&
+                   TakeLiteral(*binary_range->mutable_upper_value(),
+                               literals);
+        }
+        case ppe::kTermExpr: {
+            for (auto& value : *expr.mutable_term_expr()->mutable_values()) {
+                if (!TakeLiteral(value, literals)) {
+                    return false;
+                }
+            }
+            return true;
+        }
+        case ppe::kBinaryExpr: {
+            auto* binary = expr.mutable_binary_expr();
+            return StripLiterals(*binary->mutable_left(), literals) &&
+                   StripLiterals(*binary->mutable_right(), literals);
+        }
+        case ppe::kUnaryExpr:
+            return StripLiterals(
+                *expr.mutable_unary_expr()->mutable_child(), literals);
+        case ppe::kAlwaysTrueExpr:
+        case ppe::kCompareExpr:
+        case ppe::kExistsExpr:
+        case ppe::kNullExpr:
+            // no literals
+            return true;
+        default:
+            return false;
+    }
+}
+
+// expr, parsed from a stripped predicate, with literals[next...] bound in
+// place of the stripped ones. Sub-expressions without literals are shared.
+expr::TypedExprPtr
+BindLiterals(const expr::TypedExprPtr& expr,
+             const Literals& literals,
+             size_t& next) {
+    if (auto unary_range =
+            std::dynamic_pointer_cast<const expr::UnaryRangeFilterExpr>(
+                expr)) {
+        const auto& value = literals.at(next++);
+        Literals extra_values;
+        for (size_t i = 0; i < unary_range->extra_values_.size(); i++) {
+            extra_values.push_back(literals.at(next++));
+        }
+        return std::make_shared<expr::UnaryRangeFilterExpr>(
+            unary_range->column_, unary_range->op_type_, value, extra_values);
+    }
+    if (auto binary_range =
+            std::dynamic_pointer_cast<const expr::BinaryRangeFilterExpr>(
+                expr)) {
+        const auto& lower_value = literals.at(next++);
+        const auto& upper_value = literals.at(next++);
+        return std::make_shared<expr::BinaryRangeFilterExpr>(
+            binary_range->column_,
+            lower_value,
+            upper_value,
+            binary_range->lower_inclusive_,
+            binary_range->upper_inclusive_);
+    }
+    if (auto term =
+            std::dynamic_pointer_cast<const expr::TermFilterExpr>(expr)) {
+        Literals values;
+        for (size_t i = 0; i < term->vals_.size(); i++) {
+            values.push_back(literals.at(next++));
+        }
+        return std::make_shared<expr::TermFilterExpr>(
+            term->column_, values, term->is_in_field_);
+    }
+    if (auto binary =
+            std::dynamic_pointer_cast<const expr::LogicalBinaryExpr>(expr)) {
+        auto left = BindLiterals(binary->inputs()[0], literals, next);
+        auto right = BindLiterals(binary->inputs()[1], literals, next);
+        return std::make_shared<expr::LogicalBinaryExpr>(
+            binary->op_type_, left, right);
+    }
+    if (auto unary =
+            std::dynamic_pointer_cast<const expr::LogicalUnaryExpr>(expr)) {
+        return std::make_shared<expr::LogicalUnaryExpr>(
+            unary->op_type_, BindLiterals(unary->inputs()[0], literals, next));
+    }
+    return expr;
+}
+
+bool
+SameLiterals(const Literals& a, const Literals& b) {
+    return std::equal(
+        a.begin(),
+        a.end(),
+        b.begin(),
+        b.end(),
+        [](const auto& x, const auto& y) {
+            return google::protobuf::util::MessageDifferencer::Equals(x, y);
+        });
+}
+
+// A requested plan: its proto, its predicate with the predicate's literals,
+// and the key of its shape.
+struct PlanRequest {
+    proto::plan::PlanNode plan_node;
+    // nullptr if the plan has no predicate or its literals can't be rebound
+    const proto::plan::Expr* predicate = nullptr;
+    Literals literals;
+    std::string key;
+};
+
+// The key is the plan with its predicate literals stripped, serialized
+// deterministically; search and retrieve plans of the same shape are kept
+// apart. A predicate that can't be stripped is kept whole, so that only
+// verbatim repeats of it hit.
+std::unique_ptr<PlanRequest>
+ParseRequest(char kind, const void* serialized_expr_plan, int64_t size) {
+    auto request = std::make_unique<PlanRequest>();
+    ParsePlanNodeProto(request->plan_node, serialized_expr_plan, size);
+    auto shape = request->plan_node;
+    auto* shape_predicate = MutablePredicate(shape);
+    if (shape_predicate != nullptr) {
+        auto* predicate = MutablePredicate(request->plan_node);
+        if (StripLiterals(*shape_predicate, request->literals)) {
+            request->predicate = predicate;
+        } else {
+            *shape_predicate = *predicate;
+            request->literals.clear();
+        }
+    }
+
+    request->key.push_back(kind);
+    {
+        // appends to the key, which is complete once output is destroyed
+        google::protobuf::io::StringOutputStream stream(&request->key);
+        google::protobuf::io::CodedOutputStream output(&stream);
+        output.SetSerializationDeterministic(true);
+        shape.SerializeToCodedStream(&output);
+    }
+    return request;
+}
+
+std::unique_ptr<Plan>
+ClonePlan(const Plan& plan) {
+    auto clone = std::make_unique<Plan>(plan.schema_);
+    clone->plan_node_ = std::make_unique<VectorPlanNode>(*plan.plan_node_);
+    clone->tag2field_ = plan.tag2field_;
+    clone->target_entries_ = plan.target_entries_;
+    clone->access_entries_ = plan.access_entries_;
+    clone->target_dynamic_fields_ = plan.target_dynamic_fields_;
+    if (plan.extra_info_opt_.has_value()) {
+        const auto& involved_fields = plan.extra_info_opt_->involved_fields_;
+        ExtractedPlanInfo extra_info(0);
+        extra_info.involved_fields_ = involved_fields.clone();
+        clone->extra_info_opt_ = std::move(extra_info);
+    }
+    return clone;
+}
+
+std::unique_ptr<RetrievePlan>
+CloneRetrievePlan(const RetrievePlan& plan) {
+    auto clone = std::make_unique<RetrievePlan>(plan.schema_);
+    if (plan.plan_node_ != nullptr) {
+        clone->plan_node_ =
+            std::make_unique<RetrievePlanNode>(*plan.plan_node_);
+    }
+    clone->field_ids_ = plan.field_ids_;
+    clone->access_entries_ = plan.access_entries_;
+    clone->target_dynamic_fields_ = plan.target_dynamic_fields_;
+    return clone;
+}
+
+}  // namespace
+
+const PlanCache::Entry*
+PlanCache::Find(const std::string& key, const SchemaPtr& schema) {
+    auto iter = entries_.find(key);
+    if (iter == entries_.end()) {
+        return nullptr;
+    }
+    auto& entry = iter->second;
+    if (entry.schema != schema ||
+        entry.schema_version != schema->get_schema_version()) {
+        lru_.erase(entry.lru_iter);
+        entries_.erase(iter);
+        return nullptr;
+    }
+    lru_.splice(lru_.begin(), lru_, entry.lru_iter);
+    return &entry;
+}
+
+void
+PlanCache::Insert(std::string key, Entry entry) {
+    if (capacity_ == 0) {
+        return;
+    }
+    auto iter = entries_.find(key);
+    if (iter != entries_.end()) {
+        // parsed concurrently by another request
+        lru_.erase(iter->second.lru_iter);
+        entries_.erase(iter);
+    }
+    while (entries_.size() >= capacity_) {
+        entries_.erase(lru_.back());
+        lru_.pop_back();
+    }
+    lru_.push_front(key);
+    entry.lru_iter = lru_.begin();
+    entries_.emplace(std::move(key), std::move(entry));
+}
+
+std::unique_ptr<Plan>
+PlanCache::GetSearchPlan(const SchemaPtr& schema,
+                         const void* serialized_expr_plan,
+                         int64_t size) {
+    if (size > kMaxPlanBytes) {
+        return CreateSearchPlanByExpr(schema, serialized_expr_plan, size);
+    }
+    auto request = ParseRequest('s', serialized_expr_plan, size);
+    ProtoParser parser(schema);
+    {
+        std::unique_lock lock(mutex_);
+        if (auto entry = Find(request->key, schema)) {
+            ++hits_;
+            if (SameLiterals(entry->literals, request->literals)) {
+                return ClonePlan(*entry->search_plan);
+            }
+            auto predicate = entry->predicate;
+            lock.unlock();
+            size_t next = 0;
+            parser.SetParsedExpr(
+                *request->predicate,
+                BindLiterals(predicate, request->literals, next));
+            return parser.CreatePlan(request->plan_node);
+        }
+    }
+
+    expr::TypedExprPtr predicate;
+    if (request->predicate != nullptr) {
+        predicate = parser.ParseExprs(*request->predicate);
+        parser.SetParsedExpr(*request->predicate, predicate);
+    }
+    std::shared_ptr<const Plan> plan = parser.CreatePlan(request->plan_node);
+    auto res = ClonePlan(*plan);
+    std::lock_guard lock(mutex_);
+    Insert(std::move(request->key),
+           Entry{schema,
+                 schema->get_schema_version(),
+                 std::move(request->literals),
+                 std::move(predicate),
+                 std::move(plan),
+                 {}});
+    return res;
+}
+
+std::unique_ptr<RetrievePlan>
+PlanCache::GetRetrievePlan(const SchemaPtr& schema,
+                           const void* serialized_expr_plan,
+                           int64_t size) {
+    if (size > kMaxPlanBytes) {
+        return CreateRetrievePlanByExpr(schema, serialized_expr_plan, size);
+    }
+    auto request = ParseRequest('r', serialized_expr_plan, size);
+    ProtoParser parser(schema);
+    {
+        std::unique_lock lock(mutex_);
+        if (auto entry = Find(request->key, schema)) {
+            ++hits_;
+            if (SameLiterals(entry->literals, request->literals)) {
+                return CloneRetrievePlan(*entry->retrieve_plan);
+            }
+            auto predicate = entry->predicate;
+            lock.unlock();
+            size_t next = 0;
+            parser.SetParsedExpr(
+                *request->predicate,
+                BindLiterals(predicate, request->literals, next));
+            return parser.CreateRetrievePlan(request->plan_node);
+        }
+    }
+
+    expr::TypedExprPtr predicate;
+    if (request->predicate != nullptr) {
+        predicate = parser.ParseExprs(*request->predicate);
+        parser.SetParsedExpr(*request->predicate, predicate);
+    }
+    std::shared_ptr<const RetrievePlan> plan =
+        parser.CreateRetrievePlan(request->plan_node);
+    auto res = CloneRetrievePlan(*plan);
+    std::lock_guard lock(mutex_);
+    Insert(std::move(request->key),
+           Entry{schema,
+                 schema->get_schema_version(),
+                 std::move(request->literals),
+                 std::move(predicate),
+                 {},
+                 std::move(plan)});
+    return res;
+}
+
+void
+PlanCache::Clear() {
+    std::lock_guard lock(mutex_);
+    entries_.clear();
+    lru_.clear();
+    hits_ = 0;
+}
+
+}  // namespace milvus::query
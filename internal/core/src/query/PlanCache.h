@@ -0,0 +1,109 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License
+
+#pragma once
+
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "common/Schema.h"
+#include "expr/ITypeExpr.h"
+#include "pb/plan.pb.h"
+#include "query/PlanImpl.h"
+
+namespace milvus::query {
+
+// Bounded LRU cache of parsed search/retrieve plans, keyed by the plan shape
+// and the schema (instance and version) it was parsed against. The shape is
+// the plan with the literals of its predicate stripped, so requests that
+// differ only in those literals share an entry; everything else, the plan
+// options included, is part of the shape.
+//
+// A hit with the cached literals skips ProtoParser: the cached plan's
+// plan-node DAG and filter expressions are immutable and shared, and only the
+// top-level plan (search info, output fields, ...) is copied, since callers
+// adjust it per request. A hit with other literals rebinds them into the
+// cached predicate expression instead of parsing it again, and rebuilds the
+// plan around it. Physical expressions are still compiled per segment at
+// execution.
+class PlanCache {
+ public:
+    static constexpr size_t kDefaultCapacity = 256;
+    // Larger plans are rarely repeated verbatim and aren't cached.
+    static constexpr int64_t kMaxPlanBytes = 16 * 1024;
+
+    explicit PlanCache(size_t capacity = kDefaultCapacity)
+        : capacity_(capacity) {
+    }
+
+    std::unique_ptr<Plan>
+    GetSearchPlan(const SchemaPtr& schema,
+                  const void* serialized_expr_plan,
+                  int64_t size);
+
+    std::unique_ptr<RetrievePlan>
+    GetRetrievePlan(const SchemaPtr& schema,
+                    const void* serialized_expr_plan,
+                    int64_t size);
+
+    size_t
+    size() const {
+        std::lock_guard lock(mutex_);
+        return entries_.size();
+    }
+
+    // Lookups served by a cached shape, with its literals or rebound ones.
+    uint64_t
+    hits() const {
+        std::lock_guard lock(mutex_);
+        return hits_;
+    }
+
+    void
+    Clear();
+
+ private:
+    struct Entry {
+        SchemaPtr schema;
+        uint64_t schema_version;
+        // literals of the cached plan, in the order they were stripped
+        std::vector<proto::plan::GenericValue> literals;
+        // the cached plan's predicate, nullptr if it has none or its
+        // literals can't be rebound
+        expr::TypedExprPtr predicate;
+        std::shared_ptr<const Plan> search_plan;
+        std::shared_ptr<const RetrievePlan> retrieve_plan;
+        std::list<std::string>::iterator lru_iter;
+    };
+
+    // The cached entry of key if it was parsed against schema, or nullptr.
+    // Refreshes its LRU position. Called with mutex_ held.
+    const Entry*
+    Find(const std::string& key, const SchemaPtr& schema);
+
+    // Called with mutex_ held.
+    void
+    Insert(std::string key, Entry entry);
+
+    const size_t capacity_;
+    mutable std::mutex mutex_;
+    // most recently used first
+    std::list<std::string> lru_;
+    std::unordered_map<std::string, Entry> entries_;
+    uint64_t hits_ = 0;
+};
+
+}  // namespace milvus::query
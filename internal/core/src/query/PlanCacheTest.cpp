@@ -0,0 +1,253 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License
+
+#include <gtest/gtest.h>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "common/Schema.h"
+#include "common/Types.h"
+#include "knowhere/comp/index_param.h"
+#include "pb/plan.pb.h"
+#include "plan/PlanNode.h"
+#include "query/Plan.h"
+#include "query/PlanCache.h"
+
+using namespace milvus;
+using namespace milvus::query;
+
+namespace {
+
+SchemaPtr
+BuildSchema() {
+    auto schema = std::make_shared<Schema>();
+    schema->AddDebugField(
+        "fakevec", DataType::VECTOR_FLOAT, 16, knowhere::metric::L2);
+    auto i64_fid = schema->AddDebugField("age", DataType::INT64);
+    schema->set_primary_field_id(i64_fid);
+    return schema;
+}
+
+std::string
+SerializedSearchPlan(const SchemaPtr& schema, int64_t topk) {
+    proto::plan::PlanNode plan_node;
+    auto* vector_anns = plan_node.mutable_vector_anns();
+    vector_anns->set_vector_type(proto::plan::VectorType::FloatVector);
+    vector_anns->set_placeholder_tag("$0");
+    vector_anns->set_field_id(
+        schema->get_field_id(FieldName("fakevec")).get());
+    auto* query_info = vector_anns->mutable_query_info();
+    query_info->set_topk(topk);
+    query_info->set_round_decimal(-1);
+    query_info->set_metric_type(knowhere::metric::L2);
+    query_info->set_search_params("{}");
+    return plan_node.SerializeAsString();
+}
+
+proto::plan::ColumnInfo
+AgeColumn(const SchemaPtr& schema) {
+    proto::plan::ColumnInfo column_info;
+    column_info.set_field_id(schema->get_field_id(FieldName("age")).get());
+    column_info.set_data_type(proto::schema::DataType::Int64);
+    column_info.set_is_primary_key(true);
+    return column_info;
+}
+
+proto::plan::GenericValue
+Int64Value(int64_t value) {
+    proto::plan::GenericValue generic_value;
+    generic_value.set_int64_val(value);
+    return generic_value;
+}
+
+// age > greater_than and not (age in not_in) or lower < age <= upper
+proto::plan::Expr
+AgePredicate(const SchemaPtr& schema,
+             int64_t greater_than,
+             const std::vector<int64_t>& not_in,
+             int64_t lower,
+             int64_t upper) {
+    proto::plan::Expr greater;
+    auto* unary_range = greater.mutable_unary_range_expr();
+    *unary_range->mutable_column_info() = AgeColumn(schema);
+    unary_range->set_op(proto::plan::OpType::GreaterThan);
+    *unary_range->mutable_value() = Int64Value(greater_than);
+
+    proto::plan::Expr not_in_expr;
+    auto* unary = not_in_expr.mutable_unary_expr();
+    unary->set_op(proto::plan::UnaryExpr::Not);
+    auto* term = unary->mutable_child()->mutable_term_expr();
+    *term->mutable_column_info() = AgeColumn(schema);
+    for (auto value : not_in) {
+        *term->add_values() = Int64Value(value);
+    }
+
+    proto::plan::Expr between;
+    auto* binary_range = between.mutable_binary_range_expr();
+    *binary_range->mutable_column_info() = AgeColumn(schema);
+    binary_range->set_lower_inclusive(false);
+    binary_range->set_upper_inclusive(true);
+    *binary_range->mutable_lower_value() = Int64Value(lower);
+    *binary_range->mutable_upper_value() = Int64Value(upper);
+
+    proto::plan::Expr and_expr;
+    auto* binary_and = and_expr.mutable_binary_expr();
+    binary_and->set_op(proto::plan::BinaryExpr::LogicalAnd);
+    *binary_and->mutable_left() = greater;
+    *binary_and->mutable_right() = not_in_expr;
+
+    proto::plan::Expr predicate;
+    auto* binary_or = predicate.mutable_binary_expr();
+    binary_or->set_op(proto::plan::BinaryExpr::LogicalOr);
+    *binary_or->mutable_left() = and_expr;
+    *binary_or->mutable_right() = between;
+    return predicate;
+}
+
+std::string
+SerializedRetrievePlan(const SchemaPtr& schema,
+                       const proto::plan::Expr& predicate,
+                       bool collect_query_profile = false) {
+    proto::plan::PlanNode plan_node;
+    auto* query = plan_node.mutable_query();
+    *query->mutable_predicates() = predicate;
+    query->set_limit(10);
+    plan_node.add_output_field_ids(
+        schema->get_field_id(FieldName("age")).get());
+    plan_node.mutable_plan_options()->set_collect_query_profile(
+        collect_query_profile);
+    return plan_node.SerializeAsString();
+}
+
+// The filter expression of a retrieve plan, as text.
+std::string
+FilterOf(const RetrievePlan& plan) {
+    auto node = plan.plan_node_->plannodes_;
+    while (node != nullptr) {
+        if (auto filter =
+                std::dynamic_pointer_cast<const plan::FilterBitsNode>(node)) {
+            return filter->filter()->ToString();
+        }
+        node = node->sources().empty() ? nullptr : node->sources()[0];
+    }
+    return "";
+}
+
+}  // namespace
+
+TEST(PlanCache, ReusesParsedSearchPlan) {
+    auto schema = BuildSchema();
+    PlanCache cache(2);
+    auto blob = SerializedSearchPlan(schema, 10);
+
+    auto first = cache.GetSearchPlan(schema, blob.data(), blob.size());
+    ASSERT_EQ(cache.size(), 1);
+    // callers adjust the top-level plan per request
+    first->plan_node_->search_info_.metric_type_ = knowhere::metric::IP;
+
+    auto second = cache.GetSearchPlan(schema, blob.data(), blob.size());
+    EXPECT_EQ(cache.size(), 1);
+    EXPECT_NE(first.get(), second.get());
+    EXPECT_EQ(second->plan_node_->search_info_.topk_, 10);
+    EXPECT_EQ(second->plan_node_->search_info_.metric_type_,
+              knowhere::metric::L2);
+    EXPECT_EQ(first->plan_node_->plannodes_, second->plan_node_->plannodes_);
+    EXPECT_EQ(second->tag2field_.at("$0"),
+              schema->get_field_id(FieldName("fakevec")));
+}
+
+TEST(PlanCache, EvictsAndTracksSchema) {
+    auto schema = BuildSchema();
+    PlanCache cache(2);
+    for (int64_t topk = 1; topk <= 3; ++topk) {
+        auto blob = SerializedSearchPlan(schema, topk);
+        auto plan = cache.GetSearchPlan(schema, blob.data(), blob.size());
+        EXPECT_EQ(plan->plan_node_->search_info_.topk_, topk);
+    }
+    EXPECT_EQ(cache.size(), 2);
+
+    // a new schema instance invalidates plans parsed against the old one
+    auto blob = SerializedSearchPlan(schema, 3);
+    auto cached = cache.GetSearchPlan(schema, blob.data(), blob.size());
+    auto new_schema = BuildSchema();
+    new_schema->set_schema_version(schema->get_schema_version() + 1);
+    auto reparsed = cache.GetSearchPlan(new_schema, blob.data(), blob.size());
+    EXPECT_EQ(reparsed->schema_, new_schema);
+    EXPECT_NE(cached->plan_node_->plannodes_,
+              reparsed->plan_node_->plannodes_);
+
+    cache.Clear();
+    EXPECT_EQ(cache.size(), 0);
+}
+
+TEST(PlanCache, RebindsLiteralsOfSameShape) {
+    auto schema = BuildSchema();
+    PlanCache cache(2);
+    auto blob = SerializedRetrievePlan(
+        schema, AgePredicate(schema, 10, {1, 2}, 100, 200));
+    auto other_blob = SerializedRetrievePlan(
+        schema, AgePredicate(schema, 20, {3, 4}, 300, 400));
+
+    auto first = cache.GetRetrievePlan(schema, blob.data(), blob.size());
+    EXPECT_EQ(cache.hits(), 0);
+    auto second =
+        cache.GetRetrievePlan(schema, other_blob.data(), other_blob.size());
+    EXPECT_EQ(cache.size(), 1);
+    EXPECT_EQ(cache.hits(), 1);
+
+    // each plan carries its own literals, as if it were parsed afresh
+    auto parsed = CreateRetrievePlanByExpr(schema, blob.data(), blob.size());
+    auto other_parsed =
+        CreateRetrievePlanByExpr(schema, other_blob.data(), other_blob.size());
+    EXPECT_NE(FilterOf(*parsed), FilterOf(*other_parsed));
+    EXPECT_EQ(FilterOf(*first), FilterOf(*parsed));
+    EXPECT_EQ(FilterOf(*second), FilterOf(*other_parsed));
+    EXPECT_EQ(second->field_ids_, first->field_ids_);
+
+    auto third = cache.GetRetrievePlan(schema, blob.data(), blob.size());
+    EXPECT_EQ(cache.hits(), 2);
+    EXPECT_EQ(third->plan_node_->plannodes_, first->plan_node_->plannodes_);
+}
+
+TEST(PlanCache, PlanOptionsArePartOfTheShape) {
+    auto schema = BuildSchema();
+    PlanCache cache(2);
+    auto predicate = AgePredicate(schema, 10, {1, 2}, 100, 200);
+    auto blob = SerializedRetrievePlan(schema, predicate);
+    auto profiled_blob = SerializedRetrievePlan(schema, predicate, true);
+
+    cache.GetRetrievePlan(schema, blob.data(), blob.size());
+    cache.GetRetrievePlan(schema, profiled_blob.data(), profiled_blob.size());
+    EXPECT_EQ(cache.size(), 2);
+    EXPECT_EQ(cache.hits(), 0);
+}
+
+TEST(PlanCache, LiteralTypesArePartOfTheShape) {
+    auto schema = BuildSchema();
+    PlanCache cache(2);
+    auto predicate = AgePredicate(schema, 10, {1, 2}, 100, 200);
+    auto blob = SerializedRetrievePlan(schema, predicate);
+    // same structure, with a float literal in place of the int64 one
+    predicate.mutable_binary_expr()
+        ->mutable_left()
+        ->mutable_binary_expr()
+        ->mutable_left()
+        ->mutable_unary_range_expr()
+        ->mutable_value()
+        ->set_float_val(10.5);
+    auto float_blob = SerializedRetrievePlan(schema, predicate);
+
+    cache.GetRetrievePlan(schema, blob.data(), blob.size());
+    cache.GetRetrievePlan(schema, float_blob.data(), float_blob.size());
+    EXPECT_EQ(cache.size(), 2);
+    EXPECT_EQ(cache.hits(), 0);
+}
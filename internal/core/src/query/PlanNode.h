@@ -30,6 +30,9 @@ class PlanNodeVisitor;
 
 struct PlanOptions {
     bool expr_use_json_stats = true;
+    // record per operator / expression runtime stats and return them with
+    // the result (EXPLAIN ANALYZE)
+    bool collect_runtime_stats = false;
 };
 
 // Base of all Nodes
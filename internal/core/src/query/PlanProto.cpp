@@ -63,6 +63,8 @@ ProtoParser::PlanOptionsFromProto(
     const proto::plan::PlanOption& plan_option_proto,
     PlanOptions& plan_options) {
     plan_options.expr_use_json_stats = plan_option_proto.expr_use_json_stats();
+    plan_options.collect_runtime_stats =
+        plan_option_proto.collect_query_profile();
     LOG_TRACE("plan_options.expr_use_json_stats: {}",
               plan_options.expr_use_json_stats);
 }
@@ -458,12 +460,41 @@ BuildProjectAndAggregationNodes(
     {
         auto project_field_id_list = std::vector<FieldId>(
             project_id_list.begin(), project_id_list.end());
-        plannode = std::make_shared<plan::ProjectNode>(
+        auto project = std::make_shared<plan::ProjectNode>(
             milvus::plan::GetNextPlanNodeId(),
             std::move(project_field_id_list),
             std::move(project_name_list),
             std::move(project_type_list),
             sources);
+        // A global min/max only needs the rows holding the extreme values,
+        // which the ProjectNode can find from indexes and zone maps. count(*)
+        // next to them only needs the number of matching rows, which the
+        // ProjectNode takes from the bitmap.
+        std::vector<plan::ExtremeValueScan> extreme_value_scans;
+        bool keep_row_count = false;
+        if (groupingKeys.empty()) {
+            for (int i = 0; i < query.aggregates_size(); i++) {
+                const auto& aggregate = query.aggregates(i);
+                if (aggregate.op() == planpb::count &&
+                    aggregate.field_id() == 0) {
+                    keep_row_count = true;
+                    continue;
+                }
+                if ((aggregate.op() != planpb::min &&
+                     aggregate.op() != planpb::max) ||
+                    aggregate.field_id() <= 0) {
+                    extreme_value_scans.clear();
+                    break;
+                }
+                extreme_value_scans.push_back(
+                    {FieldId(aggregate.field_id()),
+                     aggregate.op() == planpb::max});
+            }
+        }
+        project->SetKeepRowCount(keep_row_count &&
+                                 !extreme_value_scans.empty());
+        project->SetExtremeValueScans(std::move(extreme_value_scans));
+        plannode = project;
     }
 
     // Build AggregationNode
@@ -576,6 +607,15 @@ BuildOrderByProjectNode(const proto::plan::QueryPlanNode& query,
                                             std::move(project_names),
                                             std::move(project_types),
                                             sources);
+    // A single sort key with a limit can be served in order by a sorted
+    // scalar index, if the segment has one on that field.
+    if (order_by_field_count == 1 && query.limit() > 0 && !is_element_level) {
+        const auto& order_by_field = query.order_by_fields(0);
+        plannode->SetOrderedScan({FieldId(order_by_field.field_id()),
+                                  order_by_field.ascending(),
+                                  order_by_field.nulls_first(),
+                                  query.limit()});
+    }
     return {
         plannode, std::move(deferred_field_ids), std::move(pipeline_field_ids)};
 }
@@ -1311,6 +1351,9 @@ ProtoParser::CreateAlwaysTrueExprs() {
 expr::TypedExprPtr
 ProtoParser::ParseExprs(const proto::plan::Expr& expr_pb,
                         TypeCheckFunction type_check) {
+    if (&expr_pb == parsed_expr_pb_) {
+        return parsed_expr_;
+    }
     using ppe = proto::plan::Expr;
     expr::TypedExprPtr result;
     switch (expr_pb.expr_case()) {
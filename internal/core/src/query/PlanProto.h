@@ -56,6 +56,15 @@ class ProtoParser {
     ParseExprs(const proto::plan::Expr& expr_pb,
                TypeCheckFunction type_check = TypeIsBool);
 
+    // Makes ParseExprs return `expr` for `expr_pb` (the very message, not an
+    // equal one) instead of parsing it. Used by PlanCache to plug in a cached
+    // predicate rebound to the literals of the request.
+    void
+    SetParsedExpr(const proto::plan::Expr& expr_pb, expr::TypedExprPtr expr) {
+        parsed_expr_pb_ = &expr_pb;
+        parsed_expr_ = std::move(expr);
+    }
+
     std::shared_ptr<rescores::Scorer>
     ParseScorer(const proto::plan::ScoreFunction& function);
 
@@ -132,6 +141,8 @@ class ProtoParser {
 
  private:
     const SchemaPtr schema;
+    const proto::plan::Expr* parsed_expr_pb_ = nullptr;
+    expr::TypedExprPtr parsed_expr_;
 };
 
 }  // namespace milvus::query
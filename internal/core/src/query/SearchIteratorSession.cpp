@@ -0,0 +1,214 @@
+// Copyright (C) 2019-2024 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License
+
+#include "query/SearchIteratorSession.h"
+
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+
+#include "common/Utils.h"
+
+namespace milvus::query {
+
+namespace {
+
+// Everything besides the query and the bitset the iterator depends on.
+std::string
+IteratorParams(const SearchInfo& search_info) {
+    return std::to_string(search_info.field_id_.get()) + ":" +
+           search_info.metric_type_ + ":" +
+           std::to_string(search_info.iterator_v2_info_->batch_size) + ":" +
+           search_info.search_params_.dump();
+}
+
+size_t
+BitsetBytes(const BitsetView& bitset) {
+    return bitset.empty() ? 0 : (bitset.size() + 7) / 8;
+}
+
+bool
+SameBytes(const std::vector<uint8_t>& bytes, const void* data, size_t size) {
+    return bytes.size() == size &&
+           (size == 0 || std::memcmp(bytes.data(), data, size) == 0);
+}
+
+// Whether last_bound goes back from the previous page, e.g. when the
+// iteration restarts, so results the session already passed are needed.
+bool
+Regresses(const std::optional<float>& previous,
+          const std::optional<float>& last_bound,
+          const MetricType& metric_type) {
+    if (!last_bound.has_value()) {
+        return true;
+    }
+    if (!previous.has_value()) {
+        return false;
+    }
+    if (PositivelyRelated(metric_type)) {
+        return last_bound.value() > previous.value();
+    }
+    return last_bound.value() < previous.value();
+}
+
+}  // namespace
+
+SearchIteratorSessions&
+SearchIteratorSessions::GetInstance() {
+    static SearchIteratorSessions instance;
+    return instance;
+}
+
+void
+SearchIteratorSessions::Configure(int64_t ttl_ms, int64_t max_memory_bytes) {
+    std::vector<SessionPtr> evicted;
+    std::lock_guard lock(mutex_);
+    ttl_ = std::chrono::milliseconds(std::max<int64_t>(ttl_ms, 0));
+    max_memory_bytes_ = std::max<int64_t>(max_memory_bytes, 0);
+    if (ttl_.count() == 0 || max_memory_bytes_ == 0) {
+        while (!sessions_.empty()) {
+            evicted.push_back(Erase(sessions_.begin()));
+        }
+    }
+}
+
+bool
+SearchIteratorSessions::Cacheable(const SearchInfo& search_info,
+                                  bool is_sparse,
+                                  const size_t* query_offsets,
+                                  const BitsetView& bitset) const {
+    return enabled() && !is_sparse && query_offsets == nullptr &&
+           search_info.array_offsets_ == nullptr &&
+           search_info.iterator_v2_info_.has_value() &&
+           !search_info.iterator_v2_info_->token.empty() &&
+           !bitset.has_out_ids();
+}
+
+void
+SearchIteratorSessions::NextBatch(int64_t segment_id,
+                                  const void* source,
+                                  const SearchInfo& search_info,
+                                  const void* query_data,
+                                  int64_t query_bytes,
+                                  const BitsetView& bitset,
+                                  int64_t num_rows,
+                                  std::shared_ptr<void> keep_alive,
+                                  const IteratorFactory& factory,
+                                  SearchResult& search_result) {
+    const auto& last_bound = search_info.iterator_v2_info_->last_bound;
+    Key key{segment_id, search_info.iterator_v2_info_->token};
+    auto params = IteratorParams(search_info);
+    auto bitset_bytes = BitsetBytes(bitset);
+
+    auto session = Take(key);
+    if (session == nullptr || session->source != source ||
+        session->params != params || session->num_rows != num_rows ||
+        session->bitset_bits != (bitset.empty() ? 0 : bitset.size()) ||
+        Regresses(session->last_bound, last_bound, search_info.metric_type_) ||
+        !SameBytes(session->query, query_data, query_bytes) ||
+        !SameBytes(session->bitset, bitset.data(), bitset_bytes)) {
+        // release the stale iterator before building its replacement
+        session.reset();
+        session = std::make_unique<Session>();
+        session->source = source;
+        session->params = std::move(params);
+        session->num_rows = num_rows;
+        auto query = static_cast<const uint8_t*>(query_data);
+        session->query.assign(query, query + query_bytes);
+        if (!bitset.empty()) {
+            session->bitset.assign(bitset.data(), bitset.data() + bitset_bytes);
+            session->bitset_bits = bitset.size();
+        }
+        session->keep_alive = std::move(keep_alive);
+        session->memory = static_cast<int64_t>(session->query.size() +
+                                               session->bitset.size()) +
+                          num_rows * static_cast<int64_t>(sizeof(float) +
+                                                          sizeof(int64_t));
+        BitsetView owned_bitset;
+        if (!session->bitset.empty()) {
+            owned_bitset =
+                BitsetView(session->bitset.data(), session->bitset_bits);
+        }
+        session->iterator = factory(session->query.data(), owned_bitset);
+    }
+
+    session->iterator->NextBatch(search_info, search_result);
+    session->last_bound = last_bound;
+    Put(key, std::move(session));
+}
+
+void
+SearchIteratorSessions::DropSegment(int64_t segment_id) {
+    std::vector<SessionPtr> evicted;
+    std::lock_guard lock(mutex_);
+    auto iter = sessions_.lower_bound(Key{segment_id, ""});
+    while (iter != sessions_.end() && iter->first.first == segment_id) {
+        auto next = std::next(iter);
+        evicted.push_back(Erase(iter));
+        iter = next;
+    }
+}
+
+SearchIteratorSessions::SessionPtr
+SearchIteratorSessions::Take(const Key& key) {
+    std::vector<SessionPtr> evicted;
+    std::lock_guard lock(mutex_);
+    Evict(Clock::now(), evicted);
+    auto iter = sessions_.find(key);
+    if (iter == sessions_.end()) {
+        return nullptr;
+    }
+    return Erase(iter);
+}
+
+void
+SearchIteratorSessions::Put(const Key& key, SessionPtr session) {
+    std::vector<SessionPtr> evicted;
+    std::lock_guard lock(mutex_);
+    if (ttl_.count() == 0 || max_memory_bytes_ == 0) {
+        evicted.push_back(std::move(session));
+        return;
+    }
+    // a concurrent page of the same token has put its own session back
+    if (auto iter = sessions_.find(key); iter != sessions_.end()) {
+        evicted.push_back(Erase(iter));
+    }
+    auto now = Clock::now();
+    session->last_access = now;
+    session->lru_iter = lru_.insert(lru_.end(), key);
+    memory_usage_ += session->memory;
+    sessions_.emplace(key, std::move(session));
+    Evict(now, evicted);
+}
+
+void
+SearchIteratorSessions::Evict(Clock::time_point now,
+                              std::vector<SessionPtr>& evicted) {
+    while (!lru_.empty()) {
+        auto iter = sessions_.find(lru_.front());
+        if (now - iter->second->last_access <= ttl_ &&
+            memory_usage_ <= max_memory_bytes_) {
+            break;
+        }
+        evicted.push_back(Erase(iter));
+    }
+}
+
+SearchIteratorSessions::SessionPtr
+SearchIteratorSessions::Erase(std::map<Key, SessionPtr>::iterator iter) {
+    auto session = std::move(iter->second);
+    sessions_.erase(iter);
+    lru_.erase(session->lru_iter);
+    memory_usage_ -= session->memory;
+    return session;
+}
+
+}  // namespace milvus::query
@@ -0,0 +1,157 @@
+// Copyright (C) 2019-2024 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "common/BitsetView.h"
+#include "common/QueryInfo.h"
+#include "common/QueryResult.h"
+#include "query/CachedSearchIterator.h"
+
+namespace milvus::query {
+
+// Keeps the CachedSearchIterator of a search_iterator v2 token alive between
+// the pages of that token, per segment, so that each NextBatch continues
+// where the previous page stopped instead of rebuilding the knowhere
+// iterators and skipping everything up to last_bound again.
+//
+// A session owns copies of the query vectors and of the filter bitset its
+// iterator was built with. A page reuses the session only if it searches the
+// same index or column with the same parameters, query and bitset, and its
+// last_bound doesn't go back; otherwise the session is rebuilt. The bitset
+// covers deletes and MVCC visibility, so a delete applied between pages
+// invalidates the session too. Sessions expire after ttl since their last
+// page, are evicted least recently used first beyond the memory budget, and
+// are dropped with their segment.
+class SearchIteratorSessions {
+ public:
+    // Builds the iterator of a session from the session's own copies of the
+    // query vectors and the bitset.
+    using IteratorFactory = std::function<std::unique_ptr<CachedSearchIterator>(
+        const void* query_data, const BitsetView& bitset)>;
+
+    static SearchIteratorSessions&
+    GetInstance();
+
+    // ttl_ms <= 0 or max_memory_bytes <= 0 disables the sessions and drops
+    // the existing ones.
+    void
+    Configure(int64_t ttl_ms, int64_t max_memory_bytes);
+
+    bool
+    enabled() const {
+        std::lock_guard lock(mutex_);
+        return ttl_.count() > 0 && max_memory_bytes_ > 0;
+    }
+
+    // Whether pages of search_info may be served from a session: sparse,
+    // embedding list and element-level searches are not.
+    bool
+    Cacheable(const SearchInfo& search_info,
+              bool is_sparse,
+              const size_t* query_offsets,
+              const BitsetView& bitset) const;
+
+    // Writes the next page of search_info to search_result from the session
+    // of (segment_id, token), building it with factory first if there is no
+    // reusable one. source identifies the searched index or column, and
+    // keep_alive pins whatever the iterator reads besides the copies.
+    void
+    NextBatch(int64_t segment_id,
+              const void* source,
+              const SearchInfo& search_info,
+              const void* query_data,
+              int64_t query_bytes,
+              const BitsetView& bitset,
+              int64_t num_rows,
+              std::shared_ptr<void> keep_alive,
+              const IteratorFactory& factory,
+              SearchResult& search_result);
+
+    void
+    DropSegment(int64_t segment_id);
+
+    size_t
+    size() const {
+        std::lock_guard lock(mutex_);
+        return sessions_.size();
+    }
+
+    int64_t
+    memory_usage() const {
+        std::lock_guard lock(mutex_);
+        return memory_usage_;
+    }
+
+ private:
+    using Clock = std::chrono::steady_clock;
+    using Key = std::pair<int64_t, std::string>;
+
+    struct Session {
+        // what the iterator was built from, the iterator reads the copies
+        const void* source = nullptr;
+        std::string params;
+        int64_t num_rows = 0;
+        std::vector<uint8_t> query;
+        std::vector<uint8_t> bitset;
+        size_t bitset_bits = 0;
+        std::shared_ptr<void> keep_alive;
+        std::unique_ptr<CachedSearchIterator> iterator;
+
+        std::optional<float> last_bound;
+        int64_t memory = 0;
+        Clock::time_point last_access;
+        std::list<Key>::iterator lru_iter;
+    };
+    using SessionPtr = std::unique_ptr<Session>;
+
+    SearchIteratorSessions() = default;
+
+    // Takes the session of key out of the cache, for one page at a time.
+    SessionPtr
+    Take(const Key& key);
+
+    // Puts session back as the most recently used one, evicting expired
+    // and least recently used sessions beyond the memory budget.
+    void
+    Put(const Key& key, SessionPtr session);
+
+    // Called with mutex_ held, evicted sessions are appended to evicted so
+    // that they are destroyed after the lock is released.
+    void
+    Evict(Clock::time_point now, std::vector<SessionPtr>& evicted);
+
+    // Called with mutex_ held.
+    SessionPtr
+    Erase(std::map<Key, SessionPtr>::iterator iter);
+
+    mutable std::mutex mutex_;
+    std::chrono::milliseconds ttl_{0};
+    int64_t max_memory_bytes_ = 0;
+    int64_t memory_usage_ = 0;
+    // least recently used first
+    std::list<Key> lru_;
+    std::map<Key, SessionPtr> sessions_;
+};
+
+}  // namespace milvus::query
@@ -0,0 +1,191 @@
+// Copyright (C) 2019-2024 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <map>
+#include <memory>
+#include <random>
+#include <string>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+#include "common/BitsetView.h"
+#include "common/QueryInfo.h"
+#include "common/QueryResult.h"
+#include "knowhere/comp/index_param.h"
+#include "query/SearchIteratorSession.h"
+#include "query/helper.h"
+#include "segcore/ConcurrentVector.h"
+
+using namespace milvus;
+using namespace milvus::query;
+using namespace milvus::segcore;
+
+namespace {
+
+constexpr int64_t kDim = 8;
+constexpr int64_t kNumRows = 1000;
+constexpr int64_t kSizePerChunk = 128;
+constexpr uint32_t kBatchSize = 50;
+constexpr int64_t kSegmentID = 7;
+
+class SearchIteratorSessionTest : public ::testing::Test {
+ protected:
+    void
+    SetUp() override {
+        std::mt19937 rng(42);
+        std::uniform_real_distribution<float> dist(-1, 1);
+        base_.resize(kNumRows * kDim);
+        for (auto& value : base_) {
+            value = dist(rng);
+        }
+        query_.assign(base_.begin(), base_.begin() + kDim);
+        vectors_ = std::make_unique<ConcurrentVector<FloatVector>>(
+            kDim, kSizePerChunk);
+        vectors_->set_data_raw(0, base_.data(), kNumRows);
+
+        search_info_.metric_type_ = knowhere::metric::L2;
+        search_info_.round_decimal_ = -1;
+        SearchIteratorV2Info iterator_info;
+        iterator_info.token = "token";
+        iterator_info.batch_size = kBatchSize;
+        search_info_.iterator_v2_info_ = iterator_info;
+
+        SearchIteratorSessions::GetInstance().Configure(60 * 1000, 1 << 30);
+    }
+
+    void
+    TearDown() override {
+        SearchIteratorSessions::GetInstance().Configure(0, 0);
+    }
+
+    // Returns the offsets of the page and sets last_bound to its last
+    // distance, as if the proxy accepted the whole page.
+    std::vector<int64_t>
+    NextPage(const BitsetView& bitset = nullptr) {
+        SearchResult result;
+        SearchIteratorSessions::GetInstance().NextBatch(
+            kSegmentID,
+            vectors_.get(),
+            search_info_,
+            query_.data(),
+            query_.size() * sizeof(float),
+            bitset,
+            kNumRows,
+            nullptr,
+            [this](const void* query, const BitsetView& owned_bitset) {
+                ++num_built_;
+                dataset::SearchDataset dataset{search_info_.metric_type_,
+                                               1,
+                                               kBatchSize,
+                                               -1,
+                                               kDim,
+                                               query};
+                return std::make_unique<CachedSearchIterator>(
+                    dataset,
+                    vectors_.get(),
+                    kNumRows,
+                    search_info_,
+                    std::map<std::string, std::string>{},
+                    owned_bitset,
+                    DataType::VECTOR_FLOAT);
+            },
+            result);
+        std::vector<int64_t> offsets;
+        for (size_t i = 0; i < kBatchSize && result.seg_offsets_[i] != -1;
+             ++i) {
+            offsets.push_back(result.seg_offsets_[i]);
+            search_info_.iterator_v2_info_->last_bound = result.distances_[i];
+        }
+        return offsets;
+    }
+
+    std::vector<float> base_;
+    std::vector<float> query_;
+    std::unique_ptr<ConcurrentVector<FloatVector>> vectors_;
+    SearchInfo search_info_;
+    int num_built_ = 0;
+};
+
+}  // namespace
+
+TEST_F(SearchIteratorSessionTest, PagesContinueFromSession) {
+    auto& sessions = SearchIteratorSessions::GetInstance();
+    EXPECT_TRUE(sessions.Cacheable(search_info_, false, nullptr, nullptr));
+    EXPECT_FALSE(sessions.Cacheable(search_info_, true, nullptr, nullptr));
+
+    std::unordered_set<int64_t> seen;
+    for (int64_t page = 0; page < kNumRows / kBatchSize; ++page) {
+        auto offsets = NextPage();
+        ASSERT_EQ(offsets.size(), kBatchSize);
+        for (auto offset : offsets) {
+            EXPECT_TRUE(seen.insert(offset).second);
+        }
+    }
+    EXPECT_EQ(seen.size(), kNumRows);
+    EXPECT_EQ(num_built_, 1);
+    EXPECT_EQ(sessions.size(), 1);
+    EXPECT_GT(sessions.memory_usage(), 0);
+
+    sessions.DropSegment(kSegmentID);
+    EXPECT_EQ(sessions.size(), 0);
+    EXPECT_EQ(sessions.memory_usage(), 0);
+}
+
+TEST_F(SearchIteratorSessionTest, RebuildsOnChange) {
+    NextPage();
+    NextPage();
+    EXPECT_EQ(num_built_, 1);
+
+    // a delete between pages changes the bitset
+    TargetBitmap deleted(kNumRows);
+    deleted.set(kNumRows - 1);
+    auto offsets = NextPage(deleted);
+    EXPECT_EQ(num_built_, 2);
+    // the rebuilt iterator still starts after last_bound
+    EXPECT_EQ(offsets.size(), kBatchSize);
+    NextPage(deleted);
+    EXPECT_EQ(num_built_, 2);
+
+    // restarting the iteration
+    search_info_.iterator_v2_info_->last_bound = std::nullopt;
+    NextPage(deleted);
+    EXPECT_EQ(num_built_, 3);
+
+    // another token
+    search_info_.iterator_v2_info_->token = "other";
+    NextPage(deleted);
+    EXPECT_EQ(num_built_, 4);
+    EXPECT_EQ(SearchIteratorSessions::GetInstance().size(), 2);
+}
+
+TEST_F(SearchIteratorSessionTest, Eviction) {
+    auto& sessions = SearchIteratorSessions::GetInstance();
+    // a session of kNumRows doesn't fit
+    sessions.Configure(60 * 1000, 1024);
+    NextPage();
+    EXPECT_EQ(sessions.size(), 0);
+    NextPage();
+    EXPECT_EQ(num_built_, 2);
+
+    sessions.Configure(1, 1 << 30);
+    NextPage();
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    NextPage();
+    EXPECT_EQ(num_built_, 4);
+
+    sessions.Configure(0, 0);
+    EXPECT_FALSE(sessions.enabled());
+    EXPECT_FALSE(sessions.Cacheable(search_info_, false, nullptr, nullptr));
+}
@@ -43,6 +43,7 @@
 #include "knowhere/comp/index_param.h"
 #include "query/CachedSearchIterator.h"
 #include "query/SearchBruteForce.h"
+#include "query/SearchIteratorSession.h"
 #include "query/SearchOnIndex.h"
 #include "query/SubSearchResult.h"
 #include "query/Utils.h"
@@ -97,6 +98,129 @@ FloatSegmentIndexSearch(const segcore::SegmentGrowingImpl& segment,
     }
 }
 
+// Searches an async interim index (see IndexingRecord::is_async) over the
+// rows it covers and brute forces the rows inserted since, which background
+// maintenance hasn't indexed yet. Returns false, leaving the whole segment to
+// brute force, if the index covers no rows or the search can't merge plain
+// top-k results (iterators, group by, element-level search).
+bool
+AsyncSegmentIndexSearch(const segcore::SegmentGrowingImpl& segment,
+                        const SearchInfo& info,
+                        const void* query_data,
+                        const size_t* query_offsets,
+                        int64_t num_queries,
+                        Timestamp timestamp,
+                        const BitsetView& bitset,
+                        milvus::OpContext* op_context,
+                        SearchResult& search_result) {
+    auto& indexing_record = segment.get_indexing_record();
+    auto vecfield_id = info.field_id_;
+    if (!indexing_record.is_async(vecfield_id) ||
+        info.iterator_v2_info_.has_value() ||
+        milvus::exec::UseVectorIterator(info) || info.element_level()) {
+        return false;
+    }
+    auto indexed_count = indexing_record.get_indexed_count(vecfield_id);
+    if (indexed_count == 0) {
+        return false;
+    }
+    auto active_count =
+        std::min(int64_t(bitset.size()), segment.get_active_count(timestamp));
+    if (indexed_count >= active_count) {
+        FloatSegmentIndexSearch(segment,
+                                info,
+                                query_data,
+                                num_queries,
+                                bitset,
+                                op_context,
+                                search_result);
+        return true;
+    }
+
+    // step 1: the indexed rows
+    SearchResult index_result;
+    BitsetView index_bitset =
+        bitset.empty() ? BitsetView{}
+                       : BitsetView(bitset.data(), size_t(indexed_count));
+    FloatSegmentIndexSearch(segment,
+                            info,
+                            query_data,
+                            num_queries,
+                            index_bitset,
+                            op_context,
+                            index_result);
+    auto topk = info.topk_;
+    SubSearchResult final_qr(
+        num_queries, topk, info.metric_type_, info.round_decimal_);
+    auto& offsets = final_qr.mutable_offsets();
+    auto& distances = final_qr.mutable_distances();
+    for (int64_t q = 0; q < num_queries; ++q) {
+        // Rows indexed while searching belong to the brute forced tail.
+        // Unfilled slots keep the merge's sentinels at the end of the query.
+        auto out = q * topk;
+        for (auto i = q * topk; i < (q + 1) * topk; ++i) {
+            auto offset = index_result.seg_offsets_[i];
+            if (offset != INVALID_SEG_OFFSET && offset < indexed_count) {
+                offsets[out] = offset;
+                distances[out++] = index_result.distances_[i];
+            }
+        }
+    }
+
+    // step 2: brute force the rows beyond the index, masking the indexed ones
+    auto& field = segment.get_schema()[vecfield_id];
+    auto data_type = field.get_data_type();
+    auto dim = IsSparseFloatVectorDataType(data_type) ? 0 : field.get_dim();
+    dataset::SearchDataset search_dataset{info.metric_type_,
+                                          num_queries,
+                                          topk,
+                                          info.round_decimal_,
+                                          dim,
+                                          query_data,
+                                          query_offsets};
+    std::map<std::string, std::string> index_info;
+    if (info.metric_type_ == knowhere::metric::BM25 ||
+        info.metric_type_ == knowhere::metric::MHJACCARD) {
+        index_info =
+            indexing_record.get_field_index_meta(vecfield_id).GetIndexParams();
+    }
+    TargetBitmap tail_bitset(active_count, false);
+    if (!bitset.empty()) {
+        milvus::fastmem::FastMemcpy(tail_bitset.data(),
+                                    bitset.data(),
+                                    (active_count + 7) / 8);
+    }
+    tail_bitset.set(0, indexed_count, true);
+
+    auto vec_ptr = segment.get_insert_record().get_data_base(vecfield_id);
+    auto size_per_chunk = vec_ptr->get_size_per_chunk();
+    auto max_chunk = upper_div(active_count, size_per_chunk);
+    for (int64_t chunk_id = indexed_count / size_per_chunk;
+         chunk_id < max_chunk;
+         ++chunk_id) {
+        auto row_begin = chunk_id * size_per_chunk;
+        auto row_end = std::min(active_count, row_begin + size_per_chunk);
+        query::dataset::RawDataset sub_data{row_begin,
+                                            dim,
+                                            row_end - row_begin,
+                                            vec_ptr->get_chunk_data(chunk_id)};
+        auto sub_qr = BruteForceSearch(search_dataset,
+                                       sub_data,
+                                       info,
+                                       index_info,
+                                       BitsetView(tail_bitset),
+                                       data_type,
+                                       field.get_element_type(),
+                                       op_context);
+        final_qr.merge(sub_qr);
+    }
+    search_result.seg_offsets_ = std::move(final_qr.mutable_offsets());
+    search_result.distances_ = std::move(final_qr.mutable_distances());
+    search_result.unity_topK_ = topk;
+    search_result.total_nq_ = num_queries;
+    return true;
+}
+
 void
 SearchOnGrowing(const segcore::SegmentGrowingImpl& segment,
                 const SearchInfo& info,
@@ -126,6 +250,17 @@ SearchOnGrowing(const segcore::SegmentGrowingImpl& segment,
     auto round_decimal = info.round_decimal_;
 
     // step 2: small indexing search
+    if (AsyncSegmentIndexSearch(segment,
+                                info,
+                                query_data,
+                                query_offsets,
+                                num_queries,
+                                timestamp,
+                                bitset,
+                                op_context,
+                                search_result)) {
+        return;
+    }
     if (segment.get_indexing_record().SyncDataWithIndex(field.get_id())) {
         AssertInfo(
             data_type != DataType::VECTOR_ARRAY,
@@ -235,14 +370,47 @@ SearchOnGrowing(const segcore::SegmentGrowingImpl& segment,
                        "embedding list (multi-search-multi) iterator is not "
                        "supported on vector array fields");
 
-            CachedSearchIterator cached_iter(search_dataset,
-                                             vec_ptr,
-                                             active_count,
-                                             info,
-                                             index_info,
-                                             search_bitset,
-                                             iter_data_type);
-            cached_iter.NextBatch(info, search_result);
+            auto& sessions = SearchIteratorSessions::GetInstance();
+            if (sessions.Cacheable(
+                    info,
+                    data_type == DataType::VECTOR_SPARSE_U32_F32,
+                    query_offsets,
+                    search_bitset)) {
+                // active_count is part of the session, so rows inserted
+                // between pages rebuild it.
+                sessions.NextBatch(
+                    segment.get_segment_id(),
+                    vec_ptr,
+                    info,
+                    query_data,
+                    num_queries * field.get_sizeof(),
+                    search_bitset,
+                    active_count,
+                    nullptr,
+                    [&](const void* owned_query,
+                        const BitsetView& owned_bitset) {
+                        auto owned_dataset = search_dataset;
+                        owned_dataset.query_data = owned_query;
+                        return std::make_unique<CachedSearchIterator>(
+                            owned_dataset,
+                            vec_ptr,
+                            active_count,
+                            info,
+                            index_info,
+                            owned_bitset,
+                            iter_data_type);
+                    },
+                    search_result);
+            } else {
+                CachedSearchIterator cached_iter(search_dataset,
+                                                 vec_ptr,
+                                                 active_count,
+                                                 info,
+                                                 index_info,
+                                                 search_bitset,
+                                                 iter_data_type);
+                cached_iter.NextBatch(info, search_result);
+            }
             FinalizeVectorSearchOffsets(
                 search_result, offset_mapping, info.array_offsets_.get());
             return;
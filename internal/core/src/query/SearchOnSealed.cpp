@@ -41,6 +41,7 @@
 #include "mmap/ChunkedColumnInterface.h"
 #include "query/CachedSearchIterator.h"
 #include "query/SearchBruteForce.h"
+#include "query/SearchIteratorSession.h"
 #include "query/SearchOnSealed.h"
 #include "query/SubSearchResult.h"
 #include "query/Utils.h"
@@ -58,7 +59,8 @@ SearchOnSealedIndex(const Schema& schema,
                     int64_t num_queries,
                     const BitsetView& bitset,
                     milvus::OpContext* op_context,
-                    SearchResult& search_result) {
+                    SearchResult& search_result,
+                    std::optional<int64_t> segment_id) {
     auto topK = search_info.topk_;
     auto round_decimal = search_info.round_decimal_;
 
@@ -123,9 +125,33 @@ SearchOnSealedIndex(const Schema& schema,
     }
 
     if (search_info.iterator_v2_info_.has_value()) {
-        CachedSearchIterator cached_iter(
-            *vec_index, dataset, search_info, search_bitset, op_context);
-        cached_iter.NextBatch(search_info, search_result);
+        auto& sessions = SearchIteratorSessions::GetInstance();
+        if (segment_id.has_value() &&
+            sessions.Cacheable(
+                search_info, is_sparse, query_offsets, search_bitset)) {
+            // the session iterator outlives this request, so it's built
+            // without op_context and pins the index cell itself
+            sessions.NextBatch(
+                segment_id.value(),
+                vec_index,
+                search_info,
+                query_data,
+                num_queries * field.get_sizeof(),
+                search_bitset,
+                vec_index->Count(),
+                accessor,
+                [&](const void* owned_query, const BitsetView& owned_bitset) {
+                    auto owned_dataset =
+                        knowhere::GenDataSet(num_queries, dim, owned_query);
+                    return std::make_unique<CachedSearchIterator>(
+                        *vec_index, owned_dataset, search_info, owned_bitset);
+                },
+                search_result);
+        } else {
+            CachedSearchIterator cached_iter(
+                *vec_index, dataset, search_info, search_bitset, op_context);
+            cached_iter.NextBatch(search_info, search_result);
+        }
         FinalizeVectorSearchOffsets(
             search_result, offset_mapping, search_info.array_offsets_.get());
         return;
@@ -171,7 +197,8 @@ SearchOnSealedColumn(const Schema& schema,
                      int64_t row_count,
                      const BitsetView& bitview,
                      milvus::OpContext* op_context,
-                     SearchResult& result) {
+                     SearchResult& result,
+                     std::optional<int64_t> segment_id) {
     auto field_id = search_info.field_id_;
     auto& field = schema[field_id];
 
@@ -244,13 +271,43 @@ SearchOnSealedColumn(const Schema& schema,
                    "embedding list (multi-search-multi) iterator is not "
                    "supported on vector array fields");
 
-        CachedSearchIterator cached_iter(column,
-                                         query_dataset,
-                                         search_info,
-                                         index_info,
-                                         search_bitview,
-                                         data_type);
-        cached_iter.NextBatch(search_info, result);
+        auto& sessions = SearchIteratorSessions::GetInstance();
+        if (segment_id.has_value() &&
+            sessions.Cacheable(search_info,
+                               data_type == DataType::VECTOR_SPARSE_U32_F32,
+                               query_offsets,
+                               search_bitview)) {
+            // chunks are pinned by the iterator itself
+            sessions.NextBatch(
+                segment_id.value(),
+                column,
+                search_info,
+                query_data,
+                num_queries * field.get_sizeof(),
+                search_bitview,
+                row_count,
+                nullptr,
+                [&](const void* owned_query, const BitsetView& owned_bitset) {
+                    auto owned_dataset = query_dataset;
+                    owned_dataset.query_data = owned_query;
+                    return std::make_unique<CachedSearchIterator>(
+                        column,
+                        owned_dataset,
+                        search_info,
+                        index_info,
+                        owned_bitset,
+                        data_type);
+                },
+                result);
+        } else {
+            CachedSearchIterator cached_iter(column,
+                                             query_dataset,
+                                             search_info,
+                                             index_info,
+                                             search_bitview,
+                                             data_type);
+            cached_iter.NextBatch(search_info, result);
+        }
         FinalizeVectorSearchOffsets(
             result, offset_mapping, search_info.array_offsets_.get());
         return;
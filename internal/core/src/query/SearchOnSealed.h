@@ -14,6 +14,7 @@
 #include <stdint.h>
 #include <cstddef>
 #include <map>
+#include <optional>
 #include <string>
 
 #include "common/BitsetView.h"
@@ -27,6 +28,8 @@
 
 namespace milvus::query {
 
+// segment_id, if set, lets search_iterator v2 pages continue from the
+// iterator session of their token on the segment.
 void
 SearchOnSealedIndex(const Schema& schema,
                     const segcore::SealedIndexingRecord& record,
@@ -36,7 +39,8 @@ SearchOnSealedIndex(const Schema& schema,
                     int64_t num_queries,
                     const BitsetView& view,
                     milvus::OpContext* op_context,
-                    SearchResult& search_result);
+                    SearchResult& search_result,
+                    std::optional<int64_t> segment_id = std::nullopt);
 
 void
 SearchOnSealedColumn(const Schema& schema,
@@ -49,6 +53,7 @@ SearchOnSealedColumn(const Schema& schema,
                      int64_t row_count,
                      const BitsetView& bitset,
                      milvus::OpContext* op_context,
-                     SearchResult& result);
+                     SearchResult& result,
+                     std::optional<int64_t> segment_id = std::nullopt);
 
 }  // namespace milvus::query
@@ -0,0 +1,50 @@
+// Copyright (C) 2019-2026 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License
+
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include <arrow/api.h>
+
+#include "common/Types.h"
+
+namespace milvus::segcore {
+
+// Arrow field metadata shared by the search and retrieve Arrow exports, so
+// that the Go side can map columns back to Milvus fields.
+constexpr const char* kMilvusFieldIDMetadataKey = "milvus.field_id";
+constexpr const char* kMilvusDataTypeMetadataKey = "milvus.data_type";
+// schema level metadata of retrieve results exported as arrow
+constexpr const char* kAllRetrieveCountMetadataKey =
+    "milvus.all_retrieve_count";
+constexpr const char* kHasMoreResultMetadataKey = "milvus.has_more_result";
+
+inline std::shared_ptr<arrow::KeyValueMetadata>
+MilvusFieldMetadata(milvus::FieldId field_id, milvus::DataType data_type) {
+    return arrow::key_value_metadata(
+        {kMilvusFieldIDMetadataKey, kMilvusDataTypeMetadataKey},
+        {std::to_string(field_id.get()),
+         std::to_string(static_cast<int32_t>(data_type))});
+}
+
+inline std::shared_ptr<arrow::Field>
+MilvusField(const std::string& name,
+            const std::shared_ptr<arrow::DataType>& arrow_type,
+            bool nullable,
+            milvus::FieldId field_id,
+            milvus::DataType data_type) {
+    return arrow::field(
+        name, arrow_type, nullable, MilvusFieldMetadata(field_id, data_type));
+}
+
+}  // namespace milvus::segcore
@@ -0,0 +1,95 @@
+// Copyright (C) 2019-2025 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License
+
+#include "segcore/CellAccessPredictor.h"
+
+#include <algorithm>
+#include <map>
+
+namespace milvus::segcore {
+
+uint64_t
+CellAccessPredictor::PatternOf(const std::vector<FieldId>& access_entries) {
+    std::vector<int64_t> ids;
+    ids.reserve(access_entries.size());
+    for (auto field_id : access_entries) {
+        ids.push_back(field_id.get());
+    }
+    std::sort(ids.begin(), ids.end());
+    ids.erase(std::unique(ids.begin(), ids.end()), ids.end());
+    // FNV-1a over the sorted field ids
+    uint64_t hash = 0xcbf29ce484222325ULL;
+    for (auto id : ids) {
+        hash ^= static_cast<uint64_t>(id);
+        hash *= 0x100000001b3ULL;
+    }
+    return hash;
+}
+
+void
+CellAccessPredictor::Record(uint64_t pattern,
+                            FieldId field_id,
+                            std::vector<int64_t> cells) {
+    std::sort(cells.begin(), cells.end());
+    cells.erase(std::unique(cells.begin(), cells.end()), cells.end());
+
+    std::lock_guard lock(mutex_);
+    auto iter = patterns_.find(pattern);
+    if (iter == patterns_.end()) {
+        if (patterns_.size() >= kMaxPatterns) {
+            patterns_.erase(lru_.back());
+            lru_.pop_back();
+        }
+        lru_.push_front(pattern);
+        iter = patterns_.emplace(pattern, History{}).first;
+        iter->second.lru_iter = lru_.begin();
+    } else {
+        lru_.splice(lru_.begin(), lru_, iter->second.lru_iter);
+    }
+    auto& history = iter->second.fields[field_id];
+    history.push_front(std::move(cells));
+    if (history.size() > kHistorySize) {
+        history.pop_back();
+    }
+}
+
+CellAccessPredictor::Prediction
+CellAccessPredictor::Predict(uint64_t pattern) const {
+    Prediction prediction;
+    std::lock_guard lock(mutex_);
+    auto iter = patterns_.find(pattern);
+    if (iter == patterns_.end()) {
+        return prediction;
+    }
+    for (const auto& [field_id, history] : iter->second.fields) {
+        if (history.size() < kMinHits) {
+            continue;
+        }
+        std::map<int64_t, size_t> hits;
+        for (const auto& cells : history) {
+            for (auto cell : cells) {
+                ++hits[cell];
+            }
+        }
+        std::vector<int64_t> predicted;
+        for (const auto& [cell, count] : hits) {
+            if (count >= kMinHits) {
+                predicted.push_back(cell);
+            }
+        }
+        if (!predicted.empty()) {
+            prediction.emplace_back(field_id, std::move(predicted));
+        }
+    }
+    return prediction;
+}
+
+}  // namespace milvus::segcore
@@ -0,0 +1,66 @@
+// Copyright (C) 2019-2025 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License
+
+#pragma once
+
+#include <cstdint>
+#include <deque>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "common/Types.h"
+
+namespace milvus::segcore {
+
+// Learns, per query pattern, which cells of which fields the queries of a
+// segment end up pinning to fill their output, so that the next query of the
+// same pattern can prefetch them while it is still filtering. A pattern is
+// the set of fields a query accesses, i.e. its filter and output fields.
+//
+// A cell is predicted once it was touched by kMinHits of the last
+// kHistorySize queries of the pattern; cells touched by a single query (e.g.
+// a random top-k hit) are not worth a prefetch.
+class CellAccessPredictor {
+ public:
+    static constexpr size_t kHistorySize = 8;
+    static constexpr size_t kMinHits = 2;
+    static constexpr size_t kMaxPatterns = 64;
+
+    using Prediction = std::vector<std::pair<FieldId, std::vector<int64_t>>>;
+
+    static uint64_t
+    PatternOf(const std::vector<FieldId>& access_entries);
+
+    // Records the cells of field_id one query of pattern pinned.
+    void
+    Record(uint64_t pattern, FieldId field_id, std::vector<int64_t> cells);
+
+    // Cells, per field, the next query of pattern is likely to pin.
+    Prediction
+    Predict(uint64_t pattern) const;
+
+ private:
+    struct History {
+        // the cells of each field, most recent query first
+        std::unordered_map<FieldId, std::deque<std::vector<int64_t>>> fields;
+        std::list<uint64_t>::iterator lru_iter;
+    };
+
+    mutable std::mutex mutex_;
+    // most recently recorded first
+    std::list<uint64_t> lru_;
+    std::unordered_map<uint64_t, History> patterns_;
+};
+
+}  // namespace milvus::segcore
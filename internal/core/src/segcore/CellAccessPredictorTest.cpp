@@ -0,0 +1,66 @@
+// Copyright (C) 2019-2025 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "segcore/CellAccessPredictor.h"
+
+using namespace milvus;
+using namespace milvus::segcore;
+
+TEST(CellAccessPredictor, PredictsRecurringCells) {
+    CellAccessPredictor predictor;
+    auto pattern =
+        CellAccessPredictor::PatternOf({FieldId(101), FieldId(102)});
+    EXPECT_EQ(pattern,
+              CellAccessPredictor::PatternOf(
+                  {FieldId(102), FieldId(101), FieldId(102)}));
+    EXPECT_NE(pattern, CellAccessPredictor::PatternOf({FieldId(101)}));
+
+    // a single query predicts nothing
+    predictor.Record(pattern, FieldId(102), {3, 1, 3});
+    EXPECT_TRUE(predictor.Predict(pattern).empty());
+
+    predictor.Record(pattern, FieldId(102), {3, 5});
+    predictor.Record(pattern, FieldId(101), {7});
+    auto prediction = predictor.Predict(pattern);
+    ASSERT_EQ(prediction.size(), 1);
+    EXPECT_EQ(prediction[0].first, FieldId(102));
+    EXPECT_EQ(prediction[0].second, std::vector<int64_t>{3});
+    EXPECT_TRUE(
+        predictor.Predict(CellAccessPredictor::PatternOf({FieldId(101)}))
+            .empty());
+
+    // cells drop out once they leave the history
+    for (size_t i = 0; i < CellAccessPredictor::kHistorySize; ++i) {
+        predictor.Record(pattern, FieldId(102), {8, 9});
+    }
+    prediction = predictor.Predict(pattern);
+    ASSERT_EQ(prediction.size(), 1);
+    EXPECT_EQ(prediction[0].second, (std::vector<int64_t>{8, 9}));
+}
+
+TEST(CellAccessPredictor, EvictsLeastRecentPattern) {
+    CellAccessPredictor predictor;
+    for (size_t i = 0; i <= CellAccessPredictor::kMaxPatterns; ++i) {
+        auto pattern = CellAccessPredictor::PatternOf({FieldId(100 + i)});
+        predictor.Record(pattern, FieldId(100 + i), {0});
+        predictor.Record(pattern, FieldId(100 + i), {0});
+    }
+    EXPECT_TRUE(
+        predictor.Predict(CellAccessPredictor::PatternOf({FieldId(100)}))
+            .empty());
+    EXPECT_FALSE(
+        predictor.Predict(CellAccessPredictor::PatternOf({FieldId(101)}))
+            .empty());
+}
@@ -120,6 +120,7 @@
 #include "pb/segcore.pb.h"
 #include "prometheus/histogram.h"
 #include "query/PlanImpl.h"
+#include "query/SearchIteratorSession.h"
 #include "query/SearchOnSealed.h"
 #include "segcore/ConcurrentVector.h"
 #include "segcore/DeletedRecord.h"
@@ -134,10 +135,12 @@
 #include "segcore/storagev2translator/GroupChunkTranslator.h"
 #include "segcore/storagev2translator/ManifestGroupTranslator.h"
 #include "segcore/TextColumnCache.h"
+#include "segcore/WarmSetSnapshot.h"
 #include "storage/FileManager.h"
 #include "storage/KeyRetriever.h"
 #include "storage/LocalChunkManager.h"
 #include "storage/LocalChunkManagerSingleton.h"
+#include "storage/PrefetchThreadPool.h"
 #include "storage/MmapManager.h"
 #include "storage/RemoteChunkManagerSingleton.h"
 #include "storage/ThreadPool.h"
@@ -545,7 +548,8 @@ void
 ChunkedSegmentSealedImpl::init_storage_v2_pk_index(
     FieldId field_id,
     const std::shared_ptr<ChunkedColumnInterface>& column,
-    DataType data_type) {
+    DataType data_type,
+    std::shared_ptr<const SealedSidecars> sidecars) {
     auto schema_snapshot = CaptureSchemaSnapshot();
     if (schema_snapshot->get_primary_field_id().value_or(FieldId(-1)) !=
         field_id) {
@@ -553,7 +557,7 @@ ChunkedSegmentSealedImpl::init_storage_v2_pk_index(
     }
     std::unique_ptr<Translator<storagev2translator::PkIndexCell>> translator =
         std::make_unique<storagev2translator::PkIndexTranslator>(
-            id_, column, data_type, is_sorted_by_pk_);
+            id_, column, data_type, is_sorted_by_pk_, std::move(sidecars));
     *pk_index_slot_.wlock() =
         Manager::GetInstance().CreateCacheSlot(std::move(translator));
 }
@@ -2409,6 +2413,7 @@ ChunkedSegmentSealedImpl::load_column_group_data_internal(
                 info.warmup_policy);
         auto chunked_column_group =
             std::make_shared<ChunkedColumnGroup>(std::move(translator));
+        chunked_column_group->TrackWarmSet(id_, milvus_field_ids);
 
         // Create ProxyChunkColumn for each field in this column group
         for (const auto& field_id : milvus_field_ids) {
@@ -2557,6 +2562,7 @@ ChunkedSegmentSealedImpl::load_column_group_data_internal(
                 info.warmup_policy);
         auto chunked_column_group =
             std::make_shared<ChunkedColumnGroup>(std::move(translator));
+        chunked_column_group->TrackWarmSet(id_, milvus_field_ids);
 
         for (const auto& field_id : milvus_field_ids) {
             const auto& field_meta = field_metas.at(field_id);
@@ -3058,6 +3064,75 @@ ChunkedSegmentSealedImpl::prefetch_chunks(
     }
 }
 
+void
+ChunkedSegmentSealedImpl::PrefetchPredictedCells(
+    const std::vector<FieldId>& access_entries) const {
+    if (!SegcoreConfig::default_config().get_enable_predictive_warmup()) {
+        return;
+    }
+    auto prediction = cell_access_predictor_.Predict(
+        CellAccessPredictor::PatternOf(access_entries));
+    if (prediction.empty()) {
+        return;
+    }
+    auto runtime = CaptureRuntimeResourceState();
+    auto prefetch_pool = GetPrefetchThreadPool();
+    for (auto& [field_id, cells] : prediction) {
+        auto column = get_column(runtime, field_id);
+        if (column == nullptr) {
+            continue;
+        }
+        // the column keeps its cache slot alive even if the segment is
+        // released before the prefetch runs
+        prefetch_pool->add([column,
+                            field_id = field_id,
+                            cells = std::move(cells),
+                            segment_id = id_]() {
+            try {
+                column->PrefetchChunks(nullptr, cells);
+            } catch (const std::exception& e) {
+                LOG_WARN(
+                    "predictive prefetch of segment {} field {} failed: {}",
+                    segment_id,
+                    field_id.get(),
+                    e.what());
+            }
+        });
+    }
+}
+
+void
+ChunkedSegmentSealedImpl::RecordOutputCells(
+    const std::vector<FieldId>& access_entries,
+    const std::vector<FieldId>& output_fields,
+    const int64_t* offsets,
+    int64_t size) const {
+    if (!SegcoreConfig::default_config().get_enable_predictive_warmup() ||
+        size == 0) {
+        return;
+    }
+    auto pattern = CellAccessPredictor::PatternOf(access_entries);
+    auto runtime = CaptureRuntimeResourceState();
+    for (auto field_id : output_fields) {
+        if (SystemProperty::Instance().IsSystem(field_id)) {
+            continue;
+        }
+        auto column = get_column(runtime, field_id);
+        // a single cell is pinned whole at load time anyway
+        if (column == nullptr || column->num_chunks() <= 1) {
+            continue;
+        }
+        std::vector<int64_t> cells;
+        cells.reserve(size);
+        for (int64_t i = 0; i < size; ++i) {
+            if (offsets[i] >= 0) {
+                cells.push_back(column->GetChunkIDByOffset(offsets[i]).first);
+            }
+        }
+        cell_access_predictor_.Record(pattern, field_id, std::move(cells));
+    }
+}
+
 void
 ChunkedSegmentSealedImpl::prefetch_chunks_locked(milvus::OpContext* op_ctx,
                                                  FieldId field_id) const {
@@ -3216,6 +3291,22 @@ ChunkedSegmentSealedImpl::chunk_string_views_by_offsets(
               "chunk_view_by_offsets only used for variable column field ");
 }
 
+PinWrapper<StringChunk*>
+ChunkedSegmentSealedImpl::string_chunk(milvus::OpContext* op_ctx,
+                                       FieldId field_id,
+                                       int64_t chunk_id) const {
+    auto column = get_column(field_id);
+    if (column == nullptr) {
+        return PinWrapper<StringChunk*>(nullptr);
+    }
+    auto pw = column->GetChunk(op_ctx, chunk_id);
+    auto chunk = dynamic_cast<StringChunk*>(pw.get());
+    if (chunk == nullptr) {
+        return PinWrapper<StringChunk*>(nullptr);
+    }
+    return PinWrapper<StringChunk*>(std::move(pw), chunk);
+}
+
 PinWrapper<std::pair<std::vector<ArrayView>, FixedVector<bool>>>
 ChunkedSegmentSealedImpl::chunk_array_views_by_offsets(
     milvus::OpContext* op_ctx,
@@ -3339,7 +3430,8 @@ ChunkedSegmentSealedImpl::vector_search(SearchInfo& search_info,
                                    query_count,
                                    bitset,
                                    op_context,
-                                   output);
+                                   output,
+                                   id_);
         milvus::tracer::AddEvent(
             "finish_searching_vector_temperate_binlog_index");
     } else if (get_bit(snapshot->index_ready_bitset, field_id)) {
@@ -3358,7 +3450,8 @@ ChunkedSegmentSealedImpl::vector_search(SearchInfo& search_info,
                                    query_count,
                                    bitset,
                                    op_context,
-                                   output);
+                                   output,
+                                   id_);
         milvus::tracer::AddEvent("finish_searching_vector_index");
     } else {
         AssertInfo(
@@ -3388,7 +3481,8 @@ ChunkedSegmentSealedImpl::vector_search(SearchInfo& search_info,
                                     row_count,
                                     bitset,
                                     op_context,
-                                    output);
+                                    output,
+                                    id_);
         milvus::tracer::AddEvent("finish_searching_vector_data");
     }
 }
@@ -4452,6 +4546,8 @@ ChunkedSegmentSealedImpl::~ChunkedSegmentSealedImpl() {
         auto mm = storage::MmapManager::GetInstance().GetMmapChunkManager();
         mm->UnRegister(mmap_descriptor_);
     }
+    WarmSetSnapshot::GetInstance().DropSegment(id_);
+    query::SearchIteratorSessions::GetInstance().DropSegment(id_);
 }
 
 void
@@ -4623,7 +4719,8 @@ ChunkedSegmentSealedImpl::bulk_subscript(milvus::OpContext* op_ctx,
                     view.output_data(dst[i]);
                 },
                 seg_offsets,
-                count);
+                count,
+                true);
             break;
         }
         default: {
@@ -4693,7 +4790,8 @@ ChunkedSegmentSealedImpl::bulk_subscript_ptr_impl(
                 dst->at(offset) = std::string(json.data());
             },
             seg_offsets,
-            count);
+            count,
+            true);
     } else {
         static_assert(std::is_same_v<S, std::string>);
         column->BulkRawStringAt(
@@ -4702,7 +4800,8 @@ ChunkedSegmentSealedImpl::bulk_subscript_ptr_impl(
                 dst->at(offset) = std::string(value);
             },
             seg_offsets,
-            count);
+            count,
+            true);
     }
 }
 
@@ -4721,7 +4820,8 @@ ChunkedSegmentSealedImpl::bulk_subscript_ptr_impl(
                 dst[offset] = std::move(T(json));
             },
             seg_offsets,
-            count);
+            count,
+            true);
     } else {
         static_assert(std::is_same_v<S, std::string>);
         column->BulkRawStringAt(
@@ -4730,7 +4830,8 @@ ChunkedSegmentSealedImpl::bulk_subscript_ptr_impl(
                 dst[offset] = std::move(T(value));
             },
             seg_offsets,
-            count);
+            count,
+            true);
     }
 }
 
@@ -4748,7 +4849,8 @@ ChunkedSegmentSealedImpl::bulk_subscript_array_impl(
             view.output_data(dst->at(i));
         },
         seg_offsets,
-        count);
+        count,
+        true);
 }
 
 template <typename T>
@@ -5430,7 +5532,8 @@ ChunkedSegmentSealedImpl::FillPrimaryKeys(const query::Plan* plan,
                         results.primary_keys_[offset] = std::string(value);
                     },
                     results.seg_offsets_.data(),
-                    size);
+                    size,
+                    true);
                 results.search_storage_cost_.scanned_remote_bytes +=
                     local_ctx.storage_usage.scanned_cold_bytes.load();
                 results.search_storage_cost_.scanned_total_bytes +=
@@ -5894,7 +5997,8 @@ ChunkedSegmentSealedImpl::bulk_subscript(
             dst->at(offset) = ExtractSubJson(json.data(), dynamic_field_names);
         },
         seg_offsets,
-        count);
+        count,
+        true);
     return ret;
 }
 
@@ -6471,6 +6575,42 @@ ChunkedSegmentSealedImpl::LazyCheckSchema(SchemaPtr sch,
     }
 }
 
+void
+ChunkedSegmentSealedImpl::WarmUpSnapshotCells(
+    FieldId field_id,
+    const std::shared_ptr<ChunkedColumnInterface>& column) const {
+    auto cells = WarmSetSnapshot::GetInstance().TakeWarmCells(id_, field_id);
+    // the snapshot may predate a compaction or reload of the segment
+    auto num_chunks = column->num_chunks();
+    cells.erase(std::remove_if(cells.begin(),
+                               cells.end(),
+                               [num_chunks](int64_t cid) {
+                                   return cid >= num_chunks;
+                               }),
+                cells.end());
+    if (cells.empty()) {
+        return;
+    }
+    LOG_INFO("segment {} warms up {} cells of field {} from warm set snapshot",
+             id_,
+             cells.size(),
+             field_id.get());
+    auto& pool = ThreadPools::GetThreadPool(ThreadPoolPriority::HIGH);
+    // the column keeps its cache slot alive even if the segment is released
+    // before the warmup runs
+    pool.Submit(
+        [column, field_id, cells = std::move(cells), segment_id = id_]() {
+            try {
+                column->PrefetchChunks(nullptr, cells);
+            } catch (const std::exception& e) {
+                LOG_WARN("warm set warmup of segment {} field {} failed: {}",
+                         segment_id,
+                         field_id.get(),
+                         e.what());
+            }
+        });
+}
+
 void
 ChunkedSegmentSealedImpl::load_field_data_common(
     FieldId field_id,
@@ -6487,6 +6627,8 @@ ChunkedSegmentSealedImpl::load_field_data_common(
     bool is_replace,
     StagedStateCommitter* committer) {
     auto snapshot = CapturePublishedState();
+    column->TrackWarmSet(id_);
+    WarmUpSnapshotCells(field_id, column);
 
     if (!enable_mmap) {
         if (IsVariableDataType(data_type)) {
@@ -6494,10 +6636,20 @@ ChunkedSegmentSealedImpl::load_field_data_common(
                 field_id, num_rows, column->DataByteSize());
         }
     }
+    auto sidecars = segment_load_info.GetSealedSidecars();
     if (!IsVariableDataType(data_type) || IsStringDataType(data_type)) {
+        // manifest columns can't be scanned for their skip index at load, but
+        // the zone maps written at flush describe them
+        std::vector<std::unique_ptr<index::FieldChunkMetrics>> metrics;
+        if (!statistics && sidecars != nullptr) {
+            metrics = sidecars->ChunkMetrics(
+                field_id, data_type, column->GetNumRowsUntilChunk());
+        }
         if (statistics) {
             LoadSkipIndexFromStatistics(
                 field_id, data_type, statistics.value());
+        } else if (!metrics.empty()) {
+            LoadSkipIndexFromMetrics(field_id, data_type, std::move(metrics));
         } else if (!is_proxy_column) {
             LoadSkipIndex(field_id, data_type, column);
         }
@@ -6506,7 +6658,7 @@ ChunkedSegmentSealedImpl::load_field_data_common(
     if (schema_snapshot->get_primary_field_id().value_or(FieldId(-1)) ==
         field_id) {
         if (segment_load_info.GetStorageVersion() >= STORAGE_V2) {
-            init_storage_v2_pk_index(field_id, column, data_type);
+            init_storage_v2_pk_index(field_id, column, data_type, sidecars);
         } else {
             init_storage_v1_pk_index(field_id, column, data_type, is_replace);
         }
@@ -6721,6 +6873,9 @@ ChunkedSegmentSealedImpl::PrepareLoadDiffForReopen(
                 milvus::storage::LoonFFIPropertiesSingleton::GetInstance()
                     .GetProperties();
             auto column_groups = segment_load_info.GetColumnGroups();
+            // read before the column groups load in parallel, which use them
+            // for the skip and pk indexes
+            segment_load_info.LoadSealedSidecars();
             auto arrow_schema = schema_snapshot->ConvertToLoonArrowSchema(
                 /*text_lob_as_binary=*/true);
             auto needed_columns = std::make_shared<std::vector<std::string>>();
@@ -7835,6 +7990,7 @@ ChunkedSegmentSealedImpl::LoadColumnGroup(
             segment_load_info.GetInsertChannel());
     auto chunked_column_group =
         std::make_shared<ChunkedColumnGroup>(std::move(translator));
+    chunked_column_group->TrackWarmSet(id_, milvus_field_ids);
 
     // Create ProxyChunkColumn for each field
     for (const auto& field_id : milvus_field_ids) {
@@ -7988,6 +8144,7 @@ ChunkedSegmentSealedImpl::LoadColumnGroup(
             segment_load_info.GetInsertChannel());
     auto chunked_column_group =
         std::make_shared<ChunkedColumnGroup>(std::move(translator));
+    chunked_column_group->TrackWarmSet(id_, milvus_field_ids);
 
     for (const auto& field_id : milvus_field_ids) {
         const auto& field_meta = field_metas.at(field_id);
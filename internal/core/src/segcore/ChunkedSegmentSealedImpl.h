@@ -75,6 +75,7 @@
 #include "pb/plan.pb.h"
 #include "pb/segcore.pb.h"
 #include "query/PlanImpl.h"
+#include "segcore/CellAccessPredictor.h"
 #include "segcore/IndexConfigGenerator.h"
 #include "segcore/InsertRecord.h"
 #include "segcore/SegcoreConfig.h"
@@ -261,6 +262,15 @@ class ChunkedSegmentSealedImpl : public SegmentSealed {
     std::shared_ptr<index::JsonKeyStats>
     GetJsonStats(milvus::OpContext* op_ctx, FieldId field_id) const override;
 
+    // Pins chunk chunk_id of a VARCHAR/STRING field as the StringChunk that
+    // holds it, for scans that read its offsets and data buffer directly.
+    // Null if the field isn't kept in StringChunks. Not virtual, callers
+    // reach it through dynamic_cast.
+    PinWrapper<StringChunk*>
+    string_chunk(milvus::OpContext* op_ctx,
+                 FieldId field_id,
+                 int64_t chunk_id) const;
+
     PinWrapper<index::NgramInvertedIndex*>
     GetNgramIndex(milvus::OpContext* op_ctx, FieldId field_id) const override;
 
@@ -487,6 +497,28 @@ class ChunkedSegmentSealedImpl : public SegmentSealed {
         bool fill_ids,
         milvus::OpContext* op_ctx = nullptr) const;
 
+    // Non-virtual helpers called via dynamic_cast from SegmentInterface for
+    // predictive warmup (SegcoreConfig::get_enable_predictive_warmup()).
+    // Prefetches, on the prefetch pool and without waiting, the cells earlier
+    // queries reading the same access_entries pinned for their output.
+    void
+    PrefetchPredictedCells(const std::vector<FieldId>& access_entries) const;
+
+    // Records the cells of output_fields holding the result offsets of a
+    // query reading access_entries.
+    void
+    RecordOutputCells(const std::vector<FieldId>& access_entries,
+                      const std::vector<FieldId>& output_fields,
+                      const int64_t* offsets,
+                      int64_t size) const;
+
+    // Non-virtual, reached via dynamic_cast. Rows of a segment sorted by pk
+    // are selected in offset order without pk dedup, see find_first_n.
+    bool
+    is_sorted_by_pk() const {
+        return is_sorted_by_pk_;
+    }
+
     // count of chunk that has raw data
     int64_t
     num_chunk_data(FieldId field_id) const override;
@@ -2066,6 +2098,13 @@ class ChunkedSegmentSealedImpl : public SegmentSealed {
     void
     ApplySchemaForReopen(SchemaPtr sch);
 
+    // Prefetches, on the HIGH pool and without waiting, the cells of field_id
+    // the warm set snapshot of the previous process lists as hot.
+    void
+    WarmUpSnapshotCells(
+        FieldId field_id,
+        const std::shared_ptr<ChunkedColumnInterface>& column) const;
+
     void
     load_field_data_common(
         FieldId field_id,
@@ -2145,7 +2184,8 @@ class ChunkedSegmentSealedImpl : public SegmentSealed {
     init_storage_v2_pk_index(
         FieldId field_id,
         const std::shared_ptr<ChunkedColumnInterface>& column,
-        DataType data_type);
+        DataType data_type,
+        std::shared_ptr<const SealedSidecars> sidecars = nullptr);
 
  private:
     std::unique_ptr<SpanBase>
@@ -2228,6 +2268,9 @@ class ChunkedSegmentSealedImpl : public SegmentSealed {
     // reopen/load can stage a replacement reader without exposing it early.
     mutable std::mutex reader_mutex_;
 
+    // output cells pinned by recent queries, for predictive warmup
+    mutable CellAccessPredictor cell_access_predictor_;
+
     // Array offsets grouped by the shared struct-array parent name.
     std::unordered_map<std::string, std::shared_ptr<ArrayOffsetsSealed>>
         struct_to_array_offsets_;
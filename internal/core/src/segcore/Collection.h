@@ -19,6 +19,7 @@
 
 #include "common/IndexMeta.h"
 #include "common/Schema.h"
+#include "query/PlanCache.h"
 #include "pb/schema.pb.h"
 
 namespace milvus::segcore {
@@ -80,12 +81,20 @@ class Collection {
         return collection_name_;
     }
 
+    // Parsed search/retrieve plans of this collection, reused across
+    // requests that send the same serialized plan.
+    query::PlanCache&
+    get_plan_cache() {
+        return plan_cache_;
+    }
+
  private:
     std::string collection_name_;
     SchemaPtr schema_;
     std::shared_mutex schema_mutex_;
     IndexMetaPtr index_meta_;
     std::shared_mutex index_meta_mutex_;
+    query::PlanCache plan_cache_;
 };
 
 using CollectionPtr = std::unique_ptr<Collection>;
@@ -0,0 +1,217 @@
+// Copyright (C) 2019-2025 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License
+
+#include "segcore/CompressedCellCache.h"
+
+#include <lz4.h>
+#include <sys/mman.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+
+#include "common/ChunkTarget.h"
+#include "common/EasyAssert.h"
+#include "log/Log.h"
+
+namespace milvus::segcore {
+
+namespace {
+
+size_t
+AlignedSize(size_t size) {
+    return (size + ChunkTarget::ALIGNED_SIZE - 1) &
+           ~(ChunkTarget::ALIGNED_SIZE - 1);
+}
+
+}  // namespace
+
+CompressedCellCache&
+CompressedCellCache::GetInstance() {
+    static CompressedCellCache instance;
+    return instance;
+}
+
+std::string
+CompressedCellCache::InstanceKey(const std::string& translator_key) {
+    static std::atomic<uint64_t> generation{0};
+    return fmt::format("{}_{}",
+                       translator_key,
+                       generation.fetch_add(1, std::memory_order_relaxed));
+}
+
+void
+CompressedCellCache::Configure(int64_t capacity_bytes) {
+    std::lock_guard lock(mutex_);
+    capacity_ = std::max<int64_t>(capacity_bytes, 0);
+    EvictUntil(capacity_);
+    LOG_INFO("compressed cell cache capacity set to {} bytes", capacity_);
+}
+
+void
+CompressedCellCache::EvictUntil(int64_t capacity_bytes) {
+    while (size_bytes_ > capacity_bytes && !lru_.empty()) {
+        EraseEntry(entries_.find(lru_.back()));
+    }
+}
+
+void
+CompressedCellCache::EraseEntry(EntryMap::iterator iter) {
+    const auto& [key, cid] = iter->first;
+    auto cids = cids_by_key_.find(key);
+    cids->second.erase(cid);
+    if (cids->second.empty()) {
+        cids_by_key_.erase(cids);
+    }
+    size_bytes_ -= iter->second.bytes;
+    lru_.erase(iter->second.lru_iter);
+    entries_.erase(iter);
+}
+
+void
+CompressedCellCache::Put(
+    const std::string& key,
+    int64_t cid,
+    const std::vector<std::pair<FieldId, const Chunk*>>& chunks) {
+    int64_t capacity;
+    {
+        std::lock_guard lock(mutex_);
+        capacity = capacity_;
+    }
+    if (capacity == 0 || chunks.empty()) {
+        return;
+    }
+
+    // compress outside the lock, cells are loaded concurrently
+    auto parts = std::make_shared<std::vector<Part>>();
+    parts->reserve(chunks.size());
+    size_t raw_bytes = 0;
+    int64_t bytes = 0;
+    for (const auto& [field_id, chunk] : chunks) {
+        auto size = chunk->Size();
+        if (size > LZ4_MAX_INPUT_SIZE) {
+            return;
+        }
+        Part part{field_id, size, static_cast<size_t>(chunk->RowNums()), {}};
+        if (size == 0) {
+            parts->push_back(std::move(part));
+            continue;
+        }
+        part.compressed.resize(LZ4_compressBound(size));
+        auto compressed_size =
+            LZ4_compress_default(chunk->RawData(),
+                                 part.compressed.data(),
+                                 static_cast<int>(size),
+                                 static_cast<int>(part.compressed.size()));
+        if (compressed_size <= 0) {
+            return;
+        }
+        part.compressed.resize(compressed_size);
+        part.compressed.shrink_to_fit();
+        raw_bytes += size;
+        bytes += compressed_size;
+        parts->push_back(std::move(part));
+    }
+    if (bytes == 0 || raw_bytes < bytes * kMinCompressionRatio ||
+        bytes > capacity) {
+        return;
+    }
+
+    std::lock_guard lock(mutex_);
+    CellKey cell_key{key, cid};
+    auto iter = entries_.find(cell_key);
+    if (iter != entries_.end()) {
+        // put concurrently by another load of the same cell
+        EraseEntry(iter);
+    }
+    EvictUntil(capacity_ - bytes);
+    cids_by_key_[key].insert(cid);
+    lru_.push_front(cell_key);
+    entries_.emplace(std::move(cell_key),
+                     Entry{std::move(parts), bytes, lru_.begin()});
+    size_bytes_ += bytes;
+}
+
+std::vector<std::pair<FieldId, ChunkBuffer>>
+CompressedCellCache::Get(const std::string& key, int64_t cid) {
+    std::shared_ptr<const std::vector<Part>> parts;
+    {
+        std::lock_guard lock(mutex_);
+        auto iter = entries_.find(CellKey{key, cid});
+        if (iter == entries_.end()) {
+            return {};
+        }
+        lru_.splice(lru_.begin(), lru_, iter->second.lru_iter);
+        parts = iter->second.parts;
+    }
+
+    // one region for the whole cell, each chunk aligned as if it was written
+    // by a ChunkTarget
+    size_t cap = 0;
+    for (const auto& part : *parts) {
+        cap += AlignedSize(part.size);
+    }
+    cap = std::max<size_t>(cap, ChunkTarget::ALIGNED_SIZE);
+    auto mmap_flag = MAP_PRIVATE | MAP_ANON;
+    auto m = mmap(nullptr, cap, PROT_READ | PROT_WRITE, mmap_flag, -1, 0);
+    AssertInfo(m != MAP_FAILED,
+               "failed to map: {}, map_size={}",
+               strerror(errno),
+               cap);
+    auto data = static_cast<char*>(m);
+    auto guard = std::make_shared<ChunkMmapGuard>(data, cap, "");
+
+    std::vector<std::pair<FieldId, ChunkBuffer>> buffers;
+    buffers.reserve(parts->size());
+    size_t offset = 0;
+    for (const auto& part : *parts) {
+        int decompressed = 0;
+        if (part.size > 0) {
+            decompressed =
+                LZ4_decompress_safe(part.compressed.data(),
+                                    data + offset,
+                                    static_cast<int>(part.compressed.size()),
+                                    static_cast<int>(part.size));
+        }
+        AssertInfo(decompressed == static_cast<int>(part.size),
+                   "failed to decompress cell {} of {}: got {} bytes, "
+                   "expected {}",
+                   cid,
+                   key,
+                   decompressed,
+                   part.size);
+        ChunkBuffer buffer;
+        buffer.data = data + offset;
+        buffer.size = part.size;
+        buffer.row_nums = part.row_nums;
+        buffer.guard = guard;
+        buffers.emplace_back(part.field_id, std::move(buffer));
+        offset += AlignedSize(part.size);
+    }
+    return buffers;
+}
+
+void
+CompressedCellCache::Erase(const std::string& key) {
+    std::lock_guard lock(mutex_);
+    auto cids = cids_by_key_.extract(key);
+    if (cids.empty()) {
+        return;
+    }
+    for (auto cid : cids.mapped()) {
+        auto iter = entries_.find(CellKey{key, cid});
+        size_bytes_ -= iter->second.bytes;
+        lru_.erase(iter->second.lru_iter);
+        entries_.erase(iter);
+    }
+}
+
+}  // namespace milvus::segcore
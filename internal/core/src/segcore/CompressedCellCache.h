@@ -0,0 +1,130 @@
+// Copyright (C) 2019-2025 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License
+
+#pragma once
+
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "common/Chunk.h"
+#include "common/ChunkWriter.h"
+#include "common/Types.h"
+
+namespace milvus::segcore {
+
+// Compressed in-memory tier between the caching layer and disk/remote
+// storage. Translators keep an LZ4-compressed copy of a cell once it had to
+// be reloaded (i.e. it was evicted before), and serve later reloads of that
+// cell by decompressing it instead of reading it again. The tier has its own
+// byte budget, on top of the tiered storage memory watermarks, and drops the
+// least recently used cells beyond it. A budget of 0 disables it.
+class CompressedCellCache {
+ public:
+    // Cells that compress worse than this aren't worth keeping.
+    static constexpr size_t kMinCompressionRatio = 2;
+
+    static CompressedCellCache&
+    GetInstance();
+
+    // Key under which one translator instance keeps its cells. A reloaded
+    // segment or field builds a new translator with the same translator key
+    // while the old one is still alive, so every instance gets a key of its
+    // own and neither reads nor erases the cells of the other.
+    static std::string
+    InstanceKey(const std::string& translator_key);
+
+    // Sets the byte budget of the compressed copies; shrinking it drops
+    // cells right away.
+    void
+    Configure(int64_t capacity_bytes);
+
+    bool
+    enabled() const {
+        std::lock_guard lock(mutex_);
+        return capacity_ > 0;
+    }
+
+    // Keeps a compressed copy of the chunks making up cell cid of the
+    // translator key, if the cell compresses well enough and fits.
+    void
+    Put(const std::string& key,
+        int64_t cid,
+        const std::vector<std::pair<FieldId, const Chunk*>>& chunks);
+
+    // Decompresses cell cid of the translator key into a fresh memory
+    // region, one buffer per chunk passed to Put(), in the same order.
+    // Empty if the cell isn't cached.
+    std::vector<std::pair<FieldId, ChunkBuffer>>
+    Get(const std::string& key, int64_t cid);
+
+    // Drops all cells of the translator key.
+    void
+    Erase(const std::string& key);
+
+    // Compressed bytes currently held.
+    int64_t
+    size_bytes() const {
+        std::lock_guard lock(mutex_);
+        return size_bytes_;
+    }
+
+ private:
+    struct Part {
+        FieldId field_id;
+        size_t size;
+        size_t row_nums;
+        std::string compressed;
+    };
+
+    using CellKey = std::pair<std::string, int64_t>;
+
+    struct CellKeyHash {
+        size_t
+        operator()(const CellKey& key) const {
+            return std::hash<std::string>()(key.first) ^
+                   (std::hash<int64_t>()(key.second) * 0x9e3779b97f4a7c15ULL);
+        }
+    };
+
+    struct Entry {
+        std::shared_ptr<const std::vector<Part>> parts;
+        int64_t bytes;
+        std::list<CellKey>::iterator lru_iter;
+    };
+
+    using EntryMap = std::unordered_map<CellKey, Entry, CellKeyHash>;
+
+    // Called with mutex_ held.
+    void
+    EvictUntil(int64_t capacity_bytes);
+
+    // Drops the cell at iter. Called with mutex_ held.
+    void
+    EraseEntry(EntryMap::iterator iter);
+
+    mutable std::mutex mutex_;
+    int64_t capacity_{0};
+    int64_t size_bytes_{0};
+    // most recently used first
+    std::list<CellKey> lru_;
+    EntryMap entries_;
+    // cids of the cells in entries_, by translator key
+    std::unordered_map<std::string, std::unordered_set<int64_t>> cids_by_key_;
+};
+
+}  // namespace milvus::segcore
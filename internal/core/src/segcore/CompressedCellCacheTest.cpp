@@ -0,0 +1,238 @@
+// Copyright (C) 2019-2025 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License
+
+#include <arrow/api.h>
+#include <gtest/gtest.h>
+
+#include <optional>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "common/Chunk.h"
+#include "common/ChunkWriter.h"
+#include "common/FieldMeta.h"
+#include "segcore/CompressedCellCache.h"
+#include "segcore/storagev1translator/ChunkTranslator.h"
+#include "storage/Util.h"
+#include "test_utils/storage_test_utils.h"
+
+using namespace milvus;
+using namespace milvus::segcore;
+
+TEST(CompressedCellCache, RoundTripsCompressibleCells) {
+    auto& cache = CompressedCellCache::GetInstance();
+    cache.Configure(1 << 20);
+
+    arrow::Int64Builder int_builder;
+    arrow::StringBuilder str_builder;
+    for (int64_t i = 0; i < 10000; ++i) {
+        ASSERT_TRUE(int_builder.Append(i % 16).ok());
+        ASSERT_TRUE(str_builder.Append("str_" + std::to_string(i % 8)).ok());
+    }
+    FieldMeta int_meta(
+        FieldName("a"), FieldId(100), DataType::INT64, false, std::nullopt);
+    FieldMeta str_meta(
+        FieldName("b"), FieldId(101), DataType::VARCHAR, false, std::nullopt);
+    auto int_chunk =
+        create_chunk(int_meta, {int_builder.Finish().ValueOrDie()});
+    auto str_chunk =
+        create_chunk(str_meta, {str_builder.Finish().ValueOrDie()});
+
+    EXPECT_TRUE(cache.Get("seg_1_cg_0", 0).empty());
+    cache.Put("seg_1_cg_0",
+              0,
+              {{FieldId(100), int_chunk.get()},
+               {FieldId(101), str_chunk.get()}});
+    auto raw_bytes = int_chunk->Size() + str_chunk->Size();
+    EXPECT_GT(cache.size_bytes(), 0);
+    EXPECT_LT(cache.size_bytes(), static_cast<int64_t>(raw_bytes / 2));
+
+    auto buffers = cache.Get("seg_1_cg_0", 0);
+    ASSERT_EQ(buffers.size(), 2);
+    EXPECT_EQ(buffers[0].first, FieldId(100));
+    EXPECT_EQ(buffers[1].first, FieldId(101));
+    auto int_copy = make_chunk_from_buffer(int_meta, buffers[0].second);
+    auto str_copy = make_chunk_from_buffer(str_meta, buffers[1].second);
+    buffers.clear();
+    ASSERT_EQ(int_copy->RowNums(), 10000);
+    ASSERT_EQ(str_copy->RowNums(), 10000);
+    auto str_view = static_cast<StringChunk*>(str_copy.get());
+    for (int64_t i = 0; i < 10000; ++i) {
+        EXPECT_EQ(*reinterpret_cast<const int64_t*>(int_copy->ValueAt(i)),
+                  i % 16);
+        EXPECT_EQ((*str_view)[i], "str_" + std::to_string(i % 8));
+    }
+
+    cache.Erase("seg_1_cg_0");
+    EXPECT_TRUE(cache.Get("seg_1_cg_0", 0).empty());
+    EXPECT_EQ(cache.size_bytes(), 0);
+    cache.Configure(0);
+}
+
+TEST(CompressedCellCache, SkipsIncompressibleCellsAndEvicts) {
+    auto& cache = CompressedCellCache::GetInstance();
+    FieldMeta meta(
+        FieldName("a"), FieldId(100), DataType::INT64, false, std::nullopt);
+
+    std::mt19937_64 rng(42);
+    arrow::Int64Builder random_builder;
+    arrow::Int64Builder constant_builder;
+    for (int64_t i = 0; i < 10000; ++i) {
+        ASSERT_TRUE(random_builder.Append(rng()).ok());
+        ASSERT_TRUE(constant_builder.Append(7).ok());
+    }
+    auto random_chunk =
+        create_chunk(meta, {random_builder.Finish().ValueOrDie()});
+    auto constant_chunk =
+        create_chunk(meta, {constant_builder.Finish().ValueOrDie()});
+
+    // disabled by default
+    cache.Put("seg_2_f_100", 0, {{FieldId(100), constant_chunk.get()}});
+    EXPECT_TRUE(cache.Get("seg_2_f_100", 0).empty());
+
+    cache.Configure(1 << 20);
+    cache.Put("seg_2_f_100", 0, {{FieldId(100), random_chunk.get()}});
+    EXPECT_TRUE(cache.Get("seg_2_f_100", 0).empty());
+
+    cache.Put("seg_2_f_100", 1, {{FieldId(100), constant_chunk.get()}});
+    auto cell_bytes = cache.size_bytes();
+    ASSERT_GT(cell_bytes, 0);
+
+    // room for two cells: the least recently used one goes
+    cache.Configure(cell_bytes * 2);
+    cache.Put("seg_2_f_100", 2, {{FieldId(100), constant_chunk.get()}});
+    EXPECT_FALSE(cache.Get("seg_2_f_100", 1).empty());
+    cache.Put("seg_2_f_100", 3, {{FieldId(100), constant_chunk.get()}});
+    EXPECT_FALSE(cache.Get("seg_2_f_100", 1).empty());
+    EXPECT_TRUE(cache.Get("seg_2_f_100", 2).empty());
+    EXPECT_FALSE(cache.Get("seg_2_f_100", 3).empty());
+    EXPECT_EQ(cache.size_bytes(), cell_bytes * 2);
+
+    cache.Configure(0);
+    EXPECT_EQ(cache.size_bytes(), 0);
+    EXPECT_TRUE(cache.Get("seg_2_f_100", 1).empty());
+}
+
+TEST(CompressedCellCache, EraseDropsOnlyTheCellsOfTheKey) {
+    auto& cache = CompressedCellCache::GetInstance();
+    FieldMeta meta(
+        FieldName("a"), FieldId(100), DataType::INT64, false, std::nullopt);
+    arrow::Int64Builder builder;
+    for (int64_t i = 0; i < 10000; ++i) {
+        ASSERT_TRUE(builder.Append(i % 16).ok());
+    }
+    auto chunk = create_chunk(meta, {builder.Finish().ValueOrDie()});
+
+    cache.Configure(1 << 20);
+    cache.Put("seg_4_f_100", 0, {{FieldId(100), chunk.get()}});
+    auto cell_bytes = cache.size_bytes();
+    ASSERT_GT(cell_bytes, 0);
+
+    // room for three cells: cell 0 of seg_4 is evicted before the erase
+    cache.Configure(cell_bytes * 3);
+    cache.Put("seg_5_f_100", 0, {{FieldId(100), chunk.get()}});
+    cache.Put("seg_4_f_100", 1, {{FieldId(100), chunk.get()}});
+    cache.Put("seg_5_f_100", 1, {{FieldId(100), chunk.get()}});
+    EXPECT_TRUE(cache.Get("seg_4_f_100", 0).empty());
+    EXPECT_EQ(cache.size_bytes(), cell_bytes * 3);
+
+    cache.Erase("seg_4_f_100");
+    EXPECT_TRUE(cache.Get("seg_4_f_100", 1).empty());
+    EXPECT_FALSE(cache.Get("seg_5_f_100", 0).empty());
+    EXPECT_FALSE(cache.Get("seg_5_f_100", 1).empty());
+    EXPECT_EQ(cache.size_bytes(), cell_bytes * 2);
+
+    // erasing an unknown or already erased key is a no-op
+    cache.Erase("seg_4_f_100");
+    cache.Erase("seg_6_f_100");
+    EXPECT_EQ(cache.size_bytes(), cell_bytes * 2);
+
+    cache.Put("seg_4_f_100", 0, {{FieldId(100), chunk.get()}});
+    EXPECT_FALSE(cache.Get("seg_4_f_100", 0).empty());
+    cache.Configure(0);
+    EXPECT_EQ(cache.size_bytes(), 0);
+}
+
+TEST(CompressedCellCache, ReplacedTranslatorKeepsItsOwnCells) {
+    auto& cache = CompressedCellCache::GetInstance();
+    cache.Configure(1 << 20);
+
+    constexpr int64_t kRows = 10000;
+    FieldMeta meta(
+        FieldName("a"), FieldId(100), DataType::INT64, false, std::nullopt);
+    auto cm = storage::RemoteChunkManagerSingleton::GetInstance()
+                  .GetRemoteChunkManager();
+    // the same field of the same segment, as loaded before and after a
+    // reload, with different contents
+    auto make_translator = [&](int64_t partition_id, int64_t base) {
+        std::vector<int64_t> values(kRows);
+        for (int64_t i = 0; i < kRows; ++i) {
+            values[i] = base + i % 16;
+        }
+        auto field_data =
+            storage::CreateFieldData(DataType::INT64, DataType::NONE);
+        field_data->FillFieldData(values.data(), kRows);
+        auto load_info = PrepareSingleFieldInsertBinlog(
+            kCollectionID, partition_id, 3, 100, {field_data}, cm);
+        const auto& info = load_info.field_infos.at(100);
+        std::vector<storagev1translator::ChunkTranslator::FileInfo>
+            file_infos;
+        for (size_t i = 0; i < info.insert_files.size(); ++i) {
+            file_infos.push_back({info.insert_files[i],
+                                  info.entries_nums[i],
+                                  info.memory_sizes[i]});
+        }
+        return std::make_unique<storagev1translator::ChunkTranslator>(
+            3,
+            meta,
+            FieldDataInfo(100, kRows),
+            std::move(file_infos),
+            false,
+            false,
+            proto::common::LoadPriority::HIGH,
+            "");
+    };
+    auto expect_cell = [&](storagev1translator::ChunkTranslator& translator,
+                           int64_t base) {
+        auto cells = translator.get_cells(nullptr, {0});
+        ASSERT_EQ(cells.size(), 1);
+        ASSERT_EQ(cells[0].second->RowNums(), kRows);
+        for (int64_t i = 0; i < kRows; ++i) {
+            ASSERT_EQ(*reinterpret_cast<const int64_t*>(
+                          cells[0].second->ValueAt(i)),
+                      base + i % 16);
+        }
+    };
+
+    auto old_translator = make_translator(kPartitionID, 0);
+    expect_cell(*old_translator, 0);
+    // the reload keeps a compressed copy
+    expect_cell(*old_translator, 0);
+    auto cell_bytes = cache.size_bytes();
+    ASSERT_GT(cell_bytes, 0);
+
+    auto new_translator = make_translator(kPartitionID + 1, 1000);
+    ASSERT_EQ(new_translator->key(), old_translator->key());
+    // neither the first load nor the reload sees the old copy
+    expect_cell(*new_translator, 1000);
+    expect_cell(*new_translator, 1000);
+    EXPECT_EQ(cache.size_bytes(), cell_bytes * 2);
+
+    // dropping the old translator leaves the copy of the new one
+    old_translator.reset();
+    EXPECT_EQ(cache.size_bytes(), cell_bytes);
+    expect_cell(*new_translator, 1000);
+
+    new_translator.reset();
+    EXPECT_EQ(cache.size_bytes(), 0);
+    cache.Configure(0);
+}
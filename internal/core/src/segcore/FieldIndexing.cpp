@@ -158,6 +158,20 @@ IndexingRecord::AppendingIndex(int64_t reserved_offset,
     }
 }
 
+void
+IndexingRecord::AppendingIndexFromRaw(FieldId fieldId,
+                                      int64_t end,
+                                      const InsertRecord<false>& record) {
+    AssertInfo(is_async(fieldId),
+               "field {} is indexed on the insert path",
+               fieldId.get());
+    auto& indexing = field_indexings_.at(fieldId);
+    auto vec_indexing = dynamic_cast<VectorFieldIndexing*>(indexing.get());
+    AssertInfo(vec_indexing != nullptr, "invalid indexing");
+    vec_indexing->AppendSegmentIndexFromRaw(end,
+                                            record.get_data_base(fieldId));
+}
+
 VectorFieldIndexing::VectorFieldIndexing(const FieldMeta& field_meta,
                                          const FieldIndexMeta& field_index_meta,
                                          int64_t segment_max_row_count,
@@ -537,6 +551,63 @@ VectorFieldIndexing::AppendSegmentIndexDense(int64_t reserved_offset,
     }
 }
 
+void
+VectorFieldIndexing::AppendSegmentIndexFromRaw(
+    int64_t end, const VectorBase* field_raw_data) {
+    using sparse_row = knowhere::sparse::SparseRow<SparseValueType>;
+    AssertInfo(!field_raw_data->is_mapping_storage(),
+               "nullable vector field must be indexed on the insert path");
+    if (end < get_build_threshold()) {
+        return;
+    }
+    auto data_type = get_data_type();
+    size_t vec_length = 0;
+    if (data_type == DataType::VECTOR_FLOAT) {
+        vec_length = get_dim() * sizeof(float);
+    } else if (data_type == DataType::VECTOR_FLOAT16) {
+        vec_length = get_dim() * sizeof(float16);
+    } else if (data_type == DataType::VECTOR_BFLOAT16) {
+        vec_length = get_dim() * sizeof(bfloat16);
+    }
+    auto size_per_chunk = field_raw_data->get_size_per_chunk();
+
+    // Rows of a chunk are contiguous, so the index is fed one chunk slice at
+    // a time without copying. The first slice also builds the index, which
+    // reads the build_threshold rows from the raw chunks by itself.
+    int64_t begin = get_indexed_count();
+    while (begin < end) {
+        auto chunk_id = begin / size_per_chunk;
+        auto chunk_begin = chunk_id * size_per_chunk;
+        auto count = std::min(end, chunk_begin + size_per_chunk) - begin;
+        auto chunk_data = static_cast<const char*>(
+            field_raw_data->get_chunk_data(chunk_id));
+        if (IsSparseFloatVectorDataType(data_type)) {
+            auto rows = reinterpret_cast<const sparse_row*>(chunk_data) +
+                        (begin - chunk_begin);
+            int64_t dim = 0;
+            for (int64_t i = 0; i < count; ++i) {
+                dim = std::max<int64_t>(dim, rows[i].dim());
+            }
+            AppendSegmentIndexSparse(begin, count, dim, field_raw_data, rows);
+        } else {
+            AppendSegmentIndexDense(
+                begin,
+                count,
+                field_raw_data,
+                chunk_data + (begin - chunk_begin) * vec_length);
+        }
+        auto indexed = get_indexed_count();
+        if (indexed < begin + count) {
+            // The build or add failed and left an empty index behind. Raw
+            // chunks of async fields are kept, so rebuild on the next call.
+            built_ = false;
+            index_cur_ = 0;
+            return;
+        }
+        begin = indexed;
+    }
+}
+
 knowhere::Json
 VectorFieldIndexing::get_build_params(DataType data_type) const {
     auto config = config_->GetBuildBaseParams(data_type);
@@ -18,6 +18,7 @@
 #include <cstdint>
 #include <map>
 #include <memory>
+#include <set>
 #include <string>
 #include <type_traits>
 #include <unordered_map>
@@ -340,6 +341,19 @@ class VectorFieldIndexing : public FieldIndexing {
     bool
     has_raw_data() const override;
 
+    // Indexes rows [get_indexed_count(), end), reading them from the raw
+    // chunks of field_raw_data instead of an insert request. Used by the
+    // background index maintenance of growing segments, which must be the
+    // only writer of the index. Non-nullable fields only.
+    void
+    AppendSegmentIndexFromRaw(int64_t end, const VectorBase* field_raw_data);
+
+    // rows [0, count) are searchable through the index
+    int64_t
+    get_indexed_count() const {
+        return built_.load() ? index_cur_.load() : 0;
+    }
+
     knowhere::Json
     get_build_params(DataType data_type) const;
 
@@ -413,6 +427,10 @@ class IndexingRecord {
                                         index_meta_->GetIndexMaxRowCount(),
                                         segcore_config_,
                                         field_raw_data));
+                        if (segcore_config_.get_enable_async_interim_index() &&
+                            !field_meta.is_nullable()) {
+                            async_fields_.insert(field_id);
+                        }
                     }
                 }
             } else if (field_meta.get_data_type() == DataType::GEOMETRY) {
@@ -478,10 +496,36 @@ class IndexingRecord {
         }
     }
 
-    // result shows the index has synchronized with all inserted data or not
+    // Catches the index of an async field up with rows [0, end) of record.
+    void
+    AppendingIndexFromRaw(FieldId fieldId,
+                          int64_t end,
+                          const InsertRecord<false>& record);
+
+    // Fields whose index is maintained in the background rather than on the
+    // insert path; their index may lag behind the inserted rows, see
+    // get_indexed_count.
+    bool
+    is_async(FieldId fieldId) const {
+        return async_fields_.count(fieldId) > 0;
+    }
+
+    const std::set<FieldId>&
+    get_async_fields() const {
+        return async_fields_;
+    }
+
+    // rows [0, count) of an async field are searchable through its index
+    int64_t
+    get_indexed_count(FieldId fieldId) const {
+        return get_vec_field_indexing(fieldId).get_indexed_count();
+    }
+
+    // result shows the index has synchronized with all inserted data or not,
+    // never guaranteed for async fields.
     bool
     SyncDataWithIndex(FieldId fieldId) const {
-        if (is_in(fieldId)) {
+        if (is_in(fieldId) && !is_async(fieldId)) {
             const FieldIndexing& indexing = get_field_indexing(fieldId);
             return indexing.sync_data_with_index();
         }
@@ -548,6 +592,9 @@ class IndexingRecord {
 
     // field_offset => indexing
     std::map<FieldId, std::unique_ptr<FieldIndexing>> field_indexings_;
+
+    // vector fields indexed off the insert path
+    std::set<FieldId> async_fields_;
 };
 
 }  // namespace milvus::segcore
@@ -264,6 +264,13 @@ class OffsetMap {
     virtual void
     seal() = 0;
 
+    // Seals a map whose entries were inserted as consecutive runs of the
+    // given sizes, each of them already in pk order.
+    virtual void
+    seal_sorted_runs(const std::vector<int64_t>& run_sizes) {
+        seal();
+    }
+
     virtual bool
     empty() const = 0;
 
@@ -688,6 +695,33 @@ class OffsetOrderedArray : public OffsetMap {
         is_sealed = true;
     }
 
+    void
+    seal_sorted_runs(const std::vector<int64_t>& run_sizes) override {
+        std::vector<size_t> bounds{0};
+        for (auto run_size : run_sizes) {
+            bounds.push_back(bounds.back() + run_size);
+        }
+        AssertInfo(bounds.back() == array_.size(),
+                   "sorted runs cover {} of {} pks",
+                   bounds.back(),
+                   array_.size());
+        // merge neighbouring runs pairwise until one is left
+        while (bounds.size() > 2) {
+            std::vector<size_t> merged{0};
+            for (size_t i = 2; i < bounds.size(); i += 2) {
+                std::inplace_merge(array_.begin() + bounds[i - 2],
+                                   array_.begin() + bounds[i - 1],
+                                   array_.begin() + bounds[i]);
+                merged.push_back(bounds[i]);
+            }
+            if (bounds.size() % 2 == 0) {
+                merged.push_back(bounds.back());
+            }
+            bounds = std::move(merged);
+        }
+        is_sealed = true;
+    }
+
     bool
     empty() const override {
         return array_.empty();
@@ -11,8 +11,10 @@
 
 #include <gtest/gtest.h>
 #include <stdint.h>
+#include <algorithm>
 #include <random>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "common/Types.h"
@@ -391,11 +393,49 @@ TYPED_TEST_P(TypedOffsetOrderedArrayTest,
     ASSERT_TRUE(limited_has_more);
 }
 
+TYPED_TEST_P(TypedOffsetOrderedArrayTest, seal_sorted_runs) {
+    // runs of pks, each sorted, of uneven sizes and with duplicates
+    std::vector<int64_t> run_sizes{3, 1, 4, 2, 5};
+    auto data = this->random_generate(15);
+    data[7] = data[2];
+    data[13] = data[2];
+    std::vector<std::pair<TypeParam, int64_t>> runs;
+    int64_t begin = 0;
+    for (auto run_size : run_sizes) {
+        std::vector<std::pair<TypeParam, int64_t>> run;
+        for (int64_t offset = begin; offset < begin + run_size; ++offset) {
+            run.emplace_back(data[offset], offset);
+        }
+        std::sort(run.begin(), run.end());
+        runs.insert(runs.end(), run.begin(), run.end());
+        begin += run_size;
+    }
+
+    OffsetOrderedArray<TypeParam> merged;
+    for (const auto& [pk, offset] : runs) {
+        merged.insert(pk, offset);
+    }
+    merged.seal_sorted_runs(run_sizes);
+    for (const auto& [pk, offset] : runs) {
+        this->map_.insert(pk, offset);
+    }
+    this->seal();
+
+    BitsetType all(data.size());
+    BitsetTypeView all_view(all.data(), data.size());
+    auto [offsets, has_more] = merged.find_first_n(Unlimited, all_view);
+    EXPECT_EQ(offsets, this->map_.find_first_n(Unlimited, all_view).first);
+    EXPECT_FALSE(has_more);
+    EXPECT_TRUE(merged.contain(data[2]));
+    EXPECT_EQ(merged.find(data[2]).size(), 3);
+}
+
 REGISTER_TYPED_TEST_SUITE_P(TypedOffsetOrderedArrayTest,
                             find_first_n,
                             find_first_n_element,
                             find_first_n_element_has_more,
-                            find_first_n_element_with_iterator_cursor);
+                            find_first_n_element_with_iterator_cursor,
+                            seal_sorted_runs);
 INSTANTIATE_TYPED_TEST_SUITE_P(Prefix, TypedOffsetOrderedArrayTest, TypeOfPks);
 
 // =====================================================================
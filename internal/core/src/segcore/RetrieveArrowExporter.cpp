@@ -0,0 +1,535 @@
+// Copyright (C) 2019-2026 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License
+
+#include "segcore/RetrieveArrowExporter.h"
+
+#include <arrow/util/bit_util.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "cachinglayer/Utils.h"
+#include "common/EasyAssert.h"
+#include "common/Json.h"
+#include "common/Span.h"
+#include "common/SystemProperty.h"
+#include "segcore/ArrowExportUtils.h"
+#include "segcore/SegmentInterface.h"
+
+namespace milvus::segcore {
+
+namespace {
+
+// Arrow buffer over a slice of a pinned chunk. Holding the pin keeps the
+// chunk resident until the last array using the buffer is released.
+template <typename T>
+class PinnedChunkBuffer : public arrow::Buffer {
+ public:
+    PinnedChunkBuffer(PinWrapper<Span<T>> pin, int64_t offset, int64_t length)
+        : arrow::Buffer(
+              reinterpret_cast<const uint8_t*>(pin.get().data() + offset),
+              length * static_cast<int64_t>(sizeof(T))),
+          pin_(std::move(pin)) {
+    }
+
+ private:
+    PinWrapper<Span<T>> pin_;
+};
+
+// Arrow buffer over a slice of the retrieved offsets, shared by the
+// $seg_offset columns of all batches.
+class OffsetsBuffer : public arrow::Buffer {
+ public:
+    OffsetsBuffer(std::shared_ptr<std::vector<int64_t>> offsets,
+                  int64_t begin,
+                  int64_t count)
+        : arrow::Buffer(
+              reinterpret_cast<const uint8_t*>(offsets->data() + begin),
+              count * static_cast<int64_t>(sizeof(int64_t))),
+          offsets_(std::move(offsets)) {
+    }
+
+ private:
+    std::shared_ptr<std::vector<int64_t>> offsets_;
+};
+
+std::shared_ptr<arrow::DataType>
+ArrowTypeOf(DataType data_type) {
+    switch (data_type) {
+        case DataType::BOOL:
+            return arrow::boolean();
+        case DataType::INT8:
+            return arrow::int8();
+        case DataType::INT16:
+            return arrow::int16();
+        case DataType::INT32:
+            return arrow::int32();
+        case DataType::INT64:
+        case DataType::TIMESTAMPTZ:
+            return arrow::int64();
+        case DataType::FLOAT:
+            return arrow::float32();
+        case DataType::DOUBLE:
+            return arrow::float64();
+        case DataType::STRING:
+        case DataType::VARCHAR:
+            return arrow::utf8();
+        case DataType::JSON:
+            return arrow::binary();
+        default:
+            ThrowInfo(ErrorCode::Unsupported,
+                      "data type {} can not be exported as arrow column",
+                      data_type);
+    }
+}
+
+std::string
+SystemColumnName(SystemFieldType system_type) {
+    switch (system_type) {
+        case SystemFieldType::RowId:
+            return "$row_id";
+        case SystemFieldType::Timestamp:
+            return "$timestamp";
+        default:
+            ThrowInfo(ErrorCode::Unsupported,
+                      "system field {} can not be exported as arrow column",
+                      system_type);
+    }
+}
+
+// Validity bitmap for `valid`, or null when no row is null.
+arrow::Result<std::shared_ptr<arrow::Buffer>>
+ValidityBuffer(const TargetBitmap& valid, int64_t* null_count) {
+    *null_count = valid.size() - valid.count();
+    if (*null_count == 0) {
+        return nullptr;
+    }
+    ARROW_ASSIGN_OR_RAISE(auto bitmap, arrow::AllocateBitmap(valid.size()));
+    auto* bits = bitmap->mutable_data();
+    for (size_t i = 0; i < valid.size(); ++i) {
+        arrow::bit_util::SetBitTo(bits, i, valid[i]);
+    }
+    return bitmap;
+}
+
+template <typename T>
+arrow::Result<std::shared_ptr<arrow::Array>>
+FixedWidthColumn(const SegmentInternalInterface& segment,
+                 milvus::OpContext* op_ctx,
+                 const FieldMeta& field_meta,
+                 const int64_t* offsets,
+                 int64_t count,
+                 bool contiguous,
+                 int64_t* zero_copy_arrays) {
+    auto field_id = field_meta.get_id();
+    TargetBitmap valid(count);
+    std::shared_ptr<arrow::Buffer> values;
+    if (contiguous) {
+        valid.set();
+        if (field_meta.is_nullable()) {
+            segment.ApplyFieldValidDataByOffsets(
+                op_ctx, field_id, offsets, count, TargetBitmapView(valid));
+        }
+        auto [chunk_id, offset_in_chunk] =
+            segment.get_chunk_by_offset(field_id, offsets[0]);
+        auto pin = segment.chunk_data<T>(op_ctx, field_id, chunk_id);
+        AssertInfo(offset_in_chunk + count <= pin.get().row_count(),
+                   "rows [{}, {}) exceed chunk {} of field {}",
+                   offset_in_chunk,
+                   offset_in_chunk + count,
+                   chunk_id,
+                   field_id.get());
+        const auto* begin = pin.get().data() + offset_in_chunk;
+        if (reinterpret_cast<uintptr_t>(begin) % alignof(T) == 0) {
+            values = std::make_shared<PinnedChunkBuffer<T>>(
+                std::move(pin), offset_in_chunk, count);
+            ++*zero_copy_arrays;
+        } else {
+            // consumers may read the values as T, keep them aligned
+            ARROW_ASSIGN_OR_RAISE(auto buffer,
+                                  arrow::AllocateBuffer(count * sizeof(T)));
+            std::memcpy(buffer->mutable_data(), begin, count * sizeof(T));
+            values = std::move(buffer);
+        }
+    } else {
+        ARROW_ASSIGN_OR_RAISE(auto buffer,
+                              arrow::AllocateBuffer(count * sizeof(T)));
+        segment.bulk_subscript(op_ctx,
+                               field_id,
+                               field_meta.get_data_type(),
+                               offsets,
+                               count,
+                               buffer->mutable_data(),
+                               valid,
+                               /*small_int_raw_type=*/true);
+        values = std::move(buffer);
+    }
+    int64_t null_count = 0;
+    ARROW_ASSIGN_OR_RAISE(auto validity, ValidityBuffer(valid, &null_count));
+    return arrow::MakeArray(
+        arrow::ArrayData::Make(ArrowTypeOf(field_meta.get_data_type()),
+                               count,
+                               {std::move(validity), std::move(values)},
+                               null_count));
+}
+
+arrow::Result<std::shared_ptr<arrow::Array>>
+BoolColumn(const SegmentInternalInterface& segment,
+           milvus::OpContext* op_ctx,
+           const FieldMeta& field_meta,
+           const int64_t* offsets,
+           int64_t count) {
+    FixedVector<bool> values(count);
+    TargetBitmap valid(count);
+    segment.bulk_subscript(op_ctx,
+                           field_meta.get_id(),
+                           DataType::BOOL,
+                           offsets,
+                           count,
+                           values.data(),
+                           valid);
+    arrow::BooleanBuilder builder;
+    ARROW_RETURN_NOT_OK(builder.Reserve(count));
+    for (int64_t i = 0; i < count; ++i) {
+        if (valid[i]) {
+            builder.UnsafeAppend(values[i]);
+        } else {
+            builder.UnsafeAppendNull();
+        }
+    }
+    std::shared_ptr<arrow::Array> array;
+    ARROW_RETURN_NOT_OK(builder.Finish(&array));
+    return array;
+}
+
+// Strings and JSON are copied once, straight from the chunk into the arrow
+// value buffer when the rows are contiguous in a sealed chunk.
+template <typename Builder>
+arrow::Result<std::shared_ptr<arrow::Array>>
+StringColumn(const SegmentInternalInterface& segment,
+             milvus::OpContext* op_ctx,
+             const FieldMeta& field_meta,
+             const int64_t* offsets,
+             int64_t count,
+             bool contiguous) {
+    auto field_id = field_meta.get_id();
+    auto data_type = field_meta.get_data_type();
+    Builder builder;
+    ARROW_RETURN_NOT_OK(builder.Reserve(count));
+
+    if (contiguous && segment.type() != SegmentType::Growing) {
+        auto [chunk_id, offset_in_chunk] =
+            segment.get_chunk_by_offset(field_id, offsets[0]);
+        auto pin = segment.chunk_view<std::string_view>(
+            op_ctx, field_id, chunk_id, std::make_pair(offset_in_chunk, count));
+        const auto& [views, valid] = pin.get();
+        const bool nullable = field_meta.is_nullable() && !valid.empty();
+        int64_t total_size = 0;
+        for (const auto& view : views) {
+            total_size += view.size();
+        }
+        ARROW_RETURN_NOT_OK(builder.ReserveData(total_size));
+        for (int64_t i = 0; i < count; ++i) {
+            if (nullable && !valid[i]) {
+                ARROW_RETURN_NOT_OK(builder.AppendNull());
+            } else {
+                ARROW_RETURN_NOT_OK(builder.Append(views[i]));
+            }
+        }
+    } else {
+        TargetBitmap valid(count);
+        auto append = [&](std::string_view value,
+                          int64_t i) -> arrow::Status {
+            if (!valid[i]) {
+                return builder.AppendNull();
+            }
+            return builder.Append(value);
+        };
+        if (data_type == DataType::JSON) {
+            std::vector<Json> values(count);
+            segment.bulk_subscript(op_ctx,
+                                   field_id,
+                                   data_type,
+                                   offsets,
+                                   count,
+                                   values.data(),
+                                   valid);
+            for (int64_t i = 0; i < count; ++i) {
+                ARROW_RETURN_NOT_OK(append(values[i].data(), i));
+            }
+        } else {
+            std::vector<std::string> values(count);
+            segment.bulk_subscript(op_ctx,
+                                   field_id,
+                                   data_type,
+                                   offsets,
+                                   count,
+                                   values.data(),
+                                   valid);
+            for (int64_t i = 0; i < count; ++i) {
+                ARROW_RETURN_NOT_OK(append(values[i], i));
+            }
+        }
+    }
+    std::shared_ptr<arrow::Array> array;
+    ARROW_RETURN_NOT_OK(builder.Finish(&array));
+    return array;
+}
+
+}  // namespace
+
+RetrieveArrowExporter::RetrieveArrowExporter(
+    const SegmentInternalInterface& segment,
+    SchemaPtr schema,
+    std::vector<FieldId> field_ids,
+    milvus::OpContext* op_ctx,
+    int64_t max_batch_rows)
+    : segment_(segment),
+      schema_(std::move(schema)),
+      field_ids_(std::move(field_ids)),
+      op_ctx_(op_ctx),
+      max_batch_rows_(std::max<int64_t>(max_batch_rows, 1)) {
+    arrow::FieldVector fields;
+    fields.reserve(field_ids_.size() + 1);
+    for (auto field_id : field_ids_) {
+        if (SystemProperty::Instance().IsSystem(field_id)) {
+            auto system_type =
+                SystemProperty::Instance().GetSystemFieldType(field_id);
+            fields.push_back(MilvusField(SystemColumnName(system_type),
+                                         arrow::int64(),
+                                         false,
+                                         field_id,
+                                         DataType::INT64));
+            continue;
+        }
+        auto& field_meta = schema_->operator[](field_id);
+        auto data_type = field_meta.get_data_type();
+        AssertInfo(IsSupported(data_type),
+                   "field {} of type {} can not be exported as arrow column",
+                   field_id.get(),
+                   data_type);
+        AssertInfo(segment_.is_field_exist(field_id) &&
+                       segment_.HasRawData(field_id.get()),
+                   "field {} has no raw data in segment {}",
+                   field_id.get(),
+                   segment_.get_segment_id());
+        fields.push_back(MilvusField(field_meta.get_name().get(),
+                                     ArrowTypeOf(data_type),
+                                     field_meta.is_nullable(),
+                                     field_id,
+                                     data_type));
+    }
+    fields.push_back(arrow::field(kSegmentOffsetColumn, arrow::int64()));
+    arrow_schema_ = arrow::schema(std::move(fields));
+}
+
+bool
+RetrieveArrowExporter::IsSupported(DataType data_type) {
+    switch (data_type) {
+        case DataType::BOOL:
+        case DataType::INT8:
+        case DataType::INT16:
+        case DataType::INT32:
+        case DataType::INT64:
+        case DataType::TIMESTAMPTZ:
+        case DataType::FLOAT:
+        case DataType::DOUBLE:
+        case DataType::STRING:
+        case DataType::VARCHAR:
+        case DataType::JSON:
+            return true;
+        default:
+            return false;
+    }
+}
+
+int64_t
+RetrieveArrowExporter::ConsecutiveRows(const int64_t* offsets,
+                                       int64_t begin,
+                                       int64_t end) const {
+    int64_t rows = 1;
+    while (begin + rows < end &&
+           offsets[begin + rows] == offsets[begin + rows - 1] + 1) {
+        ++rows;
+    }
+    if (rows < kMinZeroCopyRows) {
+        return rows;
+    }
+    for (auto field_id : field_ids_) {
+        if (SystemProperty::Instance().IsSystem(field_id)) {
+            continue;
+        }
+        auto [chunk_id, offset_in_chunk] =
+            segment_.get_chunk_by_offset(field_id, offsets[begin]);
+        rows = std::min(rows,
+                        segment_.chunk_size(field_id, chunk_id) -
+                            offset_in_chunk);
+    }
+    return rows;
+}
+
+std::vector<std::shared_ptr<arrow::RecordBatch>>
+RetrieveArrowExporter::Export(std::vector<int64_t> offsets) {
+    std::vector<std::shared_ptr<arrow::RecordBatch>> batches;
+    // the $seg_offset columns slice this vector without copying
+    auto shared_offsets =
+        std::make_shared<std::vector<int64_t>>(std::move(offsets));
+    const auto* data = shared_offsets->data();
+    const auto total = static_cast<int64_t>(shared_offsets->size());
+
+    auto emit = [&](int64_t begin, int64_t count, bool contiguous) {
+        auto batch = MakeBatch(shared_offsets, begin, count, contiguous);
+        if (!batch.ok()) {
+            ThrowInfo(ErrorCode::UnexpectedError,
+                      "failed to export retrieve result of segment {}: {}",
+                      segment_.get_segment_id(),
+                      batch.status().ToString());
+        }
+        batches.push_back(std::move(batch).ValueUnsafe());
+    };
+
+    int64_t begin = 0;
+    while (begin < total) {
+        auto end = std::min(total, begin + max_batch_rows_);
+        auto run = ConsecutiveRows(data, begin, end);
+        if (run >= kMinZeroCopyRows) {
+            emit(begin, run, true);
+            begin += run;
+            continue;
+        }
+        // Gather scattered rows, stopping where the next long run starts so
+        // it can still be exported in place.
+        auto cursor = begin + run;
+        while (cursor < end) {
+            auto next = ConsecutiveRows(data, cursor, end);
+            if (next >= kMinZeroCopyRows) {
+                break;
+            }
+            cursor += next;
+        }
+        emit(begin, cursor - begin, false);
+        begin = cursor;
+    }
+    return batches;
+}
+
+arrow::Result<std::shared_ptr<arrow::RecordBatch>>
+RetrieveArrowExporter::MakeBatch(
+    const std::shared_ptr<std::vector<int64_t>>& offsets,
+    int64_t begin,
+    int64_t count,
+    bool contiguous) {
+    const auto* batch_offsets = offsets->data() + begin;
+    arrow::ArrayVector columns;
+    columns.reserve(field_ids_.size() + 1);
+    for (auto field_id : field_ids_) {
+        if (SystemProperty::Instance().IsSystem(field_id)) {
+            ARROW_ASSIGN_OR_RAISE(
+                auto buffer, arrow::AllocateBuffer(count * sizeof(int64_t)));
+            segment_.bulk_subscript(
+                op_ctx_,
+                SystemProperty::Instance().GetSystemFieldType(field_id),
+                batch_offsets,
+                count,
+                buffer->mutable_data());
+            columns.push_back(std::make_shared<arrow::Int64Array>(
+                count, std::shared_ptr<arrow::Buffer>(std::move(buffer))));
+            continue;
+        }
+        ARROW_ASSIGN_OR_RAISE(auto column,
+                              MakeColumn(schema_->operator[](field_id),
+                                         batch_offsets,
+                                         count,
+                                         contiguous));
+        columns.push_back(std::move(column));
+    }
+    columns.push_back(std::make_shared<arrow::Int64Array>(
+        count, std::make_shared<OffsetsBuffer>(offsets, begin, count)));
+    return arrow::RecordBatch::Make(arrow_schema_, count, std::move(columns));
+}
+
+arrow::Result<std::shared_ptr<arrow::Array>>
+RetrieveArrowExporter::MakeColumn(const FieldMeta& field_meta,
+                                  const int64_t* offsets,
+                                  int64_t count,
+                                  bool contiguous) {
+    switch (field_meta.get_data_type()) {
+        case DataType::BOOL:
+            return BoolColumn(segment_, op_ctx_, field_meta, offsets, count);
+        case DataType::INT8:
+            return FixedWidthColumn<int8_t>(segment_,
+                                            op_ctx_,
+                                            field_meta,
+                                            offsets,
+                                            count,
+                                            contiguous,
+                                            &zero_copy_arrays_);
+        case DataType::INT16:
+            return FixedWidthColumn<int16_t>(segment_,
+                                             op_ctx_,
+                                             field_meta,
+                                             offsets,
+                                             count,
+                                             contiguous,
+                                             &zero_copy_arrays_);
+        case DataType::INT32:
+            return FixedWidthColumn<int32_t>(segment_,
+                                             op_ctx_,
+                                             field_meta,
+                                             offsets,
+                                             count,
+                                             contiguous,
+                                             &zero_copy_arrays_);
+        case DataType::INT64:
+        case DataType::TIMESTAMPTZ:
+            return FixedWidthColumn<int64_t>(segment_,
+                                             op_ctx_,
+                                             field_meta,
+                                             offsets,
+                                             count,
+                                             contiguous,
+                                             &zero_copy_arrays_);
+        case DataType::FLOAT:
+            return FixedWidthColumn<float>(segment_,
+                                           op_ctx_,
+                                           field_meta,
+                                           offsets,
+                                           count,
+                                           contiguous,
+                                           &zero_copy_arrays_);
+        case DataType::DOUBLE:
+            return FixedWidthColumn<double>(segment_,
+                                            op_ctx_,
+                                            field_meta,
+                                            offsets,
+                                            count,
+                                            contiguous,
+                                            &zero_copy_arrays_);
+        case DataType::STRING:
+        case DataType::VARCHAR:
+            return StringColumn<arrow::StringBuilder>(
+                segment_, op_ctx_, field_meta, offsets, count, contiguous);
+        case DataType::JSON:
+            return StringColumn<arrow::BinaryBuilder>(
+                segment_, op_ctx_, field_meta, offsets, count, contiguous);
+        default:
+            return arrow::Status::NotImplemented(
+                "arrow export of data type ",
+                GetDataTypeName(field_meta.get_data_type()));
+    }
+}
+
+}  // namespace milvus::segcore
@@ -0,0 +1,104 @@
+// Copyright (C) 2019-2026 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include <arrow/api.h>
+
+#include "common/OpContext.h"
+#include "common/Schema.h"
+#include "common/Types.h"
+
+namespace milvus::segcore {
+
+class SegmentInternalInterface;
+
+// Builds Arrow record batches for the rows a retrieve selected, reading
+// the segment's chunk memory directly instead of going through DataArray
+// protos.
+//
+// Rows are cut into batches of at most max_batch_rows. A run of at least
+// kMinZeroCopyRows consecutive offsets is clipped to the chunk boundaries
+// of every output field and exported as its own batch: fixed-width columns
+// of such a batch slice the pinned chunk without copying, and the pin is
+// released when the last Arrow array referencing it is released. Scattered
+// offsets, bools, strings and system fields are gathered into fresh
+// buffers with the segment's bulk_subscript.
+//
+// Only scalar fields with raw data in the segment are supported, see
+// IsSupported(). The exported arrays may point into the segment, so the
+// segment must outlive them.
+class RetrieveArrowExporter {
+ public:
+    static constexpr int64_t kDefaultBatchRows = 64 * 1024;
+    static constexpr int64_t kMinZeroCopyRows = 1024;
+    // int64 column carrying the segment offset of every row
+    static constexpr const char* kSegmentOffsetColumn = "$seg_offset";
+
+    RetrieveArrowExporter(const SegmentInternalInterface& segment,
+                          SchemaPtr schema,
+                          std::vector<FieldId> field_ids,
+                          milvus::OpContext* op_ctx,
+                          int64_t max_batch_rows = kDefaultBatchRows);
+
+    // Whether fields of this type can be exported from chunk memory.
+    static bool
+    IsSupported(DataType data_type);
+
+    const std::shared_ptr<arrow::Schema>&
+    schema() const {
+        return arrow_schema_;
+    }
+
+    // Export the rows at `offsets`, in order. Returns an empty vector when
+    // there are no rows.
+    std::vector<std::shared_ptr<arrow::RecordBatch>>
+    Export(std::vector<int64_t> offsets);
+
+    // Number of column arrays exported without copying the values.
+    int64_t
+    zero_copy_arrays() const {
+        return zero_copy_arrays_;
+    }
+
+ private:
+    // Length of the prefix of offsets[begin, end) that is consecutive and
+    // stays within one chunk of every chunked output field.
+    int64_t
+    ConsecutiveRows(const int64_t* offsets, int64_t begin, int64_t end) const;
+
+    arrow::Result<std::shared_ptr<arrow::RecordBatch>>
+    MakeBatch(const std::shared_ptr<std::vector<int64_t>>& offsets,
+              int64_t begin,
+              int64_t count,
+              bool contiguous);
+
+    arrow::Result<std::shared_ptr<arrow::Array>>
+    MakeColumn(const FieldMeta& field_meta,
+               const int64_t* offsets,
+               int64_t count,
+               bool contiguous);
+
+ private:
+    const SegmentInternalInterface& segment_;
+    SchemaPtr schema_;
+    std::vector<FieldId> field_ids_;
+    milvus::OpContext* op_ctx_;
+    int64_t max_batch_rows_;
+    std::shared_ptr<arrow::Schema> arrow_schema_;
+    int64_t zero_copy_arrays_{0};
+};
+
+}  // namespace milvus::segcore
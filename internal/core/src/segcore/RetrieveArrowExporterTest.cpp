@@ -0,0 +1,165 @@
+// Copyright (C) 2019-2026 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License
+
+#include <arrow/api.h>
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "common/Consts.h"
+#include "common/OpContext.h"
+#include "common/Schema.h"
+#include "common/Types.h"
+#include "knowhere/comp/index_param.h"
+#include "segcore/RetrieveArrowExporter.h"
+#include "segcore/SegmentGrowingImpl.h"
+#include "test_utils/DataGen.h"
+#include "test_utils/storage_test_utils.h"
+
+using namespace milvus;
+using namespace milvus::segcore;
+
+namespace {
+
+struct ExportFixture {
+    SchemaPtr schema;
+    FieldId pk{0};
+    FieldId i32{0};
+    FieldId flag{0};
+    FieldId str{0};
+};
+
+ExportFixture
+MakeSchema() {
+    ExportFixture f;
+    f.schema = std::make_shared<Schema>();
+    f.pk = f.schema->AddDebugField("pk", DataType::INT64);
+    f.i32 = f.schema->AddDebugField("i32", DataType::INT32);
+    f.flag = f.schema->AddDebugField("flag", DataType::BOOL);
+    f.str = f.schema->AddDebugField("str", DataType::VARCHAR);
+    f.schema->AddDebugField(
+        "vec", DataType::VECTOR_FLOAT, 4, knowhere::metric::L2);
+    f.schema->set_primary_field_id(f.pk);
+    return f;
+}
+
+// A long consecutive run followed by scattered rows.
+std::vector<int64_t>
+MakeOffsets() {
+    std::vector<int64_t> offsets;
+    const int64_t run = 2 * RetrieveArrowExporter::kMinZeroCopyRows;
+    for (int64_t i = 100; i < 100 + run; ++i) {
+        offsets.push_back(i);
+    }
+    for (int64_t i = 3000; i < 4000; i += 7) {
+        offsets.push_back(i);
+    }
+    return offsets;
+}
+
+void
+CheckBatches(const std::vector<std::shared_ptr<arrow::RecordBatch>>& batches,
+             const ExportFixture& f,
+             const GeneratedData& dataset,
+             const std::vector<int64_t>& offsets) {
+    auto pks = dataset.get_col<int64_t>(f.pk);
+    auto i32s = dataset.get_col<int32_t>(f.i32);
+    auto flags = dataset.get_col<bool>(f.flag);
+    auto strs = dataset.get_col<std::string>(f.str);
+
+    size_t row = 0;
+    for (const auto& batch : batches) {
+        ASSERT_TRUE(batch->ValidateFull().ok());
+        ASSERT_EQ(batch->num_columns(), 5);
+        auto pk_col =
+            std::static_pointer_cast<arrow::Int64Array>(batch->column(0));
+        auto i32_col =
+            std::static_pointer_cast<arrow::Int32Array>(batch->column(1));
+        auto flag_col =
+            std::static_pointer_cast<arrow::BooleanArray>(batch->column(2));
+        auto str_col =
+            std::static_pointer_cast<arrow::StringArray>(batch->column(3));
+        auto offset_col =
+            std::static_pointer_cast<arrow::Int64Array>(batch->column(4));
+        for (int64_t i = 0; i < batch->num_rows(); ++i, ++row) {
+            auto offset = offsets[row];
+            ASSERT_EQ(offset_col->Value(i), offset);
+            ASSERT_EQ(pk_col->Value(i), pks[offset]);
+            ASSERT_EQ(i32_col->Value(i), i32s[offset]);
+            ASSERT_EQ(flag_col->Value(i), flags[offset]);
+            ASSERT_EQ(str_col->GetString(i), strs[offset]);
+        }
+    }
+    ASSERT_EQ(row, offsets.size());
+}
+
+}  // namespace
+
+TEST(RetrieveArrowExporter, Sealed) {
+    auto f = MakeSchema();
+    auto dataset = DataGen(f.schema, 5000);
+    auto segment = CreateSealedWithFieldDataLoaded(f.schema, dataset);
+
+    OpContext op_ctx;
+    RetrieveArrowExporter exporter(
+        *segment, f.schema, {f.pk, f.i32, f.flag, f.str}, &op_ctx, 1500);
+    auto schema = exporter.schema();
+    ASSERT_EQ(schema->num_fields(), 5);
+    EXPECT_EQ(schema->field(0)->type()->id(), arrow::Type::INT64);
+    EXPECT_EQ(schema->field(3)->type()->id(), arrow::Type::STRING);
+    EXPECT_EQ(schema->field(4)->name(),
+              RetrieveArrowExporter::kSegmentOffsetColumn);
+
+    auto offsets = MakeOffsets();
+    auto batches = exporter.Export(offsets);
+    // the run fills zero-copy batches of at most max_batch_rows, a short
+    // tail is gathered together with the scattered rows
+    ASSERT_GE(batches.size(), 2);
+    EXPECT_LE(batches[0]->num_rows(), 1500);
+    EXPECT_GT(exporter.zero_copy_arrays(), 0);
+    CheckBatches(batches, f, dataset, offsets);
+
+    // the zero-copy arrays keep their chunks pinned on their own
+    auto first = batches[0];
+    batches.clear();
+    ASSERT_TRUE(first->ValidateFull().ok());
+}
+
+TEST(RetrieveArrowExporter, Growing) {
+    auto f = MakeSchema();
+    auto dataset = DataGen(f.schema, 5000);
+    auto segment = CreateGrowingSegment(f.schema, empty_index_meta);
+    segment->PreInsert(5000);
+    segment->Insert(0,
+                    5000,
+                    dataset.row_ids_.data(),
+                    dataset.timestamps_.data(),
+                    dataset.raw_);
+
+    OpContext op_ctx;
+    RetrieveArrowExporter exporter(
+        *segment, f.schema, {f.pk, f.i32, f.flag, f.str}, &op_ctx);
+    auto offsets = MakeOffsets();
+    auto batches = exporter.Export(offsets);
+    ASSERT_GE(batches.size(), 2);
+    CheckBatches(batches, f, dataset, offsets);
+
+    EXPECT_TRUE(exporter.Export({}).empty());
+}
+
+TEST(RetrieveArrowExporter, Unsupported) {
+    EXPECT_TRUE(RetrieveArrowExporter::IsSupported(DataType::JSON));
+    EXPECT_FALSE(RetrieveArrowExporter::IsSupported(DataType::VECTOR_FLOAT));
+    EXPECT_FALSE(RetrieveArrowExporter::IsSupported(DataType::ARRAY));
+    EXPECT_FALSE(RetrieveArrowExporter::IsSupported(DataType::TEXT));
+}
@@ -0,0 +1,658 @@
+// Copyright (C) 2019-2025 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License
+
+#include "segcore/SealedSidecar.h"
+
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+#include <cstring>
+#include <numeric>
+#include <type_traits>
+
+#include "log/Log.h"
+
+namespace milvus::segcore {
+
+namespace {
+
+constexpr int32_t kSidecarVersion = 1;
+
+enum ValueKind : uint8_t {
+    kNoValue = 0,
+    kIntValue = 1,
+    kDoubleValue = 2,
+    kStringValue = 3,
+};
+
+class Writer {
+ public:
+    template <typename T>
+    void
+    Put(const T& value) {
+        auto bytes = reinterpret_cast<const uint8_t*>(&value);
+        out_.insert(out_.end(), bytes, bytes + sizeof(T));
+    }
+
+    void
+    PutString(const std::string& value) {
+        Put(static_cast<uint32_t>(value.size()));
+        out_.insert(out_.end(), value.begin(), value.end());
+    }
+
+    std::vector<uint8_t>
+    Take() {
+        return std::move(out_);
+    }
+
+ private:
+    std::vector<uint8_t> out_;
+};
+
+class Reader {
+ public:
+    Reader(const uint8_t* data, int64_t size) : data_(data), size_(size) {
+    }
+
+    template <typename T>
+    arrow::Result<T>
+    Get() {
+        if (pos_ + static_cast<int64_t>(sizeof(T)) > size_) {
+            return arrow::Status::Invalid("truncated sidecar");
+        }
+        T value;
+        std::memcpy(&value, data_ + pos_, sizeof(T));
+        pos_ += sizeof(T);
+        return value;
+    }
+
+    arrow::Result<std::string>
+    GetString() {
+        ARROW_ASSIGN_OR_RAISE(auto length, Get<uint32_t>());
+        if (pos_ + static_cast<int64_t>(length) > size_) {
+            return arrow::Status::Invalid("truncated sidecar");
+        }
+        std::string value(reinterpret_cast<const char*>(data_ + pos_), length);
+        pos_ += length;
+        return value;
+    }
+
+    arrow::Status
+    CheckVersion() {
+        ARROW_ASSIGN_OR_RAISE(auto version, Get<int32_t>());
+        if (version != kSidecarVersion) {
+            return arrow::Status::Invalid("unsupported sidecar version ",
+                                          version);
+        }
+        return arrow::Status::OK();
+    }
+
+    bool
+    AtEnd() const {
+        return pos_ == size_;
+    }
+
+ private:
+    const uint8_t* data_;
+    int64_t size_;
+    int64_t pos_ = 0;
+};
+
+template <typename ArrayType, typename Value>
+void
+MinMax(const arrow::Array& array, ZoneMap::Entry& entry) {
+    const auto& typed = static_cast<const ArrayType&>(array);
+    bool has_value = false;
+    Value min{};
+    Value max{};
+    for (int64_t i = 0; i < typed.length(); ++i) {
+        if (typed.IsNull(i)) {
+            continue;
+        }
+        Value value(typed.GetView(i));
+        if constexpr (std::is_same_v<Value, double>) {
+            if (std::isnan(value)) {
+                continue;
+            }
+        }
+        if (!has_value) {
+            min = max = value;
+            has_value = true;
+        } else if (value < min) {
+            min = value;
+        } else if (max < value) {
+            max = value;
+        }
+    }
+    entry.has_value = has_value;
+    if (has_value) {
+        entry.min = std::move(min);
+        entry.max = std::move(max);
+    }
+}
+
+void
+PutValue(Writer& writer, const ZoneMap::Value& value) {
+    if (auto int_value = std::get_if<int64_t>(&value)) {
+        writer.Put(*int_value);
+    } else if (auto double_value = std::get_if<double>(&value)) {
+        writer.Put(*double_value);
+    } else {
+        writer.PutString(std::get<std::string>(value));
+    }
+}
+
+arrow::Result<ZoneMap::Value>
+GetValue(Reader& reader, uint8_t kind) {
+    switch (kind) {
+        case kIntValue: {
+            ARROW_ASSIGN_OR_RAISE(auto value, reader.Get<int64_t>());
+            return ZoneMap::Value(value);
+        }
+        case kDoubleValue: {
+            ARROW_ASSIGN_OR_RAISE(auto value, reader.Get<double>());
+            return ZoneMap::Value(value);
+        }
+        case kStringValue: {
+            ARROW_ASSIGN_OR_RAISE(auto value, reader.GetString());
+            return ZoneMap::Value(std::move(value));
+        }
+        default:
+            return arrow::Status::Invalid("unknown zone map value kind ",
+                                          static_cast<int>(kind));
+    }
+}
+
+arrow::Result<std::shared_ptr<arrow::Buffer>>
+ReadSidecarFile(const milvus_storage::ArrowFileSystemPtr& fs,
+                const std::string& path) {
+    ARROW_ASSIGN_OR_RAISE(auto input, fs->OpenInputFile(path));
+    ARROW_ASSIGN_OR_RAISE(auto size, input->GetSize());
+    return input->Read(size);
+}
+
+// Whether ranges, ordered by row offset, cover rows [0, num_rows) once.
+template <typename Range, typename NumRows>
+bool
+CoversRows(const std::vector<Range>& ranges,
+           int64_t num_rows,
+           NumRows range_rows) {
+    int64_t next_row = 0;
+    for (const auto& range : ranges) {
+        if (range.row_offset != next_row) {
+            return false;
+        }
+        next_row += range_rows(range);
+    }
+    return next_row == num_rows;
+}
+
+// Whether the offsets of pk_order are the rows of its range, each once.
+bool
+CoversOwnRows(const PkOrderBuilder::PkOrder& pk_order) {
+    if (pk_order.sorted) {
+        return true;
+    }
+    if (static_cast<int64_t>(pk_order.offsets.size()) != pk_order.num_rows) {
+        return false;
+    }
+    std::vector<bool> seen(pk_order.num_rows, false);
+    for (auto offset : pk_order.offsets) {
+        auto row = offset - pk_order.row_offset;
+        if (row < 0 || row >= pk_order.num_rows || seen[row]) {
+            return false;
+        }
+        seen[row] = true;
+    }
+    return true;
+}
+
+void
+MergeEntry(ZoneMap::Entry& merged, const ZoneMap::Entry& entry) {
+    merged.num_rows += entry.num_rows;
+    merged.null_count += entry.null_count;
+    if (!entry.has_value) {
+        return;
+    }
+    if (!merged.has_value) {
+        merged.has_value = true;
+        merged.min = entry.min;
+        merged.max = entry.max;
+        return;
+    }
+    if (entry.min < merged.min) {
+        merged.min = entry.min;
+    }
+    if (merged.max < entry.max) {
+        merged.max = entry.max;
+    }
+}
+
+template <typename T>
+std::unique_ptr<index::FieldChunkMetrics>
+IntChunkMetrics(const ZoneMap::Entry& entry) {
+    if (!std::holds_alternative<int64_t>(entry.min)) {
+        return std::make_unique<index::NoneFieldChunkMetrics>();
+    }
+    return std::make_unique<index::IntFieldChunkMetrics<T>>(
+        static_cast<T>(std::get<int64_t>(entry.min)),
+        static_cast<T>(std::get<int64_t>(entry.max)),
+        nullptr);
+}
+
+template <typename T>
+std::unique_ptr<index::FieldChunkMetrics>
+FloatChunkMetrics(const ZoneMap::Entry& entry) {
+    if (!std::holds_alternative<double>(entry.min)) {
+        return std::make_unique<index::NoneFieldChunkMetrics>();
+    }
+    return std::make_unique<index::FloatFieldChunkMetrics<T>>(
+        static_cast<T>(std::get<double>(entry.min)),
+        static_cast<T>(std::get<double>(entry.max)));
+}
+
+// The skip index metrics of a chunk whose zone map entries are merged into
+// entry.
+std::unique_ptr<index::FieldChunkMetrics>
+MakeChunkMetrics(DataType data_type, const ZoneMap::Entry& entry) {
+    if (!entry.has_value) {
+        return std::make_unique<index::NoneFieldChunkMetrics>();
+    }
+    switch (data_type) {
+        case DataType::BOOL:
+            if (std::holds_alternative<int64_t>(entry.min)) {
+                return std::make_unique<index::BooleanFieldChunkMetrics>(
+                    std::get<int64_t>(entry.max) != 0,
+                    std::get<int64_t>(entry.min) == 0);
+            }
+            break;
+        case DataType::INT8:
+            return IntChunkMetrics<int8_t>(entry);
+        case DataType::INT16:
+            return IntChunkMetrics<int16_t>(entry);
+        case DataType::INT32:
+            return IntChunkMetrics<int32_t>(entry);
+        case DataType::INT64:
+            return IntChunkMetrics<int64_t>(entry);
+        case DataType::FLOAT:
+            return FloatChunkMetrics<float>(entry);
+        case DataType::DOUBLE:
+            return FloatChunkMetrics<double>(entry);
+        case DataType::VARCHAR:
+        case DataType::STRING:
+            if (std::holds_alternative<std::string>(entry.min)) {
+                return std::make_unique<index::StringFieldChunkMetrics>(
+                    std::get<std::string>(entry.min),
+                    std::get<std::string>(entry.max),
+                    nullptr,
+                    nullptr);
+            }
+            break;
+        default:
+            break;
+    }
+    return std::make_unique<index::NoneFieldChunkMetrics>();
+}
+
+}  // namespace
+
+bool
+ZoneMap::Supports(const arrow::DataType& type) {
+    switch (type.id()) {
+        case arrow::Type::BOOL:
+        case arrow::Type::INT8:
+        case arrow::Type::INT16:
+        case arrow::Type::INT32:
+        case arrow::Type::INT64:
+        case arrow::Type::FLOAT:
+        case arrow::Type::DOUBLE:
+        case arrow::Type::STRING:
+        case arrow::Type::LARGE_STRING:
+            return true;
+        default:
+            return false;
+    }
+}
+
+void
+ZoneMap::Append(const arrow::Array& array) {
+    Entry entry;
+    entry.num_rows = array.length();
+    entry.null_count = array.null_count();
+    switch (array.type_id()) {
+        case arrow::Type::BOOL:
+            MinMax<arrow::BooleanArray, int64_t>(array, entry);
+            break;
+        case arrow::Type::INT8:
+            MinMax<arrow::Int8Array, int64_t>(array, entry);
+            break;
+        case arrow::Type::INT16:
+            MinMax<arrow::Int16Array, int64_t>(array, entry);
+            break;
+        case arrow::Type::INT32:
+            MinMax<arrow::Int32Array, int64_t>(array, entry);
+            break;
+        case arrow::Type::INT64:
+            MinMax<arrow::Int64Array, int64_t>(array, entry);
+            break;
+        case arrow::Type::FLOAT:
+            MinMax<arrow::FloatArray, double>(array, entry);
+            break;
+        case arrow::Type::DOUBLE:
+            MinMax<arrow::DoubleArray, double>(array, entry);
+            break;
+        case arrow::Type::STRING:
+            MinMax<arrow::StringArray, std::string>(array, entry);
+            break;
+        case arrow::Type::LARGE_STRING:
+            MinMax<arrow::LargeStringArray, std::string>(array, entry);
+            break;
+        default:
+            // rows and nulls only
+            break;
+    }
+    entries.push_back(std::move(entry));
+}
+
+std::vector<uint8_t>
+ZoneMap::Serialize() const {
+    Writer writer;
+    writer.Put(kSidecarVersion);
+    writer.Put(row_offset);
+    writer.Put(static_cast<uint32_t>(entries.size()));
+    for (const auto& entry : entries) {
+        writer.Put(entry.num_rows);
+        writer.Put(entry.null_count);
+        uint8_t kind = kNoValue;
+        if (entry.has_value) {
+            kind = std::holds_alternative<int64_t>(entry.min)  ? kIntValue
+                   : std::holds_alternative<double>(entry.min) ? kDoubleValue
+                                                               : kStringValue;
+        }
+        writer.Put(kind);
+        if (entry.has_value) {
+            PutValue(writer, entry.min);
+            PutValue(writer, entry.max);
+        }
+    }
+    return writer.Take();
+}
+
+arrow::Result<ZoneMap>
+ZoneMap::Deserialize(const uint8_t* data, int64_t size) {
+    Reader reader(data, size);
+    ARROW_RETURN_NOT_OK(reader.CheckVersion());
+    ZoneMap zone_map;
+    ARROW_ASSIGN_OR_RAISE(zone_map.row_offset, reader.Get<int64_t>());
+    ARROW_ASSIGN_OR_RAISE(auto num_entries, reader.Get<uint32_t>());
+    for (uint32_t i = 0; i < num_entries; ++i) {
+        Entry entry;
+        ARROW_ASSIGN_OR_RAISE(entry.num_rows, reader.Get<int64_t>());
+        ARROW_ASSIGN_OR_RAISE(entry.null_count, reader.Get<int64_t>());
+        ARROW_ASSIGN_OR_RAISE(auto kind, reader.Get<uint8_t>());
+        if (kind != kNoValue) {
+            entry.has_value = true;
+            ARROW_ASSIGN_OR_RAISE(entry.min, GetValue(reader, kind));
+            ARROW_ASSIGN_OR_RAISE(entry.max, GetValue(reader, kind));
+        }
+        zone_map.entries.push_back(std::move(entry));
+    }
+    if (!reader.AtEnd()) {
+        return arrow::Status::Invalid("trailing bytes in zone map sidecar");
+    }
+    return zone_map;
+}
+
+bool
+PkOrderBuilder::Supports(const arrow::DataType& type) {
+    switch (type.id()) {
+        case arrow::Type::INT64:
+        case arrow::Type::STRING:
+        case arrow::Type::LARGE_STRING:
+            return true;
+        default:
+            return false;
+    }
+}
+
+arrow::Status
+PkOrderBuilder::Append(const arrow::Array& pks) {
+    if (pks.null_count() > 0) {
+        return arrow::Status::Invalid("primary keys must not be null");
+    }
+    switch (pks.type_id()) {
+        case arrow::Type::INT64: {
+            const auto& typed = static_cast<const arrow::Int64Array&>(pks);
+            int_pks_.insert(int_pks_.end(),
+                            typed.raw_values(),
+                            typed.raw_values() + typed.length());
+            break;
+        }
+        case arrow::Type::STRING: {
+            const auto& typed = static_cast<const arrow::StringArray&>(pks);
+            for (int64_t i = 0; i < typed.length(); ++i) {
+                string_pks_.emplace_back(typed.GetView(i));
+            }
+            break;
+        }
+        case arrow::Type::LARGE_STRING: {
+            const auto& typed =
+                static_cast<const arrow::LargeStringArray&>(pks);
+            for (int64_t i = 0; i < typed.length(); ++i) {
+                string_pks_.emplace_back(typed.GetView(i));
+            }
+            break;
+        }
+        default:
+            return arrow::Status::NotImplemented("pk order of ",
+                                                 pks.type()->ToString());
+    }
+    return arrow::Status::OK();
+}
+
+std::vector<uint8_t>
+PkOrderBuilder::Finish() {
+    auto order_by = [](const auto& pks) {
+        std::vector<int64_t> order;
+        if (std::is_sorted(pks.begin(), pks.end())) {
+            return order;
+        }
+        order.resize(pks.size());
+        std::iota(order.begin(), order.end(), 0);
+        std::stable_sort(order.begin(), order.end(), [&](auto a, auto b) {
+            return pks[a] < pks[b];
+        });
+        return order;
+    };
+    auto num_rows =
+        static_cast<int64_t>(int_pks_.empty() ? string_pks_.size()
+                                              : int_pks_.size());
+    auto order = int_pks_.empty() ? order_by(string_pks_) : order_by(int_pks_);
+
+    Writer writer;
+    writer.Put(kSidecarVersion);
+    writer.Put(row_offset_);
+    writer.Put(num_rows);
+    writer.Put(static_cast<uint8_t>(order.empty()));
+    for (auto row : order) {
+        writer.Put(row_offset_ + row);
+    }
+    int_pks_.clear();
+    string_pks_.clear();
+    return writer.Take();
+}
+
+arrow::Result<PkOrderBuilder::PkOrder>
+PkOrderBuilder::Deserialize(const uint8_t* data, int64_t size) {
+    Reader reader(data, size);
+    ARROW_RETURN_NOT_OK(reader.CheckVersion());
+    PkOrder pk_order;
+    ARROW_ASSIGN_OR_RAISE(pk_order.row_offset, reader.Get<int64_t>());
+    ARROW_ASSIGN_OR_RAISE(pk_order.num_rows, reader.Get<int64_t>());
+    ARROW_ASSIGN_OR_RAISE(auto sorted, reader.Get<uint8_t>());
+    pk_order.sorted = sorted != 0;
+    if (!pk_order.sorted) {
+        pk_order.offsets.reserve(pk_order.num_rows);
+        for (int64_t i = 0; i < pk_order.num_rows; ++i) {
+            ARROW_ASSIGN_OR_RAISE(auto offset, reader.Get<int64_t>());
+            pk_order.offsets.push_back(offset);
+        }
+    }
+    if (!reader.AtEnd()) {
+        return arrow::Status::Invalid("trailing bytes in pk order sidecar");
+    }
+    return pk_order;
+}
+
+SealedSidecars
+SealedSidecars::Load(const milvus_storage::api::Manifest& manifest,
+                     const milvus_storage::ArrowFileSystemPtr& fs,
+                     int64_t num_rows) {
+    SealedSidecars sidecars;
+    for (const auto& [stat_key, stat] : manifest.stats()) {
+        std::string_view key(stat_key);
+        bool is_zone_map = key.substr(0, kZoneMapStatPrefix.size()) ==
+                           kZoneMapStatPrefix;
+        bool is_pk_order = key.substr(0, kPkOrderStatPrefix.size()) ==
+                           kPkOrderStatPrefix;
+        if (!is_zone_map && !is_pk_order) {
+            continue;
+        }
+        int64_t field_id = 0;
+        auto id = key.substr(is_zone_map ? kZoneMapStatPrefix.size()
+                                         : kPkOrderStatPrefix.size());
+        auto [end, ec] =
+            std::from_chars(id.data(), id.data() + id.size(), field_id);
+        if (ec != std::errc() || end != id.data() + id.size()) {
+            continue;
+        }
+
+        std::vector<ZoneMap> zone_maps;
+        std::vector<PkOrderBuilder::PkOrder> pk_orders;
+        auto status = [&]() -> arrow::Status {
+            for (const auto& path : stat.paths) {
+                ARROW_ASSIGN_OR_RAISE(auto buffer, ReadSidecarFile(fs, path));
+                if (is_zone_map) {
+                    ARROW_ASSIGN_OR_RAISE(
+                        auto zone_map,
+                        ZoneMap::Deserialize(buffer->data(), buffer->size()));
+                    zone_maps.push_back(std::move(zone_map));
+                } else {
+                    ARROW_ASSIGN_OR_RAISE(
+                        auto pk_order,
+                        PkOrderBuilder::Deserialize(buffer->data(),
+                                                    buffer->size()));
+                    pk_orders.push_back(std::move(pk_order));
+                }
+            }
+            return arrow::Status::OK();
+        }();
+        if (!status.ok()) {
+            LOG_WARN("failed to read segment sidecar {}, ignoring it: {}",
+                     stat_key,
+                     status.ToString());
+            continue;
+        }
+        if (is_zone_map) {
+            sidecars.zone_maps[field_id] = std::move(zone_maps);
+        } else {
+            sidecars.pk_orders = std::move(pk_orders);
+        }
+    }
+    sidecars.DropIncomplete(num_rows);
+    return sidecars;
+}
+
+void
+SealedSidecars::DropIncomplete(int64_t num_rows) {
+    auto by_row_offset = [](const auto& a, const auto& b) {
+        return a.row_offset < b.row_offset;
+    };
+    for (auto it = zone_maps.begin(); it != zone_maps.end();) {
+        auto& field_zone_maps = it->second;
+        std::sort(
+            field_zone_maps.begin(), field_zone_maps.end(), by_row_offset);
+        bool complete = CoversRows(
+            field_zone_maps, num_rows, [](const ZoneMap& zone_map) {
+                int64_t rows = 0;
+                for (const auto& entry : zone_map.entries) {
+                    rows += entry.num_rows;
+                }
+                return rows;
+            });
+        if (complete) {
+            ++it;
+        } else {
+            LOG_INFO("zone map sidecars of field {} don't cover the segment",
+                     it->first);
+            it = zone_maps.erase(it);
+        }
+    }
+
+    std::sort(pk_orders.begin(), pk_orders.end(), by_row_offset);
+    bool complete =
+        CoversRows(pk_orders,
+                   num_rows,
+                   [](const PkOrderBuilder::PkOrder& pk_order) {
+                       return pk_order.num_rows;
+                   }) &&
+        std::all_of(pk_orders.begin(), pk_orders.end(), CoversOwnRows);
+    if (!complete && !pk_orders.empty()) {
+        LOG_INFO("pk order sidecars don't cover the segment");
+        pk_orders.clear();
+    }
+}
+
+std::vector<std::unique_ptr<index::FieldChunkMetrics>>
+SealedSidecars::ChunkMetrics(
+    FieldId field_id,
+    DataType data_type,
+    const std::vector<int64_t>& num_rows_until_chunk) const {
+    std::vector<std::unique_ptr<index::FieldChunkMetrics>> metrics;
+    auto it = zone_maps.find(field_id.get());
+    if (it == zone_maps.end() || num_rows_until_chunk.empty()) {
+        return metrics;
+    }
+    // the zone map entries, each with the row it ends at
+    std::vector<std::pair<int64_t, const ZoneMap::Entry*>> entries;
+    int64_t num_rows = 0;
+    for (const auto& zone_map : it->second) {
+        for (const auto& entry : zone_map.entries) {
+            num_rows += entry.num_rows;
+            entries.emplace_back(num_rows, &entry);
+        }
+    }
+    if (num_rows != num_rows_until_chunk.back()) {
+        return metrics;
+    }
+
+    // a chunk takes the merged entries of all batches it has rows of
+    size_t first = 0;
+    for (size_t chunk = 0; chunk + 1 < num_rows_until_chunk.size(); ++chunk) {
+        auto chunk_begin = num_rows_until_chunk[chunk];
+        auto chunk_end = num_rows_until_chunk[chunk + 1];
+        while (first < entries.size() && entries[first].first <= chunk_begin) {
+            ++first;
+        }
+        ZoneMap::Entry merged;
+        for (auto i = first; i < entries.size(); ++i) {
+            const auto& [entry_end, entry] = entries[i];
+            if (entry_end - entry->num_rows >= chunk_end) {
+                break;
+            }
+            MergeEntry(merged, *entry);
+        }
+        metrics.push_back(MakeChunkMetrics(data_type, merged));
+    }
+    return metrics;
+}
+
+}  // namespace milvus::segcore
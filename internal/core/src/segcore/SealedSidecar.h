@@ -0,0 +1,142 @@
+// Copyright (C) 2019-2025 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License
+
+#pragma once
+
+#include <arrow/api.h>
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include "common/Types.h"
+#include "index/skipindex_stats/SkipIndexStats.h"
+#include "milvus-storage/filesystem/fs.h"
+#include "milvus-storage/manifest.h"
+
+namespace milvus::segcore {
+
+// Artifacts a sealed segment otherwise derives by reading its flushed data
+// back, built by FlushGrowingSegmentData from the batches it writes while
+// they are still in memory. Each sidecar file covers one flushed offset
+// range and is registered in the segment manifest next to the data it
+// describes, under "zone_map.{field_id}" and "pk_order.{pk_field_id}".
+inline constexpr std::string_view kZoneMapStatPrefix = "zone_map.";
+inline constexpr std::string_view kPkOrderStatPrefix = "pk_order.";
+
+// Min, max and null count of a field per flushed batch, the statistics the
+// skip index prunes chunks with.
+struct ZoneMap {
+    using Value = std::variant<int64_t, double, std::string>;
+
+    struct Entry {
+        int64_t num_rows = 0;
+        int64_t null_count = 0;
+        // unset if every row of the batch is null
+        bool has_value = false;
+        Value min;
+        Value max;
+    };
+
+    // segment offset of the first row covered
+    int64_t row_offset = 0;
+    std::vector<Entry> entries;
+
+    // Whether zone maps can be built for arrays of type.
+    static bool
+    Supports(const arrow::DataType& type);
+
+    // Appends the entry of one flushed batch.
+    void
+    Append(const arrow::Array& array);
+
+    std::vector<uint8_t>
+    Serialize() const;
+
+    static arrow::Result<ZoneMap>
+    Deserialize(const uint8_t* data, int64_t size);
+};
+
+// The flushed rows in primary key order, so that the pk index of the sealed
+// segment doesn't need to sort them again.
+class PkOrderBuilder {
+ public:
+    explicit PkOrderBuilder(int64_t row_offset) : row_offset_(row_offset) {
+    }
+
+    // Whether pk orders can be built for pk arrays of type.
+    static bool
+    Supports(const arrow::DataType& type);
+
+    arrow::Status
+    Append(const arrow::Array& pks);
+
+    // The serialized order. Rows already flushed in pk order are recorded as
+    // sorted without their offsets.
+    std::vector<uint8_t>
+    Finish();
+
+    // Segment offsets of the rows in pk order; empty if the rows are sorted.
+    struct PkOrder {
+        int64_t row_offset = 0;
+        int64_t num_rows = 0;
+        bool sorted = true;
+        std::vector<int64_t> offsets;
+    };
+
+    static arrow::Result<PkOrder>
+    Deserialize(const uint8_t* data, int64_t size);
+
+ private:
+    int64_t row_offset_;
+    std::vector<int64_t> int_pks_;
+    std::vector<std::string> string_pks_;
+};
+
+// The sidecars of a sealed segment, read back from the stats of its
+// manifest. The sealed segment uses them in place of the artifacts it would
+// otherwise derive from its data: zone maps become the skip index of their
+// field, and pk orders let the pk index merge the flushed ranges instead of
+// sorting all rows.
+struct SealedSidecars {
+    // zone maps by field id, ordered by row offset
+    std::unordered_map<int64_t, std::vector<ZoneMap>> zone_maps;
+    // ordered by row offset
+    std::vector<PkOrderBuilder::PkOrder> pk_orders;
+
+    // Reads the sidecars registered in the stats of manifest. Sidecars that
+    // can't be read are skipped; the segment derives them from its data.
+    static SealedSidecars
+    Load(const milvus_storage::api::Manifest& manifest,
+         const milvus_storage::ArrowFileSystemPtr& fs,
+         int64_t num_rows);
+
+    // Drops the sidecars that don't cover rows [0, num_rows) of the segment
+    // in order, each row once, e.g. if only part of the segment was flushed
+    // with sidecars.
+    void
+    DropIncomplete(int64_t num_rows);
+
+    // Skip index metrics of field_id, one per chunk, where chunk i holds
+    // rows [num_rows_until_chunk[i], num_rows_until_chunk[i + 1]). Empty if
+    // the field has no zone map.
+    std::vector<std::unique_ptr<index::FieldChunkMetrics>>
+    ChunkMetrics(FieldId field_id,
+                 DataType data_type,
+                 const std::vector<int64_t>& num_rows_until_chunk) const;
+};
+
+}  // namespace milvus::segcore
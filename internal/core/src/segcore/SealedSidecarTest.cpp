@@ -0,0 +1,222 @@
+// Copyright (C) 2019-2025 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License
+
+#include <arrow/api.h>
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "common/Types.h"
+#include "segcore/SealedSidecar.h"
+
+using namespace milvus::segcore;
+
+namespace {
+
+template <typename Builder, typename T>
+std::shared_ptr<arrow::Array>
+MakeArray(const std::vector<T>& values, const std::vector<bool>& valid = {}) {
+    Builder builder;
+    for (size_t i = 0; i < values.size(); ++i) {
+        if (!valid.empty() && !valid[i]) {
+            EXPECT_TRUE(builder.AppendNull().ok());
+        } else {
+            EXPECT_TRUE(builder.Append(values[i]).ok());
+        }
+    }
+    std::shared_ptr<arrow::Array> array;
+    EXPECT_TRUE(builder.Finish(&array).ok());
+    return array;
+}
+
+}  // namespace
+
+TEST(SealedSidecarTest, ZoneMapRoundTrip) {
+    EXPECT_TRUE(ZoneMap::Supports(*arrow::int32()));
+    EXPECT_TRUE(ZoneMap::Supports(*arrow::utf8()));
+    EXPECT_FALSE(ZoneMap::Supports(*arrow::binary()));
+
+    ZoneMap ints;
+    ints.row_offset = 100;
+    ints.Append(*MakeArray<arrow::Int64Builder, int64_t>(
+        {5, -3, 9, 42}, {true, true, true, false}));
+    ints.Append(
+        *MakeArray<arrow::Int64Builder, int64_t>({1, 2}, {false, false}));
+    auto serialized = ints.Serialize();
+    auto result = ZoneMap::Deserialize(serialized.data(), serialized.size());
+    ASSERT_TRUE(result.ok()) << result.status().ToString();
+    auto& zone_map = result.ValueOrDie();
+    EXPECT_EQ(zone_map.row_offset, 100);
+    ASSERT_EQ(zone_map.entries.size(), 2);
+    EXPECT_EQ(zone_map.entries[0].num_rows, 4);
+    EXPECT_EQ(zone_map.entries[0].null_count, 1);
+    ASSERT_TRUE(zone_map.entries[0].has_value);
+    EXPECT_EQ(std::get<int64_t>(zone_map.entries[0].min), -3);
+    EXPECT_EQ(std::get<int64_t>(zone_map.entries[0].max), 9);
+    EXPECT_EQ(zone_map.entries[1].null_count, 2);
+    EXPECT_FALSE(zone_map.entries[1].has_value);
+
+    ZoneMap doubles;
+    doubles.Append(*MakeArray<arrow::DoubleBuilder, double>(
+        {1.5, std::nan(""), -0.5}));
+    serialized = doubles.Serialize();
+    result = ZoneMap::Deserialize(serialized.data(), serialized.size());
+    ASSERT_TRUE(result.ok());
+    EXPECT_EQ(std::get<double>(result.ValueOrDie().entries[0].min), -0.5);
+    EXPECT_EQ(std::get<double>(result.ValueOrDie().entries[0].max), 1.5);
+
+    ZoneMap strings;
+    strings.Append(*MakeArray<arrow::StringBuilder, std::string>(
+        {"pear", "apple", "zoo"}));
+    serialized = strings.Serialize();
+    result = ZoneMap::Deserialize(serialized.data(), serialized.size());
+    ASSERT_TRUE(result.ok());
+    EXPECT_EQ(std::get<std::string>(result.ValueOrDie().entries[0].min),
+              "apple");
+    EXPECT_EQ(std::get<std::string>(result.ValueOrDie().entries[0].max),
+              "zoo");
+
+    // truncated
+    EXPECT_FALSE(
+        ZoneMap::Deserialize(serialized.data(), serialized.size() - 1).ok());
+}
+
+TEST(SealedSidecarTest, PkOrderRoundTrip) {
+    PkOrderBuilder sorted(10);
+    ASSERT_TRUE(
+        sorted.Append(*MakeArray<arrow::Int64Builder, int64_t>({1, 2})).ok());
+    ASSERT_TRUE(
+        sorted.Append(*MakeArray<arrow::Int64Builder, int64_t>({3, 7})).ok());
+    auto serialized = sorted.Finish();
+    auto result =
+        PkOrderBuilder::Deserialize(serialized.data(), serialized.size());
+    ASSERT_TRUE(result.ok()) << result.status().ToString();
+    EXPECT_EQ(result.ValueOrDie().row_offset, 10);
+    EXPECT_EQ(result.ValueOrDie().num_rows, 4);
+    EXPECT_TRUE(result.ValueOrDie().sorted);
+    EXPECT_TRUE(result.ValueOrDie().offsets.empty());
+
+    PkOrderBuilder unsorted(10);
+    ASSERT_TRUE(unsorted
+                    .Append(*MakeArray<arrow::StringBuilder, std::string>(
+                        {"c", "a"}))
+                    .ok());
+    ASSERT_TRUE(unsorted
+                    .Append(*MakeArray<arrow::StringBuilder, std::string>(
+                        {"d", "b"}))
+                    .ok());
+    serialized = unsorted.Finish();
+    result = PkOrderBuilder::Deserialize(serialized.data(), serialized.size());
+    ASSERT_TRUE(result.ok());
+    EXPECT_FALSE(result.ValueOrDie().sorted);
+    EXPECT_EQ(result.ValueOrDie().offsets,
+              (std::vector<int64_t>{11, 13, 10, 12}));
+
+    PkOrderBuilder nulls(0);
+    EXPECT_FALSE(nulls
+                     .Append(*MakeArray<arrow::Int64Builder, int64_t>(
+                         {1, 2}, {true, false}))
+                     .ok());
+}
+
+TEST(SealedSidecarTest, DropIncomplete) {
+    auto zone_map = [](int64_t row_offset, std::vector<int64_t> batch_rows) {
+        ZoneMap result;
+        result.row_offset = row_offset;
+        for (auto num_rows : batch_rows) {
+            result.entries.push_back({num_rows, 0, false, {}, {}});
+        }
+        return result;
+    };
+    auto pk_order = [](int64_t row_offset, std::vector<int64_t> offsets) {
+        PkOrderBuilder::PkOrder result;
+        result.row_offset = row_offset;
+        result.num_rows = offsets.size();
+        result.offsets = std::move(offsets);
+        return result;
+    };
+
+    SealedSidecars sidecars;
+    // out of order, complete
+    sidecars.zone_maps[100] = {zone_map(4, {2, 4}), zone_map(0, {1, 3})};
+    // gap between the ranges
+    sidecars.zone_maps[101] = {zone_map(0, {4}), zone_map(5, {5})};
+    // missing the last range
+    sidecars.zone_maps[102] = {zone_map(0, {4})};
+    sidecars.pk_orders = {pk_order(4, {9, 4, 5, 8, 7, 6}),
+                          pk_order(0, {3, 1, 2, 0})};
+    sidecars.DropIncomplete(10);
+    ASSERT_EQ(sidecars.zone_maps.size(), 1);
+    ASSERT_EQ(sidecars.zone_maps[100].size(), 2);
+    EXPECT_EQ(sidecars.zone_maps[100][0].row_offset, 0);
+    ASSERT_EQ(sidecars.pk_orders.size(), 2);
+    EXPECT_EQ(sidecars.pk_orders[0].row_offset, 0);
+
+    // an offset out of its range
+    sidecars.pk_orders = {pk_order(0, {3, 1, 2, 4}),
+                          pk_order(4, {9, 0, 5, 8, 7, 6})};
+    sidecars.DropIncomplete(10);
+    EXPECT_TRUE(sidecars.pk_orders.empty());
+
+    // an offset twice
+    sidecars.pk_orders = {pk_order(0, {3, 1, 1, 0})};
+    sidecars.DropIncomplete(4);
+    EXPECT_TRUE(sidecars.pk_orders.empty());
+}
+
+TEST(SealedSidecarTest, ChunkMetrics) {
+    SealedSidecars sidecars;
+    ZoneMap first;
+    first.Append(*MakeArray<arrow::Int64Builder, int64_t>({5, 7, 6}));
+    first.Append(
+        *MakeArray<arrow::Int64Builder, int64_t>({0, 0}, {false, false}));
+    ZoneMap second;
+    second.row_offset = 5;
+    second.Append(*MakeArray<arrow::Int64Builder, int64_t>({20, 30, 25}));
+    sidecars.zone_maps[100] = {first, second};
+
+    using milvus::OpType;
+    // the second chunk takes a batch with values and an all-null one, the
+    // third only the all-null one
+    auto metrics = sidecars.ChunkMetrics(
+        milvus::FieldId(100), milvus::DataType::INT64, {0, 2, 4, 5, 8});
+    ASSERT_EQ(metrics.size(), 4);
+    EXPECT_TRUE(metrics[0]->CanSkipUnaryRange(OpType::GreaterThan,
+                                              int64_t(7)));
+    EXPECT_FALSE(metrics[0]->CanSkipUnaryRange(OpType::GreaterThan,
+                                               int64_t(6)));
+    EXPECT_FALSE(metrics[1]->CanSkipUnaryRange(OpType::LessThan,
+                                               int64_t(6)));
+    EXPECT_TRUE(metrics[1]->CanSkipUnaryRange(OpType::LessThan,
+                                              int64_t(5)));
+    EXPECT_EQ(metrics[2]->GetMetricsType(),
+              milvus::index::FieldChunkMetricsType::NONE);
+    EXPECT_TRUE(metrics[3]->CanSkipUnaryRange(OpType::LessThan,
+                                              int64_t(20)));
+    EXPECT_FALSE(metrics[3]->CanSkipUnaryRange(OpType::GreaterThan,
+                                               int64_t(29)));
+
+    // rows that the zone maps don't describe
+    EXPECT_TRUE(sidecars
+                    .ChunkMetrics(milvus::FieldId(100),
+                                  milvus::DataType::INT64,
+                                  {0, 4, 9})
+                    .empty());
+    EXPECT_TRUE(sidecars
+                    .ChunkMetrics(milvus::FieldId(101),
+                                  milvus::DataType::INT64,
+                                  {0, 4, 8})
+                    .empty());
+}
@@ -72,6 +72,64 @@ class SegcoreConfig {
         return enable_interim_segment_index_;
     }
 
+    // Maintain interim indexes of non-nullable vector fields in the
+    // background instead of on the insert path.
+    void
+    set_enable_async_interim_index(bool enable_async_interim_index) {
+        enable_async_interim_index_ = enable_async_interim_index;
+    }
+
+    bool
+    get_enable_async_interim_index() const {
+        return enable_async_interim_index_;
+    }
+
+    // Prefetch the output cells sealed segments predict a query will pin,
+    // learned from earlier queries with the same access pattern.
+    void
+    set_enable_predictive_warmup(bool enable_predictive_warmup) {
+        enable_predictive_warmup_ = enable_predictive_warmup;
+    }
+
+    bool
+    get_enable_predictive_warmup() const {
+        return enable_predictive_warmup_;
+    }
+
+    // LZ4-compress the TEXT values growing segments spill to local files.
+    void
+    set_enable_text_lob_compression(bool enable_text_lob_compression) {
+        enable_text_lob_compression_ = enable_text_lob_compression;
+    }
+
+    bool
+    get_enable_text_lob_compression() const {
+        return enable_text_lob_compression_;
+    }
+
+    // Growing text match indexes serve fresh rows from an in-memory delta
+    // and commit no more often than this, unless the delta grows beyond
+    // text_match_delta_max_byte_size.
+    void
+    set_text_match_delta_commit_interval_ms(int64_t interval_ms) {
+        text_match_delta_commit_interval_ms_ = interval_ms;
+    }
+
+    int64_t
+    get_text_match_delta_commit_interval_ms() const {
+        return text_match_delta_commit_interval_ms_;
+    }
+
+    void
+    set_text_match_delta_max_byte_size(int64_t max_byte_size) {
+        text_match_delta_max_byte_size_ = max_byte_size;
+    }
+
+    int64_t
+    get_text_match_delta_max_byte_size() const {
+        return text_match_delta_max_byte_size_;
+    }
+
     void
     set_storage_v3_enabled(bool storage_v3_enabled) {
         this->storage_v3_enabled_ = storage_v3_enabled;
@@ -236,6 +294,11 @@ class SegcoreConfig {
     };
     inline static bool storage_v3_enabled_ = false;
     inline static bool enable_interim_segment_index_ = false;
+    inline static bool enable_async_interim_index_ = false;
+    inline static bool enable_predictive_warmup_ = false;
+    inline static bool enable_text_lob_compression_ = false;
+    inline static int64_t text_match_delta_commit_interval_ms_ = 10 * 1000;
+    inline static int64_t text_match_delta_max_byte_size_ = 64 << 20;
     inline static bool enable_growing_source_flush_ = false;
     inline static int64_t chunk_rows_ = 32 * 1024;
     inline static int64_t nlist_ = 100;
@@ -96,6 +96,12 @@ using namespace milvus::cachinglayer;
 
 namespace {
 
+// Inserts with fewer fields or rows copy the fields on the caller's thread,
+// where the copies are too small to pay for the tasks.
+constexpr size_t kParallelInsertMinFields = 4;
+constexpr int64_t kParallelInsertMinRows = 1024;
+constexpr size_t kMaxInsertTasks = 8;
+
 int64_t
 GetLoadedFieldRows(
     const std::vector<std::unordered_map<FieldId, std::vector<FieldDataPtr>>>&
@@ -419,6 +425,105 @@ SegmentGrowingImpl::try_remove_chunks(FieldId fieldId) {
     }
 }
 
+void
+SegmentGrowingImpl::ScheduleIndexMaintenance() {
+    if (indexing_record_.get_async_fields().empty()) {
+        return;
+    }
+    {
+        std::lock_guard lck(index_maintenance_mutex_);
+        if (index_maintenance_running_ || index_maintenance_stopped_) {
+            // the running task re-checks the ack before it exits
+            return;
+        }
+        if (std::chrono::steady_clock::now() < index_maintenance_retry_at_) {
+            // backing off after a failed round
+            return;
+        }
+        index_maintenance_running_ = true;
+    }
+    try {
+        auto& pool =
+            ThreadPools::GetThreadPool(milvus::ThreadPoolPriority::MIDDLE);
+        pool.Submit([this]() { MaintainIndexes(); });
+    } catch (...) {
+        std::lock_guard lck(index_maintenance_mutex_);
+        index_maintenance_running_ = false;
+        index_maintenance_cv_.notify_all();
+        throw;
+    }
+}
+
+void
+SegmentGrowingImpl::MaintainIndexes() {
+    while (true) {
+        int64_t end = 0;
+        {
+            std::lock_guard lck(index_maintenance_mutex_);
+            end = insert_record_.ack_responder_.GetAck();
+            if (index_maintenance_stopped_ || end <= index_maintained_ack_) {
+                index_maintenance_running_ = false;
+                index_maintenance_cv_.notify_all();
+                return;
+            }
+        }
+        bool failed = false;
+        for (auto field_id : indexing_record_.get_async_fields()) {
+            try {
+                indexing_record_.AppendingIndexFromRaw(
+                    field_id, end, insert_record_);
+            } catch (std::exception& e) {
+                // search keeps brute forcing the rows beyond the index
+                LOG_ERROR(
+                    "growing segment {} failed to index field {} up to row "
+                    "{}: {}",
+                    id_,
+                    field_id.get(),
+                    end,
+                    e.what());
+                failed = true;
+            }
+        }
+        if (failed) {
+            // Keep the ack so that a later insert schedules the round again,
+            // after a backoff doubling with every consecutive failure.
+            constexpr auto kMinBackoff = std::chrono::milliseconds(100);
+            constexpr auto kMaxBackoff = std::chrono::milliseconds(30 * 1000);
+            std::lock_guard lck(index_maintenance_mutex_);
+            auto backoff = std::min<std::chrono::milliseconds>(
+                kMinBackoff * (int64_t{1} << index_maintenance_failures_),
+                kMaxBackoff);
+            index_maintenance_failures_ =
+                std::min(index_maintenance_failures_ + 1, 16);
+            index_maintenance_retry_at_ =
+                std::chrono::steady_clock::now() + backoff;
+            index_maintenance_running_ = false;
+            index_maintenance_cv_.notify_all();
+            return;
+        }
+        {
+            std::lock_guard lck(index_maintenance_mutex_);
+            index_maintenance_failures_ = 0;
+        }
+        index_maintained_ack_ = end;
+    }
+}
+
+void
+SegmentGrowingImpl::WaitForIndexMaintenance() {
+    std::unique_lock lck(index_maintenance_mutex_);
+    index_maintenance_cv_.wait(lck,
+                               [this] { return !index_maintenance_running_; });
+}
+
+void
+SegmentGrowingImpl::StopIndexMaintenance() {
+    std::unique_lock lck(index_maintenance_mutex_);
+    index_maintenance_stopped_ = true;
+    index_maintenance_cv_.wait(lck,
+                               [this] { return !index_maintenance_running_; });
+}
+
 ResourceUsage
 SegmentGrowingImpl::EstimateSegmentResourceUsage() const {
     int64_t num_rows = get_row_count();
@@ -634,6 +739,100 @@ SegmentGrowingImpl::UpdateResourceTracking() {
     tracked_resource_ = new_resource;
 }
 
+void
+SegmentGrowingImpl::InsertField(FieldId field_id,
+                                const DataArray* field_data,
+                                int64_t reserved_offset,
+                                int64_t num_rows) {
+    auto& field_meta = (*schema_)[field_id];
+    if (field_meta.is_nullable()) {
+        insert_record_.get_valid_data(field_id)->set_data_raw(
+            num_rows, field_data, field_meta);
+    }
+    // Growing-source flush reads raw data from insert_record_. Keep it
+    // populated even when the interim index can also serve raw vector data.
+    // Otherwise later inserts after index sync would be visible by row count
+    // but missing from field chunks during FlushGrowingSegmentData.
+    if (field_meta.get_data_type() == DataType::TEXT) {
+        auto spillover = GetTextLobSpillover(field_id);
+        AssertInfo(spillover != nullptr, "TEXT field must have spillover");
+        const auto& string_data = field_data->scalars().string_data();
+
+        std::vector<std::string> ref_strings(num_rows);
+        for (int64_t i = 0; i < num_rows; i++) {
+            const auto& text = string_data.data(i);
+            ref_strings[i] = spillover->WriteAndEncode(text);
+        }
+
+        auto* vec_base = insert_record_.get_data_base(field_id);
+        auto* string_vec =
+            dynamic_cast<ConcurrentVector<std::string>*>(vec_base);
+        AssertInfo(string_vec != nullptr,
+                   "TEXT field must use ConcurrentVector<std::string>");
+        string_vec->set_data_raw(
+            reserved_offset, ref_strings.data(), num_rows);
+    } else {
+        insert_record_.get_data_base(field_id)->set_data_raw(
+            reserved_offset, num_rows, field_data, field_meta);
+    }
+
+    //insert vector data into index, async fields are indexed after ack
+    if (segcore_config_.get_enable_interim_segment_index() &&
+        !indexing_record_.is_async(field_id)) {
+        indexing_record_.AppendingIndex(reserved_offset,
+                                        num_rows,
+                                        field_id,
+                                        field_data,
+                                        insert_record_,
+                                        field_meta);
+    }
+
+    // update ArrayOffsetsGrowing for struct fields
+    if (struct_representative_fields_.count(field_id) > 0) {
+        std::vector<int32_t> array_lengths(num_rows);
+        ExtractArrayLengths(
+            *field_data, field_meta, num_rows, array_lengths.data());
+
+        auto offsets_it = array_offsets_map_.find(field_id);
+        if (offsets_it != array_offsets_map_.end()) {
+            offsets_it->second->Insert(
+                reserved_offset, array_lengths.data(), num_rows);
+        }
+    }
+
+    // index text.
+    if (field_meta.enable_match()) {
+        // TODO: iterate texts and call `AddText` instead of `AddTexts`. This may cost much more memory.
+        const auto& string_data = field_data->scalars().string_data().data();
+        std::vector<std::string> texts(string_data.begin(), string_data.end());
+        FixedVector<bool> texts_valid_data(field_data->valid_data().begin(),
+                                           field_data->valid_data().end());
+        AddTexts(field_id,
+                 texts.data(),
+                 texts_valid_data.data(),
+                 num_rows,
+                 reserved_offset);
+    }
+
+    // update average row data size
+    auto field_data_size =
+        GetRawDataSizeOfDataArray(field_data, field_meta, num_rows);
+    if (IsVariableDataType(field_meta.get_data_type())) {
+        SegmentInternalInterface::set_field_avg_size(
+            field_id, num_rows, field_data_size);
+    }
+
+    // Build geometry cache for GEOMETRY fields
+    if (field_meta.get_data_type() == DataType::GEOMETRY &&
+        segcore_config_.get_enable_geometry_cache()) {
+        BuildGeometryCacheForInsert(field_id, field_data, num_rows);
+    }
+
+    stats_.mem_size += field_data_size;
+
+    try_remove_chunks(field_id);
+}
+
 void
 SegmentGrowingImpl::Insert(int64_t reserved_offset,
                            int64_t num_rows,
@@ -702,6 +901,12 @@ SegmentGrowingImpl::Insert(int64_t reserved_offset,
     insert_record_.row_ids_.set_data_raw(reserved_offset, row_ids, num_rows);
     stats_.mem_size += num_rows * sizeof(int64_t);
 
+    // step 4: copy each field and maintain its indexes, fields don't depend
+    // on each other once reserved_offset is fixed. Geometry fields all parse
+    // with the segment's GEOS context, which isn't thread safe, so they are
+    // copied on the calling thread only.
+    std::vector<std::pair<FieldId, const DataArray*>> insert_fields;
+    std::vector<std::pair<FieldId, const DataArray*>> geometry_fields;
     for (auto& [field_id, field_meta] : schema_->get_fields()) {
         if (field_id.get() < START_USER_FIELDID) {
             continue;
@@ -712,125 +917,59 @@ SegmentGrowingImpl::Insert(int64_t reserved_offset,
                        field_id.get());
             continue;
         }
-        auto data_offset = field_id_to_offset[field_id];
-        if (field_meta.is_nullable()) {
-            insert_record_.get_valid_data(field_id)->set_data_raw(
-                num_rows,
-                &insert_record_proto->fields_data(data_offset),
-                field_meta);
-        }
-        // Growing-source flush reads raw data from insert_record_. Keep it
-        // populated even when the interim index can also serve raw vector data.
-        // Otherwise later inserts after index sync would be visible by row count
-        // but missing from field chunks during FlushGrowingSegmentData.
-        if (field_meta.get_data_type() == DataType::TEXT) {
-            auto spillover = GetTextLobSpillover(field_id);
-            AssertInfo(spillover != nullptr, "TEXT field must have spillover");
-            const auto& field_data =
-                insert_record_proto->fields_data(data_offset);
-            const auto& string_data = field_data.scalars().string_data();
-
-            std::vector<std::string> ref_strings(num_rows);
-            for (int64_t i = 0; i < num_rows; i++) {
-                const auto& text = string_data.data(i);
-                ref_strings[i] = spillover->WriteAndEncode(text);
-            }
-
-            auto* vec_base = insert_record_.get_data_base(field_id);
-            auto* string_vec =
-                dynamic_cast<ConcurrentVector<std::string>*>(vec_base);
-            AssertInfo(string_vec != nullptr,
-                       "TEXT field must use ConcurrentVector<std::string>");
-            string_vec->set_data_raw(
-                reserved_offset, ref_strings.data(), num_rows);
-        } else {
-            insert_record_.get_data_base(field_id)->set_data_raw(
-                reserved_offset,
-                num_rows,
-                &insert_record_proto->fields_data(data_offset),
-                field_meta);
+        auto& fields = field_meta.get_data_type() == DataType::GEOMETRY
+                           ? geometry_fields
+                           : insert_fields;
+        fields.emplace_back(
+            field_id,
+            &insert_record_proto->fields_data(field_id_to_offset[field_id]));
+    }
+    auto insert_field = [&](const std::pair<FieldId, const DataArray*>& f) {
+        InsertField(f.first, f.second, reserved_offset, num_rows);
+    };
+    if (insert_fields.size() < kParallelInsertMinFields ||
+        num_rows < kParallelInsertMinRows) {
+        std::for_each(insert_fields.begin(), insert_fields.end(), insert_field);
+        std::for_each(
+            geometry_fields.begin(), geometry_fields.end(), insert_field);
+    } else {
+        // Fields are dealt round-robin so that large vector and JSON fields,
+        // usually declared together, spread across the tasks.
+        auto num_tasks = std::min(insert_fields.size(), kMaxInsertTasks);
+        auto& pool =
+            ThreadPools::GetThreadPool(milvus::ThreadPoolPriority::MIDDLE);
+        std::vector<std::future<void>> futures;
+        futures.reserve(num_tasks);
+        for (size_t task = 0; task < num_tasks; ++task) {
+            futures.emplace_back(pool.Submit([&, task]() {
+                for (auto i = task; i < insert_fields.size(); i += num_tasks) {
+                    insert_field(insert_fields[i]);
+                }
+            }));
         }
-
-        //insert vector data into index
-        if (segcore_config_.get_enable_interim_segment_index()) {
-            indexing_record_.AppendingIndex(
-                reserved_offset,
-                num_rows,
-                field_id,
-                &insert_record_proto->fields_data(data_offset),
-                insert_record_,
-                field_meta);
+        std::exception_ptr insert_exception;
+        try {
+            std::for_each(
+                geometry_fields.begin(), geometry_fields.end(), insert_field);
+        } catch (...) {
+            insert_exception = std::current_exception();
         }
-
-        // update ArrayOffsetsGrowing for struct fields
-        if (struct_representative_fields_.count(field_id) > 0) {
-            const auto& field_data =
-                insert_record_proto->fields_data(data_offset);
-
-            std::vector<int32_t> array_lengths(num_rows);
-            ExtractArrayLengths(
-                field_data, field_meta, num_rows, array_lengths.data());
-
-            auto offsets_it = array_offsets_map_.find(field_id);
-            if (offsets_it != array_offsets_map_.end()) {
-                offsets_it->second->Insert(
-                    reserved_offset, array_lengths.data(), num_rows);
+        // join all tasks before the rows are acked, even if one failed
+        for (auto& future : futures) {
+            try {
+                future.get();
+            } catch (...) {
+                if (!insert_exception) {
+                    insert_exception = std::current_exception();
+                }
             }
         }
-
-        // index text.
-        if (field_meta.enable_match()) {
-            // TODO: iterate texts and call `AddText` instead of `AddTexts`. This may cost much more memory.
-            std::vector<std::string> texts(
-                insert_record_proto->fields_data(data_offset)
-                    .scalars()
-                    .string_data()
-                    .data()
-                    .begin(),
-                insert_record_proto->fields_data(data_offset)
-                    .scalars()
-                    .string_data()
-                    .data()
-                    .end());
-            FixedVector<bool> texts_valid_data(
-                insert_record_proto->fields_data(data_offset)
-                    .valid_data()
-                    .begin(),
-                insert_record_proto->fields_data(data_offset)
-                    .valid_data()
-                    .end());
-            AddTexts(field_id,
-                     texts.data(),
-                     texts_valid_data.data(),
-                     num_rows,
-                     reserved_offset);
-        }
-
-        // update average row data size
-        auto field_data_size = GetRawDataSizeOfDataArray(
-            &insert_record_proto->fields_data(data_offset),
-            field_meta,
-            num_rows);
-        if (IsVariableDataType(field_meta.get_data_type())) {
-            SegmentInternalInterface::set_field_avg_size(
-                field_id, num_rows, field_data_size);
-        }
-
-        // Build geometry cache for GEOMETRY fields
-        if (field_meta.get_data_type() == DataType::GEOMETRY &&
-            segcore_config_.get_enable_geometry_cache()) {
-            BuildGeometryCacheForInsert(
-                field_id,
-                &insert_record_proto->fields_data(data_offset),
-                num_rows);
+        if (insert_exception) {
+            std::rethrow_exception(insert_exception);
         }
-
-        stats_.mem_size += field_data_size;
-
-        try_remove_chunks(field_id);
     }
 
-    // step 4: set pks to offset
+    // step 5: set pks to offset
     auto field_id = schema_->get_primary_field_id().value_or(FieldId(-1));
     AssertInfo(field_id.get() != INVALID_FIELD_ID, "Primary key is -1");
     std::vector<PkType> pks(num_rows);
@@ -841,12 +980,13 @@ SegmentGrowingImpl::Insert(int64_t reserved_offset,
         insert_record_.insert_pk(pks[i], reserved_offset + i);
     }
 
-    // step 5: update the resource usage
+    // step 6: update the resource usage
     UpdateResourceTracking();
 
-    // step 6: update small indexes
+    // step 7: update small indexes
     insert_record_.ack_responder_.AddSegment(reserved_offset,
                                              reserved_offset + num_rows);
+    ScheduleIndexMaintenance();
 }
 
 void
@@ -940,6 +1080,7 @@ SegmentGrowingImpl::load_field_data_internal(const LoadFieldDataInfo& infos) {
     // step 5: update small indexes
     insert_record_.ack_responder_.AddSegment(reserved_offset,
                                              reserved_offset + num_rows);
+    ScheduleIndexMaintenance();
 }
 
 void
@@ -981,7 +1122,8 @@ SegmentGrowingImpl::load_field_data_common(
     }
     insert_record_.get_data_base(field_id)->set_data_raw(reserved_offset,
                                                          field_data);
-    if (segcore_config_.get_enable_interim_segment_index()) {
+    if (segcore_config_.get_enable_interim_segment_index() &&
+        !indexing_record_.is_async(field_id)) {
         auto offset = reserved_offset;
         for (auto& data : field_data) {
             auto row_count = data->get_num_rows();
@@ -1216,6 +1358,7 @@ SegmentGrowingImpl::load_column_group_data_internal(
     // step 5: update small indexes
     insert_record_.ack_responder_.AddSegment(reserved_offset,
                                              reserved_offset + num_rows);
+    ScheduleIndexMaintenance();
 }
 
 SegcoreError
@@ -1570,9 +1713,9 @@ SegmentGrowingImpl::bulk_subscript_text_impl(FieldId field_id,
     }
 
     if (!spillover_refs.empty()) {
-        auto texts = spillover->DecodeAndReadBatch(spillover_refs);
+        auto batch = spillover->ReadBatch(spillover_refs);
         for (size_t j = 0; j < spillover_indices.size(); ++j) {
-            set_output(spillover_indices[j], std::move(texts[j]));
+            set_output(spillover_indices[j], std::string(batch.texts[j]));
         }
     }
 
@@ -2392,7 +2535,9 @@ SegmentGrowingImpl::CreateTextIndex(FieldId field_id,
         unique_id.c_str(),
         "milvus_tokenizer",
         field_meta.get_analyzer_params().c_str(),
-        /*enable_background_merge=*/true);
+        /*enable_background_merge=*/true,
+        segcore_config_.get_text_match_delta_commit_interval_ms(),
+        segcore_config_.get_text_match_delta_max_byte_size());
     index->Commit();
     index->CreateReader(milvus::index::SetBitsetGrowing);
     index->RegisterAnalyzer("milvus_tokenizer",
@@ -2423,7 +2568,11 @@ SegmentGrowingImpl::InitializeTextLobSpillovers() {
     for (auto& [field_id, field_meta] : schema_->get_fields()) {
         if (field_meta.get_data_type() == DataType::TEXT) {
             text_lob_spillovers_[field_id] =
-                std::make_unique<TextLobSpillover>(id_, field_id, base_path);
+                std::make_unique<TextLobSpillover>(
+                    id_,
+                    field_id,
+                    base_path,
+                    segcore_config_.get_enable_text_lob_compression());
             LOG_INFO("Created TEXT LOB spillover for segment {} field {} at {}",
                      id_,
                      field_id.get(),
@@ -2779,6 +2928,7 @@ SegmentGrowingImpl::LoadColumnsGroups(std::string manifest_path) {
 
     insert_record_.ack_responder_.AddSegment(reserved_offset,
                                              reserved_offset + num_rows);
+    ScheduleIndexMaintenance();
 }
 
 std::unordered_map<FieldId, std::vector<FieldDataPtr>>
@@ -13,6 +13,8 @@
 
 #include <algorithm>
 #include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <cstddef>
 #include <cstdint>
 #include <functional>
@@ -72,6 +74,7 @@
 #include "pb/schema.pb.h"
 #include "pb/segcore.pb.h"
 #include "query/PlanImpl.h"
+#include "query/SearchIteratorSession.h"
 #include "segcore/SegcoreConfig.h"
 #include "segcore/SegmentInterface.h"
 #include "storage/MmapChunkManager.h"
@@ -203,6 +206,12 @@ class SegmentGrowingImpl : public SegmentGrowing {
         return indexing_record_;
     }
 
+    // Waits for the running async interim index maintenance task, if any.
+    // Rows acknowledged before the call are indexed once it returns, unless
+    // the task failed.
+    void
+    WaitForIndexMaintenance();
+
     Timestamp
     get_max_timestamp() const override {
         return insert_record_.timestamp_index_.get_max_timestamp();
@@ -264,6 +273,28 @@ class SegmentGrowingImpl : public SegmentGrowing {
     void
     try_remove_chunks(FieldId fieldId);
 
+    // Copies one field of an insert into insert_record_ and updates the
+    // indexes maintained on the insert path. Fields may be inserted
+    // concurrently.
+    void
+    InsertField(FieldId field_id,
+                const DataArray* field_data,
+                int64_t reserved_offset,
+                int64_t num_rows);
+
+    // Starts a background task that catches the async interim indexes (see
+    // IndexingRecord::is_async) up with the acknowledged rows, unless one is
+    // already running or the last one failed less than a backoff ago.
+    void
+    ScheduleIndexMaintenance();
+
+    void
+    MaintainIndexes();
+
+    // Waits for the running maintenance task and disables new ones.
+    void
+    StopIndexMaintenance();
+
     void
     search_batch_pks(
         const std::vector<PkType>& pks,
@@ -452,6 +483,10 @@ class SegmentGrowingImpl : public SegmentGrowing {
     }
 
     ~SegmentGrowingImpl() {
+        StopIndexMaintenance();
+        // session iterators read the vector chunks of this segment
+        query::SearchIteratorSessions::GetInstance().DropSegment(id_);
+
         // Clean up geometry cache for all fields in this segment
         auto& cache_manager =
             milvus::exec::SimpleGeometryCacheManager::Instance();
@@ -848,6 +883,18 @@ class SegmentGrowingImpl : public SegmentGrowing {
     // small indexes for every chunk
     IndexingRecord indexing_record_;
 
+    // background maintenance of the async interim indexes, at most one task
+    // per segment
+    std::mutex index_maintenance_mutex_;
+    std::condition_variable index_maintenance_cv_;
+    bool index_maintenance_running_ = false;
+    bool index_maintenance_stopped_ = false;
+    // rows all async indexes caught up with, only touched by the running task
+    int64_t index_maintained_ack_ = 0;
+    // consecutive failed rounds, no round is scheduled before retry_at
+    int index_maintenance_failures_ = 0;
+    std::chrono::steady_clock::time_point index_maintenance_retry_at_{};
+
     // deleted pks
     mutable DeletedRecord<false> deleted_record_;
 
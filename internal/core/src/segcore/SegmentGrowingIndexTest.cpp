@@ -748,3 +748,81 @@ TEST_P(GrowingIndexTest, GetVector) {
         }
     }
 }
+
+TEST(GrowingIndexAsyncTest, SearchesIndexAndUnindexedTail) {
+    constexpr int64_t dim = 4;
+    auto schema = std::make_shared<Schema>();
+    auto pk = schema->AddDebugField("pk", DataType::INT64);
+    auto vec = schema->AddDebugField(
+        "embeddings", DataType::VECTOR_FLOAT, dim, knowhere::metric::L2);
+    schema->set_primary_field_id(pk);
+
+    std::map<std::string, std::string> index_params = {
+        {"index_type", knowhere::IndexEnum::INDEX_FAISS_IVFFLAT},
+        {"metric_type", knowhere::metric::L2},
+        {"nlist", "128"}};
+    std::map<std::string, std::string> type_params = {
+        {"dim", std::to_string(dim)}};
+    FieldIndexMeta field_index_meta(
+        vec, std::move(index_params), std::move(type_params));
+
+    auto& config = SegcoreConfig::default_config();
+    ScopedSegcoreConfigRestore config_restore(config);
+    InterimIndexConfigForTest interim_config;
+    interim_config.chunk_rows = 1024;
+    ApplyInterimIndexConfigForTest(interim_config, config);
+    config.set_enable_async_interim_index(true);
+
+    std::map<FieldId, FieldIndexMeta> field_map = {{vec, field_index_meta}};
+    IndexMetaPtr meta =
+        std::make_shared<CollectionIndexMeta>(100000, std::move(field_map));
+    auto segment = CreateGrowingSegment(schema, meta);
+    auto segment_impl = dynamic_cast<SegmentGrowingImpl*>(segment.get());
+    auto& indexing_record = segment_impl->get_indexing_record();
+    ASSERT_TRUE(indexing_record.is_async(vec));
+    EXPECT_FALSE(indexing_record.SyncDataWithIndex(vec));
+
+    auto insert = [&](int64_t rows, uint64_t seed) {
+        auto dataset = DataGen(schema, rows, seed);
+        auto offset = segment->PreInsert(rows);
+        segment->Insert(offset,
+                        rows,
+                        dataset.row_ids_.data(),
+                        dataset.timestamps_.data(),
+                        dataset.raw_);
+        return dataset;
+    };
+
+    int64_t indexed_rows = 30000;
+    insert(indexed_rows, 42);
+    // the insert scheduled the maintenance task before returning
+    segment_impl->WaitForIndexMaintenance();
+    ASSERT_EQ(indexing_record.get_indexed_count(vec), indexed_rows);
+    // raw data stays for the rows the index hasn't caught up with yet
+    auto field_data =
+        segment_impl->get_insert_record().get_data<milvus::FloatVector>(vec);
+    EXPECT_EQ(field_data->num_chunk(),
+              upper_div(indexed_rows, field_data->get_size_per_chunk()));
+
+    // rows the index may not hold yet are brute forced
+    auto tail = insert(1000, 43);
+    auto tail_vectors = tail.get_col<float>(vec);
+    std::vector<float> query(tail_vectors.begin() + 500 * dim,
+                             tail_vectors.begin() + 501 * dim);
+
+    milvus::segcore::ScopedSchemaHandle schema_handle(*schema);
+    auto plan_str = schema_handle.ParseSearch(
+        "", "embeddings", 5, knowhere::metric::L2, R"({"nprobe": 16})", -1);
+    auto plan =
+        query::CreateSearchPlanByExpr(schema, plan_str.data(), plan_str.size());
+    auto ph_group_raw = CreatePlaceholderGroupFromBlob(1, dim, query.data());
+    auto ph_group =
+        ParsePlaceholderGroup(plan.get(), ph_group_raw.SerializeAsString());
+    auto result = segment->Search(plan.get(), ph_group.get(), 1000000);
+    ASSERT_EQ(result->seg_offsets_.size(), 5);
+    EXPECT_EQ(result->seg_offsets_[0], indexed_rows + 500);
+    EXPECT_FLOAT_EQ(result->distances_[0], 0.0f);
+    for (int i = 1; i < 5; ++i) {
+        EXPECT_LE(result->distances_[i - 1], result->distances_[i]);
+    }
+}
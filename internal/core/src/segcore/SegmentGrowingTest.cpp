@@ -10,6 +10,7 @@
 // or implied. See the License for the specific language governing permissions and limitations under the License
 
 #include <folly/FBVector.h>
+#include <folly/ScopeGuard.h>
 #include <gtest/gtest.h>
 #include <nlohmann/json.hpp>
 #include <stddef.h>
@@ -34,6 +35,7 @@
 #include "cachinglayer/Utils.h"
 #include "common/Consts.h"
 #include "common/EasyAssert.h"
+#include "common/GeometryCache.h"
 #include "common/IndexMeta.h"
 #include "common/QueryResult.h"
 #include "common/Schema.h"
@@ -310,6 +312,96 @@ TEST(Growing, InsertSkipsMissingFunctionOutputField) {
     EXPECT_FALSE(segment->FieldAccessible(sparse));
 }
 
+TEST(Growing, WideInsertCopiesFieldsInParallel) {
+    auto schema = std::make_shared<Schema>();
+    auto pk = schema->AddDebugField("pk", DataType::INT64);
+    schema->set_primary_field_id(pk);
+    std::vector<FieldId> int_fields;
+    std::vector<FieldId> str_fields;
+    for (int i = 0; i < 8; ++i) {
+        int_fields.push_back(schema->AddDebugField(
+            "int64_" + std::to_string(i), DataType::INT64));
+        str_fields.push_back(schema->AddDebugField(
+            "varchar_" + std::to_string(i), DataType::VARCHAR));
+    }
+    schema->AddDebugField(
+        "embeddings", DataType::VECTOR_FLOAT, 16, knowhere::metric::L2);
+
+    auto segment = CreateGrowingSegment(schema, empty_index_meta);
+    // enough fields and rows for Insert to copy the fields in parallel
+    constexpr int64_t row_count = 4096;
+    auto dataset = DataGen(schema, row_count);
+    segment->PreInsert(row_count);
+    segment->Insert(0,
+                    row_count,
+                    dataset.row_ids_.data(),
+                    dataset.timestamps_.data(),
+                    dataset.raw_);
+    ASSERT_EQ(segment->get_row_count(), row_count);
+
+    std::vector<int64_t> offsets(row_count);
+    std::iota(offsets.begin(), offsets.end(), 0);
+    for (auto field_id : int_fields) {
+        auto expected = dataset.get_col<int64_t>(field_id);
+        auto result = segment->bulk_subscript(
+            nullptr, field_id, offsets.data(), row_count);
+        const auto& data = result->scalars().long_data().data();
+        ASSERT_EQ(data.size(), row_count);
+        EXPECT_TRUE(std::equal(data.begin(), data.end(), expected.begin()));
+    }
+    for (auto field_id : str_fields) {
+        auto expected = dataset.get_col<std::string>(field_id);
+        auto result = segment->bulk_subscript(
+            nullptr, field_id, offsets.data(), row_count);
+        const auto& data = result->scalars().string_data().data();
+        ASSERT_EQ(data.size(), row_count);
+        EXPECT_TRUE(std::equal(data.begin(), data.end(), expected.begin()));
+    }
+}
+
+TEST(Growing, WideInsertKeepsGeometryFieldsOnCallingThread) {
+    auto schema = std::make_shared<Schema>();
+    auto pk = schema->AddDebugField("pk", DataType::INT64);
+    schema->set_primary_field_id(pk);
+    std::vector<FieldId> geometry_fields;
+    for (int i = 0; i < 4; ++i) {
+        schema->AddDebugField("int64_" + std::to_string(i), DataType::INT64);
+        geometry_fields.push_back(schema->AddDebugField(
+            "geometry_" + std::to_string(i), DataType::GEOMETRY));
+    }
+    schema->AddDebugField(
+        "embeddings", DataType::VECTOR_FLOAT, 16, knowhere::metric::L2);
+
+    // the geometry caches parse with the segment's GEOS context
+    auto& config = SegcoreConfig::default_config();
+    config.set_enable_geometry_cache(true);
+    auto restore = folly::makeGuard(
+        [&config]() { config.set_enable_geometry_cache(false); });
+    auto segment = CreateGrowingSegment(schema, empty_index_meta);
+    constexpr int64_t row_count = 4096;
+    auto dataset = DataGen(schema, row_count);
+    segment->PreInsert(row_count);
+    segment->Insert(0,
+                    row_count,
+                    dataset.row_ids_.data(),
+                    dataset.timestamps_.data(),
+                    dataset.raw_);
+    ASSERT_EQ(segment->get_row_count(), row_count);
+
+    auto& caches = exec::SimpleGeometryCacheManager::Instance();
+    for (auto field_id : geometry_fields) {
+        auto expected = dataset.get_col<std::string>(field_id);
+        auto cache = caches.GetCache(segment->get_segment_id(), field_id);
+        ASSERT_NE(cache, nullptr);
+        ASSERT_EQ(cache->Size(), row_count);
+        for (int64_t i = 0; i < row_count; i += 97) {
+            auto geometry = cache->GetByOffset(i);
+            ASSERT_NE(geometry, nullptr);
+            EXPECT_EQ(geometry->to_wkb_string(), expected[i]);
+        }
+    }
+}
+
 TEST(Growing, MissingStructArrayOffsetsReturnsEmptyForOldRows) {
     auto old_schema = std::make_shared<Schema>();
     old_schema->set_schema_version(1);
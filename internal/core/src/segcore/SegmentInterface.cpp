@@ -11,6 +11,7 @@
 
 #include "SegmentInterface.h"
 
+#include <arrow/record_batch.h>
 #include <folly/ExceptionWrapper.h>
 #include <algorithm>
 #include <chrono>
@@ -37,6 +38,7 @@
 #include "expr/ITypeExpr.h"
 #include "fmt/core.h"
 #include "futures/Future.h"
+#include "log/Log.h"
 #include "monitor/Monitor.h"
 #include "pb/schema.pb.h"
 #include "plan/PlanNode.h"
@@ -45,10 +47,19 @@
 #include "query/ExecPlanNodeVisitor.h"
 #include "query/PlanImpl.h"
 #include "query/PlanNode.h"
+#include "segcore/ArrowExportUtils.h"
 #include "segcore/ConcurrentVector.h"
+#include "segcore/RetrieveArrowExporter.h"
 
 namespace milvus::segcore {
 
+namespace {
+// Output fields are fetched concurrently on the search executor once a fill
+// covers at least this many rows; below it the fan-out costs more than it
+// saves.
+constexpr int64_t kParallelFillMinRows = 1024;
+}  // namespace
+
 void
 SegmentInternalInterface::FillPrimaryKeys(const query::Plan* plan,
                                           SearchResult& results,
@@ -107,7 +118,7 @@ SegmentInternalInterface::FillTargetEntry(const query::Plan* plan,
         local_ctx.runtime_load_priority = op_ctx->runtime_load_priority;
     }
     // fill other entries except primary key by result_offset
-    for (auto field_id : plan->target_entries_) {
+    auto fetch = [&](FieldId field_id) -> std::unique_ptr<DataArray> {
         segcore::CheckCancellation(
             op_ctx, get_segment_id(), field_id.get(), "FillTargetEntry");
         auto& field_meta = plan->schema_->operator[](field_id);
@@ -115,18 +126,39 @@ SegmentInternalInterface::FillTargetEntry(const query::Plan* plan,
             plan->schema_->get_dynamic_field_id().value() == field_id &&
             !plan->target_dynamic_fields_.empty()) {
             auto& target_dynamic_fields = plan->target_dynamic_fields_;
-            field_data = bulk_subscript(&local_ctx,
-                                        field_id,
-                                        results.seg_offsets_.data(),
-                                        size,
-                                        target_dynamic_fields);
-        } else if (!is_field_exist(field_id)) {
-            field_data = bulk_subscript_not_exist_field(field_meta, size);
-        } else {
-            field_data = bulk_subscript(
-                &local_ctx, field_id, results.seg_offsets_.data(), size);
+            return bulk_subscript(&local_ctx,
+                                  field_id,
+                                  results.seg_offsets_.data(),
+                                  size,
+                                  target_dynamic_fields);
+        }
+        if (!is_field_exist(field_id)) {
+            return bulk_subscript_not_exist_field(field_meta, size);
+        }
+        return bulk_subscript(
+            &local_ctx, field_id, results.seg_offsets_.data(), size);
+    };
+    auto& target_entries = plan->target_entries_;
+    if (auto* chunked = dynamic_cast<const ChunkedSegmentSealedImpl*>(this)) {
+        chunked->RecordOutputCells(plan->access_entries_,
+                                   target_entries,
+                                   results.seg_offsets_.data(),
+                                   size);
+    }
+    if (target_entries.size() > 1 && size >= kParallelFillMinRows) {
+        std::vector<std::unique_ptr<DataArray>> columns(target_entries.size());
+        ParallelForOnSearchExecutor(
+            target_entries.size(),
+            [&](int64_t i) { columns[i] = fetch(target_entries[i]); });
+        for (size_t i = 0; i < target_entries.size(); ++i) {
+            results.output_fields_data_[target_entries[i]] =
+                std::move(columns[i]);
+        }
+    } else {
+        for (auto field_id : target_entries) {
+            field_data = fetch(field_id);
+            results.output_fields_data_[field_id] = std::move(field_data);
         }
-        results.output_fields_data_[field_id] = std::move(field_data);
     }
     results.search_storage_cost_.scanned_remote_bytes +=
         local_ctx.storage_usage.scanned_cold_bytes.load();
@@ -150,6 +182,9 @@ SegmentInternalInterface::Search(
     milvus::tracer::AddEvent("obtained_segment_lock_mutex");
 
     check_search(plan);
+    if (auto* chunked = dynamic_cast<const ChunkedSegmentSealedImpl*>(this)) {
+        chunked->PrefetchPredictedCells(plan->access_entries_);
+    }
     query::ExecPlanNodeVisitor visitor(*this,
                                        timestamp,
                                        placeholder_group,
@@ -163,6 +198,9 @@ SegmentInternalInterface::Search(
     auto results = std::make_unique<SearchResult>();
     *results = visitor.get_moved_result(*plan->plan_node_);
     results->segment_ = (void*)this;
+    if (results->query_profile_.has_value()) {
+        results->query_profile_->segment_id = get_segment_id();
+    }
     return results;
 }
 
@@ -212,6 +250,9 @@ SegmentInternalInterface::Retrieve(tracer::TraceContext* trace_ctx,
     std::shared_lock lck(mutex_);
     tracer::AutoSpan span("Retrieve", tracer::GetRootSpan(), true);
     auto results = std::make_unique<proto::segcore::RetrieveResults>();
+    if (auto* chunked = dynamic_cast<const ChunkedSegmentSealedImpl*>(this)) {
+        chunked->PrefetchPredictedCells(plan->access_entries_);
+    }
     query::ExecPlanNodeVisitor visitor(*this,
                                        timestamp,
                                        cancel_token,
@@ -219,6 +260,15 @@ SegmentInternalInterface::Retrieve(tracer::TraceContext* trace_ctx,
                                        collection_ttl,
                                        entity_ttl_physical_time_us);
     auto retrieve_results = visitor.get_retrieve_result(*plan->plan_node_);
+    if (retrieve_results.query_profile_.has_value()) {
+        retrieve_results.query_profile_->segment_id = get_segment_id();
+        auto profile = retrieve_results.query_profile_->ToJson();
+        span.GetSpan()->SetAttribute("query_profile", profile);
+        results->add_query_profiles(std::move(profile));
+        LOG_DEBUG("retrieve profile of segment {}:\n{}",
+                  get_segment_id(),
+                  retrieve_results.query_profile_->ToString());
+    }
 
     retrieve_results.segment_ = (void*)this;
     results->set_has_more_result(retrieve_results.has_more_result);
@@ -294,6 +344,89 @@ SegmentInternalInterface::Retrieve(tracer::TraceContext* trace_ctx,
     return results;
 }
 
+std::shared_ptr<arrow::RecordBatchReader>
+SegmentInternalInterface::RetrieveAsArrow(
+    tracer::TraceContext* trace_ctx,
+    const query::RetrievePlan* plan,
+    Timestamp timestamp,
+    int64_t limit_size,
+    int64_t max_batch_rows,
+    const folly::CancellationToken& cancel_token,
+    int32_t consistency_level,
+    Timestamp collection_ttl,
+    int64_t entity_ttl_physical_time_us) const {
+    if (plan->schema_->get_dynamic_field_id().has_value() &&
+        !plan->target_dynamic_fields_.empty()) {
+        ThrowInfo(ErrorCode::Unsupported,
+                  "arrow retrieve does not support dynamic field subsets");
+    }
+    for (auto field_id : plan->field_ids_) {
+        if (SystemProperty::Instance().IsSystem(field_id)) {
+            continue;
+        }
+        auto data_type = plan->schema_->operator[](field_id).get_data_type();
+        if (!RetrieveArrowExporter::IsSupported(data_type) ||
+            !is_field_exist(field_id) || !HasRawData(field_id.get())) {
+            ThrowInfo(ErrorCode::Unsupported,
+                      "arrow retrieve does not support field {} of type {}",
+                      field_id.get(),
+                      data_type);
+        }
+    }
+
+    std::shared_lock lck(mutex_);
+    tracer::AutoSpan span("RetrieveAsArrow", tracer::GetRootSpan(), true);
+    query::ExecPlanNodeVisitor visitor(*this,
+                                       timestamp,
+                                       cancel_token,
+                                       consistency_level,
+                                       collection_ttl,
+                                       entity_ttl_physical_time_us);
+    auto retrieve_results = visitor.get_retrieve_result(*plan->plan_node_);
+    if (!retrieve_results.field_data_.empty() ||
+        retrieve_results.element_level_) {
+        ThrowInfo(ErrorCode::Unsupported,
+                  "arrow retrieve does not support columnar or element "
+                  "level results");
+    }
+
+    auto result_rows = GetResultRowCount(retrieve_results);
+    int64_t output_data_size = 0;
+    for (auto field_id : plan->field_ids_) {
+        output_data_size += get_field_avg_size(field_id) * result_rows;
+    }
+    if (output_data_size > limit_size) {
+        ThrowInfo(
+            RetrieveError,
+            fmt::format("query results exceed the limit size {}", limit_size));
+    }
+
+    milvus::OpContext op_ctx;
+    op_ctx.cancellation_token = cancel_token;
+    RetrieveArrowExporter exporter(
+        *this, plan->schema_, plan->field_ids_, &op_ctx, max_batch_rows);
+    auto batches =
+        exporter.Export(std::move(retrieve_results.result_offsets_));
+    milvus::futures::throwIfCancelled(cancel_token);
+
+    auto schema = exporter.schema()->WithMetadata(arrow::key_value_metadata(
+        {kAllRetrieveCountMetadataKey, kHasMoreResultMetadataKey},
+        {std::to_string(retrieve_results.total_data_cnt_),
+         retrieve_results.has_more_result ? "true" : "false"}));
+    LOG_DEBUG(
+        "segment {} retrieved {} rows as {} arrow batches, {} zero-copy "
+        "columns",
+        get_segment_id(),
+        result_rows,
+        batches.size(),
+        exporter.zero_copy_arrays());
+    auto reader = arrow::RecordBatchReader::Make(std::move(batches), schema);
+    AssertInfo(reader.ok(),
+               "failed to create arrow reader: {}",
+               reader.status().ToString());
+    return std::move(reader).ValueUnsafe();
+}
+
 void
 SegmentInternalInterface::FillTargetEntryDirectly(
     tracer::TraceContext* trace_ctx,
@@ -496,6 +629,10 @@ SegmentInternalInterface::FillTargetEntry(
     // Use dynamic_cast to avoid adding new virtual methods (vtable layout
     // change causes SIGSEGV in cgo boundary).
     if (auto* chunked = dynamic_cast<const ChunkedSegmentSealedImpl*>(this)) {
+        if (!ignore_non_pk) {
+            chunked->RecordOutputCells(
+                plan->access_entries_, plan->field_ids_, offsets, size);
+        }
         if (chunked->TryTakeForRetrieve(plan,
                                         results,
                                         offsets,
@@ -524,7 +661,38 @@ SegmentInternalInterface::FillTargetEntry(
         local_ctx.cancellation_token = op_ctx->cancellation_token;
         local_ctx.runtime_load_priority = op_ctx->runtime_load_priority;
     }
-    for (auto field_id : plan->field_ids_) {
+    auto is_dynamic_subset = [&](const FieldId& field_id) -> bool {
+        return plan->schema_->get_dynamic_field_id().has_value() &&
+               plan->schema_->get_dynamic_field_id().value() == field_id &&
+               !plan->target_dynamic_fields_.empty();
+    };
+
+    // Fetch the plain output columns concurrently up front; the loop below
+    // then only assembles them in plan order.
+    auto& field_ids = plan->field_ids_;
+    std::vector<std::unique_ptr<DataArray>> fetched(field_ids.size());
+    std::vector<int64_t> to_fetch;
+    if (size >= kParallelFillMinRows) {
+        for (size_t i = 0; i < field_ids.size(); ++i) {
+            auto field_id = field_ids[i];
+            if (SystemProperty::Instance().IsSystem(field_id) ||
+                (ignore_non_pk && !is_pk_field(field_id)) ||
+                is_dynamic_subset(field_id) || !is_field_exist(field_id)) {
+                continue;
+            }
+            to_fetch.push_back(i);
+        }
+    }
+    if (to_fetch.size() > 1) {
+        ParallelForOnSearchExecutor(to_fetch.size(), [&](int64_t i) {
+            auto idx = to_fetch[i];
+            fetched[idx] =
+                bulk_subscript(&local_ctx, field_ids[idx], offsets, size);
+        });
+    }
+
+    for (size_t i = 0; i < field_ids.size(); ++i) {
+        auto field_id = field_ids[i];
         if (SystemProperty::Instance().IsSystem(field_id)) {
             auto system_type =
                 SystemProperty::Instance().GetSystemFieldType(field_id);
@@ -549,9 +717,7 @@ SegmentInternalInterface::FillTargetEntry(
             continue;
         }
 
-        if (plan->schema_->get_dynamic_field_id().has_value() &&
-            plan->schema_->get_dynamic_field_id().value() == field_id &&
-            !plan->target_dynamic_fields_.empty()) {
+        if (is_dynamic_subset(field_id)) {
             auto& target_dynamic_fields = plan->target_dynamic_fields_;
             auto col = bulk_subscript(
                 &local_ctx, field_id, offsets, size, target_dynamic_fields);
@@ -560,7 +726,9 @@ SegmentInternalInterface::FillTargetEntry(
         }
         std::unique_ptr<DataArray> col;
         auto& field_meta = plan->schema_->operator[](field_id);
-        if (!is_field_exist(field_id)) {
+        if (fetched[i] != nullptr) {
+            col = std::move(fetched[i]);
+        } else if (!is_field_exist(field_id)) {
             col = bulk_subscript_not_exist_field(field_meta, size);
         } else {
             col = bulk_subscript(&local_ctx, field_id, offsets, size);
@@ -68,6 +68,10 @@
 #include "segcore/ConcurrentVector.h"
 #include "segcore/InsertRecord.h"
 
+namespace arrow {
+class RecordBatchReader;
+}  // namespace arrow
+
 namespace milvus::segcore {
 
 using namespace milvus::cachinglayer;
@@ -528,6 +532,23 @@ class SegmentInternalInterface : public SegmentInterface {
              int64_t size,
              const folly::CancellationToken& cancel_token) const override;
 
+    // Retrieve straight into Arrow record batches read from chunk memory,
+    // skipping the DataArray protos. The schema metadata carries
+    // all_retrieve_count and has_more_result. Throws Unsupported for plans
+    // producing columnar or element-level results, dynamic field subsets
+    // and fields RetrieveArrowExporter can not read; callers fall back to
+    // Retrieve. Not virtual on purpose, see FillTargetEntry.
+    std::shared_ptr<arrow::RecordBatchReader>
+    RetrieveAsArrow(tracer::TraceContext* trace_ctx,
+                    const query::RetrievePlan* plan,
+                    Timestamp timestamp,
+                    int64_t limit_size,
+                    int64_t max_batch_rows,
+                    const folly::CancellationToken& cancel_token,
+                    int32_t consistency_level,
+                    Timestamp collection_ttl,
+                    int64_t entity_ttl_physical_time_us = 0) const;
+
     virtual bool
     HasIndex(FieldId field_id) const = 0;
 
@@ -587,6 +608,15 @@ class SegmentInternalInterface : public SegmentInterface {
             get_segment_id(), field_id, data_type, statistics);
     }
 
+    void
+    LoadSkipIndexFromMetrics(
+        FieldId field_id,
+        DataType data_type,
+        std::vector<std::unique_ptr<index::FieldChunkMetrics>> metrics) {
+        skip_index_.LoadSkipFromMetrics(
+            get_segment_id(), field_id, data_type, std::move(metrics));
+    }
+
     virtual DataType
     GetFieldDataType(FieldId fieldId) const = 0;
 
@@ -27,6 +27,7 @@
 #include "pb/schema.pb.h"
 #include "segcore/SegcoreConfig.h"
 #include "segcore/SegmentLoadInfo.h"
+#include "segcore/default_fs.h"
 #include "storage/LocalChunkManager.h"
 #include "storage/LocalChunkManagerSingleton.h"
 #include "storage/MmapManager.h"
@@ -55,6 +56,29 @@ SegmentLoadInfo::GetColumnGroups() const {
     return column_groups_;
 }
 
+void
+SegmentLoadInfo::LoadSealedSidecars() const {
+    auto manifest_path = GetManifestPath();
+    if (manifest_path.empty() || sealed_sidecars_ != nullptr) {
+        return;
+    }
+    try {
+        auto properties =
+            milvus::storage::LoonFFIPropertiesSingleton::GetInstance()
+                .GetProperties();
+        auto loon_manifest = ::GetLoonManifest(manifest_path, properties);
+        sealed_sidecars_ = std::make_shared<const SealedSidecars>(
+            SealedSidecars::Load(*loon_manifest,
+                                 GetDefaultArrowFileSystem(),
+                                 GetNumOfRows()));
+    } catch (const std::exception& e) {
+        LOG_WARN("failed to load sidecars of segment {}, ignoring them: {}",
+                 GetSegmentID(),
+                 e.what());
+        sealed_sidecars_ = std::make_shared<const SealedSidecars>();
+    }
+}
+
 // Looks up a storage column in the cached manifest column groups only.
 bool
 SegmentLoadInfo::HasManifestColumn(const std::string& column_name) const {
@@ -36,6 +36,7 @@
 #include "pb/common.pb.h"
 #include "pb/index_cgo_msg.pb.h"
 #include "pb/segcore.pb.h"
+#include "segcore/SealedSidecar.h"
 #include "segcore/Types.h"
 
 namespace milvus::segcore {
@@ -427,6 +428,7 @@ class SegmentLoadInfo {
           field_index_has_raw_data_(other.field_index_has_raw_data_),
           fields_filled_with_default_(other.fields_filled_with_default_),
           column_groups_(other.column_groups_),
+          sealed_sidecars_(other.sealed_sidecars_),
           created_text_indexes_(other.created_text_indexes_) {
         BuildFieldBinlogCache();
     }
@@ -445,6 +447,7 @@ class SegmentLoadInfo {
               std::move(other.fields_filled_with_default_)),
           field_binlog_cache_(std::move(other.field_binlog_cache_)),
           column_groups_(std::move(other.column_groups_)),
+          sealed_sidecars_(std::move(other.sealed_sidecars_)),
           created_text_indexes_(std::move(other.created_text_indexes_)) {
     }
 
@@ -462,6 +465,7 @@ class SegmentLoadInfo {
             converted_field_index_cache_ = other.converted_field_index_cache_;
             field_index_has_raw_data_ = other.field_index_has_raw_data_;
             column_groups_ = other.column_groups_;
+            sealed_sidecars_ = other.sealed_sidecars_;
             fields_filled_with_default_ = other.fields_filled_with_default_;
             created_text_indexes_ = other.created_text_indexes_;
             BuildFieldBinlogCache();
@@ -486,6 +490,7 @@ class SegmentLoadInfo {
                 std::move(other.fields_filled_with_default_);
             field_binlog_cache_ = std::move(other.field_binlog_cache_);
             column_groups_ = std::move(other.column_groups_);
+            sealed_sidecars_ = std::move(other.sealed_sidecars_);
             created_text_indexes_ = std::move(other.created_text_indexes_);
         }
         return *this;
@@ -797,6 +802,18 @@ class SegmentLoadInfo {
     [[nodiscard]] bool
     HasManifestColumn(const std::string& column_name) const;
 
+    // Reads the zone map and pk order sidecars from the stats of the manifest
+    // and caches them, thread-compatible like GetColumnGroups. The sidecars
+    // only speed up loading, so an unreadable manifest leaves them empty.
+    void
+    LoadSealedSidecars() const;
+
+    // The sidecars cached by LoadSealedSidecars, nullptr before.
+    [[nodiscard]] std::shared_ptr<const SealedSidecars>
+    GetSealedSidecars() const {
+        return sealed_sidecars_;
+    }
+
     // Reuses manifest column groups when another load info points at the same
     // manifest path.
     void
@@ -1203,6 +1220,9 @@ class SegmentLoadInfo {
     // immutable manifest path.
     mutable std::shared_ptr<milvus_storage::api::ColumnGroups> column_groups_;
 
+    // Sidecars of the manifest, cached like column_groups_.
+    mutable std::shared_ptr<const SealedSidecars> sealed_sidecars_;
+
     // Field IDs where text indexes were created from raw data (not loaded from files)
     // These should NOT be re-loaded in diff computation
     std::unordered_set<FieldId> created_text_indexes_;
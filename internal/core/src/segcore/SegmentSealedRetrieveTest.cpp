@@ -11,6 +11,7 @@
 
 #include <folly/FBVector.h>
 #include <gtest/gtest.h>
+#include <nlohmann/json.hpp>
 #include <algorithm>
 #include <cstdint>
 #include <memory>
@@ -582,3 +583,39 @@ TEST_P(RetrieveTest, Delete) {
         }
     }
 }
+
+TEST(Retrieve, QueryProfileReturnedWithResults) {
+    auto schema = std::make_shared<Schema>();
+    auto fid_64 = schema->AddDebugField("i64", DataType::INT64);
+    schema->AddDebugField(
+        "vector_64", DataType::VECTOR_FLOAT, 16, knowhere::metric::L2);
+    schema->set_primary_field_id(fid_64);
+
+    auto dataset = DataGen(schema, 100);
+    auto segment = CreateSealedWithFieldDataLoaded(schema, dataset);
+    auto i64_col = dataset.get_col<int64_t>(fid_64);
+
+    auto plan = std::make_unique<query::RetrievePlan>(schema);
+    std::vector<proto::plan::GenericValue> values(1);
+    values[0].set_int64_val(i64_col[0]);
+    auto term_expr = std::make_shared<milvus::expr::TermFilterExpr>(
+        milvus::expr::ColumnInfo(
+            fid_64, DataType::INT64, std::vector<std::string>()),
+        values);
+    plan->plan_node_ = std::make_unique<query::RetrievePlanNode>();
+    plan->plan_node_->plannodes_ =
+        milvus::test::CreateRetrievePlanByExpr(term_expr);
+    plan->field_ids_ = {fid_64};
+
+    auto retrieve_results =
+        RetrieveUsingDefaultOutputSize(segment.get(), plan.get(), 100);
+    EXPECT_EQ(retrieve_results->query_profiles_size(), 0);
+
+    plan->plan_node_->plan_options_.collect_runtime_stats = true;
+    retrieve_results =
+        RetrieveUsingDefaultOutputSize(segment.get(), plan.get(), 100);
+    ASSERT_EQ(retrieve_results->query_profiles_size(), 1);
+    auto profile = nlohmann::json::parse(retrieve_results->query_profiles(0));
+    EXPECT_EQ(profile["segment_id"], segment->get_segment_id());
+    EXPECT_FALSE(profile["operators"].empty());
+}
@@ -18,9 +18,14 @@
 
 #include <cstdint>
 #include "common/FastMem.h"
+#include <algorithm>
 #include <cstring>
+#include <exception>
+#include <future>
 #include <limits>
+#include <memory>
 #include <mutex>
+#include <numeric>
 #include <string>
 #include <string_view>
 #include <vector>
@@ -28,10 +33,12 @@
 
 #include <atomic>
 #include <fcntl.h>
+#include <lz4.h>
 #include <unistd.h>
 
 #include "common/EasyAssert.h"
 #include "common/FieldMeta.h"
+#include "storage/ThreadPools.h"
 
 namespace milvus::segcore {
 
@@ -42,15 +49,17 @@ namespace milvus::segcore {
  *
  * Layout:
  *   - offset (8 bytes): position in the LOB file
- *   - size (4 bytes): length of the text data
- *   - flags (4 bytes): reserved for future use (e.g., compression)
+ *   - size (4 bytes): length of the stored data
+ *   - flags (4 bytes): kLz4Compressed if the stored data is the 4-byte
+ *     length of the text followed by its LZ4 block, 0 for raw text
  */
 struct TextLobRef {
     uint64_t offset;  // Position in LOB file
-    uint32_t size;    // Length of text data
-    uint32_t flags;   // Reserved (0 = uncompressed)
+    uint32_t size;    // Length of stored data
+    uint32_t flags;   // 0 = uncompressed, or kLz4Compressed
 
     static constexpr size_t kEncodedSize = 16;
+    static constexpr uint32_t kLz4Compressed = 1;
 
     // Encode reference to binary string for storage in ConcurrentVector
     std::string
@@ -79,6 +88,16 @@ struct TextLobRef {
     }
 };
 
+/**
+ * Texts read by TextLobSpillover::ReadBatch, in the order of the refs. The
+ * views point into arenas owned by the batch.
+ */
+struct TextLobBatch {
+    std::vector<std::string_view> texts;
+    std::unique_ptr<char[]> stored;
+    std::unique_ptr<char[]> decompressed;
+};
+
 /**
  * TextLobSpillover manages a temporary LOB file for a single TEXT field
  * in a growing segment. Uses a single fd with pwrite/pread for both
@@ -89,17 +108,27 @@ struct TextLobRef {
  *   - pread: lock-free (POSIX guarantees pread is thread-safe)
  *   - pwrite + pread concurrent: safe (both operate on kernel page cache)
  *
- * File format: simple binary append (raw text bytes concatenated)
+ * File format: simple binary append (stored text bytes concatenated)
  *   [text1_bytes][text2_bytes][text3_bytes]...
+ * With compression enabled, a text of at least kMinCompressSize bytes is
+ * stored as [raw_size (4 bytes)][LZ4 block] if that saves an eighth of it.
  */
 class TextLobSpillover {
  public:
+    static constexpr size_t kMinCompressSize = 256;
+    // refs closer than this in the file are read by one pread
+    static constexpr uint64_t kMaxCoalesceGap = 4 * 1024;
+    static constexpr uint64_t kMaxRangeBytes = 1024 * 1024;
+    static constexpr size_t kMaxParallelReads = 8;
+
     TextLobSpillover(int64_t segment_id,
                      FieldId field_id,
-                     const std::string& base_path)
+                     const std::string& base_path,
+                     bool compress = false)
         : segment_id_(segment_id),
           field_id_(field_id),
           path_(BuildPath(base_path, segment_id, field_id)),
+          compress_(compress),
           fd_(-1),
           current_offset_(0) {
         // Create parent directories if needed
@@ -146,16 +175,35 @@ class TextLobSpillover {
 
     std::string
     WriteAndEncode(const char* data, size_t size) {
-        std::lock_guard<std::mutex> lock(write_mutex_);
-
         AssertInfo(size <= std::numeric_limits<uint32_t>::max(),
                    "TEXT value too large for LOB spillover: {} bytes (max 4GB)",
                    size);
 
         TextLobRef ref;
+        ref.flags = 0;
+        // compress before taking the lock, inserts write concurrently
+        std::string compressed;
+        if (compress_ && size >= kMinCompressSize &&
+            size <= LZ4_MAX_INPUT_SIZE) {
+            auto raw_size = static_cast<uint32_t>(size);
+            compressed.resize(sizeof(raw_size) + LZ4_compressBound(size));
+            std::memcpy(compressed.data(), &raw_size, sizeof(raw_size));
+            auto compressed_size = LZ4_compress_default(
+                data,
+                compressed.data() + sizeof(raw_size),
+                static_cast<int>(size),
+                static_cast<int>(compressed.size() - sizeof(raw_size)));
+            auto stored_size = sizeof(raw_size) + compressed_size;
+            if (compressed_size > 0 && stored_size <= size - size / 8) {
+                data = compressed.data();
+                size = stored_size;
+                ref.flags = TextLobRef::kLz4Compressed;
+            }
+        }
+
+        std::lock_guard<std::mutex> lock(write_mutex_);
         ref.offset = current_offset_;
         ref.size = static_cast<uint32_t>(size);
-        ref.flags = 0;
 
         size_t total_written = 0;
         while (total_written < size) {
@@ -183,21 +231,101 @@ class TextLobSpillover {
     std::string
     DecodeAndRead(std::string_view ref_str) {
         TextLobRef ref = TextLobRef::Decode(ref_str);
-        return PRead(ref.offset, ref.size);
+        auto stored = PRead(ref.offset, ref.size);
+        if (ref.flags != TextLobRef::kLz4Compressed) {
+            return stored;
+        }
+        std::string text(RawSize(stored.data(), ref), '\0');
+        Decompress(stored.data(), ref, text.data(), text.size());
+        return text;
     }
 
     /**
-     * Batch read: pread all refs. No flush needed.
+     * Batch read: refs are sorted by offset and nearby ones are coalesced
+     * into a single pread into one arena. Large batches split their preads
+     * over the HIGH pool. No flush needed.
      */
-    std::vector<std::string>
-    DecodeAndReadBatch(const std::vector<std::string_view>& ref_strs) {
-        std::vector<std::string> results;
-        results.reserve(ref_strs.size());
+    TextLobBatch
+    ReadBatch(const std::vector<std::string_view>& ref_strs) {
+        TextLobBatch batch;
+        auto n = ref_strs.size();
+        std::vector<TextLobRef> refs;
+        refs.reserve(n);
         for (const auto& ref_str : ref_strs) {
-            TextLobRef ref = TextLobRef::Decode(ref_str);
-            results.push_back(PRead(ref.offset, ref.size));
+            refs.push_back(TextLobRef::Decode(ref_str));
+        }
+        std::vector<size_t> order(n);
+        std::iota(order.begin(), order.end(), 0);
+        std::sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+            return refs[a].offset < refs[b].offset;
+        });
+
+        // file range -> arena range; stored_pos is where each ref's stored
+        // bytes land in the arena
+        struct Range {
+            uint64_t offset;
+            uint64_t size;
+            uint64_t arena_offset;
+        };
+        std::vector<Range> ranges;
+        std::vector<uint64_t> stored_pos(n);
+        uint64_t arena_size = 0;
+        for (auto i : order) {
+            const auto& ref = refs[i];
+            auto end = ref.offset + ref.size;
+            if (!ranges.empty()) {
+                auto& last = ranges.back();
+                auto last_end = last.offset + last.size;
+                auto new_end = std::max(last_end, end);
+                if (ref.offset <= last_end + kMaxCoalesceGap &&
+                    new_end - last.offset <= kMaxRangeBytes) {
+                    last.size = new_end - last.offset;
+                    arena_size = last.arena_offset + last.size;
+                    stored_pos[i] =
+                        last.arena_offset + (ref.offset - last.offset);
+                    continue;
+                }
+            }
+            ranges.push_back({ref.offset, ref.size, arena_size});
+            stored_pos[i] = arena_size;
+            arena_size += ref.size;
         }
-        return results;
+
+        batch.stored.reset(new char[std::max<uint64_t>(arena_size, 1)]);
+        ReadRanges(ranges, batch.stored.get());
+
+        uint64_t decompressed_size = 0;
+        for (size_t i = 0; i < n; ++i) {
+            if (refs[i].flags == TextLobRef::kLz4Compressed) {
+                decompressed_size +=
+                    RawSize(batch.stored.get() + stored_pos[i], refs[i]);
+            }
+        }
+        if (decompressed_size > 0) {
+            batch.decompressed.reset(new char[decompressed_size]);
+        }
+        batch.texts.reserve(n);
+        uint64_t decompressed_pos = 0;
+        for (size_t i = 0; i < n; ++i) {
+            const char* stored = batch.stored.get() + stored_pos[i];
+            if (refs[i].flags != TextLobRef::kLz4Compressed) {
+                batch.texts.emplace_back(stored, refs[i].size);
+                continue;
+            }
+            auto raw_size = RawSize(stored, refs[i]);
+            auto text = batch.decompressed.get() + decompressed_pos;
+            Decompress(stored, refs[i], text, raw_size);
+            batch.texts.emplace_back(text, raw_size);
+            decompressed_pos += raw_size;
+        }
+        return batch;
+    }
+
+    std::vector<std::string>
+    DecodeAndReadBatch(const std::vector<std::string_view>& ref_strs) {
+        auto batch = ReadBatch(ref_strs);
+        return std::vector<std::string>(batch.texts.begin(),
+                                        batch.texts.end());
     }
 
     const std::string&
@@ -215,6 +343,11 @@ class TextLobSpillover {
         return fd_;
     }
 
+    bool
+    IsCompressed() const {
+        return compress_;
+    }
+
     /**
      * Get the current file size (total bytes written).
      * Used by resource tracking to account for spillover disk usage.
@@ -228,10 +361,94 @@ class TextLobSpillover {
     std::string
     PRead(uint64_t offset, uint32_t size) {
         std::string result(size, '\0');
-        size_t total_read = 0;
+        PReadInto(offset, size, result.data());
+        return result;
+    }
+
+    template <typename Range>
+    void
+    ReadRanges(const std::vector<Range>& ranges, char* arena) {
+        uint64_t total = 0;
+        for (const auto& range : ranges) {
+            total += range.size;
+        }
+        size_t tasks = 1;
+        if (total > kMaxRangeBytes) {
+            tasks = std::min(ranges.size(), kMaxParallelReads);
+        }
+        auto read_share = [&](size_t task) {
+            for (auto r = task; r < ranges.size(); r += tasks) {
+                PReadInto(ranges[r].offset,
+                          ranges[r].size,
+                          arena + ranges[r].arena_offset);
+            }
+        };
+
+        std::vector<std::future<void>> futures;
+        std::exception_ptr error;
+        try {
+            auto& pool =
+                ThreadPools::GetThreadPool(milvus::ThreadPoolPriority::HIGH);
+            for (size_t task = 1; task < tasks; ++task) {
+                futures.push_back(
+                    pool.Submit([&read_share, task]() { read_share(task); }));
+            }
+            read_share(0);
+        } catch (...) {
+            error = std::current_exception();
+        }
+        // the shares reference this frame, wait for all of them
+        for (auto& future : futures) {
+            try {
+                future.get();
+            } catch (...) {
+                if (!error) {
+                    error = std::current_exception();
+                }
+            }
+        }
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+
+    uint32_t
+    RawSize(const char* stored, const TextLobRef& ref) const {
+        uint32_t raw_size;
+        AssertInfo(ref.size >= sizeof(raw_size),
+                   "Invalid compressed LOB of {} bytes in {} at offset {}",
+                   ref.size,
+                   path_,
+                   ref.offset);
+        std::memcpy(&raw_size, stored, sizeof(raw_size));
+        return raw_size;
+    }
+
+    void
+    Decompress(const char* stored,
+               const TextLobRef& ref,
+               char* dst,
+               uint32_t raw_size) const {
+        auto decompressed = LZ4_decompress_safe(
+            stored + sizeof(raw_size),
+            dst,
+            static_cast<int>(ref.size - sizeof(raw_size)),
+            static_cast<int>(raw_size));
+        AssertInfo(decompressed == static_cast<int>(raw_size),
+                   "Failed to decompress LOB in {} at offset {}: got {} "
+                   "bytes, expected {}",
+                   path_,
+                   ref.offset,
+                   decompressed,
+                   raw_size);
+    }
+
+    void
+    PReadInto(uint64_t offset, uint64_t size, char* dst) {
+        uint64_t total_read = 0;
         while (total_read < size) {
             ssize_t n = ::pread(fd_,
-                                result.data() + total_read,
+                                dst + total_read,
                                 size - total_read,
                                 offset + total_read);
             AssertInfo(n > 0,
@@ -243,7 +460,6 @@ class TextLobSpillover {
                        total_read);
             total_read += n;
         }
-        return result;
     }
 
     static std::atomic<uint64_t>&
@@ -269,6 +485,7 @@ class TextLobSpillover {
     int64_t segment_id_;
     FieldId field_id_;
     std::string path_;
+    const bool compress_;
 
     int fd_;
     std::mutex write_mutex_;
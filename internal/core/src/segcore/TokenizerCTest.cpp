@@ -86,3 +86,73 @@ TEST(CTokenizer, Default) {
 
     free_tokenizer(tokenizer);
 }
+
+TEST(CTokenizer, TokenizeBatch) {
+    auto analyzer_params = R"({"tokenizer": "standard"})";
+    CTokenizer tokenizer;
+    {
+        auto status = create_tokenizer(analyzer_params, "", &tokenizer);
+        ASSERT_EQ(milvus::ErrorCode::Success, status.error_code);
+    }
+
+    std::vector<std::string> texts{
+        "football, basketball, football", "", "swimming"};
+    std::string data;
+    std::vector<uint64_t> text_offsets{0};
+    for (const auto& text : texts) {
+        data += text;
+        text_offsets.push_back(data.size());
+    }
+    auto token = [](const CTokenBatch& batch, uint64_t i) {
+        return std::string(batch.token_data + batch.token_offsets[i],
+                           batch.token_offsets[i + 1] - batch.token_offsets[i]);
+    };
+
+    CTokenBatch batch;
+    {
+        auto status = tokenize_batch(tokenizer,
+                                     data.data(),
+                                     text_offsets.data(),
+                                     texts.size(),
+                                     false,
+                                     &batch);
+        ASSERT_EQ(milvus::ErrorCode::Success, status.error_code);
+    }
+    std::vector<std::string> refs{
+        "football", "basketball", "football", "swimming"};
+    std::vector<int64_t> positions{0, 1, 2, 0};
+    ASSERT_EQ(batch.num_tokens, refs.size());
+    ASSERT_EQ(batch.term_freqs, nullptr);
+    for (uint64_t i = 0; i < batch.num_tokens; i++) {
+        ASSERT_EQ(refs[i], token(batch, i));
+        ASSERT_EQ(positions[i], batch.positions[i]);
+    }
+    EXPECT_EQ(batch.token_counts[0], 3);
+    EXPECT_EQ(batch.token_counts[1], 0);
+    EXPECT_EQ(batch.token_counts[2], 1);
+    free_token_batch(&batch);
+
+    {
+        auto status = tokenize_batch(tokenizer,
+                                     data.data(),
+                                     text_offsets.data(),
+                                     texts.size(),
+                                     true,
+                                     &batch);
+        ASSERT_EQ(milvus::ErrorCode::Success, status.error_code);
+    }
+    refs = {"basketball", "football", "swimming"};
+    std::vector<uint32_t> freqs{1, 2, 1};
+    ASSERT_EQ(batch.num_tokens, refs.size());
+    ASSERT_EQ(batch.positions, nullptr);
+    for (uint64_t i = 0; i < batch.num_tokens; i++) {
+        ASSERT_EQ(refs[i], token(batch, i));
+        ASSERT_EQ(freqs[i], batch.term_freqs[i]);
+    }
+    EXPECT_EQ(batch.token_counts[0], 2);
+    EXPECT_EQ(batch.token_counts[1], 0);
+    EXPECT_EQ(batch.token_counts[2], 1);
+    free_token_batch(&batch);
+
+    free_tokenizer(tokenizer);
+}
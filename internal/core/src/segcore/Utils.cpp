@@ -15,11 +15,14 @@
 #include <cxxabi.h>
 #include <folly/ExceptionWrapper.h>
 #include <algorithm>
+#include <atomic>
 #include <cmath>
+#include <condition_variable>
 #include <cstdint>
 #include <exception>
 #include <future>
 #include <memory>
+#include <mutex>
 #include <numeric>
 #include <optional>
 #include <string>
@@ -41,6 +44,7 @@
 #include "common/Types.h"
 #include "common/Utils.h"
 #include "folly/FBVector.h"
+#include "futures/Executor.h"
 #include "glog/logging.h"
 #include "google/protobuf/descriptor.h"
 #include "index/Index.h"
@@ -1819,4 +1823,64 @@ SortEqualScoresByPks(SearchResult* search_result) {
     }
 }
 
+void
+ParallelForOnSearchExecutor(int64_t count,
+                            const std::function<void(int64_t)>& fn) {
+    if (count <= 0) {
+        return;
+    }
+    auto executor = milvus::futures::getSearchCPUExecutor();
+    auto helpers = std::min<int64_t>(count - 1, executor->numThreads());
+    if (helpers <= 0) {
+        for (int64_t i = 0; i < count; ++i) {
+            fn(i);
+        }
+        return;
+    }
+
+    // Helpers scheduled after all tasks were taken only touch `next`, so
+    // fn is never called once the caller has returned.
+    struct State {
+        State(int64_t count, const std::function<void(int64_t)>* fn)
+            : count(count), fn(fn) {
+        }
+        const int64_t count;
+        const std::function<void(int64_t)>* fn;
+        std::atomic<int64_t> next{0};
+        std::mutex mutex;
+        std::condition_variable cv;
+        int64_t finished{0};
+        std::exception_ptr error;
+    };
+    auto state = std::make_shared<State>(count, &fn);
+    auto run = [](State& s) {
+        for (auto i = s.next.fetch_add(1); i < s.count;
+             i = s.next.fetch_add(1)) {
+            std::exception_ptr error;
+            try {
+                (*s.fn)(i);
+            } catch (...) {
+                error = std::current_exception();
+            }
+            std::lock_guard<std::mutex> lock(s.mutex);
+            if (error != nullptr && s.error == nullptr) {
+                s.error = error;
+            }
+            if (++s.finished == s.count) {
+                s.cv.notify_all();
+            }
+        }
+    };
+    for (int64_t i = 0; i < helpers; ++i) {
+        executor->add([state, run]() { run(*state); });
+    }
+    run(*state);
+
+    std::unique_lock<std::mutex> lock(state->mutex);
+    state->cv.wait(lock, [&]() { return state->finished == state->count; });
+    if (state->error != nullptr) {
+        std::rethrow_exception(state->error);
+    }
+}
+
 }  // namespace milvus::segcore
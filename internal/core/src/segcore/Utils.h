@@ -11,6 +11,7 @@
 
 #pragma once
 
+#include <functional>
 #include <memory>
 #include <cstdlib>
 #include <string>
@@ -287,4 +288,12 @@ GetEffectiveSearchTopk(const SearchInfo& search_info) {
 void
 SortEqualScoresByPks(SearchResult* search_result);
 
+// Runs fn(0) .. fn(count - 1) on the search executor and the calling thread.
+// The caller takes tasks itself and only waits for the ones helpers already
+// started, so it is safe to call from a search executor thread. Rethrows the
+// first exception thrown by fn after all tasks finished.
+void
+ParallelForOnSearchExecutor(int64_t count,
+                            const std::function<void(int64_t)>& fn);
+
 }  // namespace milvus::segcore
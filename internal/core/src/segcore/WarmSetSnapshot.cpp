@@ -0,0 +1,247 @@
+// Copyright (C) 2019-2025 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License
+
+#include "segcore/WarmSetSnapshot.h"
+
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <sstream>
+#include <tuple>
+
+#include "log/Log.h"
+
+namespace milvus::segcore {
+
+namespace {
+
+constexpr const char* kHeader = "# milvus warm set v1";
+
+}  // namespace
+
+WarmSetSnapshot&
+WarmSetSnapshot::GetInstance() {
+    static WarmSetSnapshot instance;
+    return instance;
+}
+
+WarmSetSnapshot::~WarmSetSnapshot() {
+    Stop();
+}
+
+void
+WarmSetSnapshot::Stop() {
+    {
+        std::lock_guard lock(persist_mutex_);
+        stopping_ = true;
+    }
+    stop_cv_.notify_all();
+    if (persist_thread_.joinable()) {
+        persist_thread_.join();
+    }
+    std::lock_guard lock(persist_mutex_);
+    stopping_ = false;
+}
+
+void
+WarmSetSnapshot::Configure(const std::string& path, int64_t interval_sec) {
+    Stop();
+    enabled_.store(false);
+    {
+        std::lock_guard lock(mutex_);
+        path_ = path;
+        snapshot_.clear();
+    }
+    for (auto& shard : shards_) {
+        std::lock_guard lock(shard.mutex);
+        shard.counts.clear();
+    }
+    if (interval_sec <= 0 || path.empty()) {
+        return;
+    }
+
+    auto snapshot = Load(path);
+    LOG_INFO("loaded warm set snapshot {} with {} fields, persisting every {}s",
+             path,
+             snapshot.size(),
+             interval_sec);
+    {
+        std::lock_guard lock(mutex_);
+        snapshot_ = std::move(snapshot);
+    }
+    enabled_.store(true);
+    persist_thread_ = std::thread([this, interval_sec]() {
+        std::unique_lock lock(persist_mutex_);
+        while (!stop_cv_.wait_for(lock,
+                                  std::chrono::seconds(interval_sec),
+                                  [this]() { return stopping_; })) {
+            lock.unlock();
+            Persist();
+            lock.lock();
+        }
+    });
+}
+
+void
+WarmSetSnapshot::RecordAccesses(int64_t segment_id,
+                                FieldId field_id,
+                                const std::vector<int64_t>& cids) {
+    if (!enabled()) {
+        return;
+    }
+    auto& shard = ShardOf(segment_id);
+    std::lock_guard lock(shard.mutex);
+    auto& cells = shard.counts[{segment_id, field_id.get()}];
+    for (auto cid : cids) {
+        ++cells[cid];
+    }
+}
+
+void
+WarmSetSnapshot::RecordAllAccesses(int64_t segment_id,
+                                   FieldId field_id,
+                                   int64_t num_cells) {
+    if (!enabled()) {
+        return;
+    }
+    auto& shard = ShardOf(segment_id);
+    std::lock_guard lock(shard.mutex);
+    auto& cells = shard.counts[{segment_id, field_id.get()}];
+    for (int64_t cid = 0; cid < num_cells; ++cid) {
+        ++cells[cid];
+    }
+}
+
+void
+WarmSetSnapshot::DropSegment(int64_t segment_id) {
+    if (!enabled()) {
+        return;
+    }
+    auto& shard = ShardOf(segment_id);
+    std::lock_guard lock(shard.mutex);
+    auto first = shard.counts.lower_bound(
+        {segment_id, std::numeric_limits<int64_t>::min()});
+    auto last = shard.counts.upper_bound(
+        {segment_id, std::numeric_limits<int64_t>::max()});
+    shard.counts.erase(first, last);
+}
+
+std::vector<int64_t>
+WarmSetSnapshot::TakeWarmCells(int64_t segment_id, FieldId field_id) {
+    std::map<int64_t, uint64_t> cells;
+    {
+        std::lock_guard lock(mutex_);
+        auto iter = snapshot_.find({segment_id, field_id.get()});
+        if (iter == snapshot_.end()) {
+            return {};
+        }
+        cells = std::move(iter->second);
+        snapshot_.erase(iter);
+    }
+    std::vector<std::pair<int64_t, uint64_t>> sorted(cells.begin(),
+                                                     cells.end());
+    std::stable_sort(
+        sorted.begin(), sorted.end(), [](const auto& a, const auto& b) {
+            return a.second > b.second;
+        });
+    std::vector<int64_t> cids;
+    cids.reserve(sorted.size());
+    for (const auto& [cid, count] : sorted) {
+        cids.push_back(cid);
+    }
+    return cids;
+}
+
+bool
+WarmSetSnapshot::Persist() {
+    std::string path;
+    // segment_id, field_id, cid, count
+    std::vector<std::tuple<int64_t, int64_t, int64_t, uint64_t>> cells;
+    {
+        std::lock_guard lock(mutex_);
+        path = path_;
+    }
+    for (auto& shard : shards_) {
+        std::lock_guard lock(shard.mutex);
+        for (const auto& [key, counts] : shard.counts) {
+            for (const auto& [cid, count] : counts) {
+                cells.emplace_back(key.first, key.second, cid, count);
+            }
+        }
+    }
+    if (path.empty() || cells.empty()) {
+        return false;
+    }
+    if (cells.size() > kMaxPersistedCells) {
+        std::nth_element(cells.begin(),
+                         cells.begin() + kMaxPersistedCells,
+                         cells.end(),
+                         [](const auto& a, const auto& b) {
+                             return std::get<3>(a) > std::get<3>(b);
+                         });
+        cells.resize(kMaxPersistedCells);
+    }
+
+    auto tmp_path = path + ".tmp";
+    try {
+        auto parent = std::filesystem::path(path).parent_path();
+        if (!parent.empty()) {
+            std::filesystem::create_directories(parent);
+        }
+        {
+            std::ofstream out(tmp_path, std::ios::trunc);
+            out << kHeader << '\n';
+            for (const auto& [segment_id, field_id, cid, count] : cells) {
+                out << segment_id << ' ' << field_id << ' ' << cid << ' '
+                    << count << '\n';
+            }
+            out.close();
+            if (!out) {
+                LOG_WARN("failed to write warm set snapshot {}", tmp_path);
+                return false;
+            }
+        }
+        std::filesystem::rename(tmp_path, path);
+    } catch (const std::exception& e) {
+        LOG_WARN("failed to persist warm set snapshot {}: {}", path, e.what());
+        return false;
+    }
+    return true;
+}
+
+WarmSetSnapshot::CellCounts
+WarmSetSnapshot::Load(const std::string& path) {
+    CellCounts snapshot;
+    std::ifstream in(path);
+    if (!in) {
+        return snapshot;
+    }
+    std::string line;
+    if (!std::getline(in, line) || line != kHeader) {
+        LOG_WARN("ignore warm set snapshot {} of unknown format", path);
+        return snapshot;
+    }
+    while (std::getline(in, line)) {
+        std::istringstream fields(line);
+        int64_t segment_id, field_id, cid;
+        uint64_t count;
+        if (!(fields >> segment_id >> field_id >> cid >> count) || cid < 0) {
+            // a truncated tail, keep what was read
+            break;
+        }
+        snapshot[{segment_id, field_id}][cid] += count;
+    }
+    return snapshot;
+}
+
+}  // namespace milvus::segcore
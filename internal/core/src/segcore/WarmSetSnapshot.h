@@ -0,0 +1,125 @@
+// Copyright (C) 2019-2025 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "common/Types.h"
+
+namespace milvus::segcore {
+
+// Tracks which cells of which sealed segment fields queries pinned, and how
+// often, and periodically persists that warm set to a local file.
+// After a restart the snapshot left by the previous process tells the
+// segment loader which cells to warm up, hottest first, before queries
+// arrive and fault them in one by one.
+//
+// The snapshot is a text file, one "segment_id field_id cid count" line per
+// cell, written to a temporary file and renamed over the previous one.
+class WarmSetSnapshot {
+ public:
+    static constexpr size_t kMaxPersistedCells = 1 << 18;
+
+    static WarmSetSnapshot&
+    GetInstance();
+
+    ~WarmSetSnapshot();
+
+    // Loads the snapshot a previous process persisted at path and persists
+    // the warm set there every interval_sec seconds. interval_sec <= 0
+    // disables both.
+    void
+    Configure(const std::string& path, int64_t interval_sec);
+
+    bool
+    enabled() const {
+        return enabled_.load(std::memory_order_relaxed);
+    }
+
+    // Counts one access to each of cids. Callers on hot paths check
+    // enabled() first.
+    void
+    RecordAccesses(int64_t segment_id,
+                   FieldId field_id,
+                   const std::vector<int64_t>& cids);
+
+    // Counts one access to each of the first num_cells cells.
+    void
+    RecordAllAccesses(int64_t segment_id, FieldId field_id, int64_t num_cells);
+
+    // Forgets the cells of a released segment.
+    void
+    DropSegment(int64_t segment_id);
+
+    // Cells of field_id of segment_id in the loaded snapshot, most often
+    // accessed first. Each field is handed out once.
+    std::vector<int64_t>
+    TakeWarmCells(int64_t segment_id, FieldId field_id);
+
+    // Writes the current warm set to the configured path. An empty warm set
+    // is not written, so a process releasing its segments on shutdown keeps
+    // the snapshot of its serving period.
+    bool
+    Persist();
+
+ private:
+    // (segment_id, field_id) -> cid -> count
+    using CellCounts =
+        std::map<std::pair<int64_t, int64_t>, std::map<int64_t, uint64_t>>;
+
+    // Accesses are counted on every pin, the counts are split by segment
+    // so that concurrent queries rarely contend.
+    static constexpr size_t kShards = 16;
+
+    struct Shard {
+        std::mutex mutex;
+        CellCounts counts;
+    };
+
+    WarmSetSnapshot() = default;
+
+    Shard&
+    ShardOf(int64_t segment_id) {
+        return shards_[static_cast<uint64_t>(segment_id) % kShards];
+    }
+
+    void
+    Stop();
+
+    static CellCounts
+    Load(const std::string& path);
+
+    std::atomic<bool> enabled_{false};
+
+    std::array<Shard, kShards> shards_;
+
+    // guards path_ and snapshot_
+    std::mutex mutex_;
+    std::string path_;
+    CellCounts snapshot_;
+
+    std::mutex persist_mutex_;
+    std::condition_variable stop_cv_;
+    bool stopping_ = false;
+    std::thread persist_thread_;
+};
+
+}  // namespace milvus::segcore
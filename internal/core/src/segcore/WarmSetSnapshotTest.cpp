@@ -0,0 +1,95 @@
+// Copyright (C) 2019-2025 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License
+
+#include <gtest/gtest.h>
+#include <unistd.h>
+
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "segcore/WarmSetSnapshot.h"
+
+using namespace milvus;
+using namespace milvus::segcore;
+
+class WarmSetSnapshotTest : public ::testing::Test {
+ protected:
+    void
+    SetUp() override {
+        dir_ = std::filesystem::temp_directory_path() /
+               ("warm_set_test_" + std::to_string(::getpid()));
+        std::filesystem::remove_all(dir_);
+        path_ = (dir_ / "warm_set").string();
+    }
+
+    void
+    TearDown() override {
+        WarmSetSnapshot::GetInstance().Configure("", 0);
+        std::filesystem::remove_all(dir_);
+    }
+
+    std::filesystem::path dir_;
+    std::string path_;
+};
+
+TEST_F(WarmSetSnapshotTest, RestoresHottestCellsFirst) {
+    auto& warm_set = WarmSetSnapshot::GetInstance();
+
+    // disabled by default
+    warm_set.RecordAccesses(1, FieldId(100), {0});
+    EXPECT_FALSE(warm_set.Persist());
+
+    warm_set.Configure(path_, 3600);
+    EXPECT_FALSE(warm_set.Persist());
+    warm_set.RecordAccesses(1, FieldId(100), {0, 2});
+    warm_set.RecordAccesses(1, FieldId(100), {2});
+    warm_set.RecordAccesses(1, FieldId(101), {1});
+    // a full scan accesses every cell once
+    warm_set.RecordAllAccesses(1, FieldId(101), 3);
+    warm_set.RecordAccesses(2, FieldId(100), {5});
+    warm_set.DropSegment(2);
+    ASSERT_TRUE(warm_set.Persist());
+    EXPECT_FALSE(std::filesystem::exists(path_ + ".tmp"));
+
+    // as after a restart
+    warm_set.Configure(path_, 3600);
+    EXPECT_EQ(warm_set.TakeWarmCells(1, FieldId(100)),
+              (std::vector<int64_t>{2, 0}));
+    EXPECT_TRUE(warm_set.TakeWarmCells(1, FieldId(100)).empty());
+    EXPECT_EQ(warm_set.TakeWarmCells(1, FieldId(101)),
+              (std::vector<int64_t>{1, 0, 2}));
+    EXPECT_TRUE(warm_set.TakeWarmCells(2, FieldId(100)).empty());
+
+    // nothing accessed yet, the previous snapshot is kept
+    EXPECT_FALSE(warm_set.Persist());
+    EXPECT_TRUE(std::filesystem::exists(path_));
+}
+
+TEST_F(WarmSetSnapshotTest, IgnoresMalformedSnapshot) {
+    std::filesystem::create_directories(dir_);
+    {
+        std::ofstream out(path_);
+        out << "1 100 0 3\n";
+    }
+    auto& warm_set = WarmSetSnapshot::GetInstance();
+    warm_set.Configure(path_, 3600);
+    EXPECT_TRUE(warm_set.TakeWarmCells(1, FieldId(100)).empty());
+
+    {
+        std::ofstream out(path_);
+        out << "# milvus warm set v1\n1 100 0 3\n1 100 4 5\n1 100";
+    }
+    warm_set.Configure(path_, 3600);
+    EXPECT_EQ(warm_set.TakeWarmCells(1, FieldId(100)),
+              (std::vector<int64_t>{4, 0}));
+}
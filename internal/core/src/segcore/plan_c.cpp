@@ -40,7 +40,7 @@ CreateSearchPlanByExpr(CCollection c_col,
     auto schema = col->get_schema();
 
     try {
-        auto res = milvus::query::CreateSearchPlanByExpr(
+        auto res = col->get_plan_cache().GetSearchPlan(
             schema, serialized_expr_plan, size);
         auto col_index_meta = col->get_index_meta();
         auto field_id = milvus::query::GetFieldID(res.get());
@@ -172,7 +172,7 @@ CreateRetrievePlanByExpr(CCollection c_col,
     auto col = static_cast<milvus::segcore::Collection*>(c_col);
 
     try {
-        auto res = milvus::query::CreateRetrievePlanByExpr(
+        auto res = col->get_plan_cache().GetRetrievePlan(
             col->get_schema(), serialized_expr_plan, size);
 
         auto status = CStatus();
@@ -38,6 +38,7 @@
 #include "monitor/scope_metric.h"
 #include "prometheus/histogram.h"
 #include "query/PlanImpl.h"
+#include "segcore/ArrowExportUtils.h"
 #include "segcore/SegmentInterface.h"
 #include "segcore/Utils.h"
 #include "segcore/reduce/Reduce.h"
@@ -89,26 +90,7 @@ AssertEmptyCProto(const CProto* proto) {
                "CProto output must be empty before FillOutputFieldsOrdered");
 }
 
-constexpr const char* kMilvusFieldIDMetadataKey = "milvus.field_id";
-constexpr const char* kMilvusDataTypeMetadataKey = "milvus.data_type";
-
-std::shared_ptr<arrow::KeyValueMetadata>
-MilvusFieldMetadata(milvus::FieldId field_id, milvus::DataType data_type) {
-    return arrow::key_value_metadata(
-        {kMilvusFieldIDMetadataKey, kMilvusDataTypeMetadataKey},
-        {std::to_string(field_id.get()),
-         std::to_string(static_cast<int32_t>(data_type))});
-}
-
-std::shared_ptr<arrow::Field>
-MilvusField(const std::string& name,
-            const std::shared_ptr<arrow::DataType>& arrow_type,
-            bool nullable,
-            milvus::FieldId field_id,
-            milvus::DataType data_type) {
-    return arrow::field(
-        name, arrow_type, nullable, MilvusFieldMetadata(field_id, data_type));
-}
+using milvus::segcore::MilvusField;
 
 void
 SetFieldDataElementTypeIfNeeded(milvus::proto::schema::FieldData* field_data,
@@ -23,8 +23,11 @@
 #include "glog/logging.h"
 #include "log/Log.h"
 #include "pthread.h"
+#include "query/SearchIteratorSession.h"
+#include "segcore/CompressedCellCache.h"
 #include "segcore/SegcoreConfig.h"
 #include "segcore/segcore_init_c.h"
+#include "segcore/WarmSetSnapshot.h"
 #include "storage/PrefetchThreadPool.h"
 
 namespace milvus::segcore {
@@ -51,6 +54,41 @@ SegcoreSetEnableInterminSegmentIndex(const bool value) {
     config.set_enable_interim_segment_index(value);
 }
 
+extern "C" void
+SegcoreSetEnableAsyncInterimIndex(const bool value) {
+    milvus::segcore::SegcoreConfig& config =
+        milvus::segcore::SegcoreConfig::default_config();
+    config.set_enable_async_interim_index(value);
+}
+
+extern "C" void
+SegcoreSetEnablePredictiveWarmup(const bool value) {
+    milvus::segcore::SegcoreConfig& config =
+        milvus::segcore::SegcoreConfig::default_config();
+    config.set_enable_predictive_warmup(value);
+}
+
+extern "C" void
+SegcoreSetEnableTextLobCompression(const bool value) {
+    milvus::segcore::SegcoreConfig& config =
+        milvus::segcore::SegcoreConfig::default_config();
+    config.set_enable_text_lob_compression(value);
+}
+
+extern "C" void
+SegcoreSetTextMatchDeltaCommitIntervalMs(const int64_t value) {
+    milvus::segcore::SegcoreConfig& config =
+        milvus::segcore::SegcoreConfig::default_config();
+    config.set_text_match_delta_commit_interval_ms(value);
+}
+
+extern "C" void
+SegcoreSetTextMatchDeltaMaxByteSize(const int64_t value) {
+    milvus::segcore::SegcoreConfig& config =
+        milvus::segcore::SegcoreConfig::default_config();
+    config.set_text_match_delta_max_byte_size(value);
+}
+
 extern "C" void
 SegcoreSetStorageV3Enabled(const bool value) {
     milvus::segcore::SegcoreConfig& config =
@@ -302,6 +340,24 @@ ConfigureTieredStorage(const CacheWarmupPolicy scalarFieldCacheWarmupPolicy,
         .set_reject_remote_vector_output(reject_remote_vector_output);
 }
 
+extern "C" void
+ConfigureCompressedCellCache(const int64_t max_bytes) {
+    milvus::segcore::CompressedCellCache::GetInstance().Configure(max_bytes);
+}
+
+extern "C" void
+ConfigureSearchIteratorSessions(const int64_t ttl_ms,
+                                const int64_t max_memory_bytes) {
+    milvus::query::SearchIteratorSessions::GetInstance().Configure(
+        ttl_ms, max_memory_bytes);
+}
+
+extern "C" void
+ConfigureWarmSetSnapshot(const char* path, const int64_t interval_sec) {
+    milvus::segcore::WarmSetSnapshot::GetInstance().Configure(path,
+                                                              interval_sec);
+}
+
 extern "C" void
 UpdateTieredStorageConfig(
     const int64_t loading_timeout_ms,
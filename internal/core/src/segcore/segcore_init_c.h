@@ -29,6 +29,21 @@ SegcoreSetChunkRows(const int64_t);
 void
 SegcoreSetEnableInterminSegmentIndex(const bool);
 
+void
+SegcoreSetEnableAsyncInterimIndex(const bool);
+
+void
+SegcoreSetEnablePredictiveWarmup(const bool);
+
+void
+SegcoreSetEnableTextLobCompression(const bool);
+
+void
+SegcoreSetTextMatchDeltaCommitIntervalMs(const int64_t);
+
+void
+SegcoreSetTextMatchDeltaMaxByteSize(const int64_t);
+
 void
 SegcoreSetStorageV3Enabled(const bool);
 
@@ -148,6 +163,20 @@ ConfigureTieredStorage(
     // async warmup prefetch pool threads
     const uint32_t prefetch_pool_threads);
 
+// Byte budget of the compressed in-memory tier of evicted cells, 0 disables
+// it.
+void
+ConfigureCompressedCellCache(const int64_t max_bytes);
+
+// Keeps the iterators of search_iterator v2 tokens alive between pages for
+// ttl_ms, within max_memory_bytes. Either <= 0 disables it.
+void
+ConfigureSearchIteratorSessions(const int64_t ttl_ms,
+                                const int64_t max_memory_bytes);
+
+void
+ConfigureWarmSetSnapshot(const char* path, const int64_t interval_sec);
+
 void
 UpdateTieredStorageConfig(const int64_t loading_timeout_ms,
                           const int64_t warmup_loading_timeout_ms,
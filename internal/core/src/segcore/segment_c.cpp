@@ -12,6 +12,8 @@
 #include "segcore/segment_c.h"
 #include "segcore/default_fs.h"
 
+#include <arrow/c/abi.h>
+#include <arrow/c/bridge.h>
 #include <folly/CancellationToken.h>
 #include <folly/ExceptionWrapper.h>
 #include <folly/Try.h>
@@ -44,6 +46,8 @@
 #include "common/protobuf_utils.h"
 #include "common/type_c.h"
 #include "exec/expression/ExprCache.h"
+#include "exec/expression/JsonPathCache.h"
+#include "exec/operator/SearchResultCache.h"
 #include "fmt/core.h"
 #include "folly/CancellationToken.h"
 #include "folly/executors/CPUThreadPoolExecutor.h"
@@ -64,6 +68,7 @@
 #include "query/PlanNode.h"
 #include "segcore/ChunkedSegmentSealedImpl.h"
 #include "segcore/Collection.h"
+#include "segcore/SealedSidecar.h"
 #include "segcore/SegcoreConfig.h"
 #include "segcore/SegmentGrowing.h"
 #include "segcore/SegmentGrowingImpl.h"
@@ -337,6 +342,14 @@ DeleteSegment(CSegmentInterface c_segment) {
     SCOPE_CGO_CALL_METRIC();
 
     auto s = static_cast<milvus::segcore::SegmentInterface*>(c_segment);
+    if (milvus::exec::SearchResultCache::IsEnabled()) {
+        milvus::exec::SearchResultCache::Instance().EraseSegment(
+            s->get_segment_id());
+    }
+    if (milvus::exec::JsonPathCache::IsEnabled()) {
+        milvus::exec::JsonPathCache::Instance().EraseSegment(
+            s->get_segment_id());
+    }
     delete s;
 }
 
@@ -365,6 +378,20 @@ GetSearchResultValidCount(CSearchResult search_result) {
     return res->valid_count_;
 }
 
+char*
+GetSearchResultProfile(CSearchResult search_result) {
+    auto res = static_cast<milvus::SearchResult*>(search_result);
+    if (res == nullptr || !res->query_profile_.has_value()) {
+        return nullptr;
+    }
+    auto json = res->query_profile_->ToJson();
+    char* profile = static_cast<char*>(malloc(json.size() + 1));
+    AssertInfo(profile != nullptr, "memory allocation for profile failed");
+    memcpy(profile, json.data(), json.size());
+    profile[json.size()] = '\0';
+    return profile;
+}
+
 // Verifies the plan's external field references against the loaded manifest,
 // after LazyCheckSchema refreshed the segment schema and manifest view.
 // Optionally ignores fields that the current execution path will not access.
@@ -586,6 +613,77 @@ AsyncRetrieve(CTraceContext c_trace,
         static_cast<milvus::futures::IFuture*>(future.release())));
 }
 
+CFuture*  // Future<struct ArrowArrayStream>
+AsyncRetrieveAsArrowStream(CTraceContext c_trace,
+                           CSegmentInterface c_segment,
+                           CRetrievePlan c_plan,
+                           uint64_t timestamp,
+                           int64_t limit_size,
+                           int64_t max_batch_rows,
+                           int32_t consistency_level,
+                           uint64_t collection_ttl,
+                           uint64_t entity_ttl_physical_time_us) {
+    auto segment = static_cast<milvus::segcore::SegmentInterface*>(c_segment);
+    auto plan = static_cast<const milvus::query::RetrievePlan*>(c_plan);
+    auto future = milvus::futures::Future<ArrowArrayStream>::async(
+        milvus::futures::getSearchCPUExecutor(),
+        milvus::futures::ExecutePriority::HIGH,
+        [c_trace,
+         segment,
+         plan,
+         timestamp,
+         limit_size,
+         max_batch_rows,
+         consistency_level,
+         collection_ttl,
+         entity_ttl_physical_time_us](folly::CancellationToken cancel_token) {
+            auto trace_ctx = milvus::tracer::TraceContext{
+                c_trace.traceID, c_trace.spanID, c_trace.traceFlags};
+            milvus::tracer::AutoSpan span(
+                "SegCoreRetrieveAsArrow", &trace_ctx, true);
+
+            milvus::OpContext op_ctx(cancel_token);
+            segment->LazyCheckSchema(plan->schema_, &op_ctx);
+            auto internal_segment =
+                static_cast<milvus::segcore::SegmentInternalInterface*>(
+                    segment);
+            CheckExternalFieldsInLoadedManifest(
+                plan->schema_, internal_segment, plan->access_entries_);
+
+            auto reader =
+                internal_segment->RetrieveAsArrow(&trace_ctx,
+                                                  plan,
+                                                  timestamp,
+                                                  limit_size,
+                                                  max_batch_rows,
+                                                  cancel_token,
+                                                  consistency_level,
+                                                  collection_ttl,
+                                                  entity_ttl_physical_time_us);
+
+            auto stream = std::make_unique<ArrowArrayStream>();
+            stream->release = nullptr;
+            auto status = arrow::ExportRecordBatchReader(reader, stream.get());
+            AssertInfo(status.ok(),
+                       "failed to export arrow stream: {}",
+                       status.ToString());
+            return stream.release();
+        });
+    return static_cast<CFuture*>(static_cast<void*>(
+        static_cast<milvus::futures::IFuture*>(future.release())));
+}
+
+void
+ReleaseArrowArrayStream(struct ArrowArrayStream* stream) {
+    if (stream == nullptr) {
+        return;
+    }
+    if (stream->release != nullptr) {
+        stream->release(stream);
+    }
+    delete stream;
+}
+
 CFuture*  // Future<CRetrieveResult>
 AsyncRetrieveByOffsets(CTraceContext c_trace,
                        CSegmentInterface c_segment,
@@ -1433,7 +1531,8 @@ BuildTextArrayForChunkWithSpillover(
     }
 
     // Batch pread all refs
-    auto texts = spillover->DecodeAndReadBatch(pending_refs);
+    auto batch = spillover->ReadBatch(pending_refs);
+    const auto& texts = batch.texts;
 
     // Build arrow array
     size_t batch_idx = 0;
@@ -1843,6 +1942,11 @@ FlushGrowingSegmentData(CSegmentInterface c_segment,
             allowed_field_ids.insert(config->allowed_field_ids[i]);
         }
         std::unordered_map<int64_t, BM25StatsAccumulator> bm25_stats;
+        // zone maps and pk order the sealed segment would otherwise derive
+        // by reading the flushed data back
+        std::unordered_map<int64_t, milvus::segcore::ZoneMap> zone_maps;
+        std::optional<milvus::segcore::PkOrderBuilder> pk_order;
+        auto pk_field_id = schema.get_primary_field_id();
 
         // Use get_field_ids() (ordered vector) instead of get_fields() (unordered_map)
         // to ensure deterministic column order matching the reader's expected order.
@@ -1922,6 +2026,17 @@ FlushGrowingSegmentData(CSegmentInterface c_segment,
                 }
                 bm25_stats.emplace(field_id.get(), BM25StatsAccumulator{});
             }
+            if (config->write_sealed_sidecars && field_id != RowFieldID &&
+                field_id != TimestampFieldID &&
+                data_type != milvus::DataType::TEXT) {
+                if (pk_field_id.has_value() && field_id == *pk_field_id &&
+                    milvus::segcore::PkOrderBuilder::Supports(*arrow_type)) {
+                    pk_order.emplace(start_offset);
+                }
+                if (milvus::segcore::ZoneMap::Supports(*arrow_type)) {
+                    zone_maps[field_id.get()].row_offset = start_offset;
+                }
+            }
 
             field_infos.push_back(std::move(info));
 
@@ -2105,6 +2220,18 @@ FlushGrowingSegmentData(CSegmentInterface c_segment,
                         has_timestamp = true;
                     }
                 }
+                auto zone_map_iter = zone_maps.find(field_id);
+                if (zone_map_iter != zone_maps.end()) {
+                    zone_map_iter->second.Append(*arr);
+                }
+                if (pk_order.has_value() &&
+                    field_info.field_id == *pk_field_id) {
+                    auto status = pk_order->Append(*arr);
+                    if (!status.ok()) {
+                        return milvus::FailureCStatus(milvus::UnexpectedError,
+                                                      status.ToString());
+                    }
+                }
                 arrays.push_back(arr);
 
                 auto stats_iter = bm25_stats.find(field_info.field_id.get());
@@ -2313,6 +2440,52 @@ FlushGrowingSegmentData(CSegmentInterface c_segment,
             transaction->UpdateStat(stat_key, stat_entry);
         }
 
+        // add zone map and pk order sidecars, one file per flushed range
+        std::vector<std::pair<std::string, std::vector<uint8_t>>> sidecars;
+        for (const auto& [field_id, zone_map] : zone_maps) {
+            sidecars.emplace_back(
+                fmt::format(
+                    "{}{}", milvus::segcore::kZoneMapStatPrefix, field_id),
+                zone_map.Serialize());
+        }
+        if (pk_order.has_value()) {
+            sidecars.emplace_back(
+                fmt::format("{}{}",
+                            milvus::segcore::kPkOrderStatPrefix,
+                            pk_field_id->get()),
+                pk_order->Finish());
+        }
+        for (const auto& [stat_key, serialized] : sidecars) {
+            milvus_storage::api::Statistics stat_entry;
+            auto existing_it = manifest->stats().find(stat_key);
+            if (existing_it != manifest->stats().end()) {
+                stat_entry = existing_it->second;
+            }
+
+            auto full_path = fmt::format("{}/_stats/{}/{}",
+                                         writer_config.segment_path,
+                                         stat_key,
+                                         config->sealed_sidecar_log_id);
+            auto write_status = WriteRawFile(fs, full_path, serialized);
+            if (!write_status.ok()) {
+                return milvus::FailureCStatus(milvus::UnexpectedError,
+                                              write_status.ToString());
+            }
+            stat_entry.paths.push_back(full_path);
+
+            int64_t memory_size = serialized.size();
+            auto mem_it = stat_entry.metadata.find("memory_size");
+            if (mem_it != stat_entry.metadata.end()) {
+                try {
+                    memory_size += std::stoll(mem_it->second);
+                } catch (...) {
+                    // rewritten below
+                }
+            }
+            stat_entry.metadata["memory_size"] = std::to_string(memory_size);
+            transaction->UpdateStat(stat_key, stat_entry);
+        }
+
         // commit
         auto commit_result = transaction->Commit();
         if (!commit_result.ok()) {
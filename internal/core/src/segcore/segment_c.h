@@ -157,6 +157,16 @@ DeleteSearchResult(CSearchResult search_result);
 int64_t
 GetSearchResultValidCount(CSearchResult search_result);
 
+/**
+ * @brief Get the runtime stats recorded for a search (EXPLAIN ANALYZE)
+ * @param search_result: The search result of a plan whose PlanOption set
+ *        collect_query_profile
+ * @return JSON encoded profile allocated with malloc, to be freed by the
+ *         caller; NULL if no stats were recorded
+ */
+char*
+GetSearchResultProfile(CSearchResult search_result);
+
 /**
  * @brief Execute search on a segment
  *
@@ -197,6 +207,27 @@ AsyncRetrieve(CTraceContext c_trace,
               uint64_t collection_ttl,
               uint64_t entity_ttl_physical_time_us);
 
+struct ArrowArrayStream;
+
+// Retrieve into an Arrow C stream of record batches read from chunk memory.
+// Fixed-width columns of consecutive rows reference the segment's chunks,
+// so the segment must not be released before the stream. Fails with
+// Unsupported for plans or fields the Arrow path can not serve; callers
+// fall back to AsyncRetrieve then. Release with ReleaseArrowArrayStream.
+CFuture*  // Future<struct ArrowArrayStream>
+AsyncRetrieveAsArrowStream(CTraceContext c_trace,
+                           CSegmentInterface c_segment,
+                           CRetrievePlan c_plan,
+                           uint64_t timestamp,
+                           int64_t limit_size,
+                           int64_t max_batch_rows,
+                           int32_t consistency_level,
+                           uint64_t collection_ttl,
+                           uint64_t entity_ttl_physical_time_us);
+
+void
+ReleaseArrowArrayStream(struct ArrowArrayStream* stream);
+
 CFuture*  // Future<CRetrieveResult>
 AsyncRetrieveByOffsets(CTraceContext c_trace,
                        CSegmentInterface c_segment,
@@ -318,6 +349,8 @@ typedef struct CFlushConfig {
     int64_t* bm25_stats_log_ids;   // array of BM25 stats log IDs
     size_t num_bm25_fields;        // number of BM25 output fields
     bool write_merged_bm25_stats;  // whether to write compound BM25 stats
+    bool write_sealed_sidecars;  // whether to write zone map/pk order stats
+    int64_t sealed_sidecar_log_id;  // log ID of the sidecar stats files
 } CFlushConfig;
 
 /**
@@ -14,6 +14,7 @@
 #include <filesystem>
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "cachinglayer/Utils.h"
@@ -22,6 +23,7 @@
 #include "common/EasyAssert.h"
 #include "common/Types.h"
 #include "common/SystemProperty.h"
+#include "segcore/CompressedCellCache.h"
 #include "segcore/Utils.h"
 #include "storage/ThreadPools.h"
 #include "mmap/Types.h"
@@ -81,6 +83,7 @@ ChunkTranslator::ChunkTranslator(
       field_id_(field_data_info.field_id),
       field_meta_(field_meta),
       key_(fmt::format("seg_{}_f_{}", segment_id, field_meta.get_id().get())),
+      compressed_cells_key_(CompressedCellCache::InstanceKey(key_)),
       use_mmap_(use_mmap),
       mmap_populate_(mmap_populate),
       file_infos_(std::move(file_infos)),
@@ -118,6 +121,19 @@ ChunkTranslator::ChunkTranslator(
                          meta_.num_rows_until_chunk_,
                          meta_.virt_chunk_order_,
                          meta_.vcid_to_cid_arr_);
+    loaded_cells_.assign(file_infos_.size(), false);
+}
+
+ChunkTranslator::~ChunkTranslator() {
+    CompressedCellCache::GetInstance().Erase(compressed_cells_key_);
+}
+
+bool
+ChunkTranslator::reloaded(milvus::cachinglayer::cid_t cid) {
+    std::lock_guard lock(loaded_mutex_);
+    bool loaded = loaded_cells_[cid];
+    loaded_cells_[cid] = true;
+    return loaded;
 }
 
 size_t
@@ -163,9 +179,26 @@ ChunkTranslator::get_cells(
         cells;
     cells.reserve(cids.size());
 
+    // cells kept compressed in memory since their last eviction don't need
+    // to be read again
+    auto& compressed_cells = CompressedCellCache::GetInstance();
+    const bool use_compressed_cells =
+        !use_mmap_ && !IsVectorDataType(field_meta_.get_data_type()) &&
+        compressed_cells.enabled();
+    std::unordered_map<milvus::cachinglayer::cid_t,
+                       std::unique_ptr<milvus::Chunk>>
+        decompressed;
     std::vector<std::string> remote_files;
     remote_files.reserve(cids.size());
     for (auto cid : cids) {
+        if (use_compressed_cells) {
+            auto buffers = compressed_cells.Get(compressed_cells_key_, cid);
+            if (!buffers.empty()) {
+                decompressed[cid] =
+                    make_chunk_from_buffer(field_meta_, buffers[0].second);
+                continue;
+            }
+        }
         remote_files.push_back(file_infos_[cid].file_path);
     }
 
@@ -174,7 +207,9 @@ ChunkTranslator::get_cells(
              segment_id_,
              field_id_,
              fmt::format("{}", fmt::join(cids, " ")));
-    LoadArrowReaderFromRemote(remote_files, channel, load_priority_);
+    if (!remote_files.empty()) {
+        LoadArrowReaderFromRemote(remote_files, channel, load_priority_);
+    }
 
     for (auto cid : cids) {
         // Check for cancellation before processing each chunk
@@ -182,7 +217,9 @@ ChunkTranslator::get_cells(
             ctx, segment_id_, field_id_, "ChunkTranslator::get_cells()");
 
         std::unique_ptr<milvus::Chunk> chunk = nullptr;
-        if (!use_mmap_) {
+        if (auto it = decompressed.find(cid); it != decompressed.end()) {
+            chunk = std::move(it->second);
+        } else if (!use_mmap_) {
             std::shared_ptr<milvus::ArrowDataWrapper> r;
             // this relies on the fact that channel is blocked when there is no data to pop
             bool popped = channel->pop(r);
@@ -190,6 +227,12 @@ ChunkTranslator::get_cells(
             arrow::ArrayVector array_vec =
                 read_single_column_batches(r->reader);
             chunk = create_chunk(field_meta_, array_vec);
+            if (use_compressed_cells && reloaded(cid)) {
+                compressed_cells.Put(
+                    compressed_cells_key_,
+                    cid,
+                    {{field_meta_.get_id(), chunk.get()}});
+            }
         } else {
             // we don't know the resulting file size beforehand, thus using a separate file for each chunk.
             auto filepath =
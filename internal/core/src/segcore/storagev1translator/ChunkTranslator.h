@@ -11,6 +11,7 @@
 
 #pragma once
 
+#include <mutex>
 #include <string>
 #include <utility>
 #include <vector>
@@ -74,6 +75,8 @@ class ChunkTranslator : public milvus::cachinglayer::Translator<milvus::Chunk> {
                     milvus::proto::common::LoadPriority load_priority,
                     const std::string& warmup_policy);
 
+    ~ChunkTranslator() override;
+
     size_t
     num_cells() const override;
     milvus::cachinglayer::cid_t
@@ -106,10 +109,17 @@ class ChunkTranslator : public milvus::cachinglayer::Translator<milvus::Chunk> {
     }
 
  private:
+    // Whether cid was loaded before, i.e. this load follows an eviction.
+    // Marks it loaded.
+    bool
+    reloaded(milvus::cachinglayer::cid_t cid);
+
     std::vector<FileInfo> file_infos_;
     int64_t segment_id_;
     int64_t field_id_;
     std::string key_;
+    // key of this instance's cells in the CompressedCellCache
+    std::string compressed_cells_key_;
     bool use_mmap_;
     bool mmap_populate_;
     CTMeta meta_;
@@ -117,6 +127,8 @@ class ChunkTranslator : public milvus::cachinglayer::Translator<milvus::Chunk> {
     std::string mmap_dir_path_;
     milvus::proto::common::LoadPriority load_priority_{
         milvus::proto::common::LoadPriority::HIGH};
+    std::mutex loaded_mutex_;
+    std::vector<bool> loaded_cells_;
 };
 
 }  // namespace milvus::segcore::storagev1translator
@@ -46,6 +46,7 @@
 #include "milvus-storage/common/constants.h"
 #include "milvus-storage/filesystem/fs.h"
 #include "mmap/Types.h"
+#include "segcore/CompressedCellCache.h"
 #include "segcore/InsertRecord.h"
 #include "segcore/Utils.h"
 #include "segcore/memory_planner.h"
@@ -94,6 +95,7 @@ GroupChunkTranslator::GroupChunkTranslator(
                                      column_group_info.field_id);
           }
       }()),
+      compressed_cells_key_(CompressedCellCache::InstanceKey(key_)),
       field_metas_(field_metas),
       column_group_info_(column_group_info),
       insert_files_(std::move(insert_files)),
@@ -136,6 +138,13 @@ GroupChunkTranslator::GroupChunkTranslator(
                                        return field.second.get_data_type() ==
                                               DataType::ARRAY;
                                    })),
+      compress_cells_(!use_mmap &&
+                      std::none_of(field_metas_.begin(),
+                                   field_metas_.end(),
+                                   [](const auto& field) {
+                                       return IsVectorDataType(
+                                           field.second.get_data_type());
+                                   })),
       load_priority_(load_priority) {
     // Build prefix sum for O(1) lookup in get_cid_from_file_and_row_group_index
     file_row_group_prefix_sum_.reserve(row_group_meta_list_.size() + 1);
@@ -198,6 +207,7 @@ GroupChunkTranslator::GroupChunkTranslator(
         meta_.num_rows_until_chunk_.push_back(cumulative_rows);
         meta_.chunk_memory_size_.push_back(cell_size);
     }
+    loaded_cells_.assign(num_cells, false);
 
     AssertInfo(
         meta_.num_rows_until_chunk_.back() == column_group_info_.row_count,
@@ -233,6 +243,15 @@ GroupChunkTranslator::GroupChunkTranslator(
 }
 
 GroupChunkTranslator::~GroupChunkTranslator() {
+    CompressedCellCache::GetInstance().Erase(compressed_cells_key_);
+}
+
+bool
+GroupChunkTranslator::reloaded(milvus::cachinglayer::cid_t cid) {
+    std::lock_guard lock(loaded_mutex_);
+    bool loaded = loaded_cells_[cid];
+    loaded_cells_[cid] = true;
+    return loaded;
 }
 
 size_t
@@ -332,10 +351,32 @@ GroupChunkTranslator::get_cells(milvus::OpContext* ctx,
             meta_.chunk_memory_size_.size());
     }
 
+    // cells kept compressed in memory since their last eviction don't need
+    // to be read again
+    std::unordered_map<cachinglayer::cid_t, std::unique_ptr<milvus::GroupChunk>>
+        completed_cells;
+    completed_cells.reserve(cids.size());
+    auto& compressed_cells = CompressedCellCache::GetInstance();
+    const bool use_compressed_cells =
+        compress_cells_ && compressed_cells.enabled();
+
     // Build CellSpec for each requested cid
     std::vector<milvus::segcore::CellSpec> cell_specs;
     cell_specs.reserve(cids.size());
     for (auto cid : cids) {
+        if (use_compressed_cells) {
+            auto buffers = compressed_cells.Get(compressed_cells_key_, cid);
+            if (!buffers.empty()) {
+                auto group_chunk = std::make_unique<milvus::GroupChunk>();
+                for (const auto& [fid, buffer] : buffers) {
+                    group_chunk->AddChunk(
+                        fid,
+                        make_chunk_from_buffer(field_metas_.at(fid), buffer));
+                }
+                completed_cells[cid] = std::move(group_chunk);
+                continue;
+            }
+        }
         auto [rg_start, rg_end] = meta_.get_row_group_range(cid);
         auto [file_idx, local_off] = get_file_and_row_group_offset(rg_start);
         cell_specs.push_back(
@@ -378,10 +419,6 @@ GroupChunkTranslator::get_cells(milvus::OpContext* ctx,
         column_group_info_.field_id);
 
     // Pop loop — batch tasks finalize cells before pushing.
-    std::unordered_map<cachinglayer::cid_t, std::unique_ptr<milvus::GroupChunk>>
-        completed_cells;
-    completed_cells.reserve(cids.size());
-
     try {
         std::shared_ptr<milvus::segcore::CellLoadResult> cell_data;
         while (channel->pop(cell_data)) {
@@ -505,6 +542,15 @@ GroupChunkTranslator::load_group_chunk(
     if (!use_mmap_) {
         chunks = create_group_chunk(
             field_ids, field_metas, array_vecs, mmap_populate_);
+        auto& compressed_cells = CompressedCellCache::GetInstance();
+        if (compress_cells_ && compressed_cells.enabled() && reloaded(cid)) {
+            std::vector<std::pair<FieldId, const Chunk*>> cell_chunks;
+            cell_chunks.reserve(field_ids.size());
+            for (auto fid : field_ids) {
+                cell_chunks.emplace_back(fid, chunks.at(fid).get());
+            }
+            compressed_cells.Put(compressed_cells_key_, cid, cell_chunks);
+        }
     } else {
         // Use a unique generation suffix to avoid file path collision when a
         // column group is replaced.  Without this, the new FileWriter would
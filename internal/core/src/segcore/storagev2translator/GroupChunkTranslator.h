@@ -18,6 +18,7 @@
 #include <string>
 #include <vector>
 #include <memory>
+#include <mutex>
 #include <unordered_map>
 
 #include "cachinglayer/Translator.h"
@@ -100,9 +101,16 @@ class GroupChunkTranslator
     int64_t
     loading_overhead_bytes(int64_t cell_size) const;
 
+    // Whether cid was loaded before, i.e. this load follows an eviction.
+    // Marks it loaded.
+    bool
+    reloaded(milvus::cachinglayer::cid_t cid);
+
     int64_t segment_id_;
     GroupChunkType group_chunk_type_{GroupChunkType::DEFAULT};
     std::string key_;
+    // key of this instance's cells in the CompressedCellCache
+    std::string compressed_cells_key_;
     std::unordered_map<FieldId, FieldMeta> field_metas_;
     FieldDataInfo column_group_info_;
     std::vector<std::string> insert_files_;
@@ -114,8 +122,12 @@ class GroupChunkTranslator
     bool use_mmap_;
     bool mmap_populate_;
     bool has_array_field_{false};
+    // whether cells may be kept in the CompressedCellCache
+    bool compress_cells_{false};
     milvus::proto::common::LoadPriority load_priority_{
         milvus::proto::common::LoadPriority::HIGH};
+    std::mutex loaded_mutex_;
+    std::vector<bool> loaded_cells_;
 };
 
 }  // namespace milvus::segcore::storagev2translator
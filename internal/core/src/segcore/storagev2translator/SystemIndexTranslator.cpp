@@ -19,6 +19,7 @@
 #include <algorithm>
 #include <fmt/core.h>
 #include <numeric>
+#include <tuple>
 #include <utility>
 
 #include "common/Chunk.h"
@@ -50,6 +51,38 @@ build_timestamp_index(const Timestamp* data, size_t num_rows) {
     return index;
 }
 
+// Inserts pks into pk2offset run by run in the order of pk_orders and seals
+// it by merging the runs. Sorts instead if a run turns out not to be in pk
+// order.
+template <typename T>
+void
+insert_in_pk_order(OffsetMap& pk2offset,
+                   const std::vector<T>& pks,
+                   const std::vector<PkOrderBuilder::PkOrder>& pk_orders) {
+    std::vector<int64_t> run_sizes;
+    run_sizes.reserve(pk_orders.size());
+    bool in_order = true;
+    for (const auto& pk_order : pk_orders) {
+        for (int64_t i = 0; i < pk_order.num_rows; ++i) {
+            auto offset = pk_order.sorted ? pk_order.row_offset + i
+                                          : pk_order.offsets[i];
+            if (i > 0) {
+                auto prev = pk_order.sorted ? offset - 1
+                                            : pk_order.offsets[i - 1];
+                in_order = in_order && std::tie(pks[prev], prev) <
+                                           std::tie(pks[offset], offset);
+            }
+            pk2offset.insert(pks[offset], offset);
+        }
+        run_sizes.push_back(pk_order.num_rows);
+    }
+    if (in_order) {
+        pk2offset.seal_sorted_runs(run_sizes);
+    } else {
+        pk2offset.seal();
+    }
+}
+
 std::unique_ptr<OffsetMap>
 create_offset_map(DataType data_type) {
     switch (data_type) {
@@ -226,11 +259,13 @@ PkIndexTranslator::PkIndexTranslator(
     int64_t segment_id,
     std::shared_ptr<ChunkedColumnInterface> column,
     DataType data_type,
-    bool is_sorted_by_pk)
+    bool is_sorted_by_pk,
+    std::shared_ptr<const SealedSidecars> sidecars)
     : segment_id_(segment_id),
       column_(std::move(column)),
       data_type_(data_type),
       is_sorted_by_pk_(is_sorted_by_pk),
+      sidecars_(std::move(sidecars)),
       key_(fmt::format("seg_{}_pk_index", segment_id)),
       meta_(milvus::cachinglayer::StorageType::MEMORY,
             milvus::cachinglayer::CellIdMappingMode::ALWAYS_ZERO,
@@ -280,6 +315,17 @@ PkIndexTranslator::get_cells(milvus::OpContext* ctx,
     std::iota(chunk_ids.begin(), chunk_ids.end(), 0);
     column_->PrefetchChunks(ctx, chunk_ids);
 
+    // with pk orders covering the segment, pks are collected first and
+    // inserted in pk order
+    const std::vector<PkOrderBuilder::PkOrder>* pk_orders = nullptr;
+    if (!is_sorted_by_pk_ && sidecars_ != nullptr &&
+        !sidecars_->pk_orders.empty()) {
+        const auto& last = sidecars_->pk_orders.back();
+        if (last.row_offset + last.num_rows == column_->NumRows()) {
+            pk_orders = &sidecars_->pk_orders;
+        }
+    }
+
     int64_t offset = 0;
     switch (data_type_) {
         case DataType::INT64: {
@@ -295,12 +341,15 @@ PkIndexTranslator::get_cells(milvus::OpContext* ctx,
                 for (int64_t j = 0; j < chunk_num_rows; ++j) {
                     auto pk = pks[j];
                     all_pks.push_back(pk);
-                    if (pk2offset) {
+                    if (pk2offset && pk_orders == nullptr) {
                         pk2offset->insert(pk, offset);
                     }
                     ++offset;
                 }
             }
+            if (pk_orders != nullptr) {
+                insert_in_pk_order(*pk2offset, all_pks, *pk_orders);
+            }
             offset2pk = std::make_unique<CompressedInt64PkArray>();
             offset2pk->build(all_pks.data(), all_pks.size());
             break;
@@ -309,16 +358,25 @@ PkIndexTranslator::get_cells(milvus::OpContext* ctx,
             if (!is_sorted_by_pk_) {
                 pk2offset = create_offset_map(data_type_);
             }
+            std::vector<std::string> all_pks;
+            if (pk_orders != nullptr) {
+                all_pks.reserve(column_->NumRows());
+            }
             for (int64_t i = 0; i < num_chunks; ++i) {
                 auto pw = column_->StringViews(ctx, i);
                 auto& pks = pw.get().first;
                 for (auto pk : pks) {
-                    if (pk2offset) {
+                    if (pk_orders != nullptr) {
+                        all_pks.emplace_back(pk);
+                    } else if (pk2offset) {
                         pk2offset->insert(std::string(pk), offset);
                     }
                     ++offset;
                 }
             }
+            if (pk_orders != nullptr) {
+                insert_in_pk_order(*pk2offset, all_pks, *pk_orders);
+            }
             break;
         }
         default:
@@ -327,7 +385,7 @@ PkIndexTranslator::get_cells(milvus::OpContext* ctx,
                       data_type_);
     }
 
-    if (pk2offset) {
+    if (pk2offset && pk_orders == nullptr) {
         pk2offset->seal();
     }
 
@@ -23,6 +23,7 @@
 #include "common/Types.h"
 #include "mmap/ChunkedColumnInterface.h"
 #include "segcore/InsertRecord.h"
+#include "segcore/SealedSidecar.h"
 #include "segcore/TimestampIndex.h"
 
 namespace milvus::segcore::storagev2translator {
@@ -150,7 +151,8 @@ class PkIndexTranslator : public milvus::cachinglayer::Translator<PkIndexCell> {
     PkIndexTranslator(int64_t segment_id,
                       std::shared_ptr<ChunkedColumnInterface> column,
                       DataType data_type,
-                      bool is_sorted_by_pk);
+                      bool is_sorted_by_pk,
+                      std::shared_ptr<const SealedSidecars> sidecars = nullptr);
 
     ~PkIndexTranslator() override = default;
 
@@ -186,6 +188,8 @@ class PkIndexTranslator : public milvus::cachinglayer::Translator<PkIndexCell> {
     std::shared_ptr<ChunkedColumnInterface> column_;
     DataType data_type_;
     bool is_sorted_by_pk_;
+    // pk orders of the flushed ranges, used to merge instead of sort pks
+    std::shared_ptr<const SealedSidecars> sidecars_;
     std::string key_;
     milvus::cachinglayer::Meta meta_;
 };
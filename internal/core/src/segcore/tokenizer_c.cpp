@@ -71,6 +71,36 @@ create_token_stream(CTokenizer tokenizer, const char* text, uint32_t text_len) {
     return impl->CreateTokenStream(std::string(text, text_len)).release();
 }
 
+CStatus
+tokenize_batch(CTokenizer tokenizer,
+               const char* data,
+               const uint64_t* text_offsets,
+               uint64_t num_texts,
+               bool term_freqs,
+               CTokenBatch* batch) {
+    try {
+        auto impl = reinterpret_cast<milvus::tantivy::Tokenizer*>(tokenizer);
+        auto tokens = std::make_unique<milvus::tantivy::TokenBatch>(
+            impl->TokenizeBatch(data, text_offsets, num_texts, term_freqs));
+        batch->token_data = tokens->data.data();
+        batch->token_offsets = tokens->offsets.data();
+        batch->positions = term_freqs ? nullptr : tokens->positions.data();
+        batch->term_freqs = term_freqs ? tokens->freqs.data() : nullptr;
+        batch->token_counts = tokens->token_counts.data();
+        batch->num_tokens = tokens->size();
+        batch->impl = tokens.release();
+        return milvus::SuccessCStatus();
+    } catch (std::exception& e) {
+        return milvus::FailureCStatus(&e);
+    }
+}
+
+void
+free_token_batch(CTokenBatch* batch) {
+    delete static_cast<milvus::tantivy::TokenBatch*>(batch->impl);
+    batch->impl = nullptr;
+}
+
 CValidateResult
 validate_tokenizer(const char* params, const char* extra_info) {
     try {
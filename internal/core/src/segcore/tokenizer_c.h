@@ -48,6 +48,36 @@ validate_tokenizer(const char* params, const char* extra_info);
 CTokenStream
 create_token_stream(CTokenizer tokenizer, const char* text, uint32_t text_len);
 
+// Tokens of a batch of texts in one arena. Token i is
+// token_data[token_offsets[i], token_offsets[i + 1]), not NUL terminated, and
+// the token_counts[j] tokens of text j follow those of text j - 1.
+typedef struct CTokenBatch {
+    void* impl;
+    const char* token_data;
+    const uint64_t* token_offsets;
+    // position of each token, NULL if term frequencies were aggregated
+    const int64_t* positions;
+    // frequency of each token, NULL if term frequencies were not aggregated
+    const uint32_t* term_freqs;
+    const uint64_t* token_counts;
+    uint64_t num_tokens;
+} CTokenBatch;
+
+// Tokenizes the texts data[text_offsets[i], text_offsets[i + 1]) for i in
+// [0, num_texts) in one call. With term_freqs, the tokens of each text are
+// aggregated into its distinct terms and their frequencies. The batch must be
+// released with free_token_batch.
+CStatus
+tokenize_batch(CTokenizer tokenizer,
+               const char* data,
+               const uint64_t* text_offsets,
+               uint64_t num_texts,
+               bool term_freqs,
+               CTokenBatch* batch);
+
+void
+free_token_batch(CTokenBatch* batch);
+
 CStatus
 validate_text_schema(const uint8_t* field_schema, uint64_t length);
 
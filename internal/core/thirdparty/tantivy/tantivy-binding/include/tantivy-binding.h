@@ -103,6 +103,8 @@ struct TantivyToken {
   int64_t position_length;
 };
 
+using TokenBatchFn = void(*)(void*, uintptr_t, const uint8_t*, uintptr_t, int64_t);
+
 extern "C" {
 
 void free_rust_array(RustArray array);
@@ -600,6 +602,13 @@ const char *tantivy_token_stream_get_token(void *token_stream);
 
 TantivyToken tantivy_token_stream_get_detailed_token(void *token_stream);
 
+RustResult tantivy_tokenize_batch(void *tokenizer,
+                                  const uint8_t *data,
+                                  const uint64_t *offsets,
+                                  uintptr_t num_texts,
+                                  void *ctx,
+                                  TokenBatchFn on_token);
+
 RustResult tantivy_create_analyzer(const char *analyzer_params, const char *extra_info);
 
 RustResult tantivy_validate_analyzer(const char *analyzer_params, const char *extra_info);
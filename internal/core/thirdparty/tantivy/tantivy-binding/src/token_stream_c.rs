@@ -1,8 +1,9 @@
 use std::ffi::c_char;
 
 use libc::c_void;
-use tantivy::tokenizer::{BoxTokenStream, TextAnalyzer, Token};
+use tantivy::tokenizer::{BoxTokenStream, TextAnalyzer, Token, TokenStream};
 
+use crate::array::RustResult;
 use crate::string_c::c_str_to_str;
 use crate::{
     string_c::create_string,
@@ -67,3 +68,45 @@ pub extern "C" fn tantivy_token_stream_get_detailed_token(
     let real = token_stream as *mut BoxTokenStream<'_>;
     TantivyToken::from_token(unsafe { (*real).token() })
 }
+
+// Called with (ctx, text index, token bytes, token length, token position).
+pub(crate) type TokenBatchFn = extern "C" fn(*mut c_void, usize, *const u8, usize, i64);
+
+// Tokenizes the texts data[offsets[i], offsets[i + 1]) for i in [0, num_texts)
+// in one call, passing every token to `on_token` in order. The token bytes are
+// only valid during the callback.
+#[no_mangle]
+pub extern "C" fn tantivy_tokenize_batch(
+    tokenizer: *mut c_void,
+    data: *const u8,
+    offsets: *const u64,
+    num_texts: usize,
+    ctx: *mut c_void,
+    on_token: TokenBatchFn,
+) -> RustResult {
+    let analyzer = unsafe { &mut *(tokenizer as *mut TextAnalyzer) };
+    let offsets = unsafe { std::slice::from_raw_parts(offsets, num_texts + 1) };
+    for i in 0..num_texts {
+        let (begin, end) = (offsets[i] as usize, offsets[i + 1] as usize);
+        if begin == end {
+            continue;
+        }
+        let bytes = unsafe { std::slice::from_raw_parts(data.add(begin), end - begin) };
+        let text = match std::str::from_utf8(bytes) {
+            Ok(text) => text,
+            Err(e) => {
+                return RustResult::from_error(format!("text {} is not utf8: {}", i, e));
+            }
+        };
+        analyzer.token_stream(text).process(&mut |token| {
+            on_token(
+                ctx,
+                i,
+                token.text.as_ptr(),
+                token.text.len(),
+                token.position as i64,
+            );
+        });
+    }
+    RustResult::from_success()
+}
@@ -1,5 +1,11 @@
 #pragma once
 
+#include <algorithm>
+#include <numeric>
+#include <string>
+#include <string_view>
+#include <vector>
+
 #include "tantivy-binding.h"
 #include "rust-binding.h"
 #include "rust-hashmap.h"
@@ -9,6 +15,73 @@
 #include "common/Utils.h"
 namespace milvus::tantivy {
 
+// Tokens of a batch of texts in one arena. Token i is
+// data[offsets[i], offsets[i + 1]), and the token_counts[j] tokens of text j
+// follow those of text j - 1. Once aggregated, the tokens of a text are its
+// distinct terms in byte order, freqs holds how often each occurs and
+// positions is empty.
+struct TokenBatch {
+    std::string data;
+    std::vector<uint64_t> offsets{0};
+    std::vector<int64_t> positions;
+    std::vector<uint32_t> freqs;
+    std::vector<uint64_t> token_counts;
+
+    size_t
+    size() const {
+        return offsets.size() - 1;
+    }
+
+    std::string_view
+    token(size_t i) const {
+        return std::string_view(data).substr(offsets[i],
+                                             offsets[i + 1] - offsets[i]);
+    }
+
+    static void
+    Append(void* ctx,
+           uintptr_t text,
+           const uint8_t* token,
+           uintptr_t len,
+           int64_t position) {
+        auto batch = static_cast<TokenBatch*>(ctx);
+        batch->data.append(reinterpret_cast<const char*>(token), len);
+        batch->offsets.push_back(batch->data.size());
+        batch->positions.push_back(position);
+        ++batch->token_counts[text];
+    }
+
+    void
+    AggregateTermFreqs() {
+        TokenBatch terms;
+        terms.data.reserve(data.size());
+        terms.token_counts.resize(token_counts.size(), 0);
+        std::vector<uint64_t> order;
+        uint64_t first = 0;
+        for (size_t text = 0; text < token_counts.size(); ++text) {
+            order.resize(token_counts[text]);
+            std::iota(order.begin(), order.end(), first);
+            std::sort(order.begin(), order.end(), [&](auto a, auto b) {
+                return token(a) < token(b);
+            });
+            for (auto i : order) {
+                auto term = token(i);
+                if (terms.token_counts[text] > 0 &&
+                    terms.token(terms.size() - 1) == term) {
+                    ++terms.freqs.back();
+                    continue;
+                }
+                terms.data.append(term);
+                terms.offsets.push_back(terms.data.size());
+                terms.freqs.push_back(1);
+                ++terms.token_counts[text];
+            }
+            first += token_counts[text];
+        }
+        *this = std::move(terms);
+    }
+};
+
 struct Tokenizer {
  public:
     NO_COPY_OR_ASSIGN(Tokenizer);
@@ -51,6 +124,31 @@ struct Tokenizer {
         return std::make_unique<TokenStream>(token_stream, shared_text);
     }
 
+    // Tokenizes the texts data[text_offsets[i], text_offsets[i + 1]) for i in
+    // [0, num_texts) with a single call into the analyzer.
+    TokenBatch
+    TokenizeBatch(const char* data,
+                  const uint64_t* text_offsets,
+                  size_t num_texts,
+                  bool term_freqs) {
+        TokenBatch batch;
+        batch.token_counts.resize(num_texts, 0);
+        auto res = RustResultWrapper(
+            tantivy_tokenize_batch(ptr_,
+                                   reinterpret_cast<const uint8_t*>(data),
+                                   text_offsets,
+                                   num_texts,
+                                   &batch,
+                                   &TokenBatch::Append));
+        AssertInfo(res.result_->success,
+                   "Tokenize batch failed: {}",
+                   res.result_->error);
+        if (term_freqs) {
+            batch.AggregateTermFreqs();
+        }
+        return batch;
+    }
+
     std::unique_ptr<Tokenizer>
     Clone() {
         auto newptr = tantivy_clone_analyzer(ptr_);
@@ -180,3 +180,82 @@ TEST_F(TextLobSpilloverTest, EmptyText) {
 
     ASSERT_EQ(read_back, "");
 }
+
+TEST_F(TextLobSpilloverTest, CompressedWriteAndRead) {
+    int64_t segment_id = 12345;
+    FieldId field_id(100);
+    TextLobSpillover spillover(segment_id, field_id, test_dir_, true);
+
+    std::string repetitive;
+    for (int i = 0; i < 1000; i++) {
+        repetitive += "milvus text " + std::to_string(i % 10) + " ";
+    }
+    std::string random_text(1024, '\0');
+    uint32_t seed = 42;
+    for (auto& c : random_text) {
+        seed = seed * 1103515245 + 12345;
+        c = static_cast<char>(seed >> 24);
+    }
+
+    auto compressed_ref = spillover.WriteAndEncode(repetitive);
+    auto raw_ref = spillover.WriteAndEncode(random_text);
+    auto short_ref = spillover.WriteAndEncode("short");
+    ASSERT_EQ(TextLobRef::Decode(compressed_ref).flags,
+              TextLobRef::kLz4Compressed);
+    ASSERT_LT(TextLobRef::Decode(compressed_ref).size, repetitive.size() / 4);
+    ASSERT_EQ(TextLobRef::Decode(raw_ref).flags, 0);
+    ASSERT_EQ(TextLobRef::Decode(short_ref).flags, 0);
+    ASSERT_LT(spillover.GetDiskUsage(),
+              repetitive.size() / 4 + random_text.size() + 5);
+
+    ASSERT_EQ(spillover.DecodeAndRead(compressed_ref), repetitive);
+    ASSERT_EQ(spillover.DecodeAndRead(raw_ref), random_text);
+    ASSERT_EQ(spillover.DecodeAndRead(short_ref), "short");
+
+    auto batch = spillover.ReadBatch({short_ref, compressed_ref, raw_ref});
+    ASSERT_EQ(batch.texts.size(), 3);
+    ASSERT_EQ(batch.texts[0], "short");
+    ASSERT_EQ(batch.texts[1], repetitive);
+    ASSERT_EQ(batch.texts[2], random_text);
+}
+
+TEST_F(TextLobSpilloverTest, ReadBatchCoalescesAndSplitsRanges) {
+    int64_t segment_id = 12345;
+    FieldId field_id(100);
+    TextLobSpillover spillover(segment_id, field_id, test_dir_);
+
+    // small texts coalesce into shared ranges, the large ones span more than
+    // kMaxRangeBytes and are read in parallel
+    std::vector<std::string> texts;
+    std::vector<std::string> refs;
+    for (int i = 0; i < 200; i++) {
+        auto size = i % 50 == 0 ? 512 * 1024 : i;
+        texts.emplace_back(size, static_cast<char>('a' + i % 26));
+        refs.push_back(spillover.WriteAndEncode(texts.back()));
+    }
+
+    // out of file order, with duplicates and every third ref skipped
+    std::vector<std::string_view> ref_views;
+    std::vector<int> expected;
+    for (int i = 199; i >= 0; i--) {
+        if (i % 3 == 0) {
+            continue;
+        }
+        ref_views.push_back(refs[i]);
+        expected.push_back(i);
+        if (i % 7 == 0) {
+            ref_views.push_back(refs[i]);
+            expected.push_back(i);
+        }
+    }
+    auto batch = spillover.ReadBatch(ref_views);
+    ASSERT_EQ(batch.texts.size(), expected.size());
+    for (size_t j = 0; j < expected.size(); j++) {
+        ASSERT_EQ(batch.texts[j], texts[expected[j]]) << "ref " << expected[j];
+    }
+
+    auto strings = spillover.DecodeAndReadBatch(ref_views);
+    ASSERT_EQ(strings.size(), expected.size());
+    ASSERT_EQ(strings.front(), texts[expected.front()]);
+    ASSERT_TRUE(spillover.ReadBatch({}).texts.empty());
+}
@@ -423,6 +423,100 @@ TEST_F(MvccFastPathTest, VisibilityFilterDisabled_PreservesUpstreamFilter) {
         << "upstream scalar filter should still filter out some rows";
 }
 
+// ---------------------------------------------------------------------------
+// A selective filter hands its kept rows to MvccNode as a sparse FilterResult,
+// which MvccNode narrows to the visible rows alongside the bitmap output.
+// ---------------------------------------------------------------------------
+TEST_F(MvccFastPathTest, SelectiveFilter_SparseFilterResult) {
+    auto segment = CreateSealedSegmentWithDeletes(5);
+
+    proto::plan::GenericValue value;
+    value.set_int64_val(10);
+    auto expr = std::make_shared<expr::UnaryRangeFilterExpr>(
+        expr::ColumnInfo(int64_fid_, DataType::INT64),
+        proto::plan::OpType::LessThan,
+        value,
+        std::vector<proto::plan::GenericValue>{});
+
+    auto filter_node = std::make_shared<plan::FilterBitsNode>("filter_1", expr);
+    auto mvcc_node = std::make_shared<plan::MvccNode>(
+        "mvcc_1", std::vector<plan::PlanNodePtr>{filter_node});
+    auto plan = plan::PlanFragment(mvcc_node);
+
+    auto query_context = std::make_shared<QueryContext>(
+        "test_sparse_filter_result",
+        segment.get(),
+        N_,
+        MAX_TIMESTAMP,
+        0,
+        0,
+        query::PlanOptions{false},
+        std::make_shared<QueryConfig>(
+            std::unordered_map<std::string, std::string>{}));
+
+    auto task =
+        Task::Create("task_sparse_filter_result", plan, 0, query_context);
+    RowVectorPtr output;
+    for (;;) {
+        auto current = task->Next();
+        if (!current) {
+            break;
+        }
+        output = current;
+    }
+
+    ASSERT_NE(output, nullptr);
+    auto col = std::static_pointer_cast<ColumnVector>(output->child(0));
+    TargetBitmapView view(col->GetRawData(), col->size());
+    const auto& filter_result = query_context->get_filter_result();
+    ASSERT_NE(filter_result, nullptr);
+    EXPECT_EQ(filter_result->kind(), FilterResult::Kind::kSortedOffsets);
+    // counter < 10 keeps rows 0..9, of which the first five are deleted
+    EXPECT_EQ(filter_result->kept_count(), 5);
+    EXPECT_EQ(filter_result->kept_count(),
+              static_cast<int64_t>(view.size() - view.count()));
+    for (int64_t i = 0; i < N_; ++i) {
+        ASSERT_EQ(filter_result->IsKept(i), !view[i]) << i;
+    }
+}
+
+// ---------------------------------------------------------------------------
+// A filter keeping most rows stays on the bitmap only.
+// ---------------------------------------------------------------------------
+TEST_F(MvccFastPathTest, BroadFilter_NoSparseFilterResult) {
+    auto segment = CreateSealedSegment();
+
+    proto::plan::GenericValue value;
+    value.set_int64_val(N_ / 2);
+    auto expr = std::make_shared<expr::UnaryRangeFilterExpr>(
+        expr::ColumnInfo(int64_fid_, DataType::INT64),
+        proto::plan::OpType::LessThan,
+        value,
+        std::vector<proto::plan::GenericValue>{});
+
+    auto filter_node = std::make_shared<plan::FilterBitsNode>("filter_1", expr);
+    auto mvcc_node = std::make_shared<plan::MvccNode>(
+        "mvcc_1", std::vector<plan::PlanNodePtr>{filter_node});
+    auto plan = plan::PlanFragment(mvcc_node);
+
+    auto query_context = std::make_shared<QueryContext>(
+        "test_broad_filter_result",
+        segment.get(),
+        N_,
+        MAX_TIMESTAMP,
+        0,
+        0,
+        query::PlanOptions{false},
+        std::make_shared<QueryConfig>(
+            std::unordered_map<std::string, std::string>{}));
+
+    auto task =
+        Task::Create("task_broad_filter_result", plan, 0, query_context);
+    while (task->Next()) {
+    }
+    EXPECT_EQ(query_context->get_filter_result(), nullptr);
+}
+
 // ---------------------------------------------------------------------------
 // visibilityFilterEnabled=false on growing segment: still skips all filtering
 // ---------------------------------------------------------------------------
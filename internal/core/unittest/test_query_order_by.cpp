@@ -11,9 +11,11 @@
 
 #include <gtest/gtest.h>
 #include <algorithm>
+#include <functional>
 #include <set>
 #include <vector>
 #include "test_utils/DataGen.h"
+#include "segcore/ChunkedSegmentSealedImpl.h"
 #include "segcore/SegmentSealed.h"
 #include "plan/PlanNode.h"
 #include "plan/PlanNodeIdGenerator.h"
@@ -22,11 +24,15 @@
 #include "exec/QueryContext.h"
 #include "common/Consts.h"
 #include "common/FieldData.h"
+#include "common/LoadInfo.h"
+#include "expr/ITypeExpr.h"
+#include "index/ScalarIndexSort.h"
 #include "pb/plan.pb.h"
 #include "query/ExecPlanNodeVisitor.h"
 #include "query/PlanImpl.h"
 #include "query/PlanNode.h"
 #include "query/PlanProto.h"
+#include "test_utils/cachinglayer_test_utils.h"
 
 using namespace milvus;
 using namespace milvus::segcore;
@@ -54,6 +60,25 @@ SetInt64FieldData(GeneratedData& raw_data,
     ThrowInfo(FieldIDInvalid, "field id not found");
 }
 
+void
+SetValidData(GeneratedData& raw_data,
+             FieldId field_id,
+             const std::vector<bool>& valid) {
+    for (int i = 0; i < raw_data.raw_->fields_data_size(); i++) {
+        auto* field_data = raw_data.raw_->mutable_fields_data(i);
+        if (field_data->field_id() != field_id.get()) {
+            continue;
+        }
+        auto* valid_data = field_data->mutable_valid_data();
+        valid_data->Clear();
+        for (auto v : valid) {
+            valid_data->Add(v);
+        }
+        return;
+    }
+    ThrowInfo(FieldIDInvalid, "field id not found");
+}
+
 void
 SetIntArrayFieldData(GeneratedData& raw_data,
                      FieldId field_id,
@@ -799,3 +824,374 @@ TEST_P(QueryOrderByTest, OrderByMultiKey) {
             << "No duplicate int8 values found — secondary sort was not tested";
     }
 }
+
+// Covers the ProjectNode pushdowns that pick rows from a sorted scalar index,
+// or from a zone-map guided chunk scan, instead of projecting every matching
+// row. Row 4 is deleted and row 1 is filtered out, so both the MVCC and the
+// filter bitmap must be honoured. "rank" is loaded as two chunks of five rows
+// so that the chunk scan can skip by zone map; "score" is all null.
+class QueryIndexOrderTest : public testing::TestWithParam<bool> {
+ protected:
+    void
+    SetUp() override {
+        Load(/*sorted_by_pk=*/true);
+        milvus::exec::expression::FunctionFactory::Instance().Initialize();
+    }
+
+    void
+    Load(bool sorted_by_pk) {
+        schema_ = std::make_shared<Schema>();
+        schema_->AddDebugField(
+            "fakevec", DataType::VECTOR_FLOAT, 16, knowhere::metric::L2);
+        rank_fid_ = schema_->AddDebugField("rank", DataType::INT64, true);
+        score_fid_ = schema_->AddDebugField("score", DataType::INT64, true);
+        pk_fid_ = schema_->AddDebugField("id", DataType::INT64);
+        schema_->set_primary_field_id(pk_fid_);
+
+        auto raw_data = DataGen(schema_, kNumRows, 42, 0, 1, 10, 1, false);
+        SetInt64FieldData(raw_data, pk_fid_, {0, 1, 2, 3, 4, 5, 6, 7, 8, 9});
+        SetValidData(raw_data, score_fid_, std::vector<bool>(kNumRows, false));
+        auto segment = CreateSealedSegment(schema_,
+                                           empty_index_meta,
+                                           /*segment_id=*/0,
+                                           SegcoreConfig::default_config(),
+                                           sorted_by_pk);
+        LoadGeneratedDataIntoSegment(
+            raw_data, segment.get(), false, {rank_fid_.get()});
+        segment_ = SegmentSealedSPtr(segment.release());
+
+        std::vector<FieldDataPtr> chunks;
+        for (int64_t begin = 0; begin < kNumRows; begin += kChunkRows) {
+            uint8_t valid_bits = 0;
+            for (int64_t i = 0; i < kChunkRows; ++i) {
+                valid_bits |= valid_[begin + i] << i;
+            }
+            auto chunk = storage::CreateFieldData(
+                DataType::INT64, DataType::NONE, true, 1, kChunkRows);
+            chunk->FillFieldData(
+                ranks_.data() + begin, &valid_bits, kChunkRows, 0);
+            chunks.push_back(chunk);
+        }
+        auto cm = storage::RemoteChunkManagerSingleton::GetInstance()
+                      .GetRemoteChunkManager();
+        auto load_info = PrepareSingleFieldInsertBinlog(kCollectionID,
+                                                        kPartitionID,
+                                                        kSegmentID,
+                                                        rank_fid_.get(),
+                                                        chunks,
+                                                        cm);
+        segment_->LoadFieldData(load_info);
+
+        if (WithIndex()) {
+            auto index = index::CreateScalarIndexSort<int64_t>();
+            std::unique_ptr<bool[]> valid(new bool[kNumRows]);
+            std::copy(valid_.begin(), valid_.end(), valid.get());
+            index->Build(kNumRows, ranks_.data(), valid.get());
+            LoadIndexInfo info;
+            info.field_id = rank_fid_.get();
+            info.field_type = DataType::INT64;
+            info.index_params = GenIndexParams(index.get());
+            info.cache_index = CreateTestCacheIndex("test", std::move(index));
+            segment_->LoadIndex(info);
+        }
+
+        auto ids = std::make_unique<IdArray>();
+        ids->mutable_int_id()->mutable_data()->Add(4);
+        std::vector<Timestamp> timestamps{100};
+        LoadDeletedRecordInfo deleted = {timestamps.data(), ids.get(), 1};
+        segment_->LoadDeletedRecord(deleted);
+    }
+
+    bool
+    WithIndex() const {
+        return GetParam();
+    }
+
+    // Runs Mvcc -> Filter(id != 1) -> Project(rank, offset) and returns the
+    // projected segment offsets in output order, -1 for a row of nulls.
+    std::vector<int64_t>
+    Project(const std::function<void(ProjectNode&)>& configure) {
+        std::vector<PlanNodePtr> sources;
+        PlanNodePtr mvcc_node =
+            std::make_shared<MvccNode>(GetNextPlanNodeId(), sources);
+        sources = {mvcc_node};
+
+        proto::plan::GenericValue val;
+        val.set_int64_val(1);
+        auto filter = std::make_shared<expr::UnaryRangeFilterExpr>(
+            expr::ColumnInfo(pk_fid_, DataType::INT64),
+            proto::plan::OpType::NotEqual,
+            val,
+            std::vector<proto::plan::GenericValue>{});
+        PlanNodePtr filter_node = std::make_shared<FilterBitsNode>(
+            GetNextPlanNodeId(), filter, sources);
+        sources = {filter_node};
+
+        auto project_node = std::make_shared<ProjectNode>(
+            GetNextPlanNodeId(),
+            std::vector<FieldId>{rank_fid_, SegmentOffsetFieldID},
+            std::vector<std::string>{"rank", "__segment_offset__"},
+            std::vector<DataType>{DataType::INT64, DataType::INT64},
+            sources);
+        configure(*project_node);
+
+        auto query_context = std::make_shared<milvus::exec::QueryContext>(
+            "test_index_order",
+            segment_.get(),
+            kNumRows,
+            MAX_TIMESTAMP,
+            0,
+            0,
+            query::PlanOptions{false},
+            std::make_shared<milvus::exec::QueryConfig>(
+                std::unordered_map<std::string, std::string>{}));
+        milvus::OpContext op_context;
+        query_context->set_op_context(&op_context);
+        auto plan_fragment = plan::PlanFragment(project_node);
+        auto output = milvus::query::ExecPlanNodeVisitor::ExecuteTask(
+            plan_fragment, query_context);
+
+        std::vector<int64_t> offsets;
+        if (output == nullptr) {
+            return offsets;
+        }
+        auto ranks = std::dynamic_pointer_cast<ColumnVector>(output->child(0));
+        auto col = std::dynamic_pointer_cast<ColumnVector>(output->child(1));
+        for (size_t i = 0; i < col->size(); ++i) {
+            // rows of nulls padding the picked rows up to the row count
+            if (!col->ValidAt(i)) {
+                EXPECT_FALSE(ranks->ValidAt(i));
+                offsets.push_back(-1);
+                continue;
+            }
+            auto offset = col->ValueAt<int64_t>(i);
+            // the projected values belong to the picked rows
+            EXPECT_EQ(ranks->ValidAt(i), valid_[offset]);
+            if (valid_[offset]) {
+                EXPECT_EQ(ranks->ValueAt<int64_t>(i), ranks_[offset]);
+            }
+            offsets.push_back(offset);
+        }
+        return offsets;
+    }
+
+    std::vector<int64_t>
+    RunOrderedScan(bool ascending, bool nulls_first, int64_t limit) {
+        return Project([&](ProjectNode& node) {
+            node.SetOrderedScan(
+                plan::OrderedScan{rank_fid_, ascending, nulls_first, limit});
+        });
+    }
+
+    std::vector<int64_t>
+    RunExtremeValueScans(std::vector<plan::ExtremeValueScan> scans) {
+        return Project([&](ProjectNode& node) {
+            node.SetExtremeValueScans(std::move(scans));
+        });
+    }
+
+    // A global aggregation over the rows with id != 1.
+    proto::plan::PlanNode
+    AggregationPlan(
+        const std::vector<std::pair<proto::plan::AggregateOp, FieldId>>&
+            aggregates) {
+        proto::plan::PlanNode plan_node;
+        auto* query = plan_node.mutable_query();
+        query->set_limit(100);
+        auto* unary_range =
+            query->mutable_predicates()->mutable_unary_range_expr();
+        auto* column_info = unary_range->mutable_column_info();
+        column_info->set_field_id(pk_fid_.get());
+        column_info->set_data_type(proto::schema::DataType::Int64);
+        unary_range->set_op(proto::plan::OpType::NotEqual);
+        unary_range->mutable_value()->set_int64_val(1);
+        for (auto [op, field_id] : aggregates) {
+            auto* aggregate = query->add_aggregates();
+            aggregate->set_op(op);
+            aggregate->set_field_id(field_id.get());
+        }
+        return plan_node;
+    }
+
+    static const ProjectNode*
+    FindProjectNode(const query::RetrievePlan& plan) {
+        auto node = plan.plan_node_->plannodes_;
+        while (node != nullptr) {
+            if (auto project = std::dynamic_pointer_cast<ProjectNode>(node)) {
+                return project.get();
+            }
+            node = node->sources().empty() ? nullptr : node->sources()[0];
+        }
+        return nullptr;
+    }
+
+    // the matching rows are all but 1 (filtered) and 4 (deleted)
+    static constexpr int64_t kNumRows = 10;
+    static constexpr int64_t kChunkRows = 5;
+    const std::vector<int64_t> ranks_{50, 20, 0, 80, 10, 0, 70, 30, 60, 40};
+    const std::vector<bool> valid_{
+        true, true, false, true, true, false, true, true, true, true};
+    const std::vector<int64_t> all_matching_{0, 2, 3, 5, 6, 7, 8, 9};
+
+    SchemaPtr schema_;
+    FieldId rank_fid_;
+    FieldId score_fid_;
+    FieldId pk_fid_;
+    SegmentSealedSPtr segment_;
+};
+
+INSTANTIATE_TEST_SUITE_P(QueryIndexOrderSuite,
+                         QueryIndexOrderTest,
+                         ::testing::Values(true, false));
+
+TEST_P(QueryIndexOrderTest, OrderedScanAscending) {
+    auto offsets = RunOrderedScan(true, false, 3);
+    if (!WithIndex()) {
+        // no sorted index, every matching row is projected for the sort
+        EXPECT_EQ(offsets, all_matching_);
+        return;
+    }
+    // 10 (deleted) and 20 (filtered out) are skipped
+    EXPECT_EQ(offsets, (std::vector<int64_t>{7, 9, 0}));
+}
+
+TEST_P(QueryIndexOrderTest, OrderedScanDescending) {
+    auto offsets = RunOrderedScan(false, false, 4);
+    if (!WithIndex()) {
+        EXPECT_EQ(offsets, all_matching_);
+        return;
+    }
+    EXPECT_EQ(offsets, (std::vector<int64_t>{3, 6, 8, 0}));
+}
+
+TEST_P(QueryIndexOrderTest, OrderedScanNullsFirst) {
+    auto offsets = RunOrderedScan(true, true, 3);
+    if (!WithIndex()) {
+        EXPECT_EQ(offsets, all_matching_);
+        return;
+    }
+    EXPECT_EQ(offsets, (std::vector<int64_t>{2, 5, 7}));
+
+    // the limit can end inside the nulls
+    EXPECT_EQ(RunOrderedScan(false, true, 1), (std::vector<int64_t>{2}));
+}
+
+TEST_P(QueryIndexOrderTest, OrderedScanNullsLastPastTheValues) {
+    auto offsets = RunOrderedScan(false, false, kNumRows);
+    if (!WithIndex()) {
+        EXPECT_EQ(offsets, all_matching_);
+        return;
+    }
+    // a limit above the matching rows returns each of them once
+    EXPECT_EQ(offsets, (std::vector<int64_t>{3, 6, 8, 0, 9, 7, 2, 5}));
+}
+
+TEST_P(QueryIndexOrderTest, PushdownNeedsPkSortedSegment) {
+    // a segment not sorted by pk selects one row per pk through find_first_n,
+    // so every matching row is projected even with a sorted index
+    Load(/*sorted_by_pk=*/false);
+    EXPECT_EQ(RunOrderedScan(true, false, 3), all_matching_);
+    EXPECT_EQ(RunExtremeValueScans({{rank_fid_, true}}), all_matching_);
+}
+
+TEST_P(QueryIndexOrderTest, ExtremeValueScanMin) {
+    // the smallest values, 10 (deleted) and 20 (filtered out), are skipped;
+    // without an index, chunk 1 still has to be scanned since its zone map
+    // holds 30 < 50, the best value of chunk 0
+    EXPECT_EQ(RunExtremeValueScans({{rank_fid_, false}}),
+              (std::vector<int64_t>{7}));
+}
+
+TEST_P(QueryIndexOrderTest, ExtremeValueScanMax) {
+    // without an index, chunk 1 is skipped by its zone map, 70 < 80
+    EXPECT_EQ(RunExtremeValueScans({{rank_fid_, true}}),
+              (std::vector<int64_t>{3}));
+}
+
+TEST_P(QueryIndexOrderTest, ExtremeValueScanMinAndMax) {
+    // the rows of all aggregates are projected once, in offset order
+    EXPECT_EQ(RunExtremeValueScans({{rank_fid_, true},
+                                    {rank_fid_, false},
+                                    {rank_fid_, true}}),
+              (std::vector<int64_t>{3, 7}));
+}
+
+TEST_P(QueryIndexOrderTest, ExtremeValueScanAllNull) {
+    // no non-null value, the first matching row still makes the aggregation
+    // emit a row of nulls
+    EXPECT_EQ(RunExtremeValueScans({{score_fid_, true}}),
+              (std::vector<int64_t>{0}));
+    // but no witness is added once some aggregate found a row
+    EXPECT_EQ(RunExtremeValueScans({{score_fid_, true}, {rank_fid_, false}}),
+              (std::vector<int64_t>{7}));
+}
+
+TEST_P(QueryIndexOrderTest, ExtremeValueScanKeepRowCount) {
+    // the picked rows come first, then rows of nulls up to the 8 matching rows
+    auto offsets = Project([&](ProjectNode& node) {
+        node.SetExtremeValueScans({{rank_fid_, true}, {rank_fid_, false}});
+        node.SetKeepRowCount(true);
+    });
+    EXPECT_EQ(offsets, (std::vector<int64_t>{3, 7, -1, -1, -1, -1, -1, -1}));
+}
+
+TEST_P(QueryIndexOrderTest, MinMaxAggregation) {
+    auto plan_node = AggregationPlan({{proto::plan::min, rank_fid_},
+                                      {proto::plan::max, rank_fid_},
+                                      {proto::plan::max, score_fid_}});
+    auto parser = milvus::query::ProtoParser(schema_);
+    auto plan = parser.CreateRetrievePlan(plan_node);
+    auto project = FindProjectNode(*plan);
+    ASSERT_NE(project, nullptr);
+    EXPECT_EQ(project->GetExtremeValueScans().size(), 3);
+    EXPECT_FALSE(project->KeepRowCount());
+    auto results = segment_->Retrieve(
+        nullptr, plan.get(), MAX_TIMESTAMP, DEFAULT_MAX_OUTPUT_SIZE, false);
+
+    ASSERT_EQ(results->fields_data_size(), 3);
+    const auto& min_rank = results->fields_data(0);
+    const auto& max_rank = results->fields_data(1);
+    const auto& max_score = results->fields_data(2);
+    ASSERT_EQ(min_rank.scalars().long_data().data_size(), 1);
+    ASSERT_EQ(max_rank.scalars().long_data().data_size(), 1);
+    EXPECT_EQ(min_rank.scalars().long_data().data(0), 30);
+    EXPECT_EQ(max_rank.scalars().long_data().data(0), 80);
+    ASSERT_EQ(max_score.valid_data_size(), 1);
+    EXPECT_FALSE(max_score.valid_data(0));
+}
+
+TEST_P(QueryIndexOrderTest, MinMaxCountAggregation) {
+    // count(*) is answered from the matching row count next to min and max
+    auto plan_node = AggregationPlan({{proto::plan::count, FieldId(0)},
+                                      {proto::plan::min, rank_fid_},
+                                      {proto::plan::max, rank_fid_}});
+    auto parser = milvus::query::ProtoParser(schema_);
+    auto plan = parser.CreateRetrievePlan(plan_node);
+    auto project = FindProjectNode(*plan);
+    ASSERT_NE(project, nullptr);
+    EXPECT_EQ(project->GetExtremeValueScans().size(), 2);
+    EXPECT_TRUE(project->KeepRowCount());
+    auto results = segment_->Retrieve(
+        nullptr, plan.get(), MAX_TIMESTAMP, DEFAULT_MAX_OUTPUT_SIZE, false);
+
+    ASSERT_EQ(results->fields_data_size(), 3);
+    const auto& count = results->fields_data(0);
+    const auto& min_rank = results->fields_data(1);
+    const auto& max_rank = results->fields_data(2);
+    ASSERT_EQ(count.scalars().long_data().data_size(), 1);
+    EXPECT_EQ(count.scalars().long_data().data(0),
+              static_cast<int64_t>(all_matching_.size()));
+    EXPECT_EQ(min_rank.scalars().long_data().data(0), 30);
+    EXPECT_EQ(max_rank.scalars().long_data().data(0), 80);
+}
+
+TEST_P(QueryIndexOrderTest, CountOfFieldIsNotPushedDown) {
+    // count(field) counts non-null values, which rows of nulls would lose
+    auto plan_node = AggregationPlan(
+        {{proto::plan::count, rank_fid_}, {proto::plan::max, rank_fid_}});
+    auto parser = milvus::query::ProtoParser(schema_);
+    auto plan = parser.CreateRetrievePlan(plan_node);
+    auto project = FindProjectNode(*plan);
+    ASSERT_NE(project, nullptr);
+    EXPECT_TRUE(project->GetExtremeValueScans().empty());
+}
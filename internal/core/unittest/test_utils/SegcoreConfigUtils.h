@@ -46,6 +46,10 @@ class ScopedSegcoreConfigRestore {
           nprobe_(config.get_nprobe()),
           enable_interim_segment_index_(
               config.get_enable_interim_segment_index()),
+          enable_async_interim_index_(config.get_enable_async_interim_index()),
+          enable_predictive_warmup_(config.get_enable_predictive_warmup()),
+          enable_text_lob_compression_(
+              config.get_enable_text_lob_compression()),
           sub_dim_(config.get_sub_dim()),
           refine_ratio_(config.get_refine_ratio()),
           dense_vector_interim_index_type_(
@@ -60,6 +64,9 @@ class ScopedSegcoreConfigRestore {
         config_.set_nlist(nlist_);
         config_.set_nprobe(nprobe_);
         config_.set_enable_interim_segment_index(enable_interim_segment_index_);
+        config_.set_enable_async_interim_index(enable_async_interim_index_);
+        config_.set_enable_predictive_warmup(enable_predictive_warmup_);
+        config_.set_enable_text_lob_compression(enable_text_lob_compression_);
         config_.set_sub_dim(sub_dim_);
         config_.set_refine_ratio(refine_ratio_);
         config_.set_dense_vector_intermin_index_type(
@@ -78,6 +85,9 @@ class ScopedSegcoreConfigRestore {
     int64_t nlist_;
     int64_t nprobe_;
     bool enable_interim_segment_index_;
+    bool enable_async_interim_index_;
+    bool enable_predictive_warmup_;
+    bool enable_text_lob_compression_;
     int64_t sub_dim_;
     float refine_ratio_;
     std::string dense_vector_interim_index_type_;
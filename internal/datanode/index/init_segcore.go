@@ -24,6 +24,7 @@ package index
 #include "common/init_c.h"
 #include "segcore/segcore_init_c.h"
 #include "indexbuilder/init_c.h"
+#include "clustering/analyze_c.h"
 */
 import "C"
 
@@ -91,6 +92,13 @@ func InitSegcore(nodeID int64) error {
 	cGpuMemoryPoolMaxSize := C.uint32_t(paramtable.Get().GpuConfig.MaxSize.GetAsUint32())
 	C.SegcoreSetKnowhereGpuMemoryPoolSize(cGpuMemoryPoolInitSize, cGpuMemoryPoolMaxSize)
 
+	C.SetMiniBatchKmeansConfig(
+		C.bool(paramtable.Get().DataNodeCfg.MiniBatchKmeansEnabled.GetAsBool()),
+		C.int64_t(paramtable.Get().DataNodeCfg.MiniBatchKmeansBatchRows.GetAsInt64()),
+		C.int64_t(paramtable.Get().DataNodeCfg.MiniBatchKmeansEpochs.GetAsInt64()),
+		C.int64_t(paramtable.Get().DataNodeCfg.MiniBatchKmeansMemoryBudget.GetAsSize()),
+		C.bool(paramtable.Get().DataNodeCfg.MiniBatchKmeansFuseAssign.GetAsBool()))
+
 	// Apply Arrow IO thread pool capacity from paramtable. Without this call the
 	// pool stays at Arrow's built-in default (kDefaultNumIoThreads = 8), which is
 	// almost always undersized for DataNode under concurrent storage v2 reads
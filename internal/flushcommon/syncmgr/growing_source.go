@@ -62,6 +62,8 @@ type GrowingFlushConfig struct {
 	BM25FieldIDs            []int64
 	BM25StatsLogIDs         []int64
 	WriteMergedBM25Stats    bool
+	WriteSealedSidecars     bool
+	SealedSidecarLogID      int64
 	ReadVersion             int64
 	WriterFormat            string
 	SchemaBasedPattern      string
@@ -727,6 +729,16 @@ func (t *GrowingSourceSyncTask) buildFlushConfig(segment *metacache.SegmentInfo,
 			return nil, err
 		}
 	}
+	writeSealedSidecars := paramtable.Get().CommonCfg.GrowingFlushSealedSidecars.GetAsBool() &&
+		t.level != datapb.SegmentLevel_L0 && t.schema != nil
+	var sealedSidecarLogID int64
+	if writeSealedSidecars {
+		logIDs, err := t.allocLogIDs(1, "sealed sidecar")
+		if err != nil {
+			return nil, err
+		}
+		sealedSidecarLogID = logIDs[0]
+	}
 	writerFormat := paramtable.Get().DataNodeCfg.StorageFormat.GetValue()
 	schemaBasedPattern, err := t.schemaBasedPattern(columnGroups)
 	if err != nil {
@@ -752,6 +764,8 @@ func (t *GrowingSourceSyncTask) buildFlushConfig(segment *metacache.SegmentInfo,
 		BM25FieldIDs:            bm25FieldIDs,
 		BM25StatsLogIDs:         bm25StatsLogIDs,
 		WriteMergedBM25Stats:    t.IsFlush() && t.level != datapb.SegmentLevel_L0 && t.schema != nil && hasBM25Function(t.schema),
+		WriteSealedSidecars:     writeSealedSidecars,
+		SealedSidecarLogID:      sealedSidecarLogID,
 		ReadVersion:             readVersion,
 		WriterFormat:            writerFormat,
 		SchemaBasedPattern:      schemaBasedPattern,
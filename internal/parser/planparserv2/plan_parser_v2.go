@@ -35,7 +35,8 @@ var (
 )
 
 type ExprParams struct {
-	UseJSONStats bool
+	UseJSONStats        bool
+	CollectQueryProfile bool
 }
 
 func ParseExprParams(vals map[string]*schemapb.TemplateValue) *ExprParams {
@@ -47,6 +48,9 @@ func ParseExprParams(vals map[string]*schemapb.TemplateValue) *ExprParams {
 		if v, ok := vals[common.ExprUseJSONStatsKey]; ok && v != nil {
 			ep.UseJSONStats = v.GetBoolVal()
 		}
+		if v, ok := vals[common.CollectQueryProfileKey]; ok && v != nil {
+			ep.CollectQueryProfile = v.GetBoolVal()
+		}
 	}
 	return ep
 }
@@ -256,7 +260,8 @@ func CreateRetrievePlanArgs(schema *typeutil.SchemaHelper, exprStr string, exprT
 			},
 		},
 		PlanOptions: &planpb.PlanOption{
-			ExprUseJsonStats: exprParams.UseJSONStats,
+			ExprUseJsonStats:    exprParams.UseJSONStats,
+			CollectQueryProfile: exprParams.CollectQueryProfile,
 		},
 	}
 	return planNode, nil
@@ -353,7 +358,8 @@ func CreateSearchPlanArgs(schema *typeutil.SchemaHelper, exprStr string, vectorF
 		Scorers:     scorers,
 		ScoreOption: options,
 		PlanOptions: &planpb.PlanOption{
-			ExprUseJsonStats: exprParams.UseJSONStats,
+			ExprUseJsonStats:    exprParams.UseJSONStats,
+			CollectQueryProfile: exprParams.CollectQueryProfile,
 		},
 	}
 	return planNode, nil
@@ -1857,6 +1857,24 @@ func TestCreateRetrievePlan(t *testing.T) {
 	assert.NoError(t, err)
 }
 
+func TestCreatePlan_CollectQueryProfile(t *testing.T) {
+	schema := newTestSchemaHelper(t)
+	plan, err := CreateRetrievePlan(schema, "Int64Field > 0", nil)
+	assert.NoError(t, err)
+	assert.False(t, plan.GetPlanOptions().GetCollectQueryProfile())
+
+	vals := map[string]*schemapb.TemplateValue{
+		common.CollectQueryProfileKey: generateTemplateValue(schemapb.DataType_Bool, true),
+	}
+	plan, err = CreateRetrievePlan(schema, "Int64Field > 0", vals)
+	assert.NoError(t, err)
+	assert.True(t, plan.GetPlanOptions().GetCollectQueryProfile())
+
+	plan, err = CreateSearchPlan(schema, "Int64Field > 0", "FloatVectorField", &planpb.QueryInfo{}, vals, nil)
+	assert.NoError(t, err)
+	assert.True(t, plan.GetPlanOptions().GetCollectQueryProfile())
+}
+
 func TestCreateSearchPlan(t *testing.T) {
 	schema := newTestSchemaHelper(t)
 	_, err := CreateSearchPlan(schema, `$meta["A"] != 10`, "FloatVectorField", &planpb.QueryInfo{
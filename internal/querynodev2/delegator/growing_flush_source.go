@@ -558,6 +558,8 @@ func (s *delegatorGrowingFlushSource) FlushGrowingData(ctx context.Context, star
 		BM25FieldIDs:            config.BM25FieldIDs,
 		BM25StatsLogIDs:         config.BM25StatsLogIDs,
 		WriteMergedBM25Stats:    config.WriteMergedBM25Stats,
+		WriteSealedSidecars:     config.WriteSealedSidecars,
+		SealedSidecarLogID:      config.SealedSidecarLogID,
 		ReadVersion:             config.ReadVersion,
 		WriterFormat:            config.WriterFormat,
 		SchemaBasedPattern:      config.SchemaBasedPattern,
@@ -57,7 +57,12 @@ func RunQNQueryPipeline(
 ) (*segcorepb.RetrieveResults, error) {
 	// Early empty check before any pipeline construction
 	if allSegcoreResultsEmpty(segcoreResults) {
-		return emptySegcoreResult(req, schema)
+		result, err := emptySegcoreResult(req, schema)
+		if err != nil {
+			return nil, err
+		}
+		result.QueryProfiles = concatQueryProfiles(segcoreResults)
+		return result, nil
 	}
 
 	// Build pipeline + input msg — the only branching point
@@ -232,6 +237,7 @@ func extractSegcoreResult(
 		HasMoreResult:      anyFieldTrue(segcoreResults, func(r *segcorepb.RetrieveResults) bool { return r.GetHasMoreResult() }),
 		ScannedRemoteBytes: sumInt64Field(segcoreResults, func(r *segcorepb.RetrieveResults) int64 { return r.GetScannedRemoteBytes() }),
 		ScannedTotalBytes:  sumInt64Field(segcoreResults, func(r *segcorepb.RetrieveResults) int64 { return r.GetScannedTotalBytes() }),
+		QueryProfiles:      concatQueryProfiles(segcoreResults),
 	}
 
 	// Only fill empty fields when result has no data at all.
@@ -293,6 +299,7 @@ func RunDelegatorQueryPipeline(
 	output.HasMoreResult = anyFieldTrueInternal(results, func(r *internalpb.RetrieveResults) bool { return r.GetHasMoreResult() })
 	output.ScannedRemoteBytes = sumInt64FieldInternal(results, func(r *internalpb.RetrieveResults) int64 { return r.GetScannedRemoteBytes() })
 	output.ScannedTotalBytes = sumInt64FieldInternal(results, func(r *internalpb.RetrieveResults) int64 { return r.GetScannedTotalBytes() })
+	output.QueryProfiles = concatQueryProfilesInternal(results)
 
 	// Only fill empty fields when result has no data at all (same guard as QN level).
 	if len(output.GetFieldsData()) == 0 {
@@ -130,6 +130,7 @@ func ReduceSearchResults(ctx context.Context, results []*internalpb.SearchResult
 	searchResults.IsRecallEvaluation = isRecallEvaluation
 	searchResults.ScannedRemoteBytes = storageCost.ScannedRemoteBytes
 	searchResults.ScannedTotalBytes = storageCost.ScannedTotalBytes
+	searchResults.QueryProfiles = mergeQueryProfiles(results)
 	return searchResults, nil
 }
 
@@ -184,9 +185,17 @@ func ReduceAdvancedSearchResults(ctx context.Context, results []*internalpb.Sear
 	searchResults.IsTopkReduce = isTopkReduce
 	searchResults.ScannedRemoteBytes = storageCost.ScannedRemoteBytes
 	searchResults.ScannedTotalBytes = storageCost.ScannedTotalBytes
+	searchResults.QueryProfiles = mergeQueryProfiles(results)
 	return searchResults, nil
 }
 
+// mergeQueryProfiles concatenates the per segment profiles of the results.
+func mergeQueryProfiles(results []*internalpb.SearchResults) []string {
+	return lo.FlatMap(results, func(result *internalpb.SearchResults, _ int) []string {
+		return result.GetQueryProfiles()
+	})
+}
+
 func SelectSearchResultData(dataArray []*schemapb.SearchResultData, resultOffsets [][]int64, offsets []int64, qi int64) int {
 	var (
 		sel                 = -1
@@ -149,6 +149,7 @@ func retrieveOnSegmentsWithStream(ctx context.Context, mgr *Manager, segments []
 					AllRetrieveCount:          result.GetAllRetrieveCount(),
 					ScannedRemoteBytes:        result.GetScannedRemoteBytes(),
 					ScannedTotalBytes:         result.GetScannedTotalBytes(),
+					QueryProfiles:             result.GetQueryProfiles(),
 				}); err != nil {
 					errs[i] = err
 				}
@@ -1727,6 +1727,8 @@ func (s *LocalSegment) FlushData(ctx context.Context, startOffset, endOffset int
 		cConfig.num_bm25_fields = 0
 	}
 	cConfig.write_merged_bm25_stats = C.bool(config.WriteMergedBM25Stats)
+	cConfig.write_sealed_sidecars = C.bool(config.WriteSealedSidecars)
+	cConfig.sealed_sidecar_log_id = C.int64_t(config.SealedSidecarLogID)
 
 	// call C FFI
 	var cResult C.CFlushResult
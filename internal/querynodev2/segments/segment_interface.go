@@ -173,6 +173,12 @@ type FlushConfig struct {
 	// WriteMergedBM25Stats writes a compound BM25 stats file in the same
 	// manifest transaction. It should be true only for the final flush.
 	WriteMergedBM25Stats bool
+	// WriteSealedSidecars writes the zone maps of the scalar fields and the
+	// primary key order of the flushed offset range as manifest stats, so the
+	// sealed segment doesn't have to rebuild them from the flushed data.
+	WriteSealedSidecars bool
+	// SealedSidecarLogID is the log ID of the sidecar stats files.
+	SealedSidecarLogID int64
 	// ReadVersion is the manifest version to read from.
 	// Must be set to the last version acknowledged by DataCoord (via SaveBinlogPaths).
 	// Use ManifestEarliest for the first flush so retries never append to latest.
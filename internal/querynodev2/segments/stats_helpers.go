@@ -60,3 +60,19 @@ func anyFieldTrueInternal(results []*internalpb.RetrieveResults, getter func(*in
 	}
 	return false
 }
+
+func concatQueryProfiles(results []*segcorepb.RetrieveResults) []string {
+	var profiles []string
+	for _, r := range results {
+		profiles = append(profiles, r.GetQueryProfiles()...)
+	}
+	return profiles
+}
+
+func concatQueryProfilesInternal(results []*internalpb.RetrieveResults) []string {
+	var profiles []string
+	for _, r := range results {
+		profiles = append(profiles, r.GetQueryProfiles()...)
+	}
+	return profiles
+}
@@ -129,3 +129,23 @@ func TestAnyFieldTrueInternal_WithNil(t *testing.T) {
 func TestAnyFieldTrueInternal_Empty(t *testing.T) {
 	assert.False(t, anyFieldTrueInternal(nil, func(r *internalpb.RetrieveResults) bool { return r.GetHasMoreResult() }))
 }
+
+func TestConcatQueryProfiles(t *testing.T) {
+	results := []*segcorepb.RetrieveResults{
+		{QueryProfiles: []string{"a"}},
+		nil,
+		{},
+		{QueryProfiles: []string{"b", "c"}},
+	}
+	assert.Equal(t, []string{"a", "b", "c"}, concatQueryProfiles(results))
+	assert.Nil(t, concatQueryProfiles(nil))
+}
+
+func TestConcatQueryProfilesInternal(t *testing.T) {
+	results := []*internalpb.RetrieveResults{
+		{QueryProfiles: []string{"a"}},
+		nil,
+		{QueryProfiles: []string{"b"}},
+	}
+	assert.Equal(t, []string{"a", "b"}, concatQueryProfilesInternal(results))
+}
@@ -169,6 +169,7 @@ func (t *QueryTask) Execute() error {
 		ScannedTotalBytes:  reducedResult.GetScannedTotalBytes(),
 		ElementLevel:       reducedResult.GetElementLevel(),
 		ElementIndices:     convertSegcoreElementIndicesToInternal(reducedResult.GetElementIndices()),
+		QueryProfiles:      reducedResult.GetQueryProfiles(),
 	}
 	return nil
 }
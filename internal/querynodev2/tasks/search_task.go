@@ -301,6 +301,11 @@ func (t *SearchTask) Execute() error {
 	if err := t.executeGoReduce(segDFs, results, searchReq, metricType, tr, relatedDataSize, allSearchCount); err != nil {
 		return err
 	}
+	if profiles := collectSearchProfiles(results); len(profiles) > 0 {
+		for i := range t.originNqs {
+			t.subTaskAt(i).result.QueryProfiles = profiles
+		}
+	}
 
 	// Reduce metric covers the full Go-reduce pipeline (Arrow export +
 	// heap merge + Late Materialization + proto marshal), aligned with the
@@ -314,6 +319,15 @@ func (t *SearchTask) Execute() error {
 	return nil
 }
 
+// collectSearchProfiles returns the runtime stats segcore recorded for each
+// segment, which it only does when the plan set collect_query_profile.
+func collectSearchProfiles(results []*segments.SearchResult) []string {
+	return lo.FilterMap(results, func(result *segments.SearchResult, _ int) (string, bool) {
+		profile := result.Profile()
+		return profile, profile != ""
+	})
+}
+
 func emptySearchResultData(nq, topK int64) *schemapb.SearchResultData {
 	return &schemapb.SearchResultData{
 		NumQueries: nq,
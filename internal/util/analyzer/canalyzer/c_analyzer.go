@@ -15,7 +15,10 @@ import (
 	_ "github.com/milvus-io/milvus/internal/util/cgo"
 )
 
-var _ interfaces.Analyzer = (*CAnalyzer)(nil)
+var (
+	_ interfaces.Analyzer      = (*CAnalyzer)(nil)
+	_ interfaces.BatchAnalyzer = (*CAnalyzer)(nil)
+)
 
 type CAnalyzer struct {
 	ptr C.CTokenizer
@@ -34,6 +37,58 @@ func (impl *CAnalyzer) NewTokenStream(text string) interfaces.TokenStream {
 	return NewCTokenStream(ptr)
 }
 
+// TokenizeBatch tokenizes all texts with a single cgo call, the tokens are
+// returned in one C arena and passed to fn without copying.
+func (impl *CAnalyzer) TokenizeBatch(texts []string, termFreqs bool, fn func(i int, token string, freq uint32)) error {
+	if len(texts) == 0 {
+		return nil
+	}
+	size := 0
+	for _, text := range texts {
+		size += len(text)
+	}
+	data := make([]byte, 0, size)
+	offsets := make([]uint64, 1, len(texts)+1)
+	for _, text := range texts {
+		data = append(data, text...)
+		offsets = append(offsets, uint64(len(data)))
+	}
+	var cData *C.char
+	if len(data) > 0 {
+		cData = (*C.char)(unsafe.Pointer(&data[0]))
+	}
+
+	var batch C.CTokenBatch
+	status := C.tokenize_batch(impl.ptr, cData, (*C.uint64_t)(unsafe.Pointer(&offsets[0])),
+		C.uint64_t(len(texts)), C.bool(termFreqs), &batch)
+	if err := HandleCStatus(&status, "failed to tokenize batch"); err != nil {
+		return err
+	}
+	defer C.free_token_batch(&batch)
+
+	numTokens := int(batch.num_tokens)
+	tokenOffsets := unsafe.Slice((*uint64)(unsafe.Pointer(batch.token_offsets)), numTokens+1)
+	tokenData := unsafe.Slice((*byte)(unsafe.Pointer(batch.token_data)), tokenOffsets[numTokens])
+	tokenCounts := unsafe.Slice((*uint64)(unsafe.Pointer(batch.token_counts)), len(texts))
+	var freqs []uint32
+	if termFreqs {
+		freqs = unsafe.Slice((*uint32)(unsafe.Pointer(batch.term_freqs)), numTokens)
+	}
+
+	token := 0
+	for i, count := range tokenCounts {
+		for end := token + int(count); token < end; token++ {
+			freq := uint32(1)
+			if freqs != nil {
+				freq = freqs[token]
+			}
+			bytes := tokenData[tokenOffsets[token]:tokenOffsets[token+1]]
+			fn(i, unsafe.String(unsafe.SliceData(bytes), len(bytes)), freq)
+		}
+	}
+	return nil
+}
+
 func (impl *CAnalyzer) Clone() (interfaces.Analyzer, error) {
 	var newptr C.CTokenizer
 	status := C.clone_tokenizer(&impl.ptr, &newptr)
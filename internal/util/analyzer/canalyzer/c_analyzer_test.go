@@ -154,6 +154,34 @@ func TestAnalyzer(t *testing.T) {
 	}
 }
 
+func TestTokenizeBatch(t *testing.T) {
+	analyzer, err := NewAnalyzer(`{"tokenizer": "standard"}`, "")
+	require.NoError(t, err)
+	defer analyzer.Destroy()
+
+	batchAnalyzer, ok := analyzer.(*CAnalyzer)
+	require.True(t, ok)
+	texts := []string{"football, basketball, football", "", "swimming"}
+
+	tokens := make([][]string, len(texts))
+	err = batchAnalyzer.TokenizeBatch(texts, false, func(i int, token string, freq uint32) {
+		assert.Equal(t, uint32(1), freq)
+		tokens[i] = append(tokens[i], strings.Clone(token))
+	})
+	require.NoError(t, err)
+	assert.Equal(t, [][]string{{"football", "basketball", "football"}, nil, {"swimming"}}, tokens)
+
+	freqs := make([]map[string]uint32, len(texts))
+	err = batchAnalyzer.TokenizeBatch(texts, true, func(i int, token string, freq uint32) {
+		if freqs[i] == nil {
+			freqs[i] = map[string]uint32{}
+		}
+		freqs[i][strings.Clone(token)] = freq
+	})
+	require.NoError(t, err)
+	assert.Equal(t, []map[string]uint32{{"football": 2, "basketball": 1}, nil, {"swimming": 1}}, freqs)
+}
+
 func TestValidateAnalyzer(t *testing.T) {
 	require.NoError(t, InitOptions())
 
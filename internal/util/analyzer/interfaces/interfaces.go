@@ -16,3 +16,12 @@ type Analyzer interface {
 	Clone() (Analyzer, error)
 	Destroy()
 }
+
+// BatchAnalyzer is implemented by analyzers that can tokenize many texts in
+// one call. fn is called with the index of the text and each of its tokens,
+// the token is only valid during the call. With termFreqs the tokens of a
+// text are its distinct terms and freq is how often each occurs, otherwise
+// they come in order with freq 1.
+type BatchAnalyzer interface {
+	TokenizeBatch(texts []string, termFreqs bool, fn func(i int, token string, freq uint32)) error
+}
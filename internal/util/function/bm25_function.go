@@ -27,6 +27,7 @@ import (
 	"github.com/milvus-io/milvus-proto/go-api/v3/milvuspb"
 	"github.com/milvus-io/milvus-proto/go-api/v3/schemapb"
 	"github.com/milvus-io/milvus/internal/util/analyzer"
+	"github.com/milvus-io/milvus/internal/util/analyzer/interfaces"
 	"github.com/milvus-io/milvus/pkg/v3/config"
 	"github.com/milvus-io/milvus/pkg/v3/mlog"
 	"github.com/milvus-io/milvus/pkg/v3/util/conc"
@@ -178,6 +179,10 @@ func (v *BM25FunctionRunner) run(data []string, dst []map[uint32]float32) error
 	}
 	defer tokenizer.Destroy()
 
+	if batchTokenizer, ok := tokenizer.(interfaces.BatchAnalyzer); ok {
+		return runBatch(batchTokenizer, data, dst)
+	}
+
 	for i := 0; i < len(data); i++ {
 		if len(data[i]) == 0 {
 			dst[i] = map[uint32]float32{}
@@ -201,6 +206,21 @@ func (v *BM25FunctionRunner) run(data []string, dst []map[uint32]float32) error
 	return nil
 }
 
+// runBatch tokenizes data with one call into the analyzer, which also counts
+// the term frequencies of each text.
+func runBatch(tokenizer interfaces.BatchAnalyzer, data []string, dst []map[uint32]float32) error {
+	for i := 0; i < len(data); i++ {
+		if !typeutil.IsUTF8(data[i]) {
+			return merr.WrapErrParameterInvalidMsg("string data must be utf8 format: %v", data[i])
+		}
+		dst[i] = map[uint32]float32{}
+	}
+	return tokenizer.TokenizeBatch(data, true, func(i int, token string, freq uint32) {
+		// TODO More Hash Option
+		dst[i][typeutil.HashString2LessUint32(token)] += float32(freq)
+	})
+}
+
 func (v *BM25FunctionRunner) BatchRun(inputs ...any) ([]any, error) {
 	v.mu.RLock()
 	defer v.mu.RUnlock()
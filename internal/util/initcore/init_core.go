@@ -32,6 +32,7 @@ import "C"
 import (
 	"context"
 	"encoding/base64"
+	"path/filepath"
 	"strconv"
 	"sync"
 	"time"
@@ -412,6 +413,14 @@ func InitTieredStorage(params *paramtable.ComponentParam) error {
 		overloadedMemoryThresholdPercentage, loadingResourceFactor, maxDiskUsagePercentage, diskPath,
 		loadingTimeoutMs, warmupLoadingTimeoutMs, rejectRemoteVectorOutput, prefetchPoolThreads)
 
+	compressedMemoryRatio := params.QueryNodeCfg.TieredCompressedMemoryRatio.GetAsFloat()
+	C.ConfigureCompressedCellCache(C.int64_t(compressedMemoryRatio * float64(osMemBytes)))
+	C.SegcoreSetEnablePredictiveWarmup(C.bool(params.QueryNodeCfg.TieredPredictiveWarmup.GetAsBool()))
+
+	warmSetPath := C.CString(filepath.Join(params.LocalStorageCfg.Path.GetValue(), "warm_set"))
+	defer C.free(unsafe.Pointer(warmSetPath))
+	C.ConfigureWarmSetSnapshot(warmSetPath, C.int64_t(params.QueryNodeCfg.TieredWarmSetSnapshotInterval.GetAsInt64()))
+
 	tieredEvictableMemoryCacheRatio := params.QueryNodeCfg.TieredEvictableMemoryCacheRatio.GetAsFloat()
 	tieredEvictableDiskCacheRatio := params.QueryNodeCfg.TieredEvictableDiskCacheRatio.GetAsFloat()
 
@@ -698,6 +707,29 @@ func SetupCoreConfigChangelCallback() {
 		paramtable.Get().QueryNodeCfg.ExprResCacheDiskMaxBytes.RegisterCallback(updateExprResCacheConfigCallback)
 		paramtable.Get().QueryNodeCfg.ExprResCacheDiskMaxFileSizeBytes.RegisterCallback(updateExprResCacheConfigCallback)
 
+		updateSearchResultCacheConfigCallback := func(ctx context.Context, key, oldValue, newValue string) error {
+			UpdateSearchResultCacheConfig()
+			return nil
+		}
+		paramtable.Get().QueryNodeCfg.SearchResultCacheEnabled.RegisterCallback(updateSearchResultCacheConfigCallback)
+		paramtable.Get().QueryNodeCfg.SearchResultCacheMaxBytes.RegisterCallback(updateSearchResultCacheConfigCallback)
+		paramtable.Get().QueryNodeCfg.SearchResultCacheAdmissionThreshold.RegisterCallback(updateSearchResultCacheConfigCallback)
+
+		updateVectorSearchBatchConfigCallback := func(ctx context.Context, key, oldValue, newValue string) error {
+			UpdateVectorSearchBatchConfig()
+			return nil
+		}
+		paramtable.Get().QueryNodeCfg.VectorSearchBatchEnabled.RegisterCallback(updateVectorSearchBatchConfigCallback)
+		paramtable.Get().QueryNodeCfg.VectorSearchBatchWindowUs.RegisterCallback(updateVectorSearchBatchConfigCallback)
+		paramtable.Get().QueryNodeCfg.VectorSearchBatchMaxBatchNq.RegisterCallback(updateVectorSearchBatchConfigCallback)
+
+		updateJSONPathCacheConfigCallback := func(ctx context.Context, key, oldValue, newValue string) error {
+			UpdateJSONPathCacheConfig()
+			return nil
+		}
+		paramtable.Get().QueryNodeCfg.JSONPathCacheEnabled.RegisterCallback(updateJSONPathCacheConfigCallback)
+		paramtable.Get().QueryNodeCfg.JSONPathCacheMaxBytes.RegisterCallback(updateJSONPathCacheConfigCallback)
+
 		updateTieredStorageConfigCallback := func(ctx context.Context, key, oldValue, newValue string) error {
 			return UpdateTieredStorageConfig(paramtable.Get())
 		}
@@ -716,6 +748,9 @@ func InitInterminIndexConfig(params *paramtable.ComponentParam) error {
 	enableInterminIndex := C.bool(params.QueryNodeCfg.EnableInterminSegmentIndex.GetAsBool())
 	C.SegcoreSetEnableInterminSegmentIndex(enableInterminIndex)
 
+	asyncInterimIndex := C.bool(params.QueryNodeCfg.InterimIndexAsyncBuild.GetAsBool())
+	C.SegcoreSetEnableAsyncInterimIndex(asyncInterimIndex)
+
 	memExpansionRate := C.float(params.QueryNodeCfg.InterimIndexMemExpandRate.GetAsFloat())
 	C.SegcoreSetInterimIndexMemExpansionRate(memExpansionRate)
 
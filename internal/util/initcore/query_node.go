@@ -84,6 +84,11 @@ func doInitQueryNodeOnce(ctx context.Context) error {
 
 	SyncPreferFieldDataWhenIndexHasRawData(ctx, paramtable.Get())
 	SyncEnableGrowingSourceFlush(ctx, paramtable.Get())
+	C.SegcoreSetEnableTextLobCompression(C.bool(paramtable.Get().QueryNodeCfg.TextLobCompression.GetAsBool()))
+	C.SegcoreSetTextMatchDeltaCommitIntervalMs(C.int64_t(paramtable.Get().QueryNodeCfg.TextMatchDeltaCommitInterval.GetAsInt64()))
+	C.SegcoreSetTextMatchDeltaMaxByteSize(C.int64_t(paramtable.Get().QueryNodeCfg.TextMatchDeltaMaxSize.GetAsInt64() << 20))
+	C.ConfigureSearchIteratorSessions(C.int64_t(paramtable.Get().QueryNodeCfg.SearchIteratorSessionTTL.GetAsInt64()*1000),
+		C.int64_t(paramtable.Get().QueryNodeCfg.SearchIteratorSessionMemSize.GetAsInt64()<<20))
 
 	cKnowhereThreadPoolSize := C.uint32_t(paramtable.Get().QueryNodeCfg.KnowhereThreadPoolSize.GetAsUint32())
 	C.SegcoreSetKnowhereSearchThreadPoolNum(cKnowhereThreadPoolSize)
@@ -164,6 +169,9 @@ func doInitQueryNodeOnce(ctx context.Context) error {
 	if paramtable.Get().QueryNodeCfg.ExprResCacheEnabled.GetAsBool() {
 		UpdateExprResCacheConfig()
 	}
+	UpdateSearchResultCacheConfig()
+	UpdateVectorSearchBatchConfig()
+	UpdateJSONPathCacheConfig()
 
 	C.SetArrowIOThreadPoolCapacity(C.int(ResolveArrowIOThreadPoolCapacity()))
 
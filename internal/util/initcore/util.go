@@ -113,6 +113,26 @@ func UpdateExprResCacheConfig() {
 		C.int64_t(params.QueryNodeCfg.ExprResCacheMinEvalDurationUs.GetAsInt64()))
 }
 
+func UpdateSearchResultCacheConfig() {
+	params := paramtable.Get()
+	C.SetSearchResultCacheConfig(C.bool(params.QueryNodeCfg.SearchResultCacheEnabled.GetAsBool()),
+		C.int64_t(params.QueryNodeCfg.SearchResultCacheMaxBytes.GetAsInt64()),
+		C.int32_t(params.QueryNodeCfg.SearchResultCacheAdmissionThreshold.GetAsInt32()))
+}
+
+func UpdateVectorSearchBatchConfig() {
+	params := paramtable.Get()
+	C.SetVectorSearchBatchConfig(C.bool(params.QueryNodeCfg.VectorSearchBatchEnabled.GetAsBool()),
+		C.int64_t(params.QueryNodeCfg.VectorSearchBatchWindowUs.GetAsInt64()),
+		C.int64_t(params.QueryNodeCfg.VectorSearchBatchMaxBatchNq.GetAsInt64()))
+}
+
+func UpdateJSONPathCacheConfig() {
+	params := paramtable.Get()
+	C.SetJsonPathCacheConfig(C.bool(params.QueryNodeCfg.JSONPathCacheEnabled.GetAsBool()),
+		C.int64_t(params.QueryNodeCfg.JSONPathCacheMaxBytes.GetAsInt64()))
+}
+
 func UpdateArrowIOThreadPoolCapacity(threads int) {
 	C.SetArrowIOThreadPoolCapacity(C.int(threads))
 }
@@ -3,6 +3,8 @@ package segcore
 /*
 #cgo pkg-config: milvus_core
 
+#include <stdlib.h>
+
 #include "segcore/plan_c.h"
 #include "segcore/segment_c.h"
 #include "segcore/search_result_export_c.h"
@@ -10,6 +12,8 @@ package segcore
 import "C"
 
 import (
+	"unsafe"
+
 	"github.com/milvus-io/milvus/pkg/v3/proto/segcorepb"
 )
 
@@ -56,6 +60,17 @@ func (r *SearchResult) ValidCount() int64 {
 	return int64(C.GetSearchResultValidCount(r.cSearchResult))
 }
 
+// Profile returns the JSON encoded per operator runtime stats of the search,
+// or "" if the plan did not collect them.
+func (r *SearchResult) Profile() string {
+	cProfile := C.GetSearchResultProfile(r.cSearchResult)
+	if cProfile == nil {
+		return ""
+	}
+	defer C.free(unsafe.Pointer(cProfile))
+	return C.GoString(cProfile)
+}
+
 type RetrieveResult struct {
 	cRetrieveResult *C.CRetrieveResult
 }
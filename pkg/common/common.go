@@ -242,6 +242,8 @@ const (
 // expr query params
 const (
 	ExprUseJSONStatsKey = "expr_use_json_stats"
+	// ask segcore to return per operator runtime stats with the results
+	CollectQueryProfileKey = "collect_query_profile"
 )
 
 // Doc-in-doc-out
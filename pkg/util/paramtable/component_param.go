@@ -307,6 +307,7 @@ type commonConfig struct {
 	Stv2SplitAvgSizeThreshold            ParamItem `refreshable:"true"`
 	UseLoonFFI                           ParamItem `refreshable:"true"`
 	EnableGrowingSourceFlush             ParamItem `refreshable:"false"`
+	GrowingFlushSealedSidecars           ParamItem `refreshable:"true"`
 
 	StoragePathPrefix        ParamItem `refreshable:"false"`
 	StorageZstdConcurrency   ParamItem `refreshable:"false"`
@@ -1105,6 +1106,15 @@ Large numeric passwords require double quotes to avoid yaml parsing precision is
 	}
 	p.EnableGrowingSourceFlush.Init(base.mgr)
 
+	p.GrowingFlushSealedSidecars = ParamItem{
+		Key:          "common.storage.growingFlushSealedSidecars",
+		Version:      "3.0.0",
+		DefaultValue: "false",
+		Doc:          "write scalar zone maps and primary key order while flushing from the growing source, so sealed segments skip rebuilding them",
+		Export:       true,
+	}
+	p.GrowingFlushSealedSidecars.Init(base.mgr)
+
 	p.Stv2SplitSystemColumn = ParamItem{
 		Key:          "common.storage.stv2.splitSystemColumn.enabled",
 		Version:      "2.6.2",
@@ -3573,8 +3583,14 @@ type queryNodeConfig struct {
 	DenseVectorInterminIndexType  ParamItem `refreshable:"false"`
 	InterimIndexMemExpandRate     ParamItem `refreshable:"false"`
 	InterimIndexBuildParallelRate ParamItem `refreshable:"false"`
+	InterimIndexAsyncBuild        ParamItem `refreshable:"false"`
 	MultipleChunkedEnable         ParamItem `refreshable:"false"` // Deprecated
 	EnableGeometryCache           ParamItem `refreshable:"false"`
+	TextLobCompression            ParamItem `refreshable:"false"`
+	TextMatchDeltaCommitInterval  ParamItem `refreshable:"false"`
+	TextMatchDeltaMaxSize         ParamItem `refreshable:"false"`
+	SearchIteratorSessionTTL      ParamItem `refreshable:"false"`
+	SearchIteratorSessionMemSize  ParamItem `refreshable:"false"`
 
 	TieredWarmupScalarField         ParamItem `refreshable:"true"`
 	TieredWarmupScalarIndex         ParamItem `refreshable:"true"`
@@ -3587,6 +3603,9 @@ type queryNodeConfig struct {
 	TieredEvictionEnabled           ParamItem `refreshable:"false"`
 	TieredEvictableMemoryCacheRatio ParamItem `refreshable:"false"`
 	TieredEvictableDiskCacheRatio   ParamItem `refreshable:"false"`
+	TieredCompressedMemoryRatio     ParamItem `refreshable:"false"`
+	TieredPredictiveWarmup          ParamItem `refreshable:"false"`
+	TieredWarmSetSnapshotInterval   ParamItem `refreshable:"false"`
 	TieredCacheTouchWindowMs        ParamItem `refreshable:"false"`
 	TieredBackgroundEvictionEnabled ParamItem `refreshable:"false"`
 	TieredEvictionIntervalMs        ParamItem `refreshable:"false"`
@@ -3713,6 +3732,20 @@ type queryNodeConfig struct {
 	ExprResCacheDiskMaxBytes          ParamItem `refreshable:"true"`
 	ExprResCacheDiskMaxFileSizeBytes  ParamItem `refreshable:"true"`
 
+	// search result cache
+	SearchResultCacheEnabled            ParamItem `refreshable:"true"`
+	SearchResultCacheMaxBytes           ParamItem `refreshable:"true"`
+	SearchResultCacheAdmissionThreshold ParamItem `refreshable:"true"`
+
+	// cross-request vector search batching
+	VectorSearchBatchEnabled    ParamItem `refreshable:"true"`
+	VectorSearchBatchWindowUs   ParamItem `refreshable:"true"`
+	VectorSearchBatchMaxBatchNq ParamItem `refreshable:"true"`
+
+	// json path cache
+	JSONPathCacheEnabled  ParamItem `refreshable:"true"`
+	JSONPathCacheMaxBytes ParamItem `refreshable:"true"`
+
 	// pipeline
 	CleanExcludeSegInterval ParamItem `refreshable:"false"`
 	FlowGraphMaxQueueLength ParamItem `refreshable:"false"`
@@ -3934,6 +3967,48 @@ It defaults to 0.3 (meaning about 30% of evictable on-disk data can be cached),
 	}
 	p.TieredEvictableDiskCacheRatio.Init(base.mgr)
 
+	p.TieredCompressedMemoryRatio = ParamItem{
+		Key:          "queryNode.segcore.tieredStorage.compressedMemoryRatio",
+		Version:      "3.0.0",
+		DefaultValue: "0",
+		Formatter: func(v string) string {
+			ratio := getAsFloat(v)
+			if ratio < 0 || ratio > 1 {
+				return "0"
+			}
+			return fmt.Sprintf("%f", ratio)
+		},
+		Doc: `Ratio of physical memory that keeps evicted scalar cells LZ4-compressed in memory.
+A cell that has to be loaded again after an eviction keeps a compressed copy (if it compresses at least 2x),
+so that its next load decompresses it instead of reading it from disk or remote storage again.
+This memory comes on top of the tiered storage memory watermarks. Only cells loaded without mmap are kept.
+Defaults to 0, which disables the compressed tier.`,
+		Export: true,
+	}
+	p.TieredCompressedMemoryRatio.Init(base.mgr)
+
+	p.TieredPredictiveWarmup = ParamItem{
+		Key:          "queryNode.segcore.tieredStorage.predictiveWarmup",
+		Version:      "3.0.0",
+		DefaultValue: "false",
+		Doc: `Learn which cells of their output fields the queries of a sealed segment pin, per set of accessed fields,
+and prefetch the cells recurring across recent queries asynchronously when the next such query starts,
+so that it doesn't load them inline after they were evicted.`,
+		Export: true,
+	}
+	p.TieredPredictiveWarmup.Init(base.mgr)
+
+	p.TieredWarmSetSnapshotInterval = ParamItem{
+		Key:          "queryNode.segcore.tieredStorage.warmSetSnapshotInterval",
+		Version:      "3.0.0",
+		DefaultValue: "0",
+		Doc: `Interval in seconds to persist which cells of sealed segment fields were accessed, and how often, to the local storage path.
+After a restart, the cells of the previous snapshot are warmed up on the high priority pool, hottest first, as their fields load.
+Defaults to 0, which disables the snapshot.`,
+		Export: true,
+	}
+	p.TieredWarmSetSnapshotInterval.Init(base.mgr)
+
 	p.TieredMemoryLowWatermarkRatio = ParamItem{
 		Key:          "queryNode.segcore.tieredStorage.memoryLowWatermarkRatio",
 		Version:      "2.6.0",
@@ -4262,6 +4337,15 @@ This defaults to true, indicating that Milvus creates temporary index for growin
 	}
 	p.InterimIndexBuildParallelRate.Init(base.mgr)
 
+	p.InterimIndexAsyncBuild = ParamItem{
+		Key:          "queryNode.segcore.interimIndex.asyncBuild",
+		Version:      "3.0.0",
+		DefaultValue: "false",
+		Doc:          "whether to build the interim index of non-nullable vector fields of growing segments in the background instead of on the insert path, rows not indexed yet are searched by brute force",
+		Export:       true,
+	}
+	p.InterimIndexAsyncBuild.Init(base.mgr)
+
 	p.MultipleChunkedEnable = ParamItem{
 		Key:          "queryNode.segcore.multipleChunkedEnable",
 		Version:      "2.0.0",
@@ -4280,6 +4364,52 @@ This defaults to true, indicating that Milvus creates temporary index for growin
 	}
 	p.EnableGeometryCache.Init(base.mgr)
 
+	p.TextLobCompression = ParamItem{
+		Key:          "queryNode.segcore.textLobCompression",
+		Version:      "3.0.0",
+		DefaultValue: "false",
+		Doc:          "LZ4-compress the TEXT values growing segments spill to local files, values that don't shrink by an eighth are kept raw",
+		Export:       true,
+	}
+	p.TextLobCompression.Init(base.mgr)
+
+	p.TextMatchDeltaCommitInterval = ParamItem{
+		Key:          "queryNode.segcore.textMatchDeltaCommitInterval",
+		Version:      "3.0.0",
+		DefaultValue: "10000",
+		Doc:          "Minimum interval in milliseconds between commits of a growing text match index, rows not committed yet are matched from an in-memory delta",
+		Export:       true,
+	}
+	p.TextMatchDeltaCommitInterval.Init(base.mgr)
+
+	p.TextMatchDeltaMaxSize = ParamItem{
+		Key:          "queryNode.segcore.textMatchDeltaMaxSizeInMB",
+		Version:      "3.0.0",
+		DefaultValue: "64",
+		Doc:          "Size in MB of the in-memory delta of a growing text match index beyond which the index commits before the commit interval elapses",
+		Export:       true,
+	}
+	p.TextMatchDeltaMaxSize.Init(base.mgr)
+
+	p.SearchIteratorSessionTTL = ParamItem{
+		Key:          "queryNode.segcore.searchIteratorSessionTTL",
+		Version:      "3.0.0",
+		DefaultValue: "0",
+		Doc: `Seconds the iterators of a search_iterator v2 token are kept alive after its last page, so that the next page continues
+where it stopped instead of searching every segment again up to the last bound. Defaults to 0, which disables the sessions.`,
+		Export: true,
+	}
+	p.SearchIteratorSessionTTL.Init(base.mgr)
+
+	p.SearchIteratorSessionMemSize = ParamItem{
+		Key:          "queryNode.segcore.searchIteratorSessionMemSizeInMB",
+		Version:      "3.0.0",
+		DefaultValue: "256",
+		Doc:          "Memory budget in MB of the search_iterator v2 sessions, least recently used sessions are evicted beyond it",
+		Export:       true,
+	}
+	p.SearchIteratorSessionMemSize.Init(base.mgr)
+
 	p.InterimIndexNProbe = ParamItem{
 		Key:     "queryNode.segcore.interimIndex.nprobe",
 		Version: "2.0.0",
@@ -5031,6 +5161,81 @@ user-task-polling:
 	}
 	p.ExprResCacheDiskMaxFileSizeBytes.Init(base.mgr)
 
+	// search result cache
+	p.SearchResultCacheEnabled = ParamItem{
+		Key:          "queryNode.searchResultCache.enabled",
+		Version:      "3.0.0",
+		DefaultValue: "false",
+		Doc:          "cache the per-segment top-k of repeated vector searches with identical query vectors, params and filter",
+		Export:       true,
+	}
+	p.SearchResultCacheEnabled.Init(base.mgr)
+
+	p.SearchResultCacheMaxBytes = ParamItem{
+		Key:          "queryNode.searchResultCache.maxBytes",
+		Version:      "3.0.0",
+		DefaultValue: "67108864",
+		Doc:          "max memory for the search result cache (default 64MB)",
+		Export:       true,
+	}
+	p.SearchResultCacheMaxBytes.Init(base.mgr)
+
+	p.SearchResultCacheAdmissionThreshold = ParamItem{
+		Key:          "queryNode.searchResultCache.admissionThreshold",
+		Version:      "3.0.0",
+		DefaultValue: "2",
+		Doc:          "frequency admission: cache a search after N+ occurrences (1=no gating)",
+		Export:       true,
+	}
+	p.SearchResultCacheAdmissionThreshold.Init(base.mgr)
+
+	// cross-request vector search batching
+	p.VectorSearchBatchEnabled = ParamItem{
+		Key:          "queryNode.vectorSearchBatch.enabled",
+		Version:      "3.0.0",
+		DefaultValue: "false",
+		Doc:          "merge concurrent vector searches on the same segment, field, params and filter into one multi-nq search",
+		Export:       true,
+	}
+	p.VectorSearchBatchEnabled.Init(base.mgr)
+
+	p.VectorSearchBatchWindowUs = ParamItem{
+		Key:          "queryNode.vectorSearchBatch.windowUs",
+		Version:      "3.0.0",
+		DefaultValue: "200",
+		Doc:          "how long the first search of a batch waits for others to join, in microseconds",
+		Export:       true,
+	}
+	p.VectorSearchBatchWindowUs.Init(base.mgr)
+
+	p.VectorSearchBatchMaxBatchNq = ParamItem{
+		Key:          "queryNode.vectorSearchBatch.maxBatchNq",
+		Version:      "3.0.0",
+		DefaultValue: "64",
+		Doc:          "a batch is dispatched as soon as it holds this many queries, searches with more queries are not batched",
+		Export:       true,
+	}
+	p.VectorSearchBatchMaxBatchNq.Init(base.mgr)
+
+	// json path cache
+	p.JSONPathCacheEnabled = ParamItem{
+		Key:          "queryNode.jsonPathCache.enabled",
+		Version:      "3.0.0",
+		DefaultValue: "false",
+		Doc:          "cache where each JSON path lives inside the rows of a segment, so repeated filters on the same path skip re-parsing the documents",
+		Export:       true,
+	}
+	p.JSONPathCacheEnabled.Init(base.mgr)
+
+	p.JSONPathCacheMaxBytes = ParamItem{
+		Key:          "queryNode.jsonPathCache.maxBytes",
+		Version:      "3.0.0",
+		DefaultValue: "268435456",
+		Doc:          "max memory for the json path cache (default 256MB)",
+		Export:       true,
+	}
+	p.JSONPathCacheMaxBytes.Init(base.mgr)
+
 	p.CleanExcludeSegInterval = ParamItem{
 		Key:          "queryCoord.cleanExcludeSegmentInterval",
 		Version:      "2.4.0",
@@ -6988,6 +7193,11 @@ type dataNodeConfig struct {
 	// clustering compaction
 	ClusteringCompactionMemoryBufferRatio ParamItem `refreshable:"true"`
 	ClusteringCompactionWorkerPoolSize    ParamItem `refreshable:"true"`
+	MiniBatchKmeansEnabled                ParamItem `refreshable:"false"`
+	MiniBatchKmeansBatchRows              ParamItem `refreshable:"false"`
+	MiniBatchKmeansEpochs                 ParamItem `refreshable:"false"`
+	MiniBatchKmeansMemoryBudget           ParamItem `refreshable:"false"`
+	MiniBatchKmeansFuseAssign             ParamItem `refreshable:"false"`
 
 	BloomFilterApplyParallelFactor ParamItem `refreshable:"true"`
 
@@ -7459,6 +7669,51 @@ if this parameter <= 0, will set it as 10`,
 	}
 	p.ClusteringCompactionWorkerPoolSize.Init(base.mgr)
 
+	p.MiniBatchKmeansEnabled = ParamItem{
+		Key:          "dataNode.clusteringCompaction.miniBatchKmeans.enabled",
+		Version:      "3.0.0",
+		Doc:          "train clustering compaction centroids with mini-batch kmeans streamed from the binlogs instead of one sampled train buffer",
+		DefaultValue: "false",
+		Export:       true,
+	}
+	p.MiniBatchKmeansEnabled.Init(base.mgr)
+
+	p.MiniBatchKmeansBatchRows = ParamItem{
+		Key:          "dataNode.clusteringCompaction.miniBatchKmeans.batchRows",
+		Version:      "3.0.0",
+		Doc:          "number of rows in each mini-batch centroid update",
+		DefaultValue: "8192",
+		Export:       true,
+	}
+	p.MiniBatchKmeansBatchRows.Init(base.mgr)
+
+	p.MiniBatchKmeansEpochs = ParamItem{
+		Key:          "dataNode.clusteringCompaction.miniBatchKmeans.epochs",
+		Version:      "3.0.0",
+		Doc:          "number of passes over the data to train the centroids",
+		DefaultValue: "1",
+		Export:       true,
+	}
+	p.MiniBatchKmeansEpochs.Init(base.mgr)
+
+	p.MiniBatchKmeansMemoryBudget = ParamItem{
+		Key:          "dataNode.clusteringCompaction.miniBatchKmeans.memoryBudget",
+		Version:      "3.0.0",
+		Doc:          "memory of the binlogs fetched ahead of the mini-batch being trained",
+		DefaultValue: "256m",
+		Export:       true,
+	}
+	p.MiniBatchKmeansMemoryBudget.Init(base.mgr)
+
+	p.MiniBatchKmeansFuseAssign = ParamItem{
+		Key:          "dataNode.clusteringCompaction.miniBatchKmeans.fuseAssign",
+		Version:      "3.0.0",
+		Doc:          "assign vectors to centroids during the last training pass instead of an extra pass over the data",
+		DefaultValue: "true",
+		Export:       true,
+	}
+	p.MiniBatchKmeansFuseAssign.Init(base.mgr)
+
 	p.BloomFilterApplyParallelFactor = ParamItem{
 		Key:          "dataNode.bloomFilterApplyParallelFactor",
 		FallbackKeys: []string{"datanode.bloomFilterApplyBatchSize"},